@@ -35,13 +35,18 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "ocs2_ballbot_mpcnet/BallbotMpcnetDefinition.h"
 
 #include <ament_index_cpp/get_package_share_directory.hpp>
+#include <algorithm>
 #include <memory>
 
 namespace ocs2::ballbot {
     BallbotMpcnetInterface::BallbotMpcnetInterface(size_t nDataGenerationThreads, size_t nPolicyEvaluationThreads,
                                                    bool raisim) {
-        // create ONNX environment
+        // create ONNX environment and inference servers, which batch the policy evaluations of the concurrent rollouts
         auto onnxEnvironmentPtr = mpcnet::createOnnxEnvironment();
+        auto dataGenerationServerPtr =
+                std::make_shared<mpcnet::MpcnetOnnxInferenceServer>(onnxEnvironmentPtr, std::max<size_t>(nDataGenerationThreads, 1));
+        auto policyEvaluationServerPtr =
+                std::make_shared<mpcnet::MpcnetOnnxInferenceServer>(onnxEnvironmentPtr, std::max<size_t>(nPolicyEvaluationThreads, 1));
         // path to config file
         const std::string taskFile =
                 ament_index_cpp::get_package_share_directory("ocs2_ballbot") +
@@ -65,7 +70,8 @@ namespace ocs2::ballbot {
             auto mpcnetDefinitionPtr = std::make_shared<BallbotMpcnetDefinition>();
             mpcPtrs.push_back(getMpc(ballbotInterface));
             mpcnetPtrs.push_back(std::make_unique<ocs2::mpcnet::MpcnetOnnxController>(
-                mpcnetDefinitionPtr, ballbotInterface.getReferenceManagerPtr(), onnxEnvironmentPtr));
+                mpcnetDefinitionPtr, ballbotInterface.getReferenceManagerPtr(),
+                i < nDataGenerationThreads ? dataGenerationServerPtr : policyEvaluationServerPtr));
             if (raisim) {
                 throw std::runtime_error(
                     "[BallbotMpcnetInterface::BallbotMpcnetInterface] raisim rollout not yet implemented for ballbot.");
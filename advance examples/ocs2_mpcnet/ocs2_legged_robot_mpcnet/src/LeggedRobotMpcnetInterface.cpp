@@ -37,13 +37,18 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "ocs2_legged_robot_mpcnet/LeggedRobotMpcnetDefinition.h"
 #include <ament_index_cpp/get_package_share_directory.hpp>
+#include <algorithm>
 #include <memory>
 
 namespace ocs2::legged_robot {
     LeggedRobotMpcnetInterface::LeggedRobotMpcnetInterface(size_t nDataGenerationThreads,
                                                            size_t nPolicyEvaluationThreads, bool raisim) {
-        // create ONNX environment
+        // create ONNX environment and inference servers, which batch the policy evaluations of the concurrent rollouts
         auto onnxEnvironmentPtr = mpcnet::createOnnxEnvironment();
+        auto dataGenerationServerPtr =
+                std::make_shared<mpcnet::MpcnetOnnxInferenceServer>(onnxEnvironmentPtr, std::max<size_t>(nDataGenerationThreads, 1));
+        auto policyEvaluationServerPtr =
+                std::make_shared<mpcnet::MpcnetOnnxInferenceServer>(onnxEnvironmentPtr, std::max<size_t>(nPolicyEvaluationThreads, 1));
         // paths to files
         const std::string taskFile = ament_index_cpp::get_package_share_directory("ocs2_legged_robot") +
                                      "/config/mpc/task.info";
@@ -77,7 +82,7 @@ namespace ocs2::legged_robot {
             mpcPtrs.push_back(getMpc(*interfaces_[i]));
             mpcnetPtrs.push_back(std::make_unique<mpcnet::MpcnetOnnxController>(
                 definition, interfaces_[i]->getReferenceManagerPtr(),
-                onnxEnvironmentPtr));
+                i < nDataGenerationThreads ? dataGenerationServerPtr : policyEvaluationServerPtr));
 
             if (raisim) {
                 RaisimRolloutSettings rollout_settings(raisimFile, "rollout");
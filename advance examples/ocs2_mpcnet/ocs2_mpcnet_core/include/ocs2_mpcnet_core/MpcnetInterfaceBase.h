@@ -60,7 +60,32 @@ namespace ocs2::mpcnet {
         /**
          * @see MpcnetRolloutManager::getGeneratedData()
          */
-        data_array_t getGeneratedData();
+        std::shared_ptr<DataBuffer> getGeneratedData();
+
+        /**
+         * @see MpcnetRolloutManager::setDataGenerationEpisodes()
+         */
+        void setDataGenerationEpisodes(scalar_t alpha, const std::string &policyFilePath, scalar_t timeStep,
+                                       size_t dataDecimation, size_t nSamples,
+                                       const matrix_t &samplingCovariance,
+                                       const std::vector<SystemObservation> &initialObservations,
+                                       const std::vector<ModeSchedule> &modeSchedules,
+                                       const std::vector<TargetTrajectories> &targetTrajectories);
+
+        /**
+         * @see MpcnetRolloutManager::startDataGenerationStream()
+         */
+        void startDataGenerationStream(size_t queueCapacity);
+
+        /**
+         * @see MpcnetRolloutManager::tryPopGeneratedData()
+         */
+        std::shared_ptr<DataBuffer> tryPopGeneratedData();
+
+        /**
+         * @see MpcnetRolloutManager::stopDataGenerationStream()
+         */
+        void stopDataGenerationStream();
 
         /**
          * @see MpcnetRolloutManager::startPolicyEvaluation()
@@ -37,6 +37,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ocs2_python_interface/PybindMacros.h>
 
 #include "ocs2_mpcnet_core/rollout/MpcnetData.h"
+#include "ocs2_mpcnet_core/rollout/MpcnetDataBuffer.h"
 #include "ocs2_mpcnet_core/rollout/MpcnetMetrics.h"
 
 namespace py = pybind11;
@@ -53,7 +54,6 @@ namespace py = pybind11;
   PYBIND11_MAKE_OPAQUE(std::vector<ocs2::SystemObservation>)                                                \
   PYBIND11_MAKE_OPAQUE(std::vector<ocs2::ModeSchedule>)                                                     \
   PYBIND11_MAKE_OPAQUE(std::vector<ocs2::TargetTrajectories>)                                               \
-  PYBIND11_MAKE_OPAQUE(ocs2::mpcnet::data_array_t)                                                          \
   PYBIND11_MAKE_OPAQUE(ocs2::mpcnet::metrics_array_t)                                                       \
   /* create a python module */                                                                              \
   PYBIND11_MODULE(LIB_NAME, m) {                                                                            \
@@ -65,7 +65,6 @@ namespace py = pybind11;
     VECTOR_TYPE_BINDING(std::vector<ocs2::SystemObservation>, "SystemObservationArray")                     \
     VECTOR_TYPE_BINDING(std::vector<ocs2::ModeSchedule>, "ModeScheduleArray")                               \
     VECTOR_TYPE_BINDING(std::vector<ocs2::TargetTrajectories>, "TargetTrajectoriesArray")                   \
-    VECTOR_TYPE_BINDING(ocs2::mpcnet::data_array_t, "DataArray")                                            \
     VECTOR_TYPE_BINDING(ocs2::mpcnet::metrics_array_t, "MetricsArray")                                      \
     /* bind approximation classes */                                                                        \
     py::class_<ocs2::ScalarFunctionQuadraticApproximation>(m, "ScalarFunctionQuadraticApproximation") \
@@ -103,6 +102,28 @@ namespace py = pybind11;
         .def_readwrite("observation", &ocs2::mpcnet::data_point_t::observation)                             \
         .def_readwrite("actionTransformation", &ocs2::mpcnet::data_point_t::actionTransformation)           \
         .def_readwrite("hamiltonian", &ocs2::mpcnet::data_point_t::hamiltonian);                            \
+    /* bind data buffer class, the fields are NumPy views which keep the buffer alive */                    \
+    py::class_<ocs2::mpcnet::DataBuffer, std::shared_ptr<ocs2::mpcnet::DataBuffer> >(m, "DataBuffer")       \
+        .def("__len__", &ocs2::mpcnet::DataBuffer::size)                                                    \
+        .def("getStateDim", &ocs2::mpcnet::DataBuffer::getStateDim)                                         \
+        .def("getInputDim", &ocs2::mpcnet::DataBuffer::getInputDim)                                         \
+        .def("getObservationDim", &ocs2::mpcnet::DataBuffer::getObservationDim)                             \
+        .def("getActionDim", &ocs2::mpcnet::DataBuffer::getActionDim)                                       \
+        .def_property_readonly("mode", py::overload_cast<>(&ocs2::mpcnet::DataBuffer::mode))                \
+        .def_property_readonly("t", py::overload_cast<>(&ocs2::mpcnet::DataBuffer::t))                      \
+        .def_property_readonly("x", py::overload_cast<>(&ocs2::mpcnet::DataBuffer::x))                      \
+        .def_property_readonly("u", py::overload_cast<>(&ocs2::mpcnet::DataBuffer::u))                      \
+        .def_property_readonly("observation", py::overload_cast<>(&ocs2::mpcnet::DataBuffer::observation))  \
+        .def_property_readonly("actionTransformationMatrix",                                                \
+                               py::overload_cast<>(&ocs2::mpcnet::DataBuffer::actionTransformationMatrix))  \
+        .def_property_readonly("actionTransformationVector",                                                \
+                               py::overload_cast<>(&ocs2::mpcnet::DataBuffer::actionTransformationVector))  \
+        .def_property_readonly("dHdxx", py::overload_cast<>(&ocs2::mpcnet::DataBuffer::dHdxx))              \
+        .def_property_readonly("dHdux", py::overload_cast<>(&ocs2::mpcnet::DataBuffer::dHdux))              \
+        .def_property_readonly("dHduu", py::overload_cast<>(&ocs2::mpcnet::DataBuffer::dHduu))              \
+        .def_property_readonly("dHdx", py::overload_cast<>(&ocs2::mpcnet::DataBuffer::dHdx))                \
+        .def_property_readonly("dHdu", py::overload_cast<>(&ocs2::mpcnet::DataBuffer::dHdu))                \
+        .def_property_readonly("H", py::overload_cast<>(&ocs2::mpcnet::DataBuffer::H));                     \
     /* bind metrics struct */                                                                               \
     py::class_<ocs2::mpcnet::metrics_t>(m, "Metrics")                                                 \
         .def(pybind11::init<>())                                                                            \
@@ -126,6 +147,13 @@ namespace py = pybind11;
              "targetTrajectories"_a)                                                                                           \
         .def("isDataGenerationDone", &MPCNET_INTERFACE::isDataGenerationDone)                                                  \
         .def("getGeneratedData", &MPCNET_INTERFACE::getGeneratedData)                                                          \
+        .def("setDataGenerationEpisodes", &MPCNET_INTERFACE::setDataGenerationEpisodes, "alpha"_a, "policyFilePath"_a,         \
+             "timeStep"_a, "dataDecimation"_a, "nSamples"_a, "samplingCovariance"_a.noconvert(), "initialObservations"_a,      \
+             "modeSchedules"_a, "targetTrajectories"_a)                                                                        \
+        .def("startDataGenerationStream", &MPCNET_INTERFACE::startDataGenerationStream, "queueCapacity"_a)                     \
+        .def("tryPopGeneratedData", &MPCNET_INTERFACE::tryPopGeneratedData)                                                    \
+        .def("stopDataGenerationStream", &MPCNET_INTERFACE::stopDataGenerationStream,                                          \
+             py::call_guard<py::gil_scoped_release>())                                                                         \
         .def("startPolicyEvaluation", &MPCNET_INTERFACE::startPolicyEvaluation, "alpha"_a, "policyFilePath"_a, "timeStep"_a,   \
              "initialObservations"_a, "modeSchedules"_a, "targetTrajectories"_a)                                               \
         .def("isPolicyEvaluationDone", &MPCNET_INTERFACE::isPolicyEvaluationDone)                                              \
@@ -34,6 +34,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "ocs2_mpcnet_core/MpcnetDefinitionBase.h"
 #include "ocs2_mpcnet_core/control/MpcnetControllerBase.h"
+#include "ocs2_mpcnet_core/control/MpcnetOnnxInferenceServer.h"
+#include "ocs2_mpcnet_core/control/MpcnetOnnxPolicy.h"
 
 namespace ocs2::mpcnet {
     /**
@@ -52,6 +54,8 @@ namespace ocs2::mpcnet {
      * x: relative state (1 x dimensionOfState),
      * u: predicted input (1 x dimensionOfInput),
      * @note The additional first dimension with size 1 for the variables of the model comes from batch processing during training.
+     * @note Without an inference server, the controller owns a session with preallocated tensors and computing the input does not allocate
+     * memory for the inference. With an inference server, the observations of all controllers sharing the server are evaluated in batches.
      */
     class MpcnetOnnxController final : public MpcnetControllerBase {
     public:
@@ -70,6 +74,21 @@ namespace ocs2::mpcnet {
               onnxEnvironmentPtr_(std::move(onnxEnvironmentPtr)) {
         }
 
+        /**
+       * Constructor for a controller that evaluates the policy with a shared inference server.
+       * @note The class is not fully instantiated until calling loadPolicyModel().
+       * @param [in] mpcnetDefinitionPtr : Pointer to the MPC-Net definitions.
+       * @param [in] referenceManagerPtr : Pointer to the reference manager.
+       * @param [in] inferenceServerPtr : Pointer to the inference server, shared with other controllers.
+       */
+        MpcnetOnnxController(std::shared_ptr<MpcnetDefinitionBase> mpcnetDefinitionPtr,
+                             std::shared_ptr<ReferenceManagerInterface> referenceManagerPtr,
+                             std::shared_ptr<MpcnetOnnxInferenceServer> inferenceServerPtr)
+            : mpcnetDefinitionPtr_(std::move(mpcnetDefinitionPtr)),
+              referenceManagerPtr_(std::move(referenceManagerPtr)),
+              inferenceServerPtr_(std::move(inferenceServerPtr)) {
+        }
+
         ~MpcnetOnnxController() override = default;
 
         MpcnetOnnxController *clone() const override { return new MpcnetOnnxController(*this); }
@@ -89,10 +108,14 @@ namespace ocs2::mpcnet {
         }
 
     private:
-        using tensor_element_t = float;
+        using tensor_element_t = MpcnetOnnxPolicy::tensor_element_t;
+        using tensor_vector_t = MpcnetOnnxInferenceServer::tensor_vector_t;
 
         MpcnetOnnxController(const MpcnetOnnxController &other)
-            : MpcnetOnnxController(other.mpcnetDefinitionPtr_, other.referenceManagerPtr_, other.onnxEnvironmentPtr_) {
+            : mpcnetDefinitionPtr_(other.mpcnetDefinitionPtr_),
+              referenceManagerPtr_(other.referenceManagerPtr_),
+              onnxEnvironmentPtr_(other.onnxEnvironmentPtr_),
+              inferenceServerPtr_(other.inferenceServerPtr_) {
             if (!other.policyFilePath_.empty()) {
                 loadPolicyModel(other.policyFilePath_);
             }
@@ -101,13 +124,11 @@ namespace ocs2::mpcnet {
         std::shared_ptr<MpcnetDefinitionBase> mpcnetDefinitionPtr_;
         std::shared_ptr<ReferenceManagerInterface> referenceManagerPtr_;
         std::shared_ptr<Ort::Env> onnxEnvironmentPtr_;
+        std::shared_ptr<MpcnetOnnxInferenceServer> inferenceServerPtr_;
         std::string policyFilePath_;
-        std::unique_ptr<Ort::Session> sessionPtr_;
-        std::vector<const char *> inputNames_;
-        std::vector<const char *> outputNames_;
-        std::vector<Ort::AllocatedStringPtr> inputNameAllocatedStrings;
-        std::vector<Ort::AllocatedStringPtr> outputNameAllocatedStrings;
-        std::vector<std::vector<int64_t> > inputShapes_;
-        std::vector<std::vector<int64_t> > outputShapes_;
+        std::unique_ptr<MpcnetOnnxPolicy> policyPtr_;
+        // buffers for the inference server
+        tensor_vector_t observation_;
+        tensor_vector_t action_;
     };
 }
@@ -0,0 +1,109 @@
+/******************************************************************************
+Copyright (c) 2022, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+ * Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+ * Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#pragma once
+
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+#include "ocs2_mpcnet_core/control/MpcnetOnnxPolicy.h"
+
+namespace ocs2::mpcnet {
+    /**
+     * An inference server that shares one policy between the controllers of concurrent rollouts.
+     * The observations of all requests that arrive while the policy is being evaluated are collected and evaluated together in the next
+     * batch, i.e. the batch size adapts to the load and a single request is not delayed to wait for others.
+     * @note All users of a server share the same policy, e.g. use one server for the data generation and one for the policy evaluation.
+     */
+    class MpcnetOnnxInferenceServer {
+    public:
+        using tensor_element_t = MpcnetOnnxPolicy::tensor_element_t;
+        using tensor_vector_t = Eigen::Matrix<tensor_element_t, Eigen::Dynamic, 1>;
+
+        /**
+         * Constructor.
+         * @param [in] onnxEnvironmentPtr : Pointer to the environment for ONNX Runtime.
+         * @param [in] maxBatchSize : The maximum number of observations evaluated in one session run, e.g. the number of rollout threads.
+         */
+        MpcnetOnnxInferenceServer(std::shared_ptr<Ort::Env> onnxEnvironmentPtr, size_t maxBatchSize);
+
+        /** Destructor, stops the worker thread. There must not be any pending evaluate() calls. */
+        ~MpcnetOnnxInferenceServer();
+
+        MpcnetOnnxInferenceServer(const MpcnetOnnxInferenceServer &) = delete;
+        MpcnetOnnxInferenceServer &operator=(const MpcnetOnnxInferenceServer &) = delete;
+
+        /**
+         * Load the model of the policy. Does nothing if the same file is already loaded.
+         * @param [in] policyFilePath : Path to the file with the model of the policy.
+         */
+        void loadPolicyModel(const std::string &policyFilePath);
+
+        /**
+         * Evaluates the policy for one observation. Blocks until the batch containing this observation has been evaluated.
+         * @note Thread-safe.
+         * @param [in] observation : The observation.
+         * @param [out] action : The predicted action, resized if needed.
+         */
+        void evaluate(const tensor_vector_t &observation, tensor_vector_t &action);
+
+    private:
+        struct Request {
+            const tensor_vector_t *observationPtr;
+            tensor_vector_t *actionPtr;
+            bool done;
+            std::exception_ptr exceptionPtr;
+        };
+
+        /** Worker loop collecting and evaluating batches. */
+        void run();
+
+        /** Evaluates the batch of requests with the current policy. */
+        void evaluateBatch(const std::vector<Request *> &batch);
+
+        std::shared_ptr<Ort::Env> onnxEnvironmentPtr_;
+        size_t maxBatchSize_;
+
+        // guards the policy, held by the worker while evaluating a batch
+        std::mutex policyMutex_;
+        std::unique_ptr<MpcnetOnnxPolicy> policyPtr_;
+
+        // guards the requests
+        std::mutex requestMutex_;
+        std::condition_variable newRequestCondition_;
+        std::condition_variable requestDoneCondition_;
+        std::vector<Request *> pendingRequests_;
+        std::vector<Request *> batch_;
+        bool stop_ = false;
+
+        std::thread workerThread_;
+    };
+}
@@ -0,0 +1,96 @@
+/******************************************************************************
+Copyright (c) 2022, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+ * Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+ * Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <onnxruntime/onnxruntime_cxx_api.h>
+
+#include <ocs2_core/Types.h>
+
+namespace ocs2::mpcnet {
+    /**
+     * A policy model loaded into an ONNX Runtime session, with preallocated input and output tensors bound to the session for every batch
+     * size up to the maximum batch size. Evaluating the policy does not allocate any memory on the side of this class.
+     * The observations and actions are stored column-wise, i.e. column i of observations() is the observation of sample i of the batch.
+     * @note This class is not thread-safe, see MpcnetOnnxInferenceServer for sharing a policy between threads.
+     */
+    class MpcnetOnnxPolicy {
+    public:
+        using tensor_element_t = float;
+        using tensor_matrix_t = Eigen::Matrix<tensor_element_t, Eigen::Dynamic, Eigen::Dynamic>;
+
+        /**
+         * Constructor.
+         * @param [in] onnxEnvironmentPtr : Pointer to the environment for ONNX Runtime.
+         * @param [in] policyFilePath : Path to the file with the model of the policy.
+         * @param [in] maxBatchSize : The maximum batch size. Limited to one if the model has a fixed batch dimension.
+         */
+        MpcnetOnnxPolicy(std::shared_ptr<Ort::Env> onnxEnvironmentPtr, std::string policyFilePath, size_t maxBatchSize);
+
+        const std::string &getPolicyFilePath() const { return policyFilePath_; }
+
+        size_t getMaxBatchSize() const { return maxBatchSize_; }
+
+        size_t getObservationDimension() const { return observations_.rows(); }
+
+        size_t getActionDimension() const { return actions_.rows(); }
+
+        /** The observations of the batch (observation dimension x max batch size), to be filled before calling run(). */
+        tensor_matrix_t &observations() { return observations_; }
+
+        /** The actions of the batch (action dimension x max batch size), valid after calling run(). */
+        const tensor_matrix_t &actions() const { return actions_; }
+
+        /**
+         * Evaluates the policy for the first batchSize columns of observations().
+         * @param [in] batchSize : The number of samples, in [1, getMaxBatchSize()].
+         */
+        void run(size_t batchSize);
+
+    private:
+        std::shared_ptr<Ort::Env> onnxEnvironmentPtr_;
+        std::string policyFilePath_;
+        size_t maxBatchSize_;
+        std::unique_ptr<Ort::Session> sessionPtr_;
+        std::vector<Ort::AllocatedStringPtr> inputNameAllocatedStrings_;
+        std::vector<Ort::AllocatedStringPtr> outputNameAllocatedStrings_;
+        tensor_matrix_t observations_;
+        tensor_matrix_t actions_;
+        Ort::MemoryInfo memoryInfo_;
+        Ort::RunOptions runOptions_;
+        // tensors and bindings for batch size i + 1
+        std::vector<Ort::Value> inputTensors_;
+        std::vector<Ort::Value> outputTensors_;
+        std::vector<Ort::IoBinding> ioBindings_;
+    };
+}
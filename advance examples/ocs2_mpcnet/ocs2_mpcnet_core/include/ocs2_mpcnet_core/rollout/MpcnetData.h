@@ -56,7 +56,6 @@ namespace ocs2::mpcnet {
     };
 
     using data_point_t = DataPoint;
-    using data_array_t = std::vector<data_point_t>;
 
     /**
     * Get a data point.
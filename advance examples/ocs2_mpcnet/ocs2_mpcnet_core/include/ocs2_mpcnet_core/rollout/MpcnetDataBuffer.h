@@ -0,0 +1,138 @@
+/******************************************************************************
+Copyright (c) 2022, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+ * Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+ * Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#pragma once
+
+#include <ocs2_core/Types.h>
+
+#include "ocs2_mpcnet_core/rollout/MpcnetData.h"
+
+namespace ocs2::mpcnet {
+    /**
+    * Contiguous structure-of-arrays storage of data points.
+    * Row i of every field belongs to data point i. Matrices of a data point are stored row-major in a single row, e.g. the rows of
+    * dHdxx have stateDim * stateDim entries. The fields are row-major, such that they can be exposed to Python as NumPy arrays
+    * without a copy. Clearing the buffer keeps its memory, therefore a reused buffer does not allocate once it has grown.
+    */
+    class DataBuffer {
+    public:
+        using row_matrix_t = Eigen::Matrix<scalar_t, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+        using size_vector_t = Eigen::Matrix<size_t, Eigen::Dynamic, 1>;
+
+        /** Number of data points in the buffer. */
+        size_t size() const { return size_; }
+
+        /** Number of data points the buffer can hold before it has to grow. */
+        size_t capacity() const { return static_cast<size_t>(t_.size()); }
+
+        /** Grows the storage such that it can hold at least capacity data points. */
+        void reserve(size_t capacity);
+
+        /** Removes all data points, but keeps the memory. */
+        void clear() { size_ = 0; }
+
+        /** Removes the data points after the first size ones. */
+        void truncate(size_t size);
+
+        /** Appends a data point. */
+        void push_back(const DataPoint &dataPoint);
+
+        /** Appends all data points of another buffer. */
+        void append(const DataBuffer &other);
+
+        size_t getStateDim() const { return stateDim_; }
+        size_t getInputDim() const { return inputDim_; }
+        size_t getObservationDim() const { return observationDim_; }
+        size_t getActionDim() const { return actionDim_; }
+
+        /** Mode of the system (size x 1). */
+        Eigen::Ref<size_vector_t> mode() { return mode_.head(size_); }
+        Eigen::Ref<const size_vector_t> mode() const { return mode_.head(size_); }
+        /** Absolute time (size x 1). */
+        Eigen::Ref<vector_t> t() { return t_.head(size_); }
+        Eigen::Ref<const vector_t> t() const { return t_.head(size_); }
+        /** Observed state (size x stateDim). */
+        Eigen::Ref<row_matrix_t> x() { return x_.topRows(size_); }
+        Eigen::Ref<const row_matrix_t> x() const { return x_.topRows(size_); }
+        /** Optimal control input (size x inputDim). */
+        Eigen::Ref<row_matrix_t> u() { return u_.topRows(size_); }
+        Eigen::Ref<const row_matrix_t> u() const { return u_.topRows(size_); }
+        /** Observation given as input to the policy (size x observationDim). */
+        Eigen::Ref<row_matrix_t> observation() { return observation_.topRows(size_); }
+        Eigen::Ref<const row_matrix_t> observation() const { return observation_.topRows(size_); }
+        /** Matrix of the action transformation (size x (inputDim * actionDim)). */
+        Eigen::Ref<row_matrix_t> actionTransformationMatrix() { return actionTransformationMatrix_.topRows(size_); }
+        Eigen::Ref<const row_matrix_t> actionTransformationMatrix() const { return actionTransformationMatrix_.topRows(size_); }
+        /** Vector of the action transformation (size x inputDim). */
+        Eigen::Ref<row_matrix_t> actionTransformationVector() { return actionTransformationVector_.topRows(size_); }
+        Eigen::Ref<const row_matrix_t> actionTransformationVector() const { return actionTransformationVector_.topRows(size_); }
+        /** State-state Hessian of the Hamiltonian (size x (stateDim * stateDim)). */
+        Eigen::Ref<row_matrix_t> dHdxx() { return dHdxx_.topRows(size_); }
+        Eigen::Ref<const row_matrix_t> dHdxx() const { return dHdxx_.topRows(size_); }
+        /** Input-state Hessian of the Hamiltonian (size x (inputDim * stateDim)). */
+        Eigen::Ref<row_matrix_t> dHdux() { return dHdux_.topRows(size_); }
+        Eigen::Ref<const row_matrix_t> dHdux() const { return dHdux_.topRows(size_); }
+        /** Input-input Hessian of the Hamiltonian (size x (inputDim * inputDim)). */
+        Eigen::Ref<row_matrix_t> dHduu() { return dHduu_.topRows(size_); }
+        Eigen::Ref<const row_matrix_t> dHduu() const { return dHduu_.topRows(size_); }
+        /** State gradient of the Hamiltonian (size x stateDim). */
+        Eigen::Ref<row_matrix_t> dHdx() { return dHdx_.topRows(size_); }
+        Eigen::Ref<const row_matrix_t> dHdx() const { return dHdx_.topRows(size_); }
+        /** Input gradient of the Hamiltonian (size x inputDim). */
+        Eigen::Ref<row_matrix_t> dHdu() { return dHdu_.topRows(size_); }
+        Eigen::Ref<const row_matrix_t> dHdu() const { return dHdu_.topRows(size_); }
+        /** Hamiltonian at the development/expansion point (size x 1). */
+        Eigen::Ref<vector_t> H() { return H_.head(size_); }
+        Eigen::Ref<const vector_t> H() const { return H_.head(size_); }
+
+    private:
+        /** Sets the dimensions of an empty buffer, the storage keeps its capacity. */
+        void setDimensions(size_t stateDim, size_t inputDim, size_t observationDim, size_t actionDim);
+
+        size_t size_ = 0;
+        size_t stateDim_ = 0;
+        size_t inputDim_ = 0;
+        size_t observationDim_ = 0;
+        size_t actionDim_ = 0;
+
+        size_vector_t mode_;
+        vector_t t_;
+        row_matrix_t x_;
+        row_matrix_t u_;
+        row_matrix_t observation_;
+        row_matrix_t actionTransformationMatrix_;
+        row_matrix_t actionTransformationVector_;
+        row_matrix_t dHdxx_;
+        row_matrix_t dHdux_;
+        row_matrix_t dHduu_;
+        row_matrix_t dHdx_;
+        row_matrix_t dHdu_;
+        vector_t H_;
+    };
+}
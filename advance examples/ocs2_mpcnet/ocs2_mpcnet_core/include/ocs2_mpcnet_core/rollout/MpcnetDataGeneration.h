@@ -30,6 +30,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #pragma once
 
 #include "ocs2_mpcnet_core/rollout/MpcnetData.h"
+#include "ocs2_mpcnet_core/rollout/MpcnetDataBuffer.h"
 #include "ocs2_mpcnet_core/rollout/MpcnetRolloutBase.h"
 
 namespace ocs2::mpcnet {
@@ -72,7 +73,7 @@ namespace ocs2::mpcnet {
         MpcnetDataGeneration &operator=(const MpcnetDataGeneration &) = delete;
 
         /**
-         * Run the data generation.
+         * Run the data generation and append the generated data to the data buffer of this data generation.
          * @param [in] alpha : The mixture parameter for the behavioral controller.
          * @param [in] policyFilePath : The path to the file with the learned policy for the behavioral controller.
          * @param [in] timeStep : The time step for the forward simulation of the system with the behavioral controller.
@@ -82,15 +83,32 @@ namespace ocs2::mpcnet {
          * @param [in] initialObservation : The initial system observation to start from (time and state required).
          * @param [in] modeSchedule : The mode schedule providing the event times and mode sequence.
          * @param [in] targetTrajectories : The target trajectories to be tracked.
-         * @return Pointer to the data array with the generated data.
+         * @return The number of generated data points.
          */
-        const data_array_t *run(scalar_t alpha, const std::string &policyFilePath, scalar_t timeStep,
+        size_t run(scalar_t alpha, const std::string &policyFilePath, scalar_t timeStep,
                                 size_t dataDecimation, size_t nSamples,
                                 const matrix_t &samplingCovariance, const SystemObservation &initialObservation,
                                 const ModeSchedule &modeSchedule,
                                 const TargetTrajectories &targetTrajectories);
 
+        /**
+         * Get the data generated since the data buffer was cleared.
+         * @return The data buffer.
+         */
+        const DataBuffer &getDataBuffer() const { return dataBuffer_; }
+
+        /**
+         * Clear the data buffer, its memory is kept for the next runs.
+         */
+        void clearDataBuffer() { dataBuffer_.clear(); }
+
+        /**
+         * Swap the data buffer with another one, e.g. a cleared buffer whose memory is reused by the next runs.
+         * @param [in, out] dataBuffer : The other data buffer.
+         */
+        void swapDataBuffer(DataBuffer &dataBuffer) { std::swap(dataBuffer, dataBuffer_); }
+
     private:
-        data_array_t dataArray_;
+        DataBuffer dataBuffer_;
     };
 }
@@ -29,7 +29,11 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #pragma once
 
+#include <mutex>
+
+#include <ocs2_core/thread_support/BoundedQueue.h>
 #include <ocs2_core/thread_support/ThreadPool.h>
+#include <ocs2_core/thread_support/VersionedSnapshot.h>
 
 #include "ocs2_mpcnet_core/rollout/MpcnetDataGeneration.h"
 #include "ocs2_mpcnet_core/rollout/MpcnetPolicyEvaluation.h"
@@ -60,9 +64,9 @@ namespace ocs2::mpcnet {
                              std::vector<std::shared_ptr<ReferenceManagerInterface> > referenceManagerPtrs);
 
         /**
-         * Default destructor.
+         * Destructor, stops the streaming data generation.
          */
-        virtual ~MpcnetRolloutManager() = default;
+        virtual ~MpcnetRolloutManager();
 
         /**
          * Starts the data genration forward simulated by a behavioral controller.
@@ -91,9 +95,61 @@ namespace ocs2::mpcnet {
 
         /**
          * Get the data generated from the data generation rollout.
+         * @note The data generation threads write into their own buffers, which are gathered here with one block copy per field and
+         * thread. The memory of the returned buffer is reused by the next call only if the caller released it, such that views on it,
+         * e.g. NumPy arrays in Python, stay valid as long as the buffer is held.
          * @return The generated data.
          */
-        const data_array_t &getGeneratedData();
+        std::shared_ptr<DataBuffer> getGeneratedData();
+
+        /**
+         * Sets the episodes of the streaming data generation. Can be called while streaming, the data generation threads pick up the new
+         * episodes, e.g. with a new policy, when they start their next episode.
+         * @param [in] alpha : The mixture parameter for the behavioral controller.
+         * @param [in] policyFilePath : The path to the file with the learned policy for the behavioral controller.
+         * @param [in] timeStep : The time step for the forward simulation of the system with the behavioral controller.
+         * @param [in] dataDecimation : The integer factor used for downsampling the data signal.
+         * @param [in] nSamples : The number of samples drawn from a multivariate normal distribution around the nominal states.
+         * @param [in] samplingCovariance : The covariance matrix used for sampling from a multivariate normal distribution.
+         * @param [in] initialObservations : The initial system observations to start from (time and state required).
+         * @param [in] modeSchedules : The mode schedules providing the event times and mode sequence.
+         * @param [in] targetTrajectories : The target trajectories to be tracked.
+         */
+        void setDataGenerationEpisodes(scalar_t alpha, const std::string &policyFilePath, scalar_t timeStep,
+                                       size_t dataDecimation, size_t nSamples,
+                                       const matrix_t &samplingCovariance,
+                                       const std::vector<SystemObservation> &initialObservations,
+                                       const std::vector<ModeSchedule> &modeSchedules,
+                                       const std::vector<TargetTrajectories> &targetTrajectories);
+
+        /**
+         * Starts the streaming data generation. The data generation threads run the episodes set by setDataGenerationEpisodes in a
+         * round-robin fashion and push the data of every episode as a chunk into a bounded queue, until the stream is stopped. They
+         * block while the queue is full, such that the consumer throttles the data generation.
+         * @param [in] queueCapacity : The maximum number of chunks waiting in the queue.
+         */
+        void startDataGenerationStream(size_t queueCapacity);
+
+        /**
+         * Takes the oldest chunk of the streaming data generation, without blocking.
+         * @note The memory of a chunk is reused by the data generation once the caller released it, such that views on it, e.g.
+         * NumPy arrays in Python, stay valid as long as the chunk is held. The released chunks are collected here, therefore this
+         * method has to be called from a single thread.
+         * @return The chunk, or nullptr if no chunk is available.
+         */
+        std::shared_ptr<DataBuffer> tryPopGeneratedData();
+
+        /**
+         * Stops the streaming data generation. Waits for the data generation threads to finish their current episode. Chunks left in
+         * the queue can still be taken with tryPopGeneratedData.
+         */
+        void stopDataGenerationStream();
+
+        /**
+         * Check if the streaming data generation is running.
+         * @return True if running.
+         */
+        bool isDataGenerationStreaming() const { return !dataGenerationStreamFtrs_.empty(); }
 
         /**
          * Starts the policy evaluation forward simulated by a behavioral controller.
@@ -122,13 +178,49 @@ namespace ocs2::mpcnet {
         metrics_array_t getComputedMetrics();
 
     private:
+        /**
+         * Episodes of the streaming data generation.
+         */
+        struct DataGenerationEpisodes {
+            scalar_t alpha;
+            std::string policyFilePath;
+            scalar_t timeStep;
+            size_t dataDecimation;
+            size_t nSamples;
+            matrix_t samplingCovariance;
+            std::vector<SystemObservation> initialObservations;
+            std::vector<ModeSchedule> modeSchedules;
+            std::vector<TargetTrajectories> targetTrajectories;
+        };
+
+        /**
+         * Runs episodes on a data generation thread until the stream is stopped.
+         * @param [in] threadNumber : The number of the data generation thread.
+         */
+        void runDataGenerationStream(int threadNumber);
+
+        /**
+         * Get a cleared chunk for the streaming data generation, whose memory is reused if a released chunk is available.
+         * @return The chunk.
+         */
+        std::shared_ptr<DataBuffer> getRecycledDataChunk();
+
         // data generation variables
         size_t nDataGenerationThreads_;
         std::atomic_int nDataGenerationTasksDone_;
         std::unique_ptr<ThreadPool> dataGenerationThreadPoolPtr_;
         std::vector<std::unique_ptr<MpcnetDataGeneration> > dataGenerationPtrs_;
-        std::vector<std::future<const data_array_t *> > dataGenerationFtrs_;
-        data_array_t dataArray_;
+        std::vector<std::future<size_t> > dataGenerationFtrs_;
+        std::shared_ptr<DataBuffer> dataBufferPtr_;
+        // streaming data generation variables
+        VersionedSnapshot<DataGenerationEpisodes> dataGenerationEpisodes_;
+        std::atomic_size_t nextDataGenerationEpisode_{0};
+        std::atomic_bool stopDataGenerationStream_{false};
+        std::unique_ptr<BoundedQueue<std::shared_ptr<DataBuffer> > > dataGenerationQueuePtr_;
+        std::vector<std::future<void> > dataGenerationStreamFtrs_;
+        std::vector<std::shared_ptr<DataBuffer> > poppedDataChunks_; // chunks handed out by tryPopGeneratedData
+        std::mutex recycledDataChunksMutex_;
+        std::vector<std::shared_ptr<DataBuffer> > recycledDataChunks_; // released chunks, ready to be reused
         // policy evaluation variables
         size_t nPolicyEvaluationThreads_;
         std::atomic_int nPolicyEvaluationTasksDone_;
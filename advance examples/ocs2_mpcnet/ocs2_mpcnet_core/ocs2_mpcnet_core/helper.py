@@ -308,3 +308,23 @@ def get_one_hot(mode: int, expert_number: int, expert_for_mode: Dict[int, int])
     one_hot = np.zeros(expert_number)
     one_hot[expert_for_mode[mode]] = 1.0
     return one_hot
+
+
+def get_one_hot_batch(modes: np.ndarray, expert_number: int, expert_for_mode: Dict[int, int]) -> np.ndarray:
+    """Get one hot encodings of a batch of modes.
+
+    Get the one hot encodings of B modes, see get_one_hot.
+
+    Args:
+        modes: The modes of the system given by a NumPy array of shape (B) containing integers.
+        expert_number: The number of experts given by an integer.
+        expert_for_mode: A dictionary that assigns modes to experts.
+
+    Returns:
+        p: Discrete probability distributions given by a NumPy array of shape (B,P) containing floats.
+    """
+    unique_modes, inverse = np.unique(modes, return_inverse=True)
+    experts = np.array([expert_for_mode[mode] for mode in unique_modes], dtype=np.intp)[inverse]
+    one_hot = np.zeros((len(modes), expert_number))
+    one_hot[np.arange(len(modes)), experts] = 1.0
+    return one_hot
@@ -34,11 +34,10 @@ Provides a base class for all memory classes.
 
 import torch
 import numpy as np
-from typing import Tuple, List
+from typing import Tuple
 from abc import ABCMeta, abstractmethod
 
 from ocs2_mpcnet_core.config import Config
-from ocs2_mpcnet_core import ScalarFunctionQuadraticApproximation
 
 
 class BaseMemory(metaclass=ABCMeta):
@@ -60,26 +59,38 @@ class BaseMemory(metaclass=ABCMeta):
     @abstractmethod
     def push(
         self,
-        t: float,
+        t: np.ndarray,
         x: np.ndarray,
         u: np.ndarray,
         p: np.ndarray,
         observation: np.ndarray,
-        action_transformation: List[np.ndarray],
-        hamiltonian: ScalarFunctionQuadraticApproximation,
+        action_transformation_matrix: np.ndarray,
+        action_transformation_vector: np.ndarray,
+        dHdxx: np.ndarray,
+        dHdux: np.ndarray,
+        dHduu: np.ndarray,
+        dHdx: np.ndarray,
+        dHdu: np.ndarray,
+        H: np.ndarray,
     ) -> None:
         """Pushes data into the memory.
 
-        Pushes one data sample into the memory.
+        Pushes a batch of N data samples into the memory.
 
         Args:
-            t: A float with the time.
-            x: A NumPy array of shape (X) with the observed state.
-            u: A NumPy array of shape (U) with the optimal input.
-            p: A NumPy array of shape (P) tensor for the observed discrete probability distributions of the modes.
-            observation: A NumPy array of shape (O) with the generalized times.
-            action_transformation: A list containing NumPy arrays of shape (U,A) and (U) with the action transformation.
-            hamiltonian: An OCS2 scalar function quadratic approximation representing the Hamiltonian around x and u.
+            t: A NumPy array of shape (N) with the times.
+            x: A NumPy array of shape (N,X) with the observed states.
+            u: A NumPy array of shape (N,U) with the optimal inputs.
+            p: A NumPy array of shape (N,P) with the observed discrete probability distributions of the modes.
+            observation: A NumPy array of shape (N,O) with the observations.
+            action_transformation_matrix: A NumPy array of shape (N,U,A) with the action transformation matrices.
+            action_transformation_vector: A NumPy array of shape (N,U) with the action transformation vectors.
+            dHdxx: A NumPy array of shape (N,X,X) with the state-state Hessians of the Hamiltonian approximations.
+            dHdux: A NumPy array of shape (N,U,X) with the input-state Hessians of the Hamiltonian approximations.
+            dHduu: A NumPy array of shape (N,U,U) with the input-input Hessians of the Hamiltonian approximations.
+            dHdx: A NumPy array of shape (N,X) with the state gradients of the Hamiltonian approximations.
+            dHdu: A NumPy array of shape (N,U) with the input gradients of the Hamiltonian approximations.
+            H: A NumPy array of shape (N) with the Hamiltonians at the development/expansion points.
         """
         pass
 
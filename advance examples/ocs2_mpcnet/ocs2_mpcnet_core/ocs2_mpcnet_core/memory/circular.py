@@ -34,11 +34,10 @@ Provides a class that implements a circular memory.
 
 import torch
 import numpy as np
-from typing import Tuple, List
+from typing import Tuple
 
 from ocs2_mpcnet_core.config import Config
 from ocs2_mpcnet_core.memory.base import BaseMemory
-from ocs2_mpcnet_core import ScalarFunctionQuadraticApproximation
 
 
 class CircularMemory(BaseMemory):
@@ -108,50 +107,58 @@ class CircularMemory(BaseMemory):
 
     def push(
         self,
-        t: float,
+        t: np.ndarray,
         x: np.ndarray,
         u: np.ndarray,
         p: np.ndarray,
         observation: np.ndarray,
-        action_transformation: List[np.ndarray],
-        hamiltonian: ScalarFunctionQuadraticApproximation,
+        action_transformation_matrix: np.ndarray,
+        action_transformation_vector: np.ndarray,
+        dHdxx: np.ndarray,
+        dHdux: np.ndarray,
+        dHduu: np.ndarray,
+        dHdx: np.ndarray,
+        dHdu: np.ndarray,
+        H: np.ndarray,
     ) -> None:
         """Pushes data into the memory.
 
-        Pushes one data sample into the memory.
+        Pushes a batch of N data samples into the memory.
 
         Args:
-            t: A float with the time.
-            x: A NumPy array of shape (X) with the observed state.
-            u: A NumPy array of shape (U) with the optimal input.
-            p: A NumPy array of shape (P) tensor for the observed discrete probability distributions of the modes.
-            observation: A NumPy array of shape (O) with the generalized times.
-            action_transformation: A list containing NumPy arrays of shape (U,A) and (U) with the action transformation.
-            hamiltonian: An OCS2 scalar function quadratic approximation representing the Hamiltonian around x and u.
+            t: A NumPy array of shape (N) with the times.
+            x: A NumPy array of shape (N,X) with the observed states.
+            u: A NumPy array of shape (N,U) with the optimal inputs.
+            p: A NumPy array of shape (N,P) with the observed discrete probability distributions of the modes.
+            observation: A NumPy array of shape (N,O) with the observations.
+            action_transformation_matrix: A NumPy array of shape (N,U,A) with the action transformation matrices.
+            action_transformation_vector: A NumPy array of shape (N,U) with the action transformation vectors.
+            dHdxx: A NumPy array of shape (N,X,X) with the state-state Hessians of the Hamiltonian approximations.
+            dHdux: A NumPy array of shape (N,U,X) with the input-state Hessians of the Hamiltonian approximations.
+            dHduu: A NumPy array of shape (N,U,U) with the input-input Hessians of the Hamiltonian approximations.
+            dHdx: A NumPy array of shape (N,X) with the state gradients of the Hamiltonian approximations.
+            dHdu: A NumPy array of shape (N,U) with the input gradients of the Hamiltonian approximations.
+            H: A NumPy array of shape (N) with the Hamiltonians at the development/expansion points.
         """
-        # push data into memory
+        data = (t, x, u, p, observation, action_transformation_matrix, action_transformation_vector)
+        data += (dHdxx, dHdux, dHduu, dHdx, dHdu, H)
+        memories = (self.t, self.x, self.u, self.p, self.observation)
+        memories += (self.action_transformation_matrix, self.action_transformation_vector)
+        memories += (self.dHdxx, self.dHdux, self.dHduu, self.dHdx, self.dHdu, self.H)
+        # only the newest samples are kept if the batch exceeds the capacity
+        n = min(len(t), self.capacity)
+        offset = len(t) - n
+        # the batch is written in at most two contiguous slices, the second one wraps around to the start of the memory
+        first = min(n, self.capacity - self.position)
         # note: - torch.as_tensor: no copy as data is a ndarray of the corresponding dtype and the device is the cpu
-        #       - torch.Tensor.copy_: copy performed together with potential dtype and device change
-        self.t[self.position].copy_(torch.as_tensor(t, dtype=None, device=torch.device("cpu")))
-        self.x[self.position].copy_(torch.as_tensor(np.copy(x), dtype=None, device=torch.device("cpu")))
-        self.u[self.position].copy_(torch.as_tensor(np.copy(u), dtype=None, device=torch.device("cpu")))
-        self.p[self.position].copy_(torch.as_tensor(np.copy(p), dtype=None, device=torch.device("cpu")))
-        self.observation[self.position].copy_(torch.as_tensor(np.copy(observation), dtype=None, device=torch.device("cpu")))
-        self.action_transformation_matrix[self.position].copy_(
-            torch.as_tensor(np.copy(action_transformation[0]), dtype=None, device=torch.device("cpu"))
-        )
-        self.action_transformation_vector[self.position].copy_(
-            torch.as_tensor(np.copy(action_transformation[1]), dtype=None, device=torch.device("cpu"))
-        )
-        self.dHdxx[self.position].copy_(torch.as_tensor(np.copy(hamiltonian.dfdxx), dtype=None, device=torch.device("cpu")))
-        self.dHdux[self.position].copy_(torch.as_tensor(np.copy(hamiltonian.dfdux), dtype=None, device=torch.device("cpu")))
-        self.dHduu[self.position].copy_(torch.as_tensor(np.copy(hamiltonian.dfduu), dtype=None, device=torch.device("cpu")))
-        self.dHdx[self.position].copy_(torch.as_tensor(np.copy(hamiltonian.dfdx), dtype=None, device=torch.device("cpu")))
-        self.dHdu[self.position].copy_(torch.as_tensor(np.copy(hamiltonian.dfdu), dtype=None, device=torch.device("cpu")))
-        self.H[self.position].copy_(torch.as_tensor(np.copy(hamiltonian.f), dtype=None, device=torch.device("cpu")))
+        #       - torch.Tensor.copy_: single copy performed together with potential dtype and device change
+        for memory, array in zip(memories, data):
+            tensor = torch.as_tensor(array, dtype=None, device=torch.device("cpu"))
+            memory[self.position : self.position + first].copy_(tensor[offset : offset + first])
+            memory[: n - first].copy_(tensor[offset + first :])
         # update size and position
-        self.size = min(self.size + 1, self.capacity)
-        self.position = (self.position + 1) % self.capacity
+        self.size = min(self.size + n, self.capacity)
+        self.position = (self.position + n) % self.capacity
 
     def sample(self, batch_size: int) -> Tuple[torch.Tensor, ...]:
         """Samples data from the memory.
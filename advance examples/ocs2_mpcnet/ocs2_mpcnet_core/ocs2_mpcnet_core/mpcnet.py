@@ -34,6 +34,7 @@ Provides a class that handles the MPC-Net training.
 
 import datetime
 import os
+import tempfile
 import time
 from abc import ABCMeta, abstractmethod
 from typing import Optional, Tuple
@@ -47,7 +48,7 @@ from ocs2_mpcnet_core.memory import BaseMemory
 from ocs2_mpcnet_core.policy import BasePolicy
 from torch.utils.tensorboard import SummaryWriter
 
-from ocs2_mpcnet_core import SystemObservationArray, ModeScheduleArray, TargetTrajectoriesArray
+from ocs2_mpcnet_core import SystemObservationArray, ModeScheduleArray, TargetTrajectoriesArray, DataBuffer
 from ocs2_mpcnet_core import helper
 
 
@@ -129,21 +130,74 @@ class Mpcnet(metaclass=ABCMeta):
         """
         pass
 
+    def export_policy(self, policy: BasePolicy, file_path: str) -> None:
+        """Export policy.
+
+        Exports the policy to the ONNX format with a dynamic batch dimension, such that the policy can be evaluated in batches.
+
+        Args:
+            policy: The policy to export.
+            file_path: The path to the ONNX file.
+        """
+        with torch.no_grad():
+            outputs = policy(self.dummy_observation)
+        output_names = ["action"] + ["output_" + str(i) for i in range(1, len(outputs))]
+        dynamic_axes = {name: {0: "batch"} for name in ["observation"] + output_names}
+        # export into a temporary file which then replaces the file at once, such that readers never see a partial policy
+        file_descriptor, temporary_file_path = tempfile.mkstemp(
+            prefix="." + os.path.basename(file_path) + ".", dir=os.path.dirname(os.path.abspath(file_path))
+        )
+        os.close(file_descriptor)
+        try:
+            torch.onnx.export(
+                model=policy,
+                args=self.dummy_observation,
+                f=temporary_file_path,
+                input_names=["observation"],
+                output_names=output_names,
+                dynamic_axes=dynamic_axes,
+            )
+            os.replace(temporary_file_path, file_path)
+        except BaseException:
+            os.remove(temporary_file_path)
+            raise
+
+    @staticmethod
+    def get_temporary_policy_file_path(prefix: str) -> str:
+        """Get temporary policy file path.
+
+        Creates a new file with a unique name in the temporary directory, which is not used by any other call.
+
+        Args:
+            prefix: The prefix of the file name.
+
+        Returns:
+            The path to the ONNX file.
+        """
+        timestamp = datetime.datetime.now().strftime("%Y-%m-%d_%H-%M-%S")
+        file_descriptor, file_path = tempfile.mkstemp(prefix=prefix + "_" + timestamp + "_", suffix=".onnx")
+        os.close(file_descriptor)
+        return file_path
+
     def start_data_generation(self, policy: BasePolicy, alpha: float = 1.0):
         """Start data generation.
 
-        Start the data generation rollouts to receive new data.
+        Start the data generation rollouts to receive new data. When streaming, set the episodes which the running data
+        generation picks up for its next rollouts instead.
 
         Args:
             policy: The current learned policy.
             alpha: The weight of the MPC policy in the rollouts.
         """
-        policy_file_path = "/tmp/data_generation_" + datetime.datetime.now().strftime("%Y-%m-%d_%H-%M-%S") + ".onnx"
-        torch.onnx.export(model=policy, args=self.dummy_observation, f=policy_file_path)
+        policy_file_path = self.get_temporary_policy_file_path("data_generation")
+        self.export_policy(policy, policy_file_path)
         initial_observations, mode_schedules, target_trajectories = self.get_tasks(
             self.config.DATA_GENERATION_TASKS, self.config.DATA_GENERATION_DURATION
         )
-        self.interface.startDataGeneration(
+        start = self.interface.startDataGeneration
+        if self.config.DATA_GENERATION_STREAMING:
+            start = self.interface.setDataGenerationEpisodes
+        start(
             alpha,
             policy_file_path,
             self.config.DATA_GENERATION_TIME_STEP,
@@ -155,6 +209,60 @@ class Mpcnet(metaclass=ABCMeta):
             target_trajectories,
         )
 
+    def push_data(self, data: DataBuffer) -> None:
+        """Push data.
+
+        Push generated data into the memory.
+
+        Args:
+            data: The generated data.
+        """
+        # push t, x, u, p, observation, action transformation, Hamiltonian into memory
+        # note: the fields of the data buffer are views on the C++ memory, which is reused once the buffer is released
+        self.memory.push(
+            data.t,
+            data.x,
+            data.u,
+            helper.get_one_hot_batch(data.mode, self.config.EXPERT_NUM, self.config.EXPERT_FOR_MODE),
+            data.observation,
+            data.actionTransformationMatrix.reshape(-1, self.config.INPUT_DIM, self.config.ACTION_DIM),
+            data.actionTransformationVector,
+            data.dHdxx.reshape(-1, self.config.STATE_DIM, self.config.STATE_DIM),
+            data.dHdux.reshape(-1, self.config.INPUT_DIM, self.config.STATE_DIM),
+            data.dHduu.reshape(-1, self.config.INPUT_DIM, self.config.INPUT_DIM),
+            data.dHdx,
+            data.dHdu,
+            data.H,
+        )
+
+    def pop_streamed_data(self) -> Tuple[int, int]:
+        """Pop streamed data.
+
+        Push all chunks which the streaming data generation has finished into the memory, without waiting for more.
+
+        Returns:
+            A tuple containing the number of received chunks and data points.
+        """
+        chunks, data_points = 0, 0
+        data = self.interface.tryPopGeneratedData()
+        while data is not None:
+            self.push_data(data)
+            chunks += 1
+            data_points += len(data)
+            data = self.interface.tryPopGeneratedData()
+        return chunks, data_points
+
+    def stop_data_generation(self) -> None:
+        """Stop data generation.
+
+        Let the data generation finish (to avoid a segmentation fault), respectively stop the streaming data generation.
+        """
+        if self.config.DATA_GENERATION_STREAMING:
+            self.interface.stopDataGenerationStream()
+        else:
+            while not self.interface.isDataGenerationDone():
+                time.sleep(1.0)
+
     def start_policy_evaluation(self, policy: BasePolicy, alpha: float = 0.0):
         """Start policy evaluation.
 
@@ -164,8 +272,8 @@ class Mpcnet(metaclass=ABCMeta):
             policy: The current learned policy.
             alpha: The weight of the MPC policy in the rollouts.
         """
-        policy_file_path = "/tmp/policy_evaluation_" + datetime.datetime.now().strftime("%Y-%m-%d_%H-%M-%S") + ".onnx"
-        torch.onnx.export(model=policy, args=self.dummy_observation, f=policy_file_path)
+        policy_file_path = self.get_temporary_policy_file_path("policy_evaluation")
+        self.export_policy(policy, policy_file_path)
         initial_observations, mode_schedules, target_trajectories = self.get_tasks(
             self.config.POLICY_EVALUATION_TASKS, self.config.POLICY_EVALUATION_DURATION
         )
@@ -186,38 +294,51 @@ class Mpcnet(metaclass=ABCMeta):
         try:
             # save initial policy
             save_path = self.log_dir + "/initial_policy"
-            torch.onnx.export(model=self.policy, args=self.dummy_observation, f=save_path + ".onnx")
+            self.export_policy(self.policy, save_path + ".onnx")
             torch.save(obj=self.policy, f=save_path + ".pt")
 
             print("==============\nWaiting for first data.\n==============")
             self.start_data_generation(self.policy)
             self.start_policy_evaluation(self.policy)
-            while not self.interface.isDataGenerationDone():
-                time.sleep(1.0)
+            if self.config.DATA_GENERATION_STREAMING:
+                # the rollouts keep running while training, a new policy is picked up between episodes
+                self.interface.startDataGenerationStream(self.config.DATA_GENERATION_QUEUE_CAPACITY)
+                streamed_chunks, _ = self.pop_streamed_data()
+                while streamed_chunks == 0:
+                    time.sleep(1.0)
+                    streamed_chunks, _ = self.pop_streamed_data()
+            else:
+                while not self.interface.isDataGenerationDone():
+                    time.sleep(1.0)
 
             print("==============\nStarting training.\n==============")
             for iteration in range(self.config.LEARNING_ITERATIONS):
                 alpha = 1.0 - 1.0 * iteration / self.config.LEARNING_ITERATIONS
 
                 # data generation
-                if self.interface.isDataGenerationDone():
+                if self.config.DATA_GENERATION_STREAMING:
+                    # take the chunks which arrived during the last optimization step
+                    chunks, data_points = self.pop_streamed_data()
+                    streamed_chunks += chunks
+                    if chunks > 0:
+                        # logging
+                        self.writer.add_scalar("data/new_data_points", data_points, iteration)
+                        self.writer.add_scalar("data/total_data_points", len(self.memory), iteration)
+                    # hand over new tasks and the current policy once as many episodes as tasks were received
+                    if streamed_chunks >= self.config.DATA_GENERATION_TASKS:
+                        print("iteration", iteration, "received", streamed_chunks, "chunks", "requesting with alpha", alpha)
+                        streamed_chunks = 0
+                        self.start_data_generation(self.policy, alpha)
+                elif self.interface.isDataGenerationDone():
                     # get generated data
                     data = self.interface.getGeneratedData()
-                    for i in range(len(data)):
-                        # push t, x, u, p, observation, action transformation, Hamiltonian into memory
-                        self.memory.push(
-                            data[i].t,
-                            data[i].x,
-                            data[i].u,
-                            helper.get_one_hot(data[i].mode, self.config.EXPERT_NUM, self.config.EXPERT_FOR_MODE),
-                            data[i].observation,
-                            data[i].actionTransformation,
-                            data[i].hamiltonian,
-                        )
+                    self.push_data(data)
                     # logging
                     self.writer.add_scalar("data/new_data_points", len(data), iteration)
                     self.writer.add_scalar("data/total_data_points", len(self.memory), iteration)
                     print("iteration", iteration, "received data points", len(data), "requesting with alpha", alpha)
+                    # release the buffer, such that its memory is reused by the next call
+                    del data
                     # start new data generation
                     self.start_data_generation(self.policy, alpha)
 
@@ -245,7 +366,7 @@ class Mpcnet(metaclass=ABCMeta):
                 # save intermediate policy
                 if (iteration % int(0.1 * self.config.LEARNING_ITERATIONS) == 0) and (iteration > 0):
                     save_path = self.log_dir + "/intermediate_policy_" + str(iteration)
-                    torch.onnx.export(model=self.policy, args=self.dummy_observation, f=save_path + ".onnx")
+                    self.export_policy(self.policy, save_path + ".onnx")
                     torch.save(obj=self.policy, f=save_path + ".pt")
 
                 # extract batch from memory
@@ -315,19 +436,21 @@ class Mpcnet(metaclass=ABCMeta):
 
                 # let data generation and policy evaluation finish in last iteration (to avoid a segmentation fault)
                 if iteration == self.config.LEARNING_ITERATIONS - 1:
-                    while (not self.interface.isDataGenerationDone()) or (not self.interface.isPolicyEvaluationDone()):
+                    self.stop_data_generation()
+                    while not self.interface.isPolicyEvaluationDone():
                         time.sleep(1.0)
 
             print("==============\nTraining completed.\n==============")
 
             # save final policy
             save_path = self.log_dir + "/final_policy"
-            torch.onnx.export(model=self.policy, args=self.dummy_observation, f=save_path + ".onnx")
+            self.export_policy(self.policy, save_path + ".onnx")
             torch.save(obj=self.policy, f=save_path + ".pt")
 
         except KeyboardInterrupt:
             # let data generation and policy evaluation finish (to avoid a segmentation fault)
-            while (not self.interface.isDataGenerationDone()) or (not self.interface.isPolicyEvaluationDone()):
+            self.stop_data_generation()
+            while not self.interface.isPolicyEvaluationDone():
                 time.sleep(1.0)
             print("==============\nTraining interrupted.\n==============")
             pass
@@ -47,11 +47,38 @@ namespace ocs2::mpcnet {
     }
 
 
-    data_array_t MpcnetInterfaceBase::getGeneratedData() {
+    std::shared_ptr<DataBuffer> MpcnetInterfaceBase::getGeneratedData() {
         return mpcnetRolloutManagerPtr_->getGeneratedData();
     }
 
 
+    void MpcnetInterfaceBase::setDataGenerationEpisodes(scalar_t alpha, const std::string &policyFilePath,
+                                                        scalar_t timeStep, size_t dataDecimation, size_t nSamples,
+                                                        const matrix_t &samplingCovariance,
+                                                        const std::vector<SystemObservation> &initialObservations,
+                                                        const std::vector<ModeSchedule> &modeSchedules,
+                                                        const std::vector<TargetTrajectories> &targetTrajectories) {
+        mpcnetRolloutManagerPtr_->setDataGenerationEpisodes(alpha, policyFilePath, timeStep, dataDecimation, nSamples,
+                                                            samplingCovariance, initialObservations, modeSchedules,
+                                                            targetTrajectories);
+    }
+
+
+    void MpcnetInterfaceBase::startDataGenerationStream(size_t queueCapacity) {
+        mpcnetRolloutManagerPtr_->startDataGenerationStream(queueCapacity);
+    }
+
+
+    std::shared_ptr<DataBuffer> MpcnetInterfaceBase::tryPopGeneratedData() {
+        return mpcnetRolloutManagerPtr_->tryPopGeneratedData();
+    }
+
+
+    void MpcnetInterfaceBase::stopDataGenerationStream() {
+        mpcnetRolloutManagerPtr_->stopDataGenerationStream();
+    }
+
+
     void MpcnetInterfaceBase::startPolicyEvaluation(scalar_t alpha, const std::string &policyFilePath,
                                                     scalar_t timeStep,
                                                     const std::vector<SystemObservation> &initialObservations,
@@ -0,0 +1,120 @@
+/******************************************************************************
+Copyright (c) 2022, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+ * Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+ * Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+/**
+ * Measures the throughput of the ONNX policy evaluation against the batch size.
+ * For every batch size, the policy is evaluated directly with one session run per batch and through the inference server with as many
+ * concurrent clients as the batch size.
+ * Usage: mpcnet_onnx_benchmark <policy.onnx> [maxBatchSize]
+ */
+
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "ocs2_mpcnet_core/control/MpcnetOnnxController.h"
+#include "ocs2_mpcnet_core/control/MpcnetOnnxInferenceServer.h"
+#include "ocs2_mpcnet_core/control/MpcnetOnnxPolicy.h"
+
+using namespace ocs2;
+using namespace ocs2::mpcnet;
+
+namespace {
+    const std::chrono::duration<double> measurementDuration(1.0);
+
+    /** Queries per second of evaluating the policy directly with the given batch size. */
+    double directQueriesPerSecond(MpcnetOnnxPolicy &policy, size_t batchSize) {
+        policy.observations().setRandom();
+        size_t nQueries = 0;
+        const auto start = std::chrono::steady_clock::now();
+        std::chrono::duration<double> elapsed(0.0);
+        while (elapsed < measurementDuration) {
+            policy.run(batchSize);
+            nQueries += batchSize;
+            elapsed = std::chrono::steady_clock::now() - start;
+        }
+        return nQueries / elapsed.count();
+    }
+
+    /** Queries per second of evaluating the policy through the server with the given number of concurrent clients. */
+    double serverQueriesPerSecond(MpcnetOnnxInferenceServer &server, size_t observationDimension, size_t nClients) {
+        std::atomic_bool stop(false);
+        std::atomic<size_t> nQueries(0);
+        std::vector<std::thread> clients;
+        clients.reserve(nClients);
+        for (size_t i = 0; i < nClients; i++) {
+            clients.emplace_back([&]() {
+                const MpcnetOnnxInferenceServer::tensor_vector_t observation =
+                        MpcnetOnnxInferenceServer::tensor_vector_t::Random(observationDimension);
+                MpcnetOnnxInferenceServer::tensor_vector_t action;
+                while (!stop) {
+                    server.evaluate(observation, action);
+                    ++nQueries;
+                }
+            });
+        }
+        const auto start = std::chrono::steady_clock::now();
+        std::this_thread::sleep_for(measurementDuration);
+        stop = true;
+        for (auto &client: clients) {
+            client.join();
+        }
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        return nQueries / elapsed.count();
+    }
+} // namespace
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " <policy.onnx> [maxBatchSize]\n";
+        return 1;
+    }
+    const std::string policyFilePath(argv[1]);
+    const size_t maxBatchSize = (argc > 2) ? std::stoul(argv[2]) : 16;
+
+    auto onnxEnvironmentPtr = createOnnxEnvironment();
+    MpcnetOnnxPolicy policy(onnxEnvironmentPtr, policyFilePath, maxBatchSize);
+    MpcnetOnnxInferenceServer server(onnxEnvironmentPtr, maxBatchSize);
+    server.loadPolicyModel(policyFilePath);
+    if (policy.getMaxBatchSize() < maxBatchSize) {
+        std::cerr << "The policy has a fixed batch dimension, export it with a dynamic batch dimension for batched inference.\n";
+    }
+
+    std::cerr << std::setw(12) << "batch size" << std::setw(20) << "direct [query/s]" << std::setw(20) << "server [query/s]" << "\n";
+    for (size_t batchSize = 1; batchSize <= policy.getMaxBatchSize(); batchSize *= 2) {
+        std::cerr << std::setw(12) << batchSize << std::setw(20) << std::fixed << std::setprecision(0)
+                  << directQueriesPerSecond(policy, batchSize) << std::setw(20)
+                  << serverQueriesPerSecond(server, policy.getObservationDimension(), batchSize) << "\n";
+    }
+
+    return 0;
+}
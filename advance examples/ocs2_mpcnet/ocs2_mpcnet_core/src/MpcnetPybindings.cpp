@@ -46,8 +46,6 @@ PYBIND11_MAKE_OPAQUE(std::vector<ocs2::ModeSchedule>)
 
 PYBIND11_MAKE_OPAQUE(std::vector<ocs2::TargetTrajectories>)
 
-PYBIND11_MAKE_OPAQUE(ocs2::mpcnet::data_array_t)
-
 PYBIND11_MAKE_OPAQUE(ocs2::mpcnet::metrics_array_t)
 
 PYBIND11_MODULE(MpcnetPybindings, m) {
@@ -59,7 +57,6 @@ PYBIND11_MODULE(MpcnetPybindings, m) {
     VECTOR_TYPE_BINDING(std::vector<ocs2::ModeSchedule>, "ModeScheduleArray")
     VECTOR_TYPE_BINDING(std::vector<ocs2::TargetTrajectories>, "TargetTrajectoriesArray")
 
-    VECTOR_TYPE_BINDING(ocs2::mpcnet::data_array_t, "DataArray")
     VECTOR_TYPE_BINDING(ocs2::mpcnet::metrics_array_t, "MetricsArray")
 
     py::class_<ocs2::vector_array_t>(m, "vector_array")
@@ -157,6 +154,27 @@ PYBIND11_MODULE(MpcnetPybindings, m) {
             .def_readwrite("actionTransformation", &ocs2::mpcnet::data_point_t::actionTransformation)
             .def_readwrite("hamiltonian", &ocs2::mpcnet::data_point_t::hamiltonian);
 
+    /* bind data buffer class, the fields are NumPy views which keep the buffer alive */
+    py::class_<ocs2::mpcnet::DataBuffer, std::shared_ptr<ocs2::mpcnet::DataBuffer> >(m, "DataBuffer")
+            .def("__len__", &ocs2::mpcnet::DataBuffer::size)
+            .def("getStateDim", &ocs2::mpcnet::DataBuffer::getStateDim)
+            .def("getInputDim", &ocs2::mpcnet::DataBuffer::getInputDim)
+            .def("getObservationDim", &ocs2::mpcnet::DataBuffer::getObservationDim)
+            .def("getActionDim", &ocs2::mpcnet::DataBuffer::getActionDim)
+            .def_property_readonly("mode", py::overload_cast<>(&ocs2::mpcnet::DataBuffer::mode))
+            .def_property_readonly("t", py::overload_cast<>(&ocs2::mpcnet::DataBuffer::t))
+            .def_property_readonly("x", py::overload_cast<>(&ocs2::mpcnet::DataBuffer::x))
+            .def_property_readonly("u", py::overload_cast<>(&ocs2::mpcnet::DataBuffer::u))
+            .def_property_readonly("observation", py::overload_cast<>(&ocs2::mpcnet::DataBuffer::observation))
+            .def_property_readonly("actionTransformationMatrix", py::overload_cast<>(&ocs2::mpcnet::DataBuffer::actionTransformationMatrix))
+            .def_property_readonly("actionTransformationVector", py::overload_cast<>(&ocs2::mpcnet::DataBuffer::actionTransformationVector))
+            .def_property_readonly("dHdxx", py::overload_cast<>(&ocs2::mpcnet::DataBuffer::dHdxx))
+            .def_property_readonly("dHdux", py::overload_cast<>(&ocs2::mpcnet::DataBuffer::dHdux))
+            .def_property_readonly("dHduu", py::overload_cast<>(&ocs2::mpcnet::DataBuffer::dHduu))
+            .def_property_readonly("dHdx", py::overload_cast<>(&ocs2::mpcnet::DataBuffer::dHdx))
+            .def_property_readonly("dHdu", py::overload_cast<>(&ocs2::mpcnet::DataBuffer::dHdu))
+            .def_property_readonly("H", py::overload_cast<>(&ocs2::mpcnet::DataBuffer::H));
+
     /* bind metrics struct */
     py::class_<ocs2::mpcnet::metrics_t>(m, "Metrics")
             .def(pybind11::init<>())
@@ -31,71 +31,43 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "ocs2_mpcnet_core/control/MpcnetOnnxController.h"
 
-#include <iostream>
-
-
 namespace ocs2::mpcnet {
     void MpcnetOnnxController::loadPolicyModel(const std::string &policyFilePath) {
         policyFilePath_ = policyFilePath;
 
-        // create session
-        Ort::SessionOptions sessionOptions;
-        sessionOptions.SetIntraOpNumThreads(1);
-        sessionOptions.SetInterOpNumThreads(1);
-        sessionPtr_ = std::make_unique<Ort::Session>(*onnxEnvironmentPtr_, policyFilePath_.c_str(), sessionOptions);
-
-        // get input and output info
-        inputNames_.clear();
-        outputNames_.clear();
-        inputShapes_.clear();
-        outputShapes_.clear();
-        const Ort::AllocatorWithDefaultOptions allocator;
-
-        for (int i = 0; i < sessionPtr_->GetInputCount(); i++) {
-            auto input_name = sessionPtr_->GetInputNameAllocated(i, allocator);
-            inputNameAllocatedStrings.push_back(std::move(input_name));
-            inputNames_.push_back(inputNameAllocatedStrings.back().get());
-            inputShapes_.push_back(sessionPtr_->GetInputTypeInfo(i).GetTensorTypeAndShapeInfo().GetShape());
-        }
-        for (int i = 0; i < sessionPtr_->GetOutputCount(); i++) {
-            auto output_name = sessionPtr_->GetOutputNameAllocated(i, allocator);
-            outputNameAllocatedStrings.push_back(std::move(output_name));
-            outputNames_.push_back(outputNameAllocatedStrings.back().get());
-            outputShapes_.push_back(sessionPtr_->GetOutputTypeInfo(i).GetTensorTypeAndShapeInfo().GetShape());
+        if (inferenceServerPtr_ != nullptr) {
+            inferenceServerPtr_->loadPolicyModel(policyFilePath_);
+        } else {
+            policyPtr_ = std::make_unique<MpcnetOnnxPolicy>(onnxEnvironmentPtr_, policyFilePath_, 1);
         }
     }
 
 
     vector_t MpcnetOnnxController::computeInput(const scalar_t t, const vector_t &x) {
-        if (sessionPtr_ == nullptr) {
+        if (policyFilePath_.empty()) {
             throw std::runtime_error(
                 "[MpcnetOnnxController::computeInput] cannot compute input, since policy model is not loaded.");
         }
 
-        // create input tensor object
-        Eigen::Matrix<tensor_element_t, Eigen::Dynamic, 1> observation =
-                mpcnetDefinitionPtr_->getObservation(t, x, referenceManagerPtr_->getModeSchedule(),
-                                                     referenceManagerPtr_->getTargetTrajectories())
-                .cast<tensor_element_t>();
-        const Ort::MemoryInfo memoryInfo = Ort::MemoryInfo::CreateCpu(OrtArenaAllocator, OrtMemTypeDefault);
-        std::vector<Ort::Value> inputValues;
-        inputValues.push_back(Ort::Value::CreateTensor<tensor_element_t>(
-            memoryInfo, observation.data(), observation.size(),
-            inputShapes_[0].data(), inputShapes_[0].size()));
+        const auto &modeSchedule = referenceManagerPtr_->getModeSchedule();
+        const auto &targetTrajectories = referenceManagerPtr_->getTargetTrajectories();
 
         // run inference
-        const Ort::RunOptions runOptions;
-        std::vector<Ort::Value> outputValues = sessionPtr_->Run(runOptions, inputNames_.data(), inputValues.data(), 1,
-                                                                outputNames_.data(), 1);
-
-        // evaluate output tensor object
-        const Eigen::Map<Eigen::Matrix<tensor_element_t, Eigen::Dynamic, 1> > action(
-            outputValues[0].GetTensorMutableData<tensor_element_t>(),
-            outputShapes_[0][1], outputShapes_[0][0]);
-        auto [fst, snd] = mpcnetDefinitionPtr_->getActionTransformation(
-            t, x, referenceManagerPtr_->getModeSchedule(), referenceManagerPtr_->getTargetTrajectories());
+        vector_t action;
+        if (inferenceServerPtr_ != nullptr) {
+            observation_ = mpcnetDefinitionPtr_->getObservation(t, x, modeSchedule, targetTrajectories).cast<tensor_element_t>();
+            inferenceServerPtr_->evaluate(observation_, action_);
+            action = action_.cast<scalar_t>();
+        } else {
+            // write the observation directly into the preallocated input tensor
+            policyPtr_->observations().col(0) =
+                    mpcnetDefinitionPtr_->getObservation(t, x, modeSchedule, targetTrajectories).cast<tensor_element_t>();
+            policyPtr_->run(1);
+            action = policyPtr_->actions().col(0).cast<scalar_t>();
+        }
 
         // transform action
-        return fst * action.cast<scalar_t>() + snd;
+        auto [fst, snd] = mpcnetDefinitionPtr_->getActionTransformation(t, x, modeSchedule, targetTrajectories);
+        return fst * action + snd;
     }
 } // namespace ocs2::mpcnet
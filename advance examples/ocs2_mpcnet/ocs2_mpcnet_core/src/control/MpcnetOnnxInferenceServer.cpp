@@ -0,0 +1,138 @@
+/******************************************************************************
+Copyright (c) 2022, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+ * Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+ * Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include "ocs2_mpcnet_core/control/MpcnetOnnxInferenceServer.h"
+
+#include <algorithm>
+
+
+namespace ocs2::mpcnet {
+    MpcnetOnnxInferenceServer::MpcnetOnnxInferenceServer(std::shared_ptr<Ort::Env> onnxEnvironmentPtr, size_t maxBatchSize)
+        : onnxEnvironmentPtr_(std::move(onnxEnvironmentPtr)), maxBatchSize_(maxBatchSize) {
+        if (maxBatchSize_ < 1) {
+            throw std::runtime_error(
+                "[MpcnetOnnxInferenceServer::MpcnetOnnxInferenceServer] the maximum batch size must be at least one.");
+        }
+        pendingRequests_.reserve(maxBatchSize_);
+        batch_.reserve(maxBatchSize_);
+        workerThread_ = std::thread([this]() { run(); });
+    }
+
+
+    MpcnetOnnxInferenceServer::~MpcnetOnnxInferenceServer() {
+        {
+            std::lock_guard<std::mutex> lock(requestMutex_);
+            stop_ = true;
+        }
+        newRequestCondition_.notify_one();
+        workerThread_.join();
+    }
+
+
+    void MpcnetOnnxInferenceServer::loadPolicyModel(const std::string &policyFilePath) {
+        std::lock_guard<std::mutex> lock(policyMutex_);
+        if (policyPtr_ == nullptr || policyPtr_->getPolicyFilePath() != policyFilePath) {
+            policyPtr_ = std::make_unique<MpcnetOnnxPolicy>(onnxEnvironmentPtr_, policyFilePath, maxBatchSize_);
+        }
+    }
+
+
+    void MpcnetOnnxInferenceServer::evaluate(const tensor_vector_t &observation, tensor_vector_t &action) {
+        Request request{&observation, &action, false, nullptr};
+
+        std::unique_lock<std::mutex> lock(requestMutex_);
+        pendingRequests_.push_back(&request);
+        newRequestCondition_.notify_one();
+        requestDoneCondition_.wait(lock, [&request]() { return request.done; });
+        lock.unlock();
+
+        if (request.exceptionPtr) {
+            std::rethrow_exception(request.exceptionPtr);
+        }
+    }
+
+
+    void MpcnetOnnxInferenceServer::run() {
+        std::unique_lock<std::mutex> lock(requestMutex_);
+        while (true) {
+            newRequestCondition_.wait(lock, [this]() { return stop_ || !pendingRequests_.empty(); });
+            if (stop_) {
+                return;
+            }
+
+            // take the oldest requests as the next batch
+            const size_t batchSize = std::min(pendingRequests_.size(), maxBatchSize_);
+            batch_.assign(pendingRequests_.begin(), pendingRequests_.begin() + batchSize);
+            pendingRequests_.erase(pendingRequests_.begin(), pendingRequests_.begin() + batchSize);
+            lock.unlock();
+
+            evaluateBatch(batch_);
+
+            lock.lock();
+            for (auto *requestPtr: batch_) {
+                requestPtr->done = true;
+            }
+            requestDoneCondition_.notify_all();
+        }
+    }
+
+
+    void MpcnetOnnxInferenceServer::evaluateBatch(const std::vector<Request *> &batch) {
+        std::lock_guard<std::mutex> lock(policyMutex_);
+        try {
+            if (policyPtr_ == nullptr) {
+                throw std::runtime_error(
+                    "[MpcnetOnnxInferenceServer::evaluateBatch] cannot evaluate, since policy model is not loaded.");
+            }
+
+            // a policy with a fixed batch dimension may support fewer samples than requested
+            for (size_t begin = 0; begin < batch.size(); begin += policyPtr_->getMaxBatchSize()) {
+                const size_t batchSize = std::min(batch.size() - begin, policyPtr_->getMaxBatchSize());
+                auto &observations = policyPtr_->observations();
+                for (size_t i = 0; i < batchSize; i++) {
+                    const auto &observation = *batch[begin + i]->observationPtr;
+                    if (observation.size() != observations.rows()) {
+                        throw std::runtime_error("[MpcnetOnnxInferenceServer::evaluateBatch] observation has size " +
+                                                 std::to_string(observation.size()) + " but the policy expects " +
+                                                 std::to_string(observations.rows()) + ".");
+                    }
+                    observations.col(i) = observation;
+                }
+                policyPtr_->run(batchSize);
+                for (size_t i = 0; i < batchSize; i++) {
+                    *batch[begin + i]->actionPtr = policyPtr_->actions().col(i);
+                }
+            }
+        } catch (...) {
+            for (auto *requestPtr: batch) {
+                requestPtr->exceptionPtr = std::current_exception();
+            }
+        }
+    }
+} // namespace ocs2::mpcnet
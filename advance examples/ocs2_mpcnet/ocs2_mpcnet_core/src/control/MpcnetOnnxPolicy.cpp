@@ -0,0 +1,98 @@
+/******************************************************************************
+Copyright (c) 2022, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+ * Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+ * Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include "ocs2_mpcnet_core/control/MpcnetOnnxPolicy.h"
+
+#include <array>
+
+
+namespace ocs2::mpcnet {
+    MpcnetOnnxPolicy::MpcnetOnnxPolicy(std::shared_ptr<Ort::Env> onnxEnvironmentPtr, std::string policyFilePath,
+                                       size_t maxBatchSize)
+        : onnxEnvironmentPtr_(std::move(onnxEnvironmentPtr)),
+          policyFilePath_(std::move(policyFilePath)),
+          memoryInfo_(Ort::MemoryInfo::CreateCpu(OrtArenaAllocator, OrtMemTypeDefault)) {
+        if (maxBatchSize < 1) {
+            throw std::runtime_error("[MpcnetOnnxPolicy::MpcnetOnnxPolicy] the maximum batch size must be at least one.");
+        }
+
+        // create session
+        Ort::SessionOptions sessionOptions;
+        sessionOptions.SetIntraOpNumThreads(1);
+        sessionOptions.SetInterOpNumThreads(1);
+        sessionPtr_ = std::make_unique<Ort::Session>(*onnxEnvironmentPtr_, policyFilePath_.c_str(), sessionOptions);
+
+        // get input and output info, the policy maps the first input (B x O) to the first output (B x A)
+        const Ort::AllocatorWithDefaultOptions allocator;
+        inputNameAllocatedStrings_.push_back(sessionPtr_->GetInputNameAllocated(0, allocator));
+        outputNameAllocatedStrings_.push_back(sessionPtr_->GetOutputNameAllocated(0, allocator));
+        const std::vector<int64_t> inputShape = sessionPtr_->GetInputTypeInfo(0).GetTensorTypeAndShapeInfo().GetShape();
+        const std::vector<int64_t> outputShape = sessionPtr_->GetOutputTypeInfo(0).GetTensorTypeAndShapeInfo().GetShape();
+        if (inputShape.size() != 2 || outputShape.size() != 2) {
+            throw std::runtime_error("[MpcnetOnnxPolicy::MpcnetOnnxPolicy] input and output of the policy must be of shape (B x N).");
+        }
+
+        // a negative batch dimension is dynamic, older models are exported with a fixed batch dimension of one
+        if (inputShape[0] < 0) {
+            maxBatchSize_ = maxBatchSize;
+        } else if (inputShape[0] == 1) {
+            maxBatchSize_ = 1;
+        } else {
+            throw std::runtime_error("[MpcnetOnnxPolicy::MpcnetOnnxPolicy] the batch dimension of the policy must be dynamic or one.");
+        }
+
+        // preallocate the tensors and bind them for every batch size
+        observations_.setZero(inputShape[1], maxBatchSize_);
+        actions_.setZero(outputShape[1], maxBatchSize_);
+        inputTensors_.reserve(maxBatchSize_);
+        outputTensors_.reserve(maxBatchSize_);
+        ioBindings_.reserve(maxBatchSize_);
+        for (size_t batchSize = 1; batchSize <= maxBatchSize_; batchSize++) {
+            const std::array<int64_t, 2> batchInputShape{static_cast<int64_t>(batchSize), observations_.rows()};
+            const std::array<int64_t, 2> batchOutputShape{static_cast<int64_t>(batchSize), actions_.rows()};
+            inputTensors_.push_back(Ort::Value::CreateTensor<tensor_element_t>(
+                memoryInfo_, observations_.data(), batchSize * observations_.rows(), batchInputShape.data(),
+                batchInputShape.size()));
+            outputTensors_.push_back(Ort::Value::CreateTensor<tensor_element_t>(
+                memoryInfo_, actions_.data(), batchSize * actions_.rows(), batchOutputShape.data(), batchOutputShape.size()));
+            ioBindings_.emplace_back(*sessionPtr_);
+            ioBindings_.back().BindInput(inputNameAllocatedStrings_.front().get(), inputTensors_.back());
+            ioBindings_.back().BindOutput(outputNameAllocatedStrings_.front().get(), outputTensors_.back());
+        }
+    }
+
+
+    void MpcnetOnnxPolicy::run(size_t batchSize) {
+        if (batchSize < 1 || batchSize > maxBatchSize_) {
+            throw std::runtime_error("[MpcnetOnnxPolicy::run] batch size " + std::to_string(batchSize) + " is not in [1, " +
+                                     std::to_string(maxBatchSize_) + "].");
+        }
+        sessionPtr_->Run(runOptions_, ioBindings_[batchSize - 1]);
+    }
+} // namespace ocs2::mpcnet
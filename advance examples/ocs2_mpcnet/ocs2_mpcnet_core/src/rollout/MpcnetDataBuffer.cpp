@@ -0,0 +1,148 @@
+/******************************************************************************
+Copyright (c) 2022, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+ * Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+ * Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include "ocs2_mpcnet_core/rollout/MpcnetDataBuffer.h"
+
+#include <algorithm>
+
+namespace ocs2::mpcnet {
+    void DataBuffer::reserve(size_t capacity) {
+        if (capacity <= this->capacity()) {
+            return;
+        }
+        // row-major storage keeps the existing rows when rows are added
+        mode_.conservativeResize(capacity);
+        t_.conservativeResize(capacity);
+        x_.conservativeResize(capacity, stateDim_);
+        u_.conservativeResize(capacity, inputDim_);
+        observation_.conservativeResize(capacity, observationDim_);
+        actionTransformationMatrix_.conservativeResize(capacity, inputDim_ * actionDim_);
+        actionTransformationVector_.conservativeResize(capacity, inputDim_);
+        dHdxx_.conservativeResize(capacity, stateDim_ * stateDim_);
+        dHdux_.conservativeResize(capacity, inputDim_ * stateDim_);
+        dHduu_.conservativeResize(capacity, inputDim_ * inputDim_);
+        dHdx_.conservativeResize(capacity, stateDim_);
+        dHdu_.conservativeResize(capacity, inputDim_);
+        H_.conservativeResize(capacity);
+    }
+
+
+    void DataBuffer::truncate(size_t size) {
+        size_ = std::min(size_, size);
+    }
+
+
+    void DataBuffer::push_back(const DataPoint &dataPoint) {
+        const size_t stateDim = dataPoint.x.size();
+        const size_t inputDim = dataPoint.u.size();
+        const size_t observationDim = dataPoint.observation.size();
+        const size_t actionDim = dataPoint.actionTransformation.first.cols();
+        if (size_ == 0) {
+            setDimensions(stateDim, inputDim, observationDim, actionDim);
+        } else if (stateDim != stateDim_ || inputDim != inputDim_ || observationDim != observationDim_ || actionDim != actionDim_) {
+            throw std::runtime_error("[DataBuffer::push_back] the dimensions of the data point do not match the buffer.");
+        }
+        if (size_ == capacity()) {
+            reserve(std::max<size_t>(2 * capacity(), 64));
+        }
+
+        const auto i = static_cast<Eigen::Index>(size_);
+        mode_(i) = dataPoint.mode;
+        t_(i) = dataPoint.t;
+        x_.row(i) = dataPoint.x.transpose();
+        u_.row(i) = dataPoint.u.transpose();
+        observation_.row(i) = dataPoint.observation.transpose();
+        Eigen::Map<row_matrix_t>(actionTransformationMatrix_.row(i).data(), inputDim_, actionDim_) = dataPoint.actionTransformation.first;
+        actionTransformationVector_.row(i) = dataPoint.actionTransformation.second.transpose();
+        Eigen::Map<row_matrix_t>(dHdxx_.row(i).data(), stateDim_, stateDim_) = dataPoint.hamiltonian.dfdxx;
+        Eigen::Map<row_matrix_t>(dHdux_.row(i).data(), inputDim_, stateDim_) = dataPoint.hamiltonian.dfdux;
+        Eigen::Map<row_matrix_t>(dHduu_.row(i).data(), inputDim_, inputDim_) = dataPoint.hamiltonian.dfduu;
+        dHdx_.row(i) = dataPoint.hamiltonian.dfdx.transpose();
+        dHdu_.row(i) = dataPoint.hamiltonian.dfdu.transpose();
+        H_(i) = dataPoint.hamiltonian.f;
+        ++size_;
+    }
+
+
+    void DataBuffer::append(const DataBuffer &other) {
+        const auto n = static_cast<Eigen::Index>(other.size_);
+        if (n == 0) {
+            return;
+        }
+        if (size_ == 0) {
+            setDimensions(other.stateDim_, other.inputDim_, other.observationDim_, other.actionDim_);
+        } else if (other.stateDim_ != stateDim_ || other.inputDim_ != inputDim_ || other.observationDim_ != observationDim_ ||
+                   other.actionDim_ != actionDim_) {
+            throw std::runtime_error("[DataBuffer::append] the dimensions of the buffers do not match.");
+        }
+        if (size_ + other.size_ > capacity()) {
+            reserve(std::max(size_ + other.size_, 2 * capacity()));
+        }
+
+        // the rows of a field are contiguous, each field is copied as one block
+        const auto i = static_cast<Eigen::Index>(size_);
+        mode_.segment(i, n) = other.mode_.head(n);
+        t_.segment(i, n) = other.t_.head(n);
+        x_.middleRows(i, n) = other.x_.topRows(n);
+        u_.middleRows(i, n) = other.u_.topRows(n);
+        observation_.middleRows(i, n) = other.observation_.topRows(n);
+        actionTransformationMatrix_.middleRows(i, n) = other.actionTransformationMatrix_.topRows(n);
+        actionTransformationVector_.middleRows(i, n) = other.actionTransformationVector_.topRows(n);
+        dHdxx_.middleRows(i, n) = other.dHdxx_.topRows(n);
+        dHdux_.middleRows(i, n) = other.dHdux_.topRows(n);
+        dHduu_.middleRows(i, n) = other.dHduu_.topRows(n);
+        dHdx_.middleRows(i, n) = other.dHdx_.topRows(n);
+        dHdu_.middleRows(i, n) = other.dHdu_.topRows(n);
+        H_.segment(i, n) = other.H_.head(n);
+        size_ += other.size_;
+    }
+
+
+    void DataBuffer::setDimensions(size_t stateDim, size_t inputDim, size_t observationDim, size_t actionDim) {
+        if (stateDim == stateDim_ && inputDim == inputDim_ && observationDim == observationDim_ && actionDim == actionDim_) {
+            return;
+        }
+        stateDim_ = stateDim;
+        inputDim_ = inputDim;
+        observationDim_ = observationDim;
+        actionDim_ = actionDim;
+
+        const auto capacity = t_.size();
+        x_.resize(capacity, stateDim_);
+        u_.resize(capacity, inputDim_);
+        observation_.resize(capacity, observationDim_);
+        actionTransformationMatrix_.resize(capacity, inputDim_ * actionDim_);
+        actionTransformationVector_.resize(capacity, inputDim_);
+        dHdxx_.resize(capacity, stateDim_ * stateDim_);
+        dHdux_.resize(capacity, inputDim_ * stateDim_);
+        dHduu_.resize(capacity, inputDim_ * inputDim_);
+        dHdx_.resize(capacity, stateDim_);
+        dHdu_.resize(capacity, inputDim_);
+    }
+} // namespace ocs2::mpcnet
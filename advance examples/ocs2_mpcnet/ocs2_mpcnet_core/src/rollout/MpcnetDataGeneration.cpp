@@ -36,15 +36,15 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 
 namespace ocs2::mpcnet {
-    const data_array_t *MpcnetDataGeneration::run(const scalar_t alpha, const std::string &policyFilePath,
+    size_t MpcnetDataGeneration::run(const scalar_t alpha, const std::string &policyFilePath,
                                                   const scalar_t timeStep,
                                                   const size_t dataDecimation,
                                                   const size_t nSamples, const matrix_t &samplingCovariance,
                                                   const SystemObservation &initialObservation,
                                                   const ModeSchedule &modeSchedule,
                                                   const TargetTrajectories &targetTrajectories) {
-        // clear data array
-        dataArray_.clear();
+        // data points of this run are appended after the ones of previous runs
+        const size_t initialSize = dataBuffer_.size();
 
         // set system
         set(alpha, policyFilePath, initialObservation, modeSchedule, targetTrajectories);
@@ -68,7 +68,7 @@ namespace ocs2::mpcnet {
                 // down-sample the data signal by an integer factor
                 if (iteration % dataDecimation == 0) {
                     // get nominal data point
-                    dataArray_.push_back(getDataPoint(*mpcPtr_, *mpcnetDefinitionPtr_,
+                    dataBuffer_.push_back(getDataPoint(*mpcPtr_, *mpcnetDefinitionPtr_,
                                                       vector_t::Zero(primalSolution_.stateTrajectory_.front().size())));
 
                     // get samples around nominal data point
@@ -76,7 +76,7 @@ namespace ocs2::mpcnet {
                         const vector_t deviation = L * vector_t::NullaryExpr(
                                                        primalSolution_.stateTrajectory_.front().size(),
                                                        standardNormalNullaryOp);
-                        dataArray_.push_back(getDataPoint(*mpcPtr_, *mpcnetDefinitionPtr_, deviation));
+                        dataBuffer_.push_back(getDataPoint(*mpcPtr_, *mpcnetDefinitionPtr_, deviation));
                     }
                 }
 
@@ -87,11 +87,11 @@ namespace ocs2::mpcnet {
             // print error for exceptions
             std::cerr << "[MpcnetDataGeneration::run] a standard exception was caught, with message: " << e.what() <<
                     "\n";
-            // this data generation run failed, clear data
-            dataArray_.clear();
+            // this data generation run failed, remove its data
+            dataBuffer_.truncate(initialSize);
         }
 
-        // return pointer to the data array
-        return &dataArray_;
+        // return number of generated data points
+        return dataBuffer_.size() - initialSize;
     }
 } // namespace ocs2::mpcnet
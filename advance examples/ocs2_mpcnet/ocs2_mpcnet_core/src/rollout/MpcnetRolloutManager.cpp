@@ -27,6 +27,8 @@ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 ******************************************************************************/
 
+#include <algorithm>
+#include <iterator>
 #include <memory>
 
 #include "ocs2_mpcnet_core/rollout/MpcnetRolloutManager.h"
@@ -70,6 +72,13 @@ namespace ocs2::mpcnet {
     }
 
 
+    MpcnetRolloutManager::~MpcnetRolloutManager() {
+        if (isDataGenerationStreaming()) {
+            stopDataGenerationStream();
+        }
+    }
+
+
     void MpcnetRolloutManager::startDataGeneration(scalar_t alpha, const std::string &policyFilePath, scalar_t timeStep,
                                                    size_t dataDecimation,
                                                    size_t nSamples, const matrix_t &samplingCovariance,
@@ -80,15 +89,28 @@ namespace ocs2::mpcnet {
             throw std::runtime_error(
                 "[MpcnetRolloutManager::startDataGeneration] cannot work without at least one data generation thread.");
         }
+        if (isDataGenerationStreaming()) {
+            throw std::runtime_error(
+                "[MpcnetRolloutManager::startDataGeneration] cannot start while the streaming data generation is running.");
+        }
+
+        // the data buffers are written by the tasks
+        if (!dataGenerationFtrs_.empty() && !isDataGenerationDone()) {
+            throw std::runtime_error(
+                "[MpcnetRolloutManager::startDataGeneration] cannot start when the previous data generation is not done.");
+        }
 
         // reset variables
         dataGenerationFtrs_.clear();
         nDataGenerationTasksDone_ = 0;
+        for (auto &dataGenerationPtr: dataGenerationPtrs_) {
+            dataGenerationPtr->clearDataBuffer();
+        }
 
         // push tasks into pool
         for (int i = 0; i < initialObservations.size(); i++) {
             dataGenerationFtrs_.push_back(dataGenerationThreadPoolPtr_->run([=](const int threadNumber) {
-                const auto *result =
+                const auto result =
                         dataGenerationPtrs_[threadNumber]->run(alpha, policyFilePath, timeStep, dataDecimation,
                                                                nSamples, samplingCovariance,
                                                                initialObservations.at(i), modeSchedules.at(i),
@@ -125,7 +147,7 @@ namespace ocs2::mpcnet {
     }
 
 
-    const data_array_t &MpcnetRolloutManager::getGeneratedData() {
+    std::shared_ptr<DataBuffer> MpcnetRolloutManager::getGeneratedData() {
         if (nDataGenerationThreads_ <= 0) {
             throw std::runtime_error(
                 "[MpcnetRolloutManager::getGeneratedData] cannot work without at least one data generation thread.");
@@ -135,16 +157,16 @@ namespace ocs2::mpcnet {
                 "[MpcnetRolloutManager::getGeneratedData] cannot get data when data generation is not done.");
         }
 
-        // clear data array
-        dataArray_.clear();
+        // reuse the data buffer only if the previous data is not held anymore
+        if (dataBufferPtr_ == nullptr || dataBufferPtr_.use_count() > 1) {
+            dataBufferPtr_ = std::make_shared<DataBuffer>();
+        }
+        dataBufferPtr_->clear();
 
-        // get pointers to data
-        std::vector<const data_array_t *> dataPtrs;
-        dataPtrs.reserve(dataGenerationFtrs_.size());
         for (auto &dataGenerationFtr: dataGenerationFtrs_) {
             try {
                 // get results from futures of the tasks
-                dataPtrs.push_back(dataGenerationFtr.get());
+                dataGenerationFtr.get();
             } catch (const std::exception &e) {
                 // print error for exceptions
                 std::cerr << "[MpcnetRolloutManager::getGeneratedData] a standard exception was caught, with message: "
@@ -153,19 +175,157 @@ namespace ocs2::mpcnet {
         }
 
         // find number of data points
-        int nDataPoints = 0;
-        for (const auto &dataPtr: dataPtrs) {
-            nDataPoints += dataPtr->size();
+        size_t nDataPoints = 0;
+        for (const auto &dataGenerationPtr: dataGenerationPtrs_) {
+            nDataPoints += dataGenerationPtr->getDataBuffer().size();
         }
 
-        // fill data array
-        dataArray_.reserve(nDataPoints);
-        for (const auto dataPtr: dataPtrs) {
-            dataArray_.insert(dataArray_.end(), dataPtr->begin(), dataPtr->end());
+        // fill data buffer
+        dataBufferPtr_->reserve(nDataPoints);
+        for (const auto &dataGenerationPtr: dataGenerationPtrs_) {
+            dataBufferPtr_->append(dataGenerationPtr->getDataBuffer());
         }
 
-        // return data array
-        return dataArray_;
+        // return data buffer
+        return dataBufferPtr_;
+    }
+
+
+    void MpcnetRolloutManager::setDataGenerationEpisodes(scalar_t alpha, const std::string &policyFilePath,
+                                                         scalar_t timeStep, size_t dataDecimation, size_t nSamples,
+                                                         const matrix_t &samplingCovariance,
+                                                         const std::vector<SystemObservation> &initialObservations,
+                                                         const std::vector<ModeSchedule> &modeSchedules,
+                                                         const std::vector<TargetTrajectories> &targetTrajectories) {
+        if (initialObservations.empty() || modeSchedules.size() != initialObservations.size() ||
+            targetTrajectories.size() != initialObservations.size()) {
+            throw std::runtime_error(
+                "[MpcnetRolloutManager::setDataGenerationEpisodes] requires the same non-zero number of initial observations, mode schedules and target trajectories.");
+        }
+
+        // the data generation threads pick up the new episodes when they start their next episode
+        dataGenerationEpisodes_.publish(std::make_shared<const DataGenerationEpisodes>(DataGenerationEpisodes{
+            alpha, policyFilePath, timeStep, dataDecimation, nSamples, samplingCovariance, initialObservations, modeSchedules,
+            targetTrajectories
+        }));
+    }
+
+
+    void MpcnetRolloutManager::startDataGenerationStream(size_t queueCapacity) {
+        if (nDataGenerationThreads_ <= 0) {
+            throw std::runtime_error(
+                "[MpcnetRolloutManager::startDataGenerationStream] cannot work without at least one data generation thread.");
+        }
+        if (isDataGenerationStreaming()) {
+            throw std::runtime_error(
+                "[MpcnetRolloutManager::startDataGenerationStream] the streaming data generation is already running.");
+        }
+        if (!dataGenerationFtrs_.empty() && !isDataGenerationDone()) {
+            throw std::runtime_error(
+                "[MpcnetRolloutManager::startDataGenerationStream] cannot start when the previous data generation is not done.");
+        }
+        if (dataGenerationEpisodes_.version() == 0) {
+            throw std::runtime_error(
+                "[MpcnetRolloutManager::startDataGenerationStream] cannot start before setDataGenerationEpisodes has been called once.");
+        }
+
+        // reset variables
+        stopDataGenerationStream_ = false;
+        dataGenerationQueuePtr_ = std::make_unique<BoundedQueue<std::shared_ptr<DataBuffer> > >(queueCapacity);
+
+        // one long-running task per data generation thread
+        for (size_t i = 0; i < nDataGenerationThreads_; i++) {
+            dataGenerationStreamFtrs_.push_back(dataGenerationThreadPoolPtr_->run([this](int threadNumber) {
+                runDataGenerationStream(threadNumber);
+            }));
+        }
+    }
+
+
+    std::shared_ptr<DataBuffer> MpcnetRolloutManager::tryPopGeneratedData() {
+        if (dataGenerationQueuePtr_ == nullptr) {
+            throw std::runtime_error(
+                "[MpcnetRolloutManager::tryPopGeneratedData] cannot return if startDataGenerationStream has not been triggered once.");
+        }
+
+        // hand the chunks which are not held by the caller anymore back to the data generation
+        const auto released = std::partition(poppedDataChunks_.begin(), poppedDataChunks_.end(),
+                                             [](const std::shared_ptr<DataBuffer> &chunk) { return chunk.use_count() > 1; });
+        if (released != poppedDataChunks_.end()) {
+            std::lock_guard<std::mutex> lock(recycledDataChunksMutex_);
+            std::move(released, poppedDataChunks_.end(), std::back_inserter(recycledDataChunks_));
+        }
+        poppedDataChunks_.erase(released, poppedDataChunks_.end());
+
+        std::shared_ptr<DataBuffer> dataChunk;
+        if (!dataGenerationQueuePtr_->tryPop(dataChunk)) {
+            return nullptr;
+        }
+        poppedDataChunks_.push_back(dataChunk);
+        return dataChunk;
+    }
+
+
+    void MpcnetRolloutManager::stopDataGenerationStream() {
+        // closing the queue releases the threads blocked on a full queue
+        stopDataGenerationStream_ = true;
+        if (dataGenerationQueuePtr_ != nullptr) {
+            dataGenerationQueuePtr_->close();
+        }
+
+        for (auto &dataGenerationStreamFtr: dataGenerationStreamFtrs_) {
+            try {
+                dataGenerationStreamFtr.get();
+            } catch (const std::exception &e) {
+                // print error for exceptions
+                std::cerr << "[MpcnetRolloutManager::stopDataGenerationStream] a standard exception was caught, with message: "
+                        << e.what() << "\n";
+            }
+        }
+        dataGenerationStreamFtrs_.clear();
+    }
+
+
+    void MpcnetRolloutManager::runDataGenerationStream(int threadNumber) {
+        auto &dataGeneration = *dataGenerationPtrs_[threadNumber];
+        while (!stopDataGenerationStream_) {
+            // pin the latest episodes only for the start of the episode, a new policy is picked up by the next one
+            const auto episodes = dataGenerationEpisodes_.pin().share();
+            const size_t i = nextDataGenerationEpisode_++ % episodes->initialObservations.size();
+
+            dataGeneration.clearDataBuffer();
+            const auto nDataPoints = dataGeneration.run(episodes->alpha, episodes->policyFilePath, episodes->timeStep,
+                                                        episodes->dataDecimation, episodes->nSamples,
+                                                        episodes->samplingCovariance, episodes->initialObservations[i],
+                                                        episodes->modeSchedules[i], episodes->targetTrajectories[i]);
+
+            if (nDataPoints == 0) {
+                continue;
+            }
+
+            // hand the data over in a chunk, the data generation continues with the memory of a released chunk
+            auto dataChunk = getRecycledDataChunk();
+            dataGeneration.swapDataBuffer(*dataChunk);
+
+            // blocks while the queue is full, returns false once the stream is stopped
+            if (!dataGenerationQueuePtr_->push(std::move(dataChunk))) {
+                break;
+            }
+        }
+    }
+
+
+    std::shared_ptr<DataBuffer> MpcnetRolloutManager::getRecycledDataChunk() {
+        {
+            std::lock_guard<std::mutex> lock(recycledDataChunksMutex_);
+            if (!recycledDataChunks_.empty()) {
+                auto dataChunk = std::move(recycledDataChunks_.back());
+                recycledDataChunks_.pop_back();
+                dataChunk->clear();
+                return dataChunk;
+            }
+        }
+        return std::make_shared<DataBuffer>();
     }
 
 
@@ -0,0 +1,179 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "ocs2_mpcnet_core/rollout/MpcnetDataBuffer.h"
+
+using namespace ocs2;
+using namespace ocs2::mpcnet;
+
+namespace {
+
+constexpr size_t stateDim = 3;
+constexpr size_t inputDim = 2;
+constexpr size_t observationDim = 4;
+constexpr size_t actionDim = 2;
+
+/** A data point whose entries are all different and derived from the given tag. */
+DataPoint taggedDataPoint(scalar_t tag, size_t xDim = stateDim) {
+  auto sequence = [tag](size_t rows, size_t cols, scalar_t offset) {
+    matrix_t m(rows, cols);
+    for (int i = 0; i < m.size(); i++) {
+      m(i) = tag + offset + 0.001 * i;
+    }
+    return m;
+  };
+  DataPoint dataPoint;
+  dataPoint.mode = static_cast<size_t>(tag);
+  dataPoint.t = tag;
+  dataPoint.x = sequence(xDim, 1, 0.1);
+  dataPoint.u = sequence(inputDim, 1, 0.2);
+  dataPoint.observation = sequence(observationDim, 1, 0.3);
+  dataPoint.actionTransformation = {sequence(inputDim, actionDim, 0.4), sequence(inputDim, 1, 0.5)};
+  dataPoint.hamiltonian.f = tag + 0.6;
+  dataPoint.hamiltonian.dfdx = sequence(xDim, 1, 0.7);
+  dataPoint.hamiltonian.dfdu = sequence(inputDim, 1, 0.8);
+  dataPoint.hamiltonian.dfdxx = sequence(xDim, xDim, 0.9);
+  dataPoint.hamiltonian.dfdux = sequence(inputDim, xDim, 0.11);
+  dataPoint.hamiltonian.dfduu = sequence(inputDim, inputDim, 0.12);
+  return dataPoint;
+}
+
+/** Flattens a matrix row-major into a row. */
+vector_t rowMajor(const matrix_t& m) {
+  const Eigen::Matrix<scalar_t, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> r = m;
+  return Eigen::Map<const vector_t>(r.data(), r.size());
+}
+
+/** Checks that row i of the buffer holds the given data point. */
+void expectDataPoint(const DataBuffer& buffer, size_t i, const DataPoint& dataPoint) {
+  const auto row = static_cast<Eigen::Index>(i);
+  EXPECT_EQ(buffer.mode()(row), dataPoint.mode);
+  EXPECT_EQ(buffer.t()(row), dataPoint.t);
+  EXPECT_TRUE(buffer.x().row(row).transpose().isApprox(dataPoint.x));
+  EXPECT_TRUE(buffer.u().row(row).transpose().isApprox(dataPoint.u));
+  EXPECT_TRUE(buffer.observation().row(row).transpose().isApprox(dataPoint.observation));
+  EXPECT_TRUE(buffer.actionTransformationMatrix().row(row).transpose().isApprox(rowMajor(dataPoint.actionTransformation.first)));
+  EXPECT_TRUE(buffer.actionTransformationVector().row(row).transpose().isApprox(dataPoint.actionTransformation.second));
+  EXPECT_TRUE(buffer.dHdxx().row(row).transpose().isApprox(rowMajor(dataPoint.hamiltonian.dfdxx)));
+  EXPECT_TRUE(buffer.dHdux().row(row).transpose().isApprox(rowMajor(dataPoint.hamiltonian.dfdux)));
+  EXPECT_TRUE(buffer.dHduu().row(row).transpose().isApprox(rowMajor(dataPoint.hamiltonian.dfduu)));
+  EXPECT_TRUE(buffer.dHdx().row(row).transpose().isApprox(dataPoint.hamiltonian.dfdx));
+  EXPECT_TRUE(buffer.dHdu().row(row).transpose().isApprox(dataPoint.hamiltonian.dfdu));
+  EXPECT_EQ(buffer.H()(row), dataPoint.hamiltonian.f);
+}
+
+}  // unnamed namespace
+
+TEST(testDataBuffer, pushBack) {
+  DataBuffer buffer;
+  EXPECT_EQ(buffer.size(), 0);
+
+  // grows beyond the initial capacity
+  constexpr size_t numDataPoints = 100;
+  for (size_t i = 0; i < numDataPoints; i++) {
+    buffer.push_back(taggedDataPoint(i));
+  }
+  ASSERT_EQ(buffer.size(), numDataPoints);
+  EXPECT_GE(buffer.capacity(), numDataPoints);
+  EXPECT_EQ(buffer.getStateDim(), stateDim);
+  EXPECT_EQ(buffer.getInputDim(), inputDim);
+  EXPECT_EQ(buffer.getObservationDim(), observationDim);
+  EXPECT_EQ(buffer.getActionDim(), actionDim);
+  EXPECT_EQ(buffer.x().rows(), numDataPoints);
+  EXPECT_EQ(buffer.dHdux().cols(), inputDim * stateDim);
+  for (size_t i = 0; i < numDataPoints; i++) {
+    expectDataPoint(buffer, i, taggedDataPoint(i));
+  }
+
+  // a data point of other dimensions is rejected
+  EXPECT_THROW(buffer.push_back(taggedDataPoint(0, stateDim + 1)), std::runtime_error);
+  EXPECT_EQ(buffer.size(), numDataPoints);
+}
+
+TEST(testDataBuffer, append) {
+  DataBuffer buffer;
+  DataBuffer other;
+  buffer.push_back(taggedDataPoint(0));
+  for (size_t i = 1; i < 80; i++) {
+    other.push_back(taggedDataPoint(i));
+  }
+
+  buffer.append(other);
+  ASSERT_EQ(buffer.size(), 80);
+  for (size_t i = 0; i < 80; i++) {
+    expectDataPoint(buffer, i, taggedDataPoint(i));
+  }
+
+  // appending to an empty buffer takes over the dimensions, appending an empty buffer does nothing
+  DataBuffer empty;
+  empty.append(other);
+  EXPECT_EQ(empty.size(), other.size());
+  EXPECT_EQ(empty.getStateDim(), stateDim);
+  buffer.append(DataBuffer());
+  EXPECT_EQ(buffer.size(), 80);
+
+  // buffers of other dimensions are rejected
+  DataBuffer otherDimensions;
+  otherDimensions.push_back(taggedDataPoint(0, stateDim + 1));
+  EXPECT_THROW(buffer.append(otherDimensions), std::runtime_error);
+}
+
+TEST(testDataBuffer, truncateAndClear) {
+  DataBuffer buffer;
+  for (size_t i = 0; i < 10; i++) {
+    buffer.push_back(taggedDataPoint(i));
+  }
+
+  // truncating never grows the buffer
+  buffer.truncate(20);
+  EXPECT_EQ(buffer.size(), 10);
+  buffer.truncate(4);
+  ASSERT_EQ(buffer.size(), 4);
+  EXPECT_EQ(buffer.t().size(), 4);
+  EXPECT_EQ(buffer.dHdxx().rows(), 4);
+
+  // data points pushed after truncating overwrite the removed ones
+  buffer.push_back(taggedDataPoint(42));
+  ASSERT_EQ(buffer.size(), 5);
+  expectDataPoint(buffer, 3, taggedDataPoint(3));
+  expectDataPoint(buffer, 4, taggedDataPoint(42));
+
+  // clearing keeps the memory, also for data points of other dimensions
+  const size_t capacity = buffer.capacity();
+  const scalar_t* data = buffer.t().data();
+  buffer.clear();
+  EXPECT_EQ(buffer.size(), 0);
+  EXPECT_EQ(buffer.capacity(), capacity);
+  buffer.push_back(taggedDataPoint(7, stateDim + 1));
+  EXPECT_EQ(buffer.t().data(), data);
+  EXPECT_EQ(buffer.getStateDim(), stateDim + 1);
+  expectDataPoint(buffer, 0, taggedDataPoint(7, stateDim + 1));
+}
@@ -0,0 +1,356 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <set>
+#include <thread>
+
+#include <ocs2_core/control/FeedforwardController.h>
+#include <ocs2_oc/synchronized_module/ReferenceManager.h>
+
+#include "ocs2_mpcnet_core/rollout/MpcnetRolloutManager.h"
+
+using namespace ocs2;
+using namespace ocs2::mpcnet;
+
+namespace {
+
+constexpr size_t stateDim = 2;
+constexpr size_t inputDim = 1;
+
+/** A solver whose solution stays at the initial state with a zero input. */
+class ConstantSolver final : public SolverBase {
+ public:
+  void reset() override {}
+  const OptimalControlProblem& getOptimalControlProblem() const override { return problem_; }
+  const PerformanceIndex& getPerformanceIndeces() const override { return performanceIndex_; }
+  size_t getNumIterations() const override { return 1; }
+  const std::vector<PerformanceIndex>& getIterationsLog() const override { return iterationsLog_; }
+  scalar_t getFinalTime() const override { return primalSolution_.timeTrajectory_.back(); }
+  void getPrimalSolution(scalar_t finalTime, PrimalSolution* primalSolutionPtr) const override { *primalSolutionPtr = primalSolution_; }
+  const ProblemMetrics& getSolutionMetrics() const override { return problemMetrics_; }
+  ScalarFunctionQuadraticApproximation getValueFunction(scalar_t time, const vector_t& state) const override { return {}; }
+  ScalarFunctionQuadraticApproximation getHamiltonian(scalar_t time, const vector_t& state, const vector_t& input) override {
+    ScalarFunctionQuadraticApproximation hamiltonian;
+    hamiltonian.setZero(state.size(), input.size());
+    hamiltonian.f = time;
+    return hamiltonian;
+  }
+  vector_t getStateInputEqualityConstraintLagrangian(scalar_t time, const vector_t& state) const override { return {}; }
+  MultiplierCollection getIntermediateDualSolution(scalar_t time) const override { return {}; }
+
+ private:
+  void runImpl(scalar_t initTime, const vector_t& initState, scalar_t finalTime) override {
+    primalSolution_.timeTrajectory_ = {initTime, finalTime};
+    primalSolution_.stateTrajectory_ = {initState, initState};
+    primalSolution_.inputTrajectory_ = {vector_t::Zero(inputDim), vector_t::Zero(inputDim)};
+    primalSolution_.controllerPtr_.reset(new FeedforwardController(primalSolution_.timeTrajectory_, primalSolution_.inputTrajectory_));
+  }
+  void runImpl(scalar_t initTime, const vector_t& initState, scalar_t finalTime, const ControllerBase* externalControllerPtr) override {
+    runImpl(initTime, initState, finalTime);
+  }
+  void runImpl(scalar_t initTime, const vector_t& initState, scalar_t finalTime, const PrimalSolution& primalSolution) override {
+    runImpl(initTime, initState, finalTime);
+  }
+
+  OptimalControlProblem problem_;
+  PerformanceIndex performanceIndex_;
+  std::vector<PerformanceIndex> iterationsLog_;
+  ProblemMetrics problemMetrics_;
+  PrimalSolution primalSolution_;
+};
+
+class ConstantMpc final : public MPC_BASE {
+ public:
+  ConstantMpc() : MPC_BASE(mpc::Settings()) {}
+
+  ConstantSolver* getSolverPtr() override { return &solver_; }
+  const ConstantSolver* getSolverPtr() const override { return &solver_; }
+
+ protected:
+  void calculateController(scalar_t initTime, const vector_t& initState, scalar_t finalTime) override {
+    solver_.run(initTime, initState, finalTime);
+  }
+
+ private:
+  ConstantSolver solver_;
+};
+
+/** A learned policy with a zero input. */
+class ZeroPolicy final : public MpcnetControllerBase {
+ public:
+  ZeroPolicy* clone() const override { return new ZeroPolicy(*this); }
+  void loadPolicyModel(const std::string& policyFilePath) override {}
+  vector_t computeInput(scalar_t t, const vector_t& x) override { return vector_t::Zero(inputDim); }
+  void concatenate(const ControllerBase* otherController, int index, int length) override {}
+  int size() const override { return 0; }
+  ControllerType getType() const override { return ControllerType::ONNX; }
+  void clear() override {}
+  bool empty() const override { return false; }
+};
+
+/** A rollout which keeps the state constant. */
+class ConstantRollout final : public RolloutBase {
+ public:
+  ConstantRollout() : RolloutBase(rollout::Settings()) {}
+
+  ConstantRollout* clone() const override { return new ConstantRollout(*this); }
+
+  vector_t run(scalar_t initTime, const vector_t& initState, scalar_t finalTime, ControllerBase* controller, ModeSchedule& modeSchedule,
+               scalar_array_t& timeTrajectory, size_array_t& postEventIndices, vector_array_t& stateTrajectory,
+               vector_array_t& inputTrajectory) override {
+    timeTrajectory = {initTime, finalTime};
+    postEventIndices.clear();
+    stateTrajectory = {initState, initState};
+    const vector_t input = controller->computeInput(initTime, initState);
+    inputTrajectory = {input, input};
+    return initState;
+  }
+};
+
+/** Observes the state, the action is the input. */
+class StateDefinition final : public MpcnetDefinitionBase {
+ public:
+  vector_t getObservation(scalar_t t, const vector_t& x, const ModeSchedule& modeSchedule,
+                          const TargetTrajectories& targetTrajectories) override {
+    return x;
+  }
+  std::pair<matrix_t, vector_t> getActionTransformation(scalar_t t, const vector_t& x, const ModeSchedule& modeSchedule,
+                                                        const TargetTrajectories& targetTrajectories) override {
+    return {matrix_t::Identity(inputDim, inputDim), vector_t::Zero(inputDim)};
+  }
+  bool isValid(scalar_t t, const vector_t& x, const ModeSchedule& modeSchedule, const TargetTrajectories& targetTrajectories) override {
+    return true;
+  }
+};
+
+std::unique_ptr<MpcnetRolloutManager> createRolloutManager(size_t nDataGenerationThreads) {
+  std::vector<std::unique_ptr<MPC_BASE>> mpcPtrs;
+  std::vector<std::unique_ptr<MpcnetControllerBase>> mpcnetPtrs;
+  std::vector<std::unique_ptr<RolloutBase>> rolloutPtrs;
+  std::vector<std::shared_ptr<MpcnetDefinitionBase>> mpcnetDefinitionPtrs;
+  std::vector<std::shared_ptr<ReferenceManagerInterface>> referenceManagerPtrs;
+  for (size_t i = 0; i < nDataGenerationThreads; i++) {
+    mpcPtrs.emplace_back(new ConstantMpc());
+    mpcnetPtrs.emplace_back(new ZeroPolicy());
+    rolloutPtrs.emplace_back(new ConstantRollout());
+    mpcnetDefinitionPtrs.emplace_back(new StateDefinition());
+    referenceManagerPtrs.emplace_back(new ReferenceManager());
+  }
+  return std::make_unique<MpcnetRolloutManager>(nDataGenerationThreads, 0, std::move(mpcPtrs), std::move(mpcnetPtrs),
+                                                std::move(rolloutPtrs), std::move(mpcnetDefinitionPtrs), std::move(referenceManagerPtrs));
+}
+
+/** Episodes which start at the given states and run from t = 0 to t = 0.25 with a time step of 0.1, i.e. three data points each. */
+struct Episodes {
+  explicit Episodes(const std::vector<scalar_t>& initialStates) {
+    for (const auto initialState : initialStates) {
+      SystemObservation observation;
+      observation.state = vector_t::Constant(stateDim, initialState);
+      observation.input = vector_t::Zero(inputDim);
+      initialObservations.push_back(observation);
+      modeSchedules.emplace_back();
+      targetTrajectories.emplace_back(scalar_array_t{0.0, 0.25}, vector_array_t(2, vector_t::Zero(stateDim)),
+                                      vector_array_t(2, vector_t::Zero(inputDim)));
+    }
+  }
+
+  const scalar_t alpha = 1.0;
+  const scalar_t timeStep = 0.1;
+  const size_t dataDecimation = 1;
+  const size_t nSamples = 0;
+  const matrix_t samplingCovariance = matrix_t::Identity(stateDim, stateDim);
+  std::vector<SystemObservation> initialObservations;
+  std::vector<ModeSchedule> modeSchedules;
+  std::vector<TargetTrajectories> targetTrajectories;
+};
+
+std::shared_ptr<DataBuffer> generateData(MpcnetRolloutManager& rolloutManager, const Episodes& episodes) {
+  rolloutManager.startDataGeneration(episodes.alpha, "", episodes.timeStep, episodes.dataDecimation, episodes.nSamples,
+                                     episodes.samplingCovariance, episodes.initialObservations, episodes.modeSchedules,
+                                     episodes.targetTrajectories);
+  while (!rolloutManager.isDataGenerationDone()) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  return rolloutManager.getGeneratedData();
+}
+
+void setStreamEpisodes(MpcnetRolloutManager& rolloutManager, const Episodes& episodes) {
+  rolloutManager.setDataGenerationEpisodes(episodes.alpha, "", episodes.timeStep, episodes.dataDecimation, episodes.nSamples,
+                                           episodes.samplingCovariance, episodes.initialObservations, episodes.modeSchedules,
+                                           episodes.targetTrajectories);
+}
+
+/** Polls the stream until a chunk arrives, gives up after a few seconds. */
+std::shared_ptr<DataBuffer> popChunk(MpcnetRolloutManager& rolloutManager) {
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+  while (std::chrono::steady_clock::now() < deadline) {
+    if (auto chunk = rolloutManager.tryPopGeneratedData()) {
+      return chunk;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  return nullptr;
+}
+
+/** Sum of the states of all data points, the data of an episode starting at state s adds 3 * stateDim * s. */
+scalar_t stateSum(const DataBuffer& dataBuffer) {
+  return dataBuffer.x().sum();
+}
+
+}  // unnamed namespace
+
+TEST(testMpcnetRolloutManager, generatedDataStaysValidWhileHeld) {
+  auto rolloutManager = createRolloutManager(2);
+
+  // all data points of all episodes are gathered
+  auto firstData = generateData(*rolloutManager, Episodes({1.0, 2.0}));
+  ASSERT_EQ(firstData->size(), 6);
+  EXPECT_DOUBLE_EQ(stateSum(*firstData), 3.0 * stateDim * (1.0 + 2.0));
+  EXPECT_TRUE(firstData->observation().isApprox(firstData->x()));
+
+  // the next data does not overwrite the held one
+  auto secondData = generateData(*rolloutManager, Episodes({3.0}));
+  EXPECT_NE(secondData.get(), firstData.get());
+  ASSERT_EQ(secondData->size(), 3);
+  EXPECT_DOUBLE_EQ(stateSum(*secondData), 3.0 * stateDim * 3.0);
+  ASSERT_EQ(firstData->size(), 6);
+  EXPECT_DOUBLE_EQ(stateSum(*firstData), 3.0 * stateDim * (1.0 + 2.0));
+
+  // once released, the memory is reused
+  const DataBuffer* released = secondData.get();
+  firstData.reset();
+  secondData.reset();
+  auto thirdData = generateData(*rolloutManager, Episodes({4.0}));
+  EXPECT_EQ(thirdData.get(), released);
+  ASSERT_EQ(thirdData->size(), 3);
+  EXPECT_DOUBLE_EQ(stateSum(*thirdData), 3.0 * stateDim * 4.0);
+}
+
+TEST(testMpcnetRolloutManager, streamPreconditions) {
+  auto rolloutManager = createRolloutManager(1);
+  EXPECT_THROW(rolloutManager->tryPopGeneratedData(), std::runtime_error);
+  EXPECT_THROW(rolloutManager->startDataGenerationStream(1), std::runtime_error);
+  EXPECT_THROW(setStreamEpisodes(*rolloutManager, Episodes({})), std::runtime_error);
+
+  setStreamEpisodes(*rolloutManager, Episodes({1.0}));
+  rolloutManager->startDataGenerationStream(1);
+  EXPECT_TRUE(rolloutManager->isDataGenerationStreaming());
+  EXPECT_THROW(rolloutManager->startDataGenerationStream(1), std::runtime_error);
+  const Episodes episodes({1.0});
+  EXPECT_THROW(rolloutManager->startDataGeneration(episodes.alpha, "", episodes.timeStep, episodes.dataDecimation, episodes.nSamples,
+                                                   episodes.samplingCovariance, episodes.initialObservations, episodes.modeSchedules,
+                                                   episodes.targetTrajectories),
+               std::runtime_error);
+  rolloutManager->stopDataGenerationStream();
+  EXPECT_FALSE(rolloutManager->isDataGenerationStreaming());
+}
+
+TEST(testMpcnetRolloutManager, streamEpisodes) {
+  auto rolloutManager = createRolloutManager(2);
+  setStreamEpisodes(*rolloutManager, Episodes({1.0, 2.0}));
+  rolloutManager->startDataGenerationStream(2);
+
+  // every chunk holds one episode, which are run round-robin
+  std::vector<size_t> numChunksPerEpisode(2, 0);
+  for (int i = 0; i < 20; i++) {
+    const auto chunk = popChunk(*rolloutManager);
+    ASSERT_NE(chunk, nullptr);
+    ASSERT_EQ(chunk->size(), 3);
+    const scalar_t initialState = chunk->x()(0, 0);
+    ASSERT_TRUE(initialState == 1.0 || initialState == 2.0);
+    EXPECT_TRUE((chunk->x().array() == initialState).all());
+    ++numChunksPerEpisode[initialState == 1.0 ? 0 : 1];
+  }
+  EXPECT_GT(numChunksPerEpisode[0], 0);
+  EXPECT_GT(numChunksPerEpisode[1], 0);
+
+  // new episodes are picked up while streaming
+  setStreamEpisodes(*rolloutManager, Episodes({3.0}));
+  bool isNewEpisodeReceived = false;
+  for (int i = 0; i < 20 && !isNewEpisodeReceived; i++) {
+    const auto chunk = popChunk(*rolloutManager);
+    ASSERT_NE(chunk, nullptr);
+    isNewEpisodeReceived = chunk->x()(0, 0) == 3.0;
+  }
+  EXPECT_TRUE(isNewEpisodeReceived);
+
+  rolloutManager->stopDataGenerationStream();
+  EXPECT_FALSE(rolloutManager->isDataGenerationStreaming());
+}
+
+TEST(testMpcnetRolloutManager, streamRecyclesReleasedChunks) {
+  auto rolloutManager = createRolloutManager(1);
+  setStreamEpisodes(*rolloutManager, Episodes({1.0}));
+  rolloutManager->startDataGenerationStream(1);
+
+  // a held chunk is not overwritten
+  const auto heldChunk = popChunk(*rolloutManager);
+  ASSERT_NE(heldChunk, nullptr);
+  const DataBuffer::row_matrix_t heldState = heldChunk->x();
+  setStreamEpisodes(*rolloutManager, Episodes({2.0}));
+
+  // released chunks are reused, such that only a few chunks exist: one in the queue, one being filled and one just released
+  std::set<const DataBuffer*> chunks;
+  for (int i = 0; i < 50; i++) {
+    const auto chunk = popChunk(*rolloutManager);
+    ASSERT_NE(chunk, nullptr);
+    ASSERT_NE(chunk, heldChunk);
+    chunks.insert(chunk.get());
+  }
+  EXPECT_LE(chunks.size(), 4);
+  ASSERT_EQ(heldChunk->size(), 3);
+  EXPECT_TRUE(heldChunk->x() == heldState);
+
+  rolloutManager->stopDataGenerationStream();
+}
+
+TEST(testMpcnetRolloutManager, stopStreamWithFullQueue) {
+  auto rolloutManager = createRolloutManager(2);
+  setStreamEpisodes(*rolloutManager, Episodes({1.0}));
+  rolloutManager->startDataGenerationStream(1);
+
+  // both data generation threads end up blocked on the full queue, stopping releases them
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  rolloutManager->stopDataGenerationStream();
+  EXPECT_FALSE(rolloutManager->isDataGenerationStreaming());
+
+  // the chunk left in the queue can still be taken
+  const auto chunk = rolloutManager->tryPopGeneratedData();
+  ASSERT_NE(chunk, nullptr);
+  EXPECT_EQ(chunk->size(), 3);
+  EXPECT_EQ(rolloutManager->tryPopGeneratedData(), nullptr);
+
+  // the stream can be restarted
+  rolloutManager->startDataGenerationStream(1);
+  EXPECT_NE(popChunk(*rolloutManager), nullptr);
+  rolloutManager->stopDataGenerationStream();
+}
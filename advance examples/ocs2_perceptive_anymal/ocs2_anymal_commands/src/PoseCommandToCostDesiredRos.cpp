@@ -13,8 +13,8 @@ namespace switched_model
 
   PoseCommandToCostDesiredRos::PoseCommandToCostDesiredRos(const rclcpp::Node::SharedPtr &node, const std::string &configFile)
   {
-    boost::property_tree::ptree pt;
-    boost::property_tree::read_info(configFile, pt);
+    const auto ptPtr = ocs2::loadData::readInfoFile(configFile);
+    const auto &pt = *ptPtr;
     targetDisplacementVelocity = pt.get<scalar_t>("targetDisplacementVelocity");
     targetRotationVelocity = pt.get<scalar_t>("targetRotationVelocity");
     comHeight = pt.get<scalar_t>("comHeight");
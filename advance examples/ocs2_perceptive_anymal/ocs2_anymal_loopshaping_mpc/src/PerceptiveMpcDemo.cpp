@@ -220,7 +220,7 @@ int main(int argc, char* argv[]) {
                               .getSwitchedModelModeScheduleManagerPtr();
 
   // Register the terrain model
-  referenceManager->getTerrainModel().reset(std::move(terrainModel));
+  referenceManager->getTerrainModel().publish(std::move(terrainModel));
 
   // Register the gait
   referenceManager->getGaitSchedule()->setGaitSequenceAtTime(gaitSequence,
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <ocs2_core/misc/TelemetryLogger.h>
 #include <ocs2_mpc/SystemObservation.h>
 #include <ocs2_ros_interfaces/mrt/DummyObserver.h>
 
@@ -15,7 +16,8 @@ namespace switched_model {
 
 /**
  * Simple logger for Quadruped observations.
- * Logs a sequence of quadruped observations to a file. Has the option to log additional user-defined data.
+ * Streams a sequence of quadruped observations to a binary telemetry file, see ocs2::TelemetryLogger. Has the option to log additional
+ * user-defined data. Use ocs2_telemetry_converter to convert the file to CSV or NumPy.
  *
  * Can be either used stand-alone or as a dummy observer
  */
@@ -28,7 +30,7 @@ class QuadrupedLogger : public ocs2::DummyObserver {
                   std::vector<std::string> additionalColumns = {});
 
   /**
-   * The destructor writes the buffered log data to file.
+   * The destructor writes the remaining log data to file.
    */
   ~QuadrupedLogger() override;
 
@@ -53,13 +55,15 @@ class QuadrupedLogger : public ocs2::DummyObserver {
   static std::vector<std::string> namesPerLeg(const std::string& prefix, const std::vector<std::string>& postfixes);
 
  private:
-  std::string getLogHeader() const;
+  std::vector<std::string> getColumnNames() const;
   int getNumColumns() const;
 
   std::string logFileName_;
   std::vector<std::string> additionalColumns_;
 
-  std::vector<vector_t> buffer_;
+  std::unique_ptr<ocs2::TelemetryLogger> telemetryLoggerPtr_;  // nullptr if the file could not be opened
+  vector_t logEntry_;
+  scalar_t lastTime_;
 
   std::unique_ptr<kinematic_model_t> kinematicModel_;
   std::unique_ptr<com_model_t> comModel_;
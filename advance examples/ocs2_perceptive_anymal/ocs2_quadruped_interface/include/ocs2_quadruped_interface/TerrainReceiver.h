@@ -7,7 +7,7 @@
 #include "rclcpp/rclcpp.hpp"
 #include "rclcpp/publisher.hpp"
 
-#include <ocs2_core/thread_support/Synchronized.h>
+#include <ocs2_core/thread_support/VersionedSnapshot.h>
 #include <ocs2_oc/synchronized_module/SolverSynchronizedModule.h>
 
 #include <ocs2_switched_model_interface/terrain/TerrainModel.h>
@@ -16,9 +16,12 @@
 
 namespace switched_model {
 
+/**
+ * Owns the terrain pipeline, which processes the received terrains in the background and publishes them to the given terrain model.
+ */
 class TerrainReceiverSynchronizedModule : public ocs2::SolverSynchronizedModule {
  public:
-  TerrainReceiverSynchronizedModule(ocs2::Synchronized<TerrainModel>& terrainModel, const rclcpp::Node::SharedPtr &node);
+  TerrainReceiverSynchronizedModule(ocs2::VersionedSnapshot<TerrainModel>& terrainModel, const rclcpp::Node::SharedPtr &node);
   ~TerrainReceiverSynchronizedModule() override = default;
 
   void preSolverRun(scalar_t initTime, scalar_t finalTime, const vector_t& currentState,
@@ -27,7 +30,6 @@ class TerrainReceiverSynchronizedModule : public ocs2::SolverSynchronizedModule
   void postSolverRun(const ocs2::PrimalSolution& primalSolution) override{};
 
  private:
-  ocs2::Synchronized<TerrainModel>* terrainModelPtr_;
   std::unique_ptr<switched_model::SegmentedPlanesTerrainModelRos> segmentedPlanesRos_;
 };
 
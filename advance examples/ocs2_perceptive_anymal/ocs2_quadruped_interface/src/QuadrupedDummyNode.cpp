@@ -30,7 +30,7 @@ void quadrupedDummyNode(const rclcpp::Node::SharedPtr &node, const QuadrupedInte
       quadrupedInterface.getKinematicModel(), quadrupedInterface.getJointNames(), quadrupedInterface.getBaseName(), node);
 
   // Logging
-  std::string logFileName = "/tmp/ocs2/QuadrupedDummyNodeLog.txt";
+  std::string logFileName = "/tmp/ocs2/QuadrupedDummyNodeLog.bin";
   auto logger = std::make_shared<switched_model::QuadrupedLogger>(logFileName, quadrupedInterface.getKinematicModel(),
                                                                   quadrupedInterface.getComModel());
 
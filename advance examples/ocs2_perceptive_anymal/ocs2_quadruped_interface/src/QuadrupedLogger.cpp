@@ -4,7 +4,7 @@
 
 #include "ocs2_quadruped_interface/QuadrupedLogger.h"
 
-#include <fstream>
+#include <limits>
 
 #include <ocs2_switched_model_interface/core/MotionPhaseDefinition.h>
 #include <ocs2_switched_model_interface/core/Rotations.h>
@@ -17,59 +17,50 @@ QuadrupedLogger::QuadrupedLogger(std::string logFileName, const kinematic_model_
     : logFileName_(std::move(logFileName)),
       kinematicModel_(kinematicModel.clone()),
       comModel_(comModel.clone()),
-      additionalColumns_(std::move(additionalColumns)) {}
+      additionalColumns_(std::move(additionalColumns)),
+      logEntry_(getNumColumns()),
+      lastTime_(std::numeric_limits<scalar_t>::quiet_NaN()) {
+  try {
+    telemetryLoggerPtr_.reset(new ocs2::TelemetryLogger(logFileName_, getColumnNames()));
+  } catch (const std::runtime_error& error) {
+    std::cerr << "[QuadrupedLogger] Unable to open '" << logFileName_ << "'\n";
+  }
+}
 
 QuadrupedLogger::~QuadrupedLogger() {
-  Eigen::IOFormat CommaFmt(Eigen::StreamPrecision, Eigen::DontAlignCols, ", ", ", ", "", "", "", "");
-
-  if (std::ofstream logfile{logFileName_}) {
-    logfile << getLogHeader() << std::endl;
-    for (int i = 1; i < buffer_.size(); ++i) {
-      logfile << buffer_[i].transpose().format(CommaFmt) << ", \n";
-    }
+  if (telemetryLoggerPtr_ != nullptr) {
+    telemetryLoggerPtr_.reset();  // writes the remaining rows
     std::cerr << "[QuadrupedLogger] Log written to '" << logFileName_ << "'\n";
-  } else {
-    std::cerr << "[QuadrupedLogger] Unable to open '" << logFileName_ << "'\n";
   }
 }
 
-std::string QuadrupedLogger::getLogHeader() const {
-  std::string delim = ", ";
-  std::stringstream header;
+std::vector<std::string> QuadrupedLogger::getColumnNames() const {
   // clang-format off
-  header <<
-         "time" << delim <<
-         "contactflag_LF" << delim <<
-         "contactflag_RF" << delim <<
-         "contactflag_LH" << delim <<
-         "contactflag_RH" << delim <<
-         "base_positionInWorld_x" << delim <<
-         "base_positionInWorld_y" << delim <<
-         "base_positionInWorld_z" << delim <<
-         "base_quaternion_w" << delim <<
-         "base_quaternion_x" << delim <<
-         "base_quaternion_y" << delim <<
-         "base_quaternion_z" << delim <<
-         "base_linearvelocityInBase_x" << delim <<
-         "base_linearvelocityInBase_y" << delim <<
-         "base_linearvelocityInBase_z" << delim <<
-         "base_angularvelocityInBase_x" << delim <<
-         "base_angularvelocityInBase_y" << delim <<
-         "base_angularvelocityInBase_z" << delim;
+  std::vector<std::string> names{
+      "time",
+      "contactflag_LF",
+      "contactflag_RF",
+      "contactflag_LH",
+      "contactflag_RH",
+      "base_positionInWorld_x",
+      "base_positionInWorld_y",
+      "base_positionInWorld_z",
+      "base_quaternion_w",
+      "base_quaternion_x",
+      "base_quaternion_y",
+      "base_quaternion_z",
+      "base_linearvelocityInBase_x",
+      "base_linearvelocityInBase_y",
+      "base_linearvelocityInBase_z",
+      "base_angularvelocityInBase_x",
+      "base_angularvelocityInBase_y",
+      "base_angularvelocityInBase_z"};
   // clang-format on
-  for (const auto& name : namesPerLeg("jointAngle", {"HAA", "HFE", "KFE"})) {
-    header << name << delim;
-  }
-  for (const auto& name : namesPerLeg("jointVelocity", {"HAA", "HFE", "KFE"})) {
-    header << name << delim;
-  }
-  for (const auto& name : namesPerLeg("contactForcesInWorld", {"x", "y", "z"})) {
-    header << name << delim;
+  for (const auto& postfixedNames : {namesPerLeg("jointAngle", {"HAA", "HFE", "KFE"}), namesPerLeg("jointVelocity", {"HAA", "HFE", "KFE"}),
+                                     namesPerLeg("contactForcesInWorld", {"x", "y", "z"}), additionalColumns_}) {
+    names.insert(names.end(), postfixedNames.begin(), postfixedNames.end());
   }
-  for (const auto& name : additionalColumns_) {
-    header << name << delim;
-  }
-  return header.str();
+  return names;
 }
 
 int QuadrupedLogger::getNumColumns() const {
@@ -86,7 +77,7 @@ int QuadrupedLogger::getNumColumns() const {
 }
 
 void QuadrupedLogger::addLine(const ocs2::SystemObservation& observation, const vector_t& additionalColumns) {
-  if (!buffer_.empty() && observation.time == buffer_.back()[0]) {  // time is same as last one
+  if (telemetryLoggerPtr_ == nullptr || observation.time == lastTime_) {  // time is same as last one
     return;
   }
   comkino_state_t state(observation.state);
@@ -115,9 +106,8 @@ void QuadrupedLogger::addLine(const ocs2::SystemObservation& observation, const
   }
 
   // Fill log
-  vector_t logEntry(getNumColumns());
   // clang-format off
-  logEntry <<
+  logEntry_ <<
       observation.time,
       static_cast<double>(contactFlags[0]),
       static_cast<double>(contactFlags[1]),
@@ -139,7 +129,8 @@ void QuadrupedLogger::addLine(const ocs2::SystemObservation& observation, const
       additionalColumns;
   // clang-format on
 
-  buffer_.push_back(std::move(logEntry));
+  telemetryLoggerPtr_->append(logEntry_);
+  lastTime_ = observation.time;
 }
 
 std::vector<std::string> QuadrupedLogger::namesPerLeg(const std::string& prefix, const std::vector<std::string>& postfixes) {
@@ -6,16 +6,13 @@
 
 namespace switched_model {
 
-TerrainReceiverSynchronizedModule::TerrainReceiverSynchronizedModule(ocs2::Synchronized<TerrainModel>& terrainModel,
+TerrainReceiverSynchronizedModule::TerrainReceiverSynchronizedModule(ocs2::VersionedSnapshot<TerrainModel>& terrainModel,
                                                                      const rclcpp::Node::SharedPtr &node)
-    : terrainModelPtr_(&terrainModel), segmentedPlanesRos_(new switched_model::SegmentedPlanesTerrainModelRos(node)) {}
+    : segmentedPlanesRos_(new switched_model::SegmentedPlanesTerrainModelRos(node, terrainModel)) {}
 
 void TerrainReceiverSynchronizedModule::preSolverRun(scalar_t initTime, scalar_t finalTime, const vector_t& currentState,
                                                      const ocs2::ReferenceManagerInterface& referenceManager) {
-  if (auto newTerrain = segmentedPlanesRos_->getTerrainModel()) {
-    terrainModelPtr_->reset(std::move(newTerrain));
-    segmentedPlanesRos_->publish();
-  }
+  // Nothing to do, the terrain pipeline publishes finished terrains directly and the reference manager picks up the latest one
 }
 
 }  // namespace switched_model
\ No newline at end of file
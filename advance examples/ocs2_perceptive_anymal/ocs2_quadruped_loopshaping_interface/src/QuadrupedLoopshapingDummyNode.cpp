@@ -30,7 +30,7 @@ void quadrupedLoopshapingDummyNode(const rclcpp::Node::SharedPtr &node, const Qu
       quadrupedInterface.getKinematicModel(), quadrupedInterface.getJointNames(), quadrupedInterface.getBaseName(), node);
 
   // Logging
-  std::string logFileName = "/tmp/ocs2/QuadrupedLoopshapingDummyNodeLog.txt";
+  std::string logFileName = "/tmp/ocs2/QuadrupedLoopshapingDummyNodeLog.bin";
   auto logger = std::make_shared<switched_model::QuadrupedLogger>(logFileName, quadrupedInterface.getKinematicModel(),
                                                                   quadrupedInterface.getComModel());
 
@@ -59,8 +59,8 @@ namespace switched_model {
                                const KinematicsModelBase<scalar_t> &kinematicsModel,
                                const InverseKinematicsModelBase *inverseKinematicsModelPtr);
 
-        // Update terrain model
-        void updateTerrain(std::unique_ptr<TerrainModel> terrainModel);
+        // Update terrain model, the terrain is shared with its producer and is not modified
+        void updateTerrain(std::shared_ptr<const TerrainModel> terrainModel);
 
         // Access the SDF of the current terrain model
         const SignedDistanceField *getSignedDistanceField() const;
@@ -138,7 +138,7 @@ namespace switched_model {
 
         feet_array_t<std::vector<ConvexTerrain> > nominalFootholdsPerLeg_;
         feet_array_t<std::vector<vector3_t> > heuristicFootholdsPerLeg_;
-        std::unique_ptr<TerrainModel> terrainModel_;
+        std::shared_ptr<const TerrainModel> terrainModel_;
 
         ocs2::TargetTrajectories targetTrajectories_;
     };
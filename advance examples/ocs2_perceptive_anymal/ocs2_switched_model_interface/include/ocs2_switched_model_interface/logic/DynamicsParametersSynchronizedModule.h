@@ -1,6 +1,6 @@
 #pragma once
 
-#include <ocs2_core/thread_support/Synchronized.h>
+#include <ocs2_core/thread_support/VersionedSnapshot.h>
 #include <ocs2_oc/synchronized_module/SolverSynchronizedModule.h>
 
 #include "ocs2_switched_model_interface/dynamics/ComKinoDynamicsParameters.h"
@@ -16,9 +16,9 @@ class DynamicsParametersSynchronizedModule : public ocs2::SolverSynchronizedModu
 
   void postSolverRun(const ocs2::PrimalSolution& primalSolution) override{};
 
-  // Write-able access to dynamics parameters
-  ocs2::Synchronized<ComKinoSystemDynamicsParameters<scalar_t>>& getDynamicsParameters() { return newDynamicsParameters_; }
-  const ocs2::Synchronized<ComKinoSystemDynamicsParameters<scalar_t>>& getDynamicsParameters() const { return newDynamicsParameters_; }
+  // Publish new dynamics parameters here, they become active in the next MPC iteration
+  ocs2::VersionedSnapshot<ComKinoSystemDynamicsParameters<scalar_t>>& getDynamicsParameters() { return newDynamicsParameters_; }
+  const ocs2::VersionedSnapshot<ComKinoSystemDynamicsParameters<scalar_t>>& getDynamicsParameters() const { return newDynamicsParameters_; }
 
   // Read-only access to active dynamics parameters (Not thread safe while MPC is running!)
   const ComKinoSystemDynamicsParameters<scalar_t>& getActiveDynamicsParameters() const { return activeDynamicsParameters_; }
@@ -27,7 +27,8 @@ class DynamicsParametersSynchronizedModule : public ocs2::SolverSynchronizedModu
   //! Parameters active in the current MPC optimization
   ComKinoSystemDynamicsParameters<scalar_t> activeDynamicsParameters_;
   //! Updated externally, becomes active in next MPC iteration
-  ocs2::Synchronized<ComKinoSystemDynamicsParameters<scalar_t>> newDynamicsParameters_;
+  ocs2::VersionedSnapshot<ComKinoSystemDynamicsParameters<scalar_t>> newDynamicsParameters_;
+  uint64_t activeVersion_ = 0;
 };
 
 }  // namespace switched_model
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <ocs2_core/thread_support/Synchronized.h>
+#include <ocs2_core/thread_support/VersionedSnapshot.h>
 #include <ocs2_oc/synchronized_module/ReferenceManager.h>
 
 #include "ocs2_switched_model_interface/core/SwitchedModel.h"
@@ -28,8 +29,9 @@ class SwitchedModelModeScheduleManager : public ocs2::ReferenceManager {
 
   const SwingTrajectoryPlanner& getSwingTrajectoryPlanner() const { return *swingTrajectoryPtr_; }
 
-  ocs2::Synchronized<TerrainModel>& getTerrainModel() { return terrainModel_; }
-  const ocs2::Synchronized<TerrainModel>& getTerrainModel() const { return terrainModel_; }
+  /** Producers publish new terrains here, the latest version is picked up at the start of each solver run. */
+  ocs2::VersionedSnapshot<TerrainModel>& getTerrainModel() { return terrainModel_; }
+  const ocs2::VersionedSnapshot<TerrainModel>& getTerrainModel() const { return terrainModel_; }
 
  private:
   void modifyReferences(scalar_t initTime, scalar_t finalTime, const vector_t& initState, ocs2::TargetTrajectories& targetTrajectories,
@@ -37,7 +39,8 @@ class SwitchedModelModeScheduleManager : public ocs2::ReferenceManager {
 
   ocs2::Synchronized<GaitSchedule> gaitSchedule_;
   std::unique_ptr<SwingTrajectoryPlanner> swingTrajectoryPtr_;
-  ocs2::Synchronized<TerrainModel> terrainModel_;
+  ocs2::VersionedSnapshot<TerrainModel> terrainModel_;
+  uint64_t terrainVersion_ = 0;  // version of the terrain used by the swing trajectory planner
 };
 
 }  // namespace switched_model
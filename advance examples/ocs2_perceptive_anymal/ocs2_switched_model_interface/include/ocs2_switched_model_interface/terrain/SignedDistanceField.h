@@ -4,6 +4,9 @@
 
 #pragma once
 
+#include <tuple>
+#include <vector>
+
 #include "ocs2_switched_model_interface/core/SwitchedModel.h"
 
 namespace switched_model {
@@ -22,6 +25,21 @@ class SignedDistanceField {
   virtual scalar_t value(const vector3_t& position) const = 0;
   virtual Eigen::Vector3d derivative(const vector3_t& position) const = 0;
   virtual std::pair<scalar_t, vector3_t> valueAndDerivative(const vector3_t& position) const = 0;
+
+  /**
+   * Evaluates the value and derivative at a batch of positions. Implementations can override this to avoid a virtual call per query.
+   * @param [in] positions : query positions.
+   * @param [out] values : value at each position, resized to the number of positions.
+   * @param [out] derivatives : derivative at each position, resized to the number of positions.
+   */
+  virtual void valuesAndDerivatives(const std::vector<vector3_t>& positions, std::vector<scalar_t>& values,
+                                    std::vector<vector3_t>& derivatives) const {
+    values.resize(positions.size());
+    derivatives.resize(positions.size());
+    for (size_t i = 0; i < positions.size(); ++i) {
+      std::tie(values[i], derivatives[i]) = valueAndDerivative(positions[i]);
+    }
+  }
 };
 
 }  // namespace switched_model
\ No newline at end of file
@@ -0,0 +1,128 @@
+#pragma once
+
+#include <vector>
+
+#include "ocs2_switched_model_interface/core/SwitchedModel.h"
+#include "ocs2_switched_model_interface/terrain/SignedDistanceField.h"
+
+namespace switched_model {
+
+/**
+ * Truncated signed distance field of an elevation map, stored in a blocked memory layout.
+ *
+ * The 3D grid is split in cubic tiles of tileSize^3 points. The points of a tile are stored contiguously in Morton (Z-curve) order,
+ * such that the 8 neighbours used by the trilinear interpolation of a query are almost always within the same cache lines.
+ *
+ * Grid point (ix, iy, iz) is located at (origin.x + (ix + 0.5) * resolution, origin.y + (iy + 0.5) * resolution, minHeight + iz * resolution),
+ * i.e. the xy locations are the centers of the elevation map cells. Non-finite elevations are treated as free space.
+ *
+ * The distance in each layer is the minimum of the 2D Euclidean distance to the nearest cell of the other occupancy and the vertical
+ * distance to the terrain in the same cell. The field is truncated at +-truncationDistance. As a result, a change in elevation only affects
+ * the grid points within the truncation distance, which is used by update() to recompute only the changed region of the map.
+ */
+class TiledSignedDistanceField : public SignedDistanceField {
+ public:
+  using elevation_matrix_t = Eigen::MatrixXf;
+
+  /** Number of grid points along each edge of a tile (2^tileBits) */
+  static constexpr int tileBits = 3;
+  static constexpr int tileSize = 1 << tileBits;
+  static constexpr int tileVolume = tileSize * tileSize * tileSize;
+
+  /**
+   * Constructor
+   * @param [in] elevation : elevation of each map cell, indexed by (ix, iy).
+   * @param [in] origin : xy position of the corner of cell (0, 0).
+   * @param [in] resolution : size of a cell, also used as vertical spacing of the layers.
+   * @param [in] minHeight : height of the lowest layer.
+   * @param [in] maxHeight : the layers cover at least up to this height.
+   * @param [in] truncationDistance : the absolute value of the field is limited to this distance.
+   */
+  TiledSignedDistanceField(elevation_matrix_t elevation, const vector2_t& origin, scalar_t resolution, scalar_t minHeight,
+                           scalar_t maxHeight, scalar_t truncationDistance);
+
+  ~TiledSignedDistanceField() override = default;
+  TiledSignedDistanceField* clone() const override { return new TiledSignedDistanceField(*this); };
+
+  scalar_t value(const vector3_t& position) const override;
+
+  vector3_t derivative(const vector3_t& position) const override;
+
+  std::pair<scalar_t, vector3_t> valueAndDerivative(const vector3_t& position) const override;
+
+  void valuesAndDerivatives(const std::vector<vector3_t>& positions, std::vector<scalar_t>& values,
+                            std::vector<vector3_t>& derivatives) const override;
+
+  /**
+   * Updates the field to a new elevation map of the same size. Only the grid points within the truncation distance of a changed elevation
+   * cell are recomputed.
+   * @param [in] elevation : new elevation of each map cell.
+   * @return the number of recomputed grid points.
+   */
+  size_t update(const elevation_matrix_t& elevation);
+
+  const elevation_matrix_t& elevation() const { return elevation_; }
+  const vector2_t& origin() const { return origin_; }
+  scalar_t resolution() const { return resolution_; }
+  scalar_t minHeight() const { return minHeight_; }
+  scalar_t truncationDistance() const { return truncationDistance_; }
+  int sizeX() const { return sizeX_; }
+  int sizeY() const { return sizeY_; }
+  int sizeZ() const { return sizeZ_; }
+
+  /** Calls func(const vector3_t& position, float value) for every grid point. */
+  template <typename Func>
+  void forEachGridPoint(Func&& func) const {
+    for (int iz = 0; iz < sizeZ_; ++iz) {
+      for (int iy = 0; iy < sizeY_; ++iy) {
+        for (int ix = 0; ix < sizeX_; ++ix) {
+          const vector3_t position(origin_.x() + (ix + 0.5) * resolution_, origin_.y() + (iy + 0.5) * resolution_,
+                                   minHeight_ + iz * resolution_);
+          func(position, data_[dataIndex(ix, iy, iz)]);
+        }
+      }
+    }
+  }
+
+ protected:
+  TiledSignedDistanceField(const TiledSignedDistanceField& other);
+
+ private:
+  /** Half open range of map cells [xBegin, xEnd) x [yBegin, yEnd) */
+  struct Region {
+    int xBegin;
+    int xEnd;
+    int yBegin;
+    int yEnd;
+  };
+
+  /** Recomputes all layers of the given region. Returns the number of recomputed grid points. */
+  size_t computeRegion(const Region& region);
+
+  /** Trilinear interpolation of the field, the derivative is only evaluated if derivativePtr is not null. */
+  scalar_t interpolate(const vector3_t& position, vector3_t* derivativePtr) const;
+
+  size_t dataIndex(int ix, int iy, int iz) const {
+    const size_t tileIndex =
+        (static_cast<size_t>(iz >> tileBits) * numTilesY_ + static_cast<size_t>(iy >> tileBits)) * numTilesX_ + (ix >> tileBits);
+    return tileIndex * tileVolume + mortonCode(ix & (tileSize - 1), iy & (tileSize - 1), iz & (tileSize - 1));
+  }
+
+  /** Interleaves the bits of the local coordinates inside a tile */
+  static size_t mortonCode(int x, int y, int z) { return spreadBits(x) | (spreadBits(y) << 1) | (spreadBits(z) << 2); }
+  static size_t spreadBits(int v) { return (v & 1) | ((v & 2) << 2) | ((v & 4) << 4); }
+
+  elevation_matrix_t elevation_;
+  vector2_t origin_;
+  scalar_t resolution_;
+  scalar_t minHeight_;
+  scalar_t truncationDistance_;
+  int sizeX_;
+  int sizeY_;
+  int sizeZ_;
+  size_t numTilesX_;
+  size_t numTilesY_;
+  std::vector<float> data_;
+};
+
+}  // namespace switched_model
@@ -27,8 +27,8 @@ namespace switched_model {
     ModelSettings loadModelSettings(const std::string &filename, bool verbose) {
         ModelSettings modelSettings;
 
-        boost::property_tree::ptree pt;
-        read_info(filename, pt);
+        const auto ptPtr = ocs2::loadData::readInfoFile(filename);
+        const auto &pt = *ptPtr;
 
         const std::string prefix{"model_settings."};
 
@@ -68,26 +68,39 @@ namespace switched_model {
             const auto &collisionSpheres = switchedModelPreComp.collisionSpheresInOriginFrame();
             const auto &collisionSphereDerivatives = switchedModelPreComp.
                     collisionSpheresInOriginFrameStateDerivative();
+
+            // Query the distance field for all active spheres at once
+            std::vector<size_t> activeSphereIds;
+            std::vector<vector3_t> activeSpherePositions;
+            activeSphereIds.reserve(collisionSpheres.size());
+            activeSpherePositions.reserve(collisionSpheres.size());
             for (size_t i = 0; i < collisionSpheres.size(); ++i) {
                 if (collisionSpheresActive[i]) {
-                    const auto &collisionSphere = collisionSpheres[i];
-                    const auto &collisionSphereDerivative = collisionSphereDerivatives[i];
-                    const auto sdfFirstOrder = sdfPtr->valueAndDerivative(collisionSphere.position);
-                    const auto h_sdf = sdfFirstOrder.first - collisionSphere.radius;
-
-                    SingleLinearStateInequalitySoftConstraint linearStateInequalitySoftConstraint;
-                    linearStateInequalitySoftConstraint.penalty = penalty_.get();
-                    linearStateInequalitySoftConstraint.A = sdfFirstOrder.second.transpose();
-                    linearStateInequalitySoftConstraint.h = h_sdf;
-
-                    const auto targetcost = switched_model::getQuadraticApproximation(
-                        linearStateInequalitySoftConstraint, collisionSphere.position,
-                        collisionSphereDerivative);
-                    cost.f += targetcost.f;
-                    cost.dfdx += targetcost.dfdx;
-                    cost.dfdxx += targetcost.dfdxx;
+                    activeSphereIds.push_back(i);
+                    activeSpherePositions.push_back(collisionSpheres[i].position);
                 }
             }
+            std::vector<scalar_t> sdfValues;
+            std::vector<vector3_t> sdfDerivatives;
+            sdfPtr->valuesAndDerivatives(activeSpherePositions, sdfValues, sdfDerivatives);
+
+            for (size_t j = 0; j < activeSphereIds.size(); ++j) {
+                const auto &collisionSphere = collisionSpheres[activeSphereIds[j]];
+                const auto &collisionSphereDerivative = collisionSphereDerivatives[activeSphereIds[j]];
+                const auto h_sdf = sdfValues[j] - collisionSphere.radius;
+
+                SingleLinearStateInequalitySoftConstraint linearStateInequalitySoftConstraint;
+                linearStateInequalitySoftConstraint.penalty = penalty_.get();
+                linearStateInequalitySoftConstraint.A = sdfDerivatives[j].transpose();
+                linearStateInequalitySoftConstraint.h = h_sdf;
+
+                const auto targetcost = switched_model::getQuadraticApproximation(
+                    linearStateInequalitySoftConstraint, collisionSphere.position,
+                    collisionSphereDerivative);
+                cost.f += targetcost.f;
+                cost.dfdx += targetcost.dfdx;
+                cost.dfdxx += targetcost.dfdxx;
+            }
         }
 
         return cost;
@@ -105,8 +105,8 @@ namespace switched_model {
                                                     bool verbose) {
         MotionTrackingCost::Weights weights;
 
-        boost::property_tree::ptree pt;
-        read_info(filename, pt);
+        const auto ptPtr = ocs2::loadData::readInfoFile(filename);
+        const auto &pt = *ptPtr;
 
         if (verbose) {
             std::cerr << "\n #### Tacking Cost Weights:" << std::endl;
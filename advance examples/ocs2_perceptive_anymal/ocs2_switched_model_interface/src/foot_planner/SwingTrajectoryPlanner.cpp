@@ -29,7 +29,7 @@ namespace switched_model {
         }
     }
 
-    void SwingTrajectoryPlanner::updateTerrain(std::unique_ptr<TerrainModel> terrainModel) {
+    void SwingTrajectoryPlanner::updateTerrain(std::shared_ptr<const TerrainModel> terrainModel) {
         terrainModel_ = std::move(terrainModel);
     }
 
@@ -643,8 +643,8 @@ namespace switched_model {
     SwingTrajectoryPlannerSettings loadSwingTrajectorySettings(const std::string &filename, bool verbose) {
         SwingTrajectoryPlannerSettings settings{};
 
-        boost::property_tree::ptree pt;
-        boost::property_tree::read_info(filename, pt);
+        const auto ptPtr = ocs2::loadData::readInfoFile(filename);
+        const auto &pt = *ptPtr;
 
         const std::string prefix{"model_settings.swing_trajectory_settings."};
 
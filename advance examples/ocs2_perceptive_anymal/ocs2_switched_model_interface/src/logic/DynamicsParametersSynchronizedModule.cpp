@@ -4,14 +4,18 @@
 
 namespace switched_model {
     DynamicsParametersSynchronizedModule::DynamicsParametersSynchronizedModule()
-        : newDynamicsParameters_(std::make_unique<ComKinoSystemDynamicsParameters<scalar_t> >(
+        : newDynamicsParameters_(std::make_shared<const ComKinoSystemDynamicsParameters<scalar_t> >(
             activeDynamicsParameters_)) {
+        activeVersion_ = newDynamicsParameters_.version();
     }
 
     void DynamicsParametersSynchronizedModule::preSolverRun(scalar_t initTime, scalar_t finalTime,
                                                             const vector_t &initState,
                                                             const ocs2::ReferenceManagerInterface &referenceManager) {
-        auto lockedDynamicsParameterPtr = newDynamicsParameters_.lock();
-        activeDynamicsParameters_ = *lockedDynamicsParameterPtr; // Copy external parameters to the active parameter set
+        const auto dynamicsParameters = newDynamicsParameters_.pin();
+        if (dynamicsParameters && dynamicsParameters.version() != activeVersion_) {
+            activeDynamicsParameters_ = *dynamicsParameters; // Copy external parameters to the active parameter set
+            activeVersion_ = dynamicsParameters.version();
+        }
     }
 } // namespace switched_model
@@ -12,7 +12,7 @@ namespace switched_model {
                                                                        swingTrajectory,
                                                                        std::unique_ptr<TerrainModel> terrainModel)
         : gaitSchedule_(std::move(gaitSchedule)), swingTrajectoryPtr_(std::move(swingTrajectory)),
-          terrainModel_(std::move(terrainModel)) {
+          terrainModel_(std::shared_ptr<const TerrainModel>(std::move(terrainModel))) {
     }
 
     contact_flag_t SwitchedModelModeScheduleManager::getContactFlags(scalar_t time) const {
@@ -30,11 +30,13 @@ namespace switched_model {
                 timeHorizon + swingTrajectoryPtr_->settings().referenceExtensionAfterHorizon);
         }
 
-        // Transfer terrain ownership if a new terrain is available
-        std::unique_ptr<TerrainModel> newTerrain;
-        terrainModel_.swap(newTerrain); // Thread-safe swap with lockable Terrain
-        if (newTerrain) {
-            swingTrajectoryPtr_->updateTerrain(std::move(newTerrain));
+        // Share the latest terrain with the planner if a new version is published, the planner keeps it for the whole solver run
+        {
+            const auto terrain = terrainModel_.pin(); // wait-free, does not block the producer
+            if (terrain && terrain.version() != terrainVersion_) {
+                swingTrajectoryPtr_->updateTerrain(terrain.share());
+                terrainVersion_ = terrain.version();
+            }
         }
 
         // Prepare swing motions
@@ -10,8 +10,8 @@
 
 namespace switched_model {
     TerrainPlane loadTerrainPlane(const std::string &filename, bool verbose) {
-        boost::property_tree::ptree pt;
-        read_info(filename, pt);
+        const auto ptPtr = ocs2::loadData::readInfoFile(filename);
+        const auto &pt = *ptPtr;
 
         if (verbose) {
             std::cerr << "\n #### terrain plane:" << std::endl;
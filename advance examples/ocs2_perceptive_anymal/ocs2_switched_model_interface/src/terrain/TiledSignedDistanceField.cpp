@@ -0,0 +1,272 @@
+#include "ocs2_switched_model_interface/terrain/TiledSignedDistanceField.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace switched_model {
+    namespace {
+        // Finite "infinity" for the distance transform, avoids inf - inf in the parabola intersections.
+        constexpr scalar_t distanceTransformInfinity = 1e20;
+
+        /**
+         * 1D squared Euclidean distance transform of sampled functions (Felzenszwalb and Huttenlocher).
+         * Reads f[i * stride] and writes d[i * stride] for i in [0, n). v and z are scratch buffers of size n and n + 1.
+         */
+        void squaredDistanceTransform1d(const scalar_t *f, scalar_t *d, int n, int stride, std::vector<int> &v,
+                                        std::vector<scalar_t> &z) {
+            int k = 0;
+            v[0] = 0;
+            z[0] = -distanceTransformInfinity;
+            z[1] = distanceTransformInfinity;
+            for (int q = 1; q < n; ++q) {
+                // Intersection with the lower envelope, z[0] = -infinity guarantees termination
+                const auto intersection = [&](int p) {
+                    return ((f[q * stride] + q * q) - (f[p * stride] + p * p)) / (2.0 * (q - p));
+                };
+                scalar_t s = intersection(v[k]);
+                while (s <= z[k]) {
+                    --k;
+                    s = intersection(v[k]);
+                }
+                ++k;
+                v[k] = q;
+                z[k] = s;
+                z[k + 1] = distanceTransformInfinity;
+            }
+
+            k = 0;
+            for (int q = 0; q < n; ++q) {
+                while (z[k + 1] < q) {
+                    ++k;
+                }
+                const int p = v[k];
+                d[q * stride] = (q - p) * (q - p) + f[p * stride];
+            }
+        }
+
+        /**
+         * 2D squared distance (in cells) to the nearest cell with isTarget == true. Column major, size sizeX x sizeY.
+         */
+        void squaredDistanceTransform2d(const std::vector<bool> &isTarget, int sizeX, int sizeY, std::vector<scalar_t> &result,
+                                        std::vector<scalar_t> &buffer, std::vector<int> &v, std::vector<scalar_t> &z) {
+            const size_t numCells = static_cast<size_t>(sizeX) * sizeY;
+            buffer.resize(numCells);
+            result.resize(numCells);
+            for (size_t i = 0; i < numCells; ++i) {
+                buffer[i] = isTarget[i] ? 0.0 : distanceTransformInfinity;
+            }
+
+            // along x (contiguous), then along y
+            for (int iy = 0; iy < sizeY; ++iy) {
+                const size_t offset = static_cast<size_t>(iy) * sizeX;
+                squaredDistanceTransform1d(buffer.data() + offset, result.data() + offset, sizeX, 1, v, z);
+            }
+            for (int ix = 0; ix < sizeX; ++ix) {
+                squaredDistanceTransform1d(result.data() + ix, buffer.data() + ix, sizeY, sizeX, v, z);
+            }
+            result.swap(buffer);
+        }
+    } // namespace
+
+    TiledSignedDistanceField::TiledSignedDistanceField(elevation_matrix_t elevation, const vector2_t &origin,
+                                                       scalar_t resolution, scalar_t minHeight, scalar_t maxHeight,
+                                                       scalar_t truncationDistance)
+        : elevation_(std::move(elevation)),
+          origin_(origin),
+          resolution_(resolution),
+          minHeight_(minHeight),
+          truncationDistance_(truncationDistance),
+          sizeX_(elevation_.rows()),
+          sizeY_(elevation_.cols()),
+          sizeZ_(std::max(2, static_cast<int>(std::floor((maxHeight - minHeight) / resolution)) + 1)) {
+        if (resolution_ <= 0.0 || truncationDistance_ <= 0.0) {
+            throw std::runtime_error("[TiledSignedDistanceField] resolution and truncationDistance must be positive.");
+        }
+        if (sizeX_ < 2 || sizeY_ < 2) {
+            throw std::runtime_error("[TiledSignedDistanceField] the elevation map needs at least 2x2 cells.");
+        }
+
+        numTilesX_ = (sizeX_ + tileSize - 1) / tileSize;
+        numTilesY_ = (sizeY_ + tileSize - 1) / tileSize;
+        const size_t numTilesZ = (sizeZ_ + tileSize - 1) / tileSize;
+        data_.resize(numTilesX_ * numTilesY_ * numTilesZ * tileVolume, static_cast<float>(truncationDistance_));
+
+        computeRegion({0, sizeX_, 0, sizeY_});
+    }
+
+    TiledSignedDistanceField::TiledSignedDistanceField(const TiledSignedDistanceField &other)
+        : elevation_(other.elevation_),
+          origin_(other.origin_),
+          resolution_(other.resolution_),
+          minHeight_(other.minHeight_),
+          truncationDistance_(other.truncationDistance_),
+          sizeX_(other.sizeX_),
+          sizeY_(other.sizeY_),
+          sizeZ_(other.sizeZ_),
+          numTilesX_(other.numTilesX_),
+          numTilesY_(other.numTilesY_),
+          data_(other.data_) {
+    }
+
+    scalar_t TiledSignedDistanceField::value(const vector3_t &position) const {
+        return interpolate(position, nullptr);
+    }
+
+    vector3_t TiledSignedDistanceField::derivative(const vector3_t &position) const {
+        vector3_t derivative;
+        interpolate(position, &derivative);
+        return derivative;
+    }
+
+    std::pair<scalar_t, vector3_t> TiledSignedDistanceField::valueAndDerivative(const vector3_t &position) const {
+        vector3_t derivative;
+        const scalar_t value = interpolate(position, &derivative);
+        return {value, derivative};
+    }
+
+    void TiledSignedDistanceField::valuesAndDerivatives(const std::vector<vector3_t> &positions,
+                                                        std::vector<scalar_t> &values,
+                                                        std::vector<vector3_t> &derivatives) const {
+        values.resize(positions.size());
+        derivatives.resize(positions.size());
+        for (size_t i = 0; i < positions.size(); ++i) {
+            values[i] = interpolate(positions[i], &derivatives[i]);
+        }
+    }
+
+    size_t TiledSignedDistanceField::update(const elevation_matrix_t &elevation) {
+        if (elevation.rows() != sizeX_ || elevation.cols() != sizeY_) {
+            throw std::runtime_error("[TiledSignedDistanceField] update() requires an elevation map of the same size.");
+        }
+
+        // Bounding box of the changed cells
+        Region changed{sizeX_, 0, sizeY_, 0};
+        for (int iy = 0; iy < sizeY_; ++iy) {
+            for (int ix = 0; ix < sizeX_; ++ix) {
+                const float oldValue = elevation_(ix, iy);
+                const float newValue = elevation(ix, iy);
+                const bool bothNaN = std::isnan(oldValue) && std::isnan(newValue);
+                if (oldValue != newValue && !bothNaN) {
+                    changed.xBegin = std::min(changed.xBegin, ix);
+                    changed.xEnd = std::max(changed.xEnd, ix + 1);
+                    changed.yBegin = std::min(changed.yBegin, iy);
+                    changed.yEnd = std::max(changed.yEnd, iy + 1);
+                }
+            }
+        }
+        elevation_ = elevation;
+
+        if (changed.xBegin >= changed.xEnd) {
+            return 0;
+        }
+
+        // Grid points within the truncation distance of a changed cell are affected
+        const int margin = static_cast<int>(std::ceil(truncationDistance_ / resolution_)) + 1;
+        const Region affected{
+            std::max(0, changed.xBegin - margin), std::min(sizeX_, changed.xEnd + margin),
+            std::max(0, changed.yBegin - margin), std::min(sizeY_, changed.yEnd + margin)
+        };
+        return computeRegion(affected);
+    }
+
+    size_t TiledSignedDistanceField::computeRegion(const Region &region) {
+        // The distances of the region only depend on the cells within the truncation distance
+        const int margin = static_cast<int>(std::ceil(truncationDistance_ / resolution_)) + 1;
+        const Region window{
+            std::max(0, region.xBegin - margin), std::min(sizeX_, region.xEnd + margin),
+            std::max(0, region.yBegin - margin), std::min(sizeY_, region.yEnd + margin)
+        };
+        const int windowSizeX = window.xEnd - window.xBegin;
+        const int windowSizeY = window.yEnd - window.yBegin;
+        const size_t numWindowCells = static_cast<size_t>(windowSizeX) * windowSizeY;
+
+        std::vector<scalar_t> heights(numWindowCells);
+        for (int iy = 0; iy < windowSizeY; ++iy) {
+            for (int ix = 0; ix < windowSizeX; ++ix) {
+                const float h = elevation_(window.xBegin + ix, window.yBegin + iy);
+                heights[iy * windowSizeX + ix] = std::isfinite(h) ? h : -std::numeric_limits<scalar_t>::infinity();
+            }
+        }
+
+        std::vector<bool> isObstacle(numWindowCells);
+        std::vector<bool> isFree(numWindowCells);
+        std::vector<scalar_t> squaredDistanceToObstacle;
+        std::vector<scalar_t> squaredDistanceToFree;
+        std::vector<scalar_t> buffer;
+        std::vector<int> v(std::max(windowSizeX, windowSizeY));
+        std::vector<scalar_t> z(std::max(windowSizeX, windowSizeY) + 1);
+
+        for (int iz = 0; iz < sizeZ_; ++iz) {
+            const scalar_t layerHeight = minHeight_ + iz * resolution_;
+            for (size_t i = 0; i < numWindowCells; ++i) {
+                isObstacle[i] = heights[i] >= layerHeight;
+                isFree[i] = !isObstacle[i];
+            }
+            squaredDistanceTransform2d(isObstacle, windowSizeX, windowSizeY, squaredDistanceToObstacle, buffer, v, z);
+            squaredDistanceTransform2d(isFree, windowSizeX, windowSizeY, squaredDistanceToFree, buffer, v, z);
+
+            for (int iy = region.yBegin; iy < region.yEnd; ++iy) {
+                for (int ix = region.xBegin; ix < region.xEnd; ++ix) {
+                    const size_t i = (iy - window.yBegin) * windowSizeX + (ix - window.xBegin);
+                    // Distances are measured to the border between the cells, hence the half cell offset
+                    scalar_t distance;
+                    if (isObstacle[i]) {
+                        const scalar_t horizontal = (std::sqrt(squaredDistanceToFree[i]) - 0.5) * resolution_;
+                        distance = -std::min(horizontal, heights[i] - layerHeight);
+                    } else {
+                        const scalar_t horizontal = (std::sqrt(squaredDistanceToObstacle[i]) - 0.5) * resolution_;
+                        distance = std::min(horizontal, layerHeight - heights[i]);
+                    }
+                    data_[dataIndex(ix, iy, iz)] = static_cast<float>(
+                        std::max(-truncationDistance_, std::min(distance, truncationDistance_)));
+                }
+            }
+        }
+
+        return static_cast<size_t>(region.xEnd - region.xBegin) * (region.yEnd - region.yBegin) * sizeZ_;
+    }
+
+    scalar_t TiledSignedDistanceField::interpolate(const vector3_t &position, vector3_t *derivativePtr) const {
+        // Continuous grid coordinates, clamped to the grid
+        const scalar_t gx = std::max(0.0, std::min((position.x() - origin_.x()) / resolution_ - 0.5, sizeX_ - 1.0));
+        const scalar_t gy = std::max(0.0, std::min((position.y() - origin_.y()) / resolution_ - 0.5, sizeY_ - 1.0));
+        const scalar_t gz = std::max(0.0, std::min((position.z() - minHeight_) / resolution_, sizeZ_ - 1.0));
+
+        const int ix = std::min(static_cast<int>(gx), sizeX_ - 2);
+        const int iy = std::min(static_cast<int>(gy), sizeY_ - 2);
+        const int iz = std::min(static_cast<int>(gz), sizeZ_ - 2);
+        const scalar_t tx = gx - ix;
+        const scalar_t ty = gy - iy;
+        const scalar_t tz = gz - iz;
+
+        const scalar_t v000 = data_[dataIndex(ix, iy, iz)];
+        const scalar_t v100 = data_[dataIndex(ix + 1, iy, iz)];
+        const scalar_t v010 = data_[dataIndex(ix, iy + 1, iz)];
+        const scalar_t v110 = data_[dataIndex(ix + 1, iy + 1, iz)];
+        const scalar_t v001 = data_[dataIndex(ix, iy, iz + 1)];
+        const scalar_t v101 = data_[dataIndex(ix + 1, iy, iz + 1)];
+        const scalar_t v011 = data_[dataIndex(ix, iy + 1, iz + 1)];
+        const scalar_t v111 = data_[dataIndex(ix + 1, iy + 1, iz + 1)];
+
+        // Interpolate along x
+        const scalar_t v00 = v000 + tx * (v100 - v000);
+        const scalar_t v10 = v010 + tx * (v110 - v010);
+        const scalar_t v01 = v001 + tx * (v101 - v001);
+        const scalar_t v11 = v011 + tx * (v111 - v011);
+        // along y
+        const scalar_t v0 = v00 + ty * (v10 - v00);
+        const scalar_t v1 = v01 + ty * (v11 - v01);
+
+        if (derivativePtr != nullptr) {
+            const scalar_t dx0 = (1.0 - ty) * (v100 - v000) + ty * (v110 - v010);
+            const scalar_t dx1 = (1.0 - ty) * (v101 - v001) + ty * (v111 - v011);
+            derivativePtr->x() = ((1.0 - tz) * dx0 + tz * dx1) / resolution_;
+            derivativePtr->y() = ((1.0 - tz) * (v10 - v00) + tz * (v11 - v01)) / resolution_;
+            derivativePtr->z() = (v1 - v0) / resolution_;
+        }
+
+        return v0 + tz * (v1 - v0);
+    }
+} // namespace switched_model
@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+
+#include "ocs2_switched_model_interface/terrain/TiledSignedDistanceField.h"
+
+using namespace switched_model;
+
+namespace {
+const scalar_t resolution = 0.05;
+const scalar_t truncationDistance = 0.3;
+const vector2_t origin{-1.0, -1.0};
+
+TiledSignedDistanceField::elevation_matrix_t getStepElevation(int size, scalar_t stepHeight) {
+  TiledSignedDistanceField::elevation_matrix_t elevation = TiledSignedDistanceField::elevation_matrix_t::Zero(size, size);
+  elevation.bottomRows(size / 2).setConstant(stepHeight);
+  return elevation;
+}
+}  // namespace
+
+TEST(TestTiledSignedDistanceField, flatTerrain) {
+  const TiledSignedDistanceField::elevation_matrix_t elevation = TiledSignedDistanceField::elevation_matrix_t::Zero(40, 40);
+  const TiledSignedDistanceField sdf(elevation, origin, resolution, -0.5, 0.5, truncationDistance);
+
+  for (const scalar_t height : {-0.2, -0.05, 0.0, 0.1, 0.25}) {
+    const vector3_t position{0.1, 0.2, height};
+    const auto valueAndDerivative = sdf.valueAndDerivative(position);
+    EXPECT_NEAR(valueAndDerivative.first, height, 1e-6);
+    EXPECT_TRUE(valueAndDerivative.second.isApprox(vector3_t::UnitZ(), 1e-6));
+  }
+
+  // Truncated far away from the terrain
+  EXPECT_NEAR(sdf.value({0.0, 0.0, 0.45}), truncationDistance, 1e-6);
+  EXPECT_NEAR(sdf.value({0.0, 0.0, -0.45}), -truncationDistance, 1e-6);
+}
+
+TEST(TestTiledSignedDistanceField, stepTerrain) {
+  const int size = 40;
+  const scalar_t stepHeight = 0.2;
+  const TiledSignedDistanceField sdf(getStepElevation(size, stepHeight), origin, resolution, -0.5, 0.5, truncationDistance);
+
+  // In front of the step face, the distance is measured horizontally
+  const scalar_t stepX = origin.x() + (size / 2) * resolution;
+  const vector3_t inFrontOfStep{stepX - 0.1, 0.0, 0.15};
+  EXPECT_NEAR(sdf.value(inFrontOfStep), 0.1, 1e-6);
+  EXPECT_NEAR(sdf.derivative(inFrontOfStep).x(), -1.0, 1e-6);
+
+  // On top of the step
+  EXPECT_NEAR(sdf.value({stepX + 0.2, 0.0, stepHeight + 0.1}), 0.1, 1e-6);
+}
+
+TEST(TestTiledSignedDistanceField, batchedQueries) {
+  const TiledSignedDistanceField sdf(getStepElevation(40, 0.2), origin, resolution, -0.5, 0.5, truncationDistance);
+
+  std::vector<vector3_t> positions;
+  for (int i = 0; i < 100; ++i) {
+    positions.emplace_back(vector3_t::Random());
+  }
+
+  std::vector<scalar_t> values;
+  std::vector<vector3_t> derivatives;
+  sdf.valuesAndDerivatives(positions, values, derivatives);
+
+  ASSERT_EQ(values.size(), positions.size());
+  ASSERT_EQ(derivatives.size(), positions.size());
+  for (size_t i = 0; i < positions.size(); ++i) {
+    const auto valueAndDerivative = sdf.valueAndDerivative(positions[i]);
+    EXPECT_DOUBLE_EQ(values[i], valueAndDerivative.first);
+    EXPECT_TRUE(derivatives[i].isApprox(valueAndDerivative.second));
+  }
+}
+
+TEST(TestTiledSignedDistanceField, derivativeFiniteDifference) {
+  const TiledSignedDistanceField sdf(getStepElevation(40, 0.2), origin, resolution, -0.5, 0.5, truncationDistance);
+
+  const scalar_t eps = 1e-7;
+  for (int i = 0; i < 100; ++i) {
+    // inside the grid, where the interpolation is not clamped
+    const vector3_t position = vector3_t(0.9, 0.9, 0.4).cwiseProduct(vector3_t::Random());
+    const auto valueAndDerivative = sdf.valueAndDerivative(position);
+    for (int j = 0; j < 3; ++j) {
+      const vector3_t perturbedPosition = position + eps * vector3_t::Unit(j);
+      const scalar_t finiteDifference = (sdf.value(perturbedPosition) - valueAndDerivative.first) / eps;
+      EXPECT_NEAR(valueAndDerivative.second[j], finiteDifference, 1e-4);
+    }
+  }
+}
+
+TEST(TestTiledSignedDistanceField, incrementalUpdate) {
+  const int size = 60;
+  TiledSignedDistanceField::elevation_matrix_t elevation = getStepElevation(size, 0.2);
+  TiledSignedDistanceField sdf(elevation, origin, resolution, -0.5, 0.5, truncationDistance);
+
+  // Unchanged map does not recompute anything
+  EXPECT_EQ(sdf.update(elevation), 0);
+
+  // Add a block in a corner
+  elevation.block(2, 2, 4, 4).setConstant(0.4);
+  const size_t numRecomputed = sdf.update(elevation);
+  const TiledSignedDistanceField sdfFromScratch(elevation, origin, resolution, -0.5, 0.5, truncationDistance);
+
+  EXPECT_GT(numRecomputed, 0);
+  EXPECT_LT(numRecomputed, static_cast<size_t>(size * size * sdf.sizeZ()));
+
+  sdf.forEachGridPoint([&](const vector3_t& position, float value) { ASSERT_NEAR(value, sdfFromScratch.value(position), 1e-6); });
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <functional>
+#include <vector>
+
+#include <ocs2_switched_model_interface/core/SwitchedModel.h>
+
+#include <convex_plane_decomposition/PlanarRegion.h>
+#include <convex_plane_decomposition/SegmentedPlaneProjection.h>
+
+namespace switched_model {
+
+/**
+ * Spatial index over the planar regions of a terrain, used to find the best planar region for a query position.
+ *
+ * The world-frame xy bounding boxes of the regions are stored in a uniform grid. A query visits the grid cells in rings of increasing
+ * distance around the query position and only projects onto regions whose lower bound on the cost is below the best cost found so far.
+ * The search stops as soon as the unvisited cells are further away than the best cost. The result is the same as
+ * convex_plane_decomposition::getBestPlanarRegionAtPositionInWorld, under the same assumption that the penalty function is non-negative.
+ *
+ * The index is built once per terrain and is immutable afterwards, such that it can be queried concurrently.
+ */
+class PlanarRegionIndex {
+ public:
+  /**
+   * Constructor
+   * @param [in] planarRegions : regions to index, the index keeps pointers to the regions, they must outlive the index.
+   */
+  explicit PlanarRegionIndex(const std::vector<convex_plane_decomposition::PlanarRegion>& planarRegions);
+
+  /** Finds the planar region with the lowest squared distance + penalty. The returned regionPtr is nullptr if there are no regions. */
+  convex_plane_decomposition::PlanarTerrainProjection getBestPlanarRegionAtPositionInWorld(
+      const vector3_t& positionInWorld, const std::function<scalar_t(const vector3_t&)>& penaltyFunction) const;
+
+ private:
+  struct RegionInfo {
+    const convex_plane_decomposition::PlanarRegion* regionPtr;
+    Eigen::Isometry3d transformWorldToPlane;
+    // Bounding box of the region in the plane frame
+    vector2_t minInPlane;
+    vector2_t maxInPlane;
+    // Bounding box of the region in world xy
+    vector2_t minInWorld;
+    vector2_t maxInWorld;
+    // Range of grid cells overlapped by the world bounding box
+    int cellMinX;
+    int cellMaxX;
+    int cellMinY;
+    int cellMaxY;
+  };
+
+  /** Lower bound on the cost of projecting positionInWorld onto the region. Also returns the position in the plane frame. */
+  static scalar_t costLowerBound(const RegionInfo& regionInfo, const vector3_t& positionInWorld, vector3_t& positionInPlane);
+
+  int cellIndexX(scalar_t x) const;
+  int cellIndexY(scalar_t y) const;
+
+  std::vector<RegionInfo> regions_;
+
+  vector2_t origin_;
+  scalar_t cellSize_;
+  int sizeX_;
+  int sizeY_;
+  // Regions overlapping cell (ix, iy) are cellRegions_[cellStart_[i]] ... cellRegions_[cellStart_[i + 1] - 1], with i = iy * sizeX_ + ix.
+  std::vector<int> cellStart_;
+  std::vector<int> cellRegions_;
+};
+
+}  // namespace switched_model
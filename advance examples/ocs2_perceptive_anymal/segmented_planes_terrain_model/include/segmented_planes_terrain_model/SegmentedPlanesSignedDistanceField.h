@@ -4,59 +4,56 @@
 
 #pragma once
 
-#include <ocs2_switched_model_interface/terrain/SignedDistanceField.h>
+#include <ocs2_switched_model_interface/terrain/TiledSignedDistanceField.h>
 
-#include <grid_map_sdf/SignedDistanceField.hpp>
+#include <grid_map_core/GridMap.hpp>
 
 namespace switched_model {
 
 /**
- * Simple wrapper class to implement the switched_model::SignedDistanceField
- * interface. See the forwarded function for documentation.
+ * Signed distance field of the elevation layer of a grid map. The field is stored and queried through TiledSignedDistanceField; this class
+ * converts from the grid map (circular buffer, x and y decreasing with the index) to the regular grid of TiledSignedDistanceField.
  */
-class SegmentedPlanesSignedDistanceField : public SignedDistanceField {
+class SegmentedPlanesSignedDistanceField : public TiledSignedDistanceField {
  public:
   EIGEN_MAKE_ALIGNED_OPERATOR_NEW
 
   SegmentedPlanesSignedDistanceField(const grid_map::GridMap& gridMap,
                                      const std::string& elevationLayer,
-                                     double minHeight, double maxHeight)
-      : gridMap_(gridMap) {
-    sdf_.calculateSignedDistanceField(gridMap_, elevationLayer, maxHeight);
-  }
+                                     double minHeight, double maxHeight,
+                                     double truncationDistance = 0.5);
 
   ~SegmentedPlanesSignedDistanceField() override = default;
   SegmentedPlanesSignedDistanceField* clone() const override {
     return new SegmentedPlanesSignedDistanceField(*this);
   };
 
-  switched_model::scalar_t value(
-      const switched_model::vector3_t& position) const override {
-    return sdf_.getDistanceAt(position);
-  }
+  /** Whether updateFromGridMap() can be used with this map, i.e. the map covers the same cells and the height range is the same */
+  bool isCompatible(const grid_map::GridMap& gridMap, double minHeight,
+                    double maxHeight) const;
 
-  switched_model::vector3_t derivative(
-      const switched_model::vector3_t& position) const override {
-    return sdf_.getDistanceGradientAt(position);
-  }
+  /**
+   * Incrementally updates the field to a new elevation layer of a compatible grid map. Only the region around changed cells is recomputed.
+   * @return the number of recomputed grid points.
+   */
+  size_t updateFromGridMap(const grid_map::GridMap& gridMap,
+                           const std::string& elevationLayer);
 
-  std::pair<switched_model::scalar_t, switched_model::vector3_t>
-  valueAndDerivative(const switched_model::vector3_t& position) const override {
-    return {value(position), derivative(position)};
-  }
-
-  grid_map::SignedDistanceField& asGridmapSdf() { return sdf_; }
-  const grid_map::SignedDistanceField& asGridmapSdf() const { return sdf_; }
-  const grid_map::GridMap& gridMap() const {return gridMap_; } 
+  const std::string& frameId() const { return frameId_; }
+  grid_map::Time timestamp() const { return timestamp_; }
 
  protected:
   SegmentedPlanesSignedDistanceField(
       const SegmentedPlanesSignedDistanceField& other)
-      : sdf_(other.sdf_){};
+      : TiledSignedDistanceField(other),
+        maxHeight_(other.maxHeight_),
+        frameId_(other.frameId_),
+        timestamp_(other.timestamp_){};
 
  private:
-  grid_map::SignedDistanceField sdf_;
-  grid_map::GridMap gridMap_;
+  double maxHeight_;
+  std::string frameId_;
+  grid_map::Time timestamp_;
 };
 
 }  // namespace switched_model
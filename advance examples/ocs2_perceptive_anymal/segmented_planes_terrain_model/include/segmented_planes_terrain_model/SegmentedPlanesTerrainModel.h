@@ -8,6 +8,7 @@
 
 #include <convex_plane_decomposition/PlanarRegion.h>
 
+#include "segmented_planes_terrain_model/PlanarRegionIndex.h"
 #include "segmented_planes_terrain_model/SegmentedPlanesSignedDistanceField.h"
 
 namespace switched_model {
@@ -23,7 +24,15 @@ class SegmentedPlanesTerrainModel : public switched_model::TerrainModel {
   ConvexTerrain getConvexTerrainAtPositionInWorld(const vector3_t& positionInWorld,
                                                   std::function<scalar_t(const vector3_t&)> penaltyFunction) const override;
 
-  void createSignedDistanceBetween(const Eigen::Vector3d& minCoordinates, const Eigen::Vector3d& maxCoordinates);
+  /**
+   * Creates the signed distance field of the terrain within the given coordinates.
+   * @param [in] minCoordinates : lower corner of the field
+   * @param [in] maxCoordinates : upper corner of the field
+   * @param [in] previousSignedDistanceFieldPtr : optional field of a previous terrain. If it covers the same region, it is updated
+   *                                              incrementally instead of recomputing the full field.
+   */
+  void createSignedDistanceBetween(const Eigen::Vector3d& minCoordinates, const Eigen::Vector3d& maxCoordinates,
+                                   const SegmentedPlanesSignedDistanceField* previousSignedDistanceFieldPtr = nullptr);
 
   const SegmentedPlanesSignedDistanceField* getSignedDistanceField() const override { return signedDistanceField_.get(); }
 
@@ -35,6 +44,7 @@ class SegmentedPlanesTerrainModel : public switched_model::TerrainModel {
 
  private:
   const convex_plane_decomposition::PlanarTerrain planarTerrain_;
+  const PlanarRegionIndex planarRegionIndex_;  // Refers to the regions in planarTerrain_
   std::unique_ptr<SegmentedPlanesSignedDistanceField> signedDistanceField_;
   const grid_map::Matrix* const elevationData_;
 };
@@ -5,29 +5,44 @@
 #pragma once
 
 #include <ocs2_core/misc/Benchmark.h>
+#include <ocs2_core/thread_support/BoundedQueue.h>
+#include <ocs2_core/thread_support/VersionedSnapshot.h>
 
 #include <convex_plane_decomposition_msgs/msg/planar_terrain.hpp>
 #include <mutex>
 #include <sensor_msgs/msg/point_cloud2.hpp>
+#include <thread>
 
 #include "SegmentedPlanesTerrainModel.h"
 #include "rclcpp/rclcpp.hpp"
 
 namespace switched_model {
 
+/**
+ * Receives planar terrain messages and turns them into terrain models in a staged pipeline of background threads:
+ *  1. decode : converts the message into a planar terrain.
+ *  2. index : creates the terrain model, which indexes the planar regions.
+ *  3. sdf : updates the signed distance field incrementally from the previous one, publishes the model and its visualization.
+ *
+ * The stages are connected by bounded queues which drop the oldest terrain when a stage falls behind, such that maps arriving at a high
+ * rate are skipped instead of queued up. The finished model is published to a VersionedSnapshot, so the MPC only swaps a pointer.
+ */
 class SegmentedPlanesTerrainModelRos {
  public:
-  SegmentedPlanesTerrainModelRos(const rclcpp::Node::SharedPtr& node);
+  /**
+   * Constructor
+   * @param node : The ROS node to subscribe to the terrain and to publish the signed distance field.
+   * @param terrainModel : The finished terrain models are published here.
+   * @param queueCapacity : Capacity of the queue in front of each stage.
+   */
+  SegmentedPlanesTerrainModelRos(const rclcpp::Node::SharedPtr& node, ocs2::VersionedSnapshot<TerrainModel>& terrainModel,
+                                 size_t queueCapacity = 1);
 
   ~SegmentedPlanesTerrainModelRos();
 
-  /// Extract the latest terrain model. Resets internal model to a nullptr
-  std::unique_ptr<SegmentedPlanesTerrainModel> getTerrainModel();
-
   void createSignedDistanceBetween(const Eigen::Vector3d& minCoordinates,
                                    const Eigen::Vector3d& maxCoordinates);
 
-  void publish();
   static void toPointCloud(
       const SegmentedPlanesSignedDistanceField& segmentedPlanesSignedDistanceField,
       sensor_msgs::msg::PointCloud2& pointCloud, size_t decimation,
@@ -38,6 +53,10 @@ class SegmentedPlanesTerrainModelRos {
       const convex_plane_decomposition_msgs::msg::PlanarTerrain::ConstSharedPtr&
           msg);
 
+  void decodeStage();
+  void indexStage();
+  void signedDistanceStage();
+
   std::pair<Eigen::Vector3d, Eigen::Vector3d> getSignedDistanceRange(
       const grid_map::GridMap& gridMap, const std::string& elevationLayer);
 
@@ -47,19 +66,28 @@ class SegmentedPlanesTerrainModelRos {
   rclcpp::Publisher<sensor_msgs::msg::PointCloud2>::SharedPtr
       distanceFieldPublisher_;
 
-  std::mutex updateMutex_;
-  std::atomic_bool terrainUpdated_;
-  std::unique_ptr<SegmentedPlanesTerrainModel> terrainPtr_;
+  ocs2::VersionedSnapshot<TerrainModel>* terrainModelPtr_;
 
   std::mutex updateCoordinatesMutex_;
   Eigen::Vector3d minCoordinates_;
   Eigen::Vector3d maxCoordinates_;
   bool externalCoordinatesGiven_;
 
-  std::mutex pointCloudMutex_;
-  std::unique_ptr<sensor_msgs::msg::PointCloud2> pointCloud2MsgPtr_;
-
-  ocs2::benchmark::RepeatedTimer callbackTimer_;
+  // Last signed distance field, only accessed from the sdf stage. Used for incremental updates.
+  std::unique_ptr<SegmentedPlanesSignedDistanceField> lastSignedDistanceFieldPtr_;
+
+  // Pipeline
+  ocs2::BoundedQueue<convex_plane_decomposition_msgs::msg::PlanarTerrain::ConstSharedPtr> decodeQueue_;
+  ocs2::BoundedQueue<convex_plane_decomposition::PlanarTerrain> indexQueue_;
+  ocs2::BoundedQueue<std::unique_ptr<SegmentedPlanesTerrainModel>> signedDistanceQueue_;
+  std::thread decodeThread_;
+  std::thread indexThread_;
+  std::thread signedDistanceThread_;
+
+  // Each timer is only accessed from its stage
+  ocs2::benchmark::RepeatedTimer decodeTimer_;
+  ocs2::benchmark::RepeatedTimer indexTimer_;
+  ocs2::benchmark::RepeatedTimer signedDistanceTimer_;
 };
 
 }  // namespace switched_model
@@ -0,0 +1,197 @@
+#include "segmented_planes_terrain_model/PlanarRegionIndex.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <convex_plane_decomposition/GeometryUtils.h>
+
+namespace switched_model {
+
+namespace {
+/** Minimum size of a grid cell [m], prevents a huge grid for many small regions */
+const scalar_t minCellSize = 0.1;
+
+scalar_t squaredDistanceToBox(const vector2_t& point, const vector2_t& boxMin, const vector2_t& boxMax) {
+  const vector2_t outside = (boxMin - point).cwiseMax(point - boxMax).cwiseMax(0.0);
+  return outside.squaredNorm();
+}
+}  // namespace
+
+PlanarRegionIndex::PlanarRegionIndex(const std::vector<convex_plane_decomposition::PlanarRegion>& planarRegions)
+    : origin_(vector2_t::Zero()), cellSize_(1.0), sizeX_(0), sizeY_(0) {
+  if (planarRegions.empty()) {
+    return;
+  }
+
+  // Bounding boxes of the regions
+  regions_.reserve(planarRegions.size());
+  vector2_t mapMin = vector2_t::Constant(std::numeric_limits<scalar_t>::max());
+  vector2_t mapMax = vector2_t::Constant(std::numeric_limits<scalar_t>::lowest());
+  for (const auto& planarRegion : planarRegions) {
+    RegionInfo regionInfo;
+    regionInfo.regionPtr = &planarRegion;
+    regionInfo.transformWorldToPlane = planarRegion.transformPlaneToWorld.inverse();
+    regionInfo.minInPlane = {planarRegion.bbox2d.xmin(), planarRegion.bbox2d.ymin()};
+    regionInfo.maxInPlane = {planarRegion.bbox2d.xmax(), planarRegion.bbox2d.ymax()};
+
+    // The region lies in the plane, its world xy bounding box is bounded by the corners of the bounding box in the plane.
+    regionInfo.minInWorld.setConstant(std::numeric_limits<scalar_t>::max());
+    regionInfo.maxInWorld.setConstant(std::numeric_limits<scalar_t>::lowest());
+    for (const scalar_t x : {regionInfo.minInPlane.x(), regionInfo.maxInPlane.x()}) {
+      for (const scalar_t y : {regionInfo.minInPlane.y(), regionInfo.maxInPlane.y()}) {
+        const vector2_t cornerInWorld = (planarRegion.transformPlaneToWorld * Eigen::Vector3d(x, y, 0.0)).head<2>();
+        regionInfo.minInWorld = regionInfo.minInWorld.cwiseMin(cornerInWorld);
+        regionInfo.maxInWorld = regionInfo.maxInWorld.cwiseMax(cornerInWorld);
+      }
+    }
+    mapMin = mapMin.cwiseMin(regionInfo.minInWorld);
+    mapMax = mapMax.cwiseMax(regionInfo.maxInWorld);
+    regions_.push_back(regionInfo);
+  }
+
+  // Grid with about one cell per region
+  const vector2_t mapSize = mapMax - mapMin;
+  origin_ = mapMin;
+  cellSize_ = std::max(std::sqrt(mapSize.x() * mapSize.y() / regions_.size()), minCellSize);
+  sizeX_ = static_cast<int>(mapSize.x() / cellSize_) + 1;
+  sizeY_ = static_cast<int>(mapSize.y() / cellSize_) + 1;
+
+  // Count the regions per cell, then fill in compressed row format
+  cellStart_.assign(sizeX_ * sizeY_ + 1, 0);
+  for (auto& regionInfo : regions_) {
+    regionInfo.cellMinX = cellIndexX(regionInfo.minInWorld.x());
+    regionInfo.cellMaxX = cellIndexX(regionInfo.maxInWorld.x());
+    regionInfo.cellMinY = cellIndexY(regionInfo.minInWorld.y());
+    regionInfo.cellMaxY = cellIndexY(regionInfo.maxInWorld.y());
+    for (int iy = regionInfo.cellMinY; iy <= regionInfo.cellMaxY; ++iy) {
+      for (int ix = regionInfo.cellMinX; ix <= regionInfo.cellMaxX; ++ix) {
+        ++cellStart_[iy * sizeX_ + ix + 1];
+      }
+    }
+  }
+  for (size_t i = 1; i < cellStart_.size(); ++i) {
+    cellStart_[i] += cellStart_[i - 1];
+  }
+
+  cellRegions_.resize(cellStart_.back());
+  std::vector<int> cellFill(cellStart_.begin(), cellStart_.end() - 1);
+  for (int regionId = 0; regionId < static_cast<int>(regions_.size()); ++regionId) {
+    const auto& regionInfo = regions_[regionId];
+    for (int iy = regionInfo.cellMinY; iy <= regionInfo.cellMaxY; ++iy) {
+      for (int ix = regionInfo.cellMinX; ix <= regionInfo.cellMaxX; ++ix) {
+        cellRegions_[cellFill[iy * sizeX_ + ix]++] = regionId;
+      }
+    }
+  }
+}
+
+convex_plane_decomposition::PlanarTerrainProjection PlanarRegionIndex::getBestPlanarRegionAtPositionInWorld(
+    const vector3_t& positionInWorld, const std::function<scalar_t(const vector3_t&)>& penaltyFunction) const {
+  convex_plane_decomposition::PlanarTerrainProjection projection;
+  projection.regionPtr = nullptr;
+  projection.cost = std::numeric_limits<scalar_t>::max();
+  if (regions_.empty()) {
+    return projection;
+  }
+
+  const auto evaluateRegion = [&](const RegionInfo& regionInfo) {
+    vector3_t positionInPlane;
+    if (costLowerBound(regionInfo, positionInWorld, positionInPlane) >= projection.cost) {
+      return;
+    }
+
+    const convex_plane_decomposition::CgalPoint2d queryInPlane(positionInPlane.x(), positionInPlane.y());
+    const auto projectedPointInPlane = convex_plane_decomposition::projectToPlanarRegion(queryInPlane, *regionInfo.regionPtr);
+    const vector3_t projectionInWorld = convex_plane_decomposition::positionInWorldFrameFromPosition2dInPlane(
+        projectedPointInPlane, regionInfo.regionPtr->transformPlaneToWorld);
+    const scalar_t cost = (positionInWorld - projectionInWorld).squaredNorm() + penaltyFunction(projectionInWorld);
+    if (cost < projection.cost) {
+      projection.cost = cost;
+      projection.regionPtr = regionInfo.regionPtr;
+      projection.positionInTerrainFrame = projectedPointInPlane;
+      projection.positionInWorld = projectionInWorld;
+    }
+  };
+
+  // Visits all regions overlapping the cell that were not visited in a previous ring. A region is visited at the lowest cell of its
+  // overlap with the current ring, which is on the ring itself if the region does not overlap the previous rings.
+  const int centerX = cellIndexX(positionInWorld.x());
+  const int centerY = cellIndexY(positionInWorld.y());
+  const auto visitCell = [&](int ix, int iy, int ring) {
+    const int cell = iy * sizeX_ + ix;
+    for (int i = cellStart_[cell]; i < cellStart_[cell + 1]; ++i) {
+      const auto& regionInfo = regions_[cellRegions_[i]];
+      const bool inPreviousRing = ring > 0 && regionInfo.cellMinX <= centerX + ring - 1 && regionInfo.cellMaxX >= centerX - ring + 1 &&
+                                  regionInfo.cellMinY <= centerY + ring - 1 && regionInfo.cellMaxY >= centerY - ring + 1;
+      const bool isLowestCell = ix == std::max(regionInfo.cellMinX, centerX - ring) && iy == std::max(regionInfo.cellMinY, centerY - ring);
+      if (!inPreviousRing && isLowestCell) {
+        evaluateRegion(regionInfo);
+      }
+    }
+  };
+
+  for (int ring = 0;; ++ring) {
+    const int xBegin = std::max(centerX - ring, 0);
+    const int xEnd = std::min(centerX + ring, sizeX_ - 1);
+    const int yBegin = std::max(centerY - ring, 0);
+    const int yEnd = std::min(centerY + ring, sizeY_ - 1);
+    for (int iy = yBegin; iy <= yEnd; ++iy) {
+      if (std::abs(iy - centerY) == ring) {
+        for (int ix = xBegin; ix <= xEnd; ++ix) {
+          visitCell(ix, iy, ring);
+        }
+      } else {
+        if (centerX - ring >= 0) {
+          visitCell(centerX - ring, iy, ring);
+        }
+        if (centerX + ring < sizeX_) {
+          visitCell(centerX + ring, iy, ring);
+        }
+      }
+    }
+
+    // Distance from the query to the cells that are not visited yet
+    scalar_t unvisitedDistance = std::numeric_limits<scalar_t>::max();
+    if (centerX - ring > 0) {
+      unvisitedDistance = std::min(unvisitedDistance, positionInWorld.x() - (origin_.x() + (centerX - ring) * cellSize_));
+    }
+    if (centerX + ring < sizeX_ - 1) {
+      unvisitedDistance = std::min(unvisitedDistance, origin_.x() + (centerX + ring + 1) * cellSize_ - positionInWorld.x());
+    }
+    if (centerY - ring > 0) {
+      unvisitedDistance = std::min(unvisitedDistance, positionInWorld.y() - (origin_.y() + (centerY - ring) * cellSize_));
+    }
+    if (centerY + ring < sizeY_ - 1) {
+      unvisitedDistance = std::min(unvisitedDistance, origin_.y() + (centerY + ring + 1) * cellSize_ - positionInWorld.y());
+    }
+
+    if (unvisitedDistance == std::numeric_limits<scalar_t>::max()) {
+      break;  // All cells visited
+    }
+    unvisitedDistance = std::max(unvisitedDistance, 0.0);
+    if (unvisitedDistance * unvisitedDistance >= projection.cost) {
+      break;  // No unvisited region can improve the cost
+    }
+  }
+
+  return projection;
+}
+
+scalar_t PlanarRegionIndex::costLowerBound(const RegionInfo& regionInfo, const vector3_t& positionInWorld, vector3_t& positionInPlane) {
+  positionInPlane = regionInfo.transformWorldToPlane * positionInWorld;
+  const scalar_t squaredDistanceInPlane =
+      squaredDistanceToBox(positionInPlane.head<2>(), regionInfo.minInPlane, regionInfo.maxInPlane) + positionInPlane.z() * positionInPlane.z();
+  const scalar_t squaredDistanceInWorld = squaredDistanceToBox(positionInWorld.head<2>(), regionInfo.minInWorld, regionInfo.maxInWorld);
+  return std::max(squaredDistanceInPlane, squaredDistanceInWorld);
+}
+
+int PlanarRegionIndex::cellIndexX(scalar_t x) const {
+  return std::min(std::max(static_cast<int>(std::floor((x - origin_.x()) / cellSize_)), 0), sizeX_ - 1);
+}
+
+int PlanarRegionIndex::cellIndexY(scalar_t y) const {
+  return std::min(std::max(static_cast<int>(std::floor((y - origin_.y()) / cellSize_)), 0), sizeY_ - 1);
+}
+
+}  // namespace switched_model
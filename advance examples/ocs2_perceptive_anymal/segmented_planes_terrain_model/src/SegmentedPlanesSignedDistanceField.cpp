@@ -0,0 +1,66 @@
+#include "segmented_planes_terrain_model/SegmentedPlanesSignedDistanceField.h"
+
+#include <cmath>
+#include <limits>
+
+namespace switched_model {
+
+namespace {
+
+vector2_t getOrigin(const grid_map::GridMap& gridMap) {
+  return gridMap.getPosition() - 0.5 * gridMap.getLength().matrix();
+}
+
+TiledSignedDistanceField::elevation_matrix_t getElevation(
+    const grid_map::GridMap& gridMap, const std::string& elevationLayer) {
+  const auto& data = gridMap.get(elevationLayer);
+  const auto& size = gridMap.getSize();
+  const double resolution = gridMap.getResolution();
+  const vector2_t origin = getOrigin(gridMap);
+
+  // Cell (ix, iy) of the regular grid has its center at origin + (ix + 0.5, iy + 0.5) * resolution
+  TiledSignedDistanceField::elevation_matrix_t elevation(size.x(), size.y());
+  grid_map::Index index;
+  for (int iy = 0; iy < size.y(); ++iy) {
+    for (int ix = 0; ix < size.x(); ++ix) {
+      const grid_map::Position position(origin.x() + (ix + 0.5) * resolution,
+                                        origin.y() + (iy + 0.5) * resolution);
+      elevation(ix, iy) = gridMap.getIndex(position, index)
+                              ? data(index.x(), index.y())
+                              : std::numeric_limits<float>::quiet_NaN();
+    }
+  }
+  return elevation;
+}
+
+}  // namespace
+
+SegmentedPlanesSignedDistanceField::SegmentedPlanesSignedDistanceField(
+    const grid_map::GridMap& gridMap, const std::string& elevationLayer,
+    double minHeight, double maxHeight, double truncationDistance)
+    : TiledSignedDistanceField(getElevation(gridMap, elevationLayer),
+                               getOrigin(gridMap), gridMap.getResolution(),
+                               minHeight, maxHeight, truncationDistance),
+      maxHeight_(maxHeight),
+      frameId_(gridMap.getFrameId()),
+      timestamp_(gridMap.getTimestamp()) {}
+
+bool SegmentedPlanesSignedDistanceField::isCompatible(
+    const grid_map::GridMap& gridMap, double minHeight,
+    double maxHeight) const {
+  const double tolerance = 1e-6 * resolution();
+  return gridMap.getSize().x() == sizeX() && gridMap.getSize().y() == sizeY() &&
+         std::abs(gridMap.getResolution() - resolution()) < tolerance &&
+         (getOrigin(gridMap) - origin()).cwiseAbs().maxCoeff() < tolerance &&
+         std::abs(minHeight - TiledSignedDistanceField::minHeight()) < tolerance &&
+         std::abs(maxHeight - maxHeight_) < tolerance &&
+         gridMap.getFrameId() == frameId_;
+}
+
+size_t SegmentedPlanesSignedDistanceField::updateFromGridMap(
+    const grid_map::GridMap& gridMap, const std::string& elevationLayer) {
+  timestamp_ = gridMap.getTimestamp();
+  return update(getElevation(gridMap, elevationLayer));
+}
+
+}  // namespace switched_model
@@ -19,12 +19,13 @@ const std::string elevationLayerName = "elevation";
 
 SegmentedPlanesTerrainModel::SegmentedPlanesTerrainModel(convex_plane_decomposition::PlanarTerrain planarTerrain)
     : planarTerrain_(std::move(planarTerrain)),
+      planarRegionIndex_(planarTerrain_.planarRegions),
       signedDistanceField_(nullptr),
       elevationData_(&planarTerrain_.gridMap.get(elevationLayerName)) {}
 
 TerrainPlane SegmentedPlanesTerrainModel::getLocalTerrainAtPositionInWorldAlongGravity(
     const vector3_t& positionInWorld, std::function<scalar_t(const vector3_t&)> penaltyFunction) const {
-  const auto projection = getBestPlanarRegionAtPositionInWorld(positionInWorld, planarTerrain_.planarRegions, std::move(penaltyFunction));
+  const auto projection = planarRegionIndex_.getBestPlanarRegionAtPositionInWorld(positionInWorld, penaltyFunction);
   if (projection.regionPtr == nullptr) {
     throw std::runtime_error("[SegmentedPlanesTerrainModel] no region found");
   }
@@ -34,7 +35,7 @@ TerrainPlane SegmentedPlanesTerrainModel::getLocalTerrainAtPositionInWorldAlongG
 
 ConvexTerrain SegmentedPlanesTerrainModel::getConvexTerrainAtPositionInWorld(
     const vector3_t& positionInWorld, std::function<scalar_t(const vector3_t&)> penaltyFunction) const {
-  const auto projection = getBestPlanarRegionAtPositionInWorld(positionInWorld, planarTerrain_.planarRegions, std::move(penaltyFunction));
+  const auto projection = planarRegionIndex_.getBestPlanarRegionAtPositionInWorld(positionInWorld, penaltyFunction);
   if (projection.regionPtr == nullptr) {
     throw std::runtime_error("[SegmentedPlanesTerrainModel] no region found");
   }
@@ -57,8 +58,8 @@ ConvexTerrain SegmentedPlanesTerrainModel::getConvexTerrainAtPositionInWorld(
   return convexTerrain;
 }
 
-void SegmentedPlanesTerrainModel::createSignedDistanceBetween(const Eigen::Vector3d& minCoordinates,
-                                                              const Eigen::Vector3d& maxCoordinates) {
+void SegmentedPlanesTerrainModel::createSignedDistanceBetween(const Eigen::Vector3d& minCoordinates, const Eigen::Vector3d& maxCoordinates,
+                                                              const SegmentedPlanesSignedDistanceField* previousSignedDistanceFieldPtr) {
   // Compute coordinates of submap
   const auto minXY =
       grid_map::lookup::projectToMapWithMargin(planarTerrain_.gridMap, grid_map::Position(minCoordinates.x(), minCoordinates.y()));
@@ -70,8 +71,14 @@ void SegmentedPlanesTerrainModel::createSignedDistanceBetween(const Eigen::Vecto
   bool success = true;
   grid_map::GridMap subMap = planarTerrain_.gridMap.getSubmap(centerXY, lengths, success);
   if (success) {
-    signedDistanceField_ =
-        std::make_unique<SegmentedPlanesSignedDistanceField>(subMap, elevationLayerName, minCoordinates.z(), maxCoordinates.z());
+    if (previousSignedDistanceFieldPtr != nullptr &&
+        previousSignedDistanceFieldPtr->isCompatible(subMap, minCoordinates.z(), maxCoordinates.z())) {
+      signedDistanceField_.reset(previousSignedDistanceFieldPtr->clone());
+      signedDistanceField_->updateFromGridMap(subMap, elevationLayerName);
+    } else {
+      signedDistanceField_ =
+          std::make_unique<SegmentedPlanesSignedDistanceField>(subMap, elevationLayerName, minCoordinates.z(), maxCoordinates.z());
+    }
   } else {
     std::cerr << "[SegmentedPlanesTerrainModel] Failed to get subMap" << std::endl;
   }
@@ -9,44 +9,63 @@
 #include <grid_map_filters_rsl/lookup.hpp>
 #include <grid_map_ros/GridMapRosConverter.hpp>
 
+#include <cstring>
+
 namespace switched_model {
 
+namespace {
+void printTimer(const std::string& name, const ocs2::benchmark::RepeatedTimer& timer) {
+  if (timer.getNumTimedIntervals() > 0) {
+    std::cout << "\t" << name << ": " << timer.getNumTimedIntervals() << " iterations, average time [ms] "
+              << timer.getAverageInMilliseconds() << ", maximum time [ms] " << timer.getMaxIntervalInMilliseconds() << "\n";
+  }
+}
+}  // namespace
+
 SegmentedPlanesTerrainModelRos::SegmentedPlanesTerrainModelRos(
-    const rclcpp::Node::SharedPtr& node)
+    const rclcpp::Node::SharedPtr& node, ocs2::VersionedSnapshot<TerrainModel>& terrainModel, size_t queueCapacity)
     : node_(node),
-      terrainUpdated_(false),
+      terrainModelPtr_(&terrainModel),
       minCoordinates_(Eigen::Vector3d::Zero()),
       maxCoordinates_(Eigen::Vector3d::Zero()),
-      externalCoordinatesGiven_(false) {
+      externalCoordinatesGiven_(false),
+      decodeQueue_(queueCapacity, ocs2::QueueOverflowPolicy::DropOldest),
+      indexQueue_(queueCapacity, ocs2::QueueOverflowPolicy::DropOldest),
+      signedDistanceQueue_(queueCapacity, ocs2::QueueOverflowPolicy::DropOldest) {
+  distanceFieldPublisher_ =
+      node->create_publisher<sensor_msgs::msg::PointCloud2>(
+          "/convex_plane_decomposition_ros/signed_distance_field", 1);
+
+  decodeThread_ = std::thread([this]() { decodeStage(); });
+  indexThread_ = std::thread([this]() { indexStage(); });
+  signedDistanceThread_ = std::thread([this]() { signedDistanceStage(); });
+
   terrainSubscriber_ = node->create_subscription<
       convex_plane_decomposition_msgs::msg::PlanarTerrain>(
       "/convex_plane_decomposition_ros/planar_terrain", 1,
       std::bind(&SegmentedPlanesTerrainModelRos::callback, this,
                 std::placeholders::_1));
-  distanceFieldPublisher_ =
-      node->create_publisher<sensor_msgs::msg::PointCloud2>(
-          "/convex_plane_decomposition_ros/signed_distance_field", 1);
 }
 
 SegmentedPlanesTerrainModelRos::~SegmentedPlanesTerrainModelRos() {
-  if (callbackTimer_.getNumTimedIntervals() > 0) {
-    std::cout
-        << "[SegmentedPlanesTerrainModelRos] Benchmarking terrain Callback\n"
-        << "\tStatistics computed over "
-        << callbackTimer_.getNumTimedIntervals() << " iterations. \n"
-        << "\tAverage time [ms] " << callbackTimer_.getAverageInMilliseconds()
-        << "\n"
-        << "\tMaximum time [ms] "
-        << callbackTimer_.getMaxIntervalInMilliseconds() << std::endl;
+  terrainSubscriber_.reset();
+  decodeQueue_.close();
+  indexQueue_.close();
+  signedDistanceQueue_.close();
+  decodeThread_.join();
+  indexThread_.join();
+  signedDistanceThread_.join();
+
+  if (decodeTimer_.getNumTimedIntervals() > 0) {
+    std::cout << "[SegmentedPlanesTerrainModelRos] Benchmarking terrain pipeline\n";
+    printTimer("decode", decodeTimer_);
+    printTimer("index", indexTimer_);
+    printTimer("sdf", signedDistanceTimer_);
+    std::cout << "\tDropped terrains [decode, index, sdf]: " << decodeQueue_.getNumDropped() << ", "
+              << indexQueue_.getNumDropped() << ", " << signedDistanceQueue_.getNumDropped() << std::endl;
   }
 }
 
-std::unique_ptr<SegmentedPlanesTerrainModel>
-SegmentedPlanesTerrainModelRos::getTerrainModel() {
-  std::lock_guard<std::mutex> lock(updateMutex_);
-  return std::move(terrainPtr_);
-}
-
 void SegmentedPlanesTerrainModelRos::createSignedDistanceBetween(
     const Eigen::Vector3d& minCoordinates,
     const Eigen::Vector3d& maxCoordinates) {
@@ -56,54 +75,66 @@ void SegmentedPlanesTerrainModelRos::createSignedDistanceBetween(
   externalCoordinatesGiven_ = true;
 }
 
-void SegmentedPlanesTerrainModelRos::publish() {
-  // Extract point cloud.
-  std::unique_ptr<sensor_msgs::msg::PointCloud2> pointCloud2MsgPtr;
-  {
-    std::lock_guard<std::mutex> lock(pointCloudMutex_);
-    pointCloud2MsgPtr.swap(pointCloud2MsgPtr_);
-  }
-
-  // Publish.
-  if (pointCloud2MsgPtr != nullptr) {
-    distanceFieldPublisher_->publish(*pointCloud2MsgPtr);
-  }
-}
-
 void SegmentedPlanesTerrainModelRos::callback(
     const convex_plane_decomposition_msgs::msg::PlanarTerrain::ConstSharedPtr&
         msg) {
-  callbackTimer_.startTimer();
-
-  // Read terrain
-  auto terrainPtr = std::make_unique<SegmentedPlanesTerrainModel>(
-      convex_plane_decomposition::fromMessage(*msg));
-
-  // Create SDF
-  const std::string elevationLayer = "elevation";
-  if (terrainPtr->planarTerrain().gridMap.exists(elevationLayer)) {
-    const auto sdfRange = getSignedDistanceRange(
-        terrainPtr->planarTerrain().gridMap, elevationLayer);
-    terrainPtr->createSignedDistanceBetween(sdfRange.first, sdfRange.second);
-  }
+  decodeQueue_.push(msg);
+}
 
-  // Create pointcloud for visualization
-  const auto* sdfPtr = terrainPtr->getSignedDistanceField();
-  if (sdfPtr != nullptr) {
-    std::unique_ptr<sensor_msgs::msg::PointCloud2> pointCloud2MsgPtr(
-        new sensor_msgs::msg::PointCloud2());
-    toPointCloud(*sdfPtr, *pointCloud2MsgPtr, 1,
-                 [](float val) { return -0.05F <= val && val <= 0.0F; });
-    std::lock_guard<std::mutex> lock(pointCloudMutex_);
-    pointCloud2MsgPtr_.swap(pointCloud2MsgPtr);
+void SegmentedPlanesTerrainModelRos::decodeStage() {
+  convex_plane_decomposition_msgs::msg::PlanarTerrain::ConstSharedPtr msg;
+  while (decodeQueue_.pop(msg)) {
+    decodeTimer_.startTimer();
+    auto planarTerrain = convex_plane_decomposition::fromMessage(*msg);
+    msg.reset();
+    decodeTimer_.endTimer();
+    indexQueue_.push(std::move(planarTerrain));
   }
+}
 
-  {  // Move to storage under the lock
-    std::lock_guard<std::mutex> lock(updateMutex_);
-    terrainPtr_.swap(terrainPtr);
+void SegmentedPlanesTerrainModelRos::indexStage() {
+  convex_plane_decomposition::PlanarTerrain planarTerrain;
+  while (indexQueue_.pop(planarTerrain)) {
+    indexTimer_.startTimer();
+    auto terrainPtr = std::make_unique<SegmentedPlanesTerrainModel>(std::move(planarTerrain));
+    indexTimer_.endTimer();
+    signedDistanceQueue_.push(std::move(terrainPtr));
   }
+}
+
+void SegmentedPlanesTerrainModelRos::signedDistanceStage() {
+  std::unique_ptr<SegmentedPlanesTerrainModel> terrainPtr;
+  while (signedDistanceQueue_.pop(terrainPtr)) {
+    signedDistanceTimer_.startTimer();
+
+    // Create SDF
+    const std::string elevationLayer = "elevation";
+    if (terrainPtr->planarTerrain().gridMap.exists(elevationLayer)) {
+      const auto sdfRange = getSignedDistanceRange(
+          terrainPtr->planarTerrain().gridMap, elevationLayer);
+      terrainPtr->createSignedDistanceBetween(sdfRange.first, sdfRange.second,
+                                              lastSignedDistanceFieldPtr_.get());
+    }
+
+    // Create pointcloud for visualization
+    std::unique_ptr<sensor_msgs::msg::PointCloud2> pointCloud2MsgPtr;
+    const auto* sdfPtr = terrainPtr->getSignedDistanceField();
+    if (sdfPtr != nullptr) {
+      lastSignedDistanceFieldPtr_.reset(sdfPtr->clone());
+
+      pointCloud2MsgPtr.reset(new sensor_msgs::msg::PointCloud2());
+      toPointCloud(*sdfPtr, *pointCloud2MsgPtr, 1,
+                   [](float val) { return -0.05F <= val && val <= 0.0F; });
+    }
+
+    // Publish the finished model, the MPC picks it up with a pointer swap
+    terrainModelPtr_->publish(std::move(terrainPtr));
+    signedDistanceTimer_.endTimer();
 
-  callbackTimer_.endTimer();
+    if (pointCloud2MsgPtr != nullptr) {
+      distanceFieldPublisher_->publish(*pointCloud2MsgPtr);
+    }
+  }
 }
 
 std::pair<Eigen::Vector3d, Eigen::Vector3d>
@@ -144,14 +175,20 @@ void SegmentedPlanesTerrainModelRos::toPointCloud(
         segmentedPlanesSignedDistanceField,
     sensor_msgs::msg::PointCloud2& pointCloud, size_t decimation,
     const std::function<bool(float)>& condition) {
-  const auto& gridMap = segmentedPlanesSignedDistanceField.gridMap();
-  pcl::PointCloud<pcl::PointXYZI> points;
-  const grid_map::SignedDistanceField& signedDistanceField =
-      segmentedPlanesSignedDistanceField.asGridmapSdf();
-  signedDistanceField.convertToPointCloud(points);
-
-  pointCloud.header.stamp.nanosec = gridMap.getTimestamp();
-  pointCloud.header.frame_id = gridMap.getFrameId();
+  // Filtered points as consecutive (x, y, z, value)
+  std::vector<float> filterPoints;
+  segmentedPlanesSignedDistanceField.forEachGridPoint(
+      [&](const vector3_t& position, float value) {
+        if (condition(value)) {
+          filterPoints.push_back(position.x());
+          filterPoints.push_back(position.y());
+          filterPoints.push_back(position.z());
+          filterPoints.push_back(value);
+        }
+      });
+
+  pointCloud.header.stamp.nanosec = segmentedPlanesSignedDistanceField.timestamp();
+  pointCloud.header.frame_id = segmentedPlanesSignedDistanceField.frameId();
 
   // Fields: Store each point analogous to pcl::PointXYZI
   const std::vector<std::string> fieldNames{"x", "y", "z", "intensity"};
@@ -168,35 +205,13 @@ void SegmentedPlanesTerrainModelRos::toPointCloud(
     offset += pointField.count * sizeof(float);
   }
 
-  // Resize
-  const size_t pointCloudMaxSize{points.size()};
+  // Resize and fill data
   pointCloud.height = 1;
-  pointCloud.width = pointCloudMaxSize;
+  pointCloud.width = filterPoints.size() / fieldNames.size();
   pointCloud.point_step = offset;
   pointCloud.row_step = pointCloud.width * pointCloud.point_step;
   pointCloud.data.resize(pointCloud.height * pointCloud.row_step);
-
-  // Fill data
-  size_t addedPoints = 0;
-  std::vector<float> filterPoints;
-  for (auto it = points.begin(); it != points.end(); it++) {
-    const auto sdfValue = it->intensity;
-    if (condition(sdfValue)) {
-      filterPoints.push_back(it->x);
-      filterPoints.push_back(it->y);
-      filterPoints.push_back(it->z);
-      filterPoints.push_back(sdfValue);
-      ++addedPoints;
-    }
-  }
-
-  if (addedPoints != pointCloudMaxSize) {
-    pointCloud.width = addedPoints;
-    pointCloud.row_step = pointCloud.width * pointCloud.point_step;
-    const auto size = pointCloud.height * pointCloud.row_step;
-    pointCloud.data.resize(size);
-    memcpy(pointCloud.data.data(), filterPoints.data(), size);
-  }
+  memcpy(pointCloud.data.data(), filterPoints.data(), pointCloud.data.size());
 }
 
 }  // namespace switched_model
@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <random>
+
+#include "segmented_planes_terrain_model/PlanarRegionIndex.h"
+
+using namespace switched_model;
+
+namespace {
+
+/** Random rectangular region on a tilted plane, with a single inset shrunk by a margin. */
+convex_plane_decomposition::PlanarRegion getRandomRegion(std::mt19937& generator) {
+  std::uniform_real_distribution<scalar_t> positionDistribution(-5.0, 5.0);
+  std::uniform_real_distribution<scalar_t> heightDistribution(-0.5, 0.5);
+  std::uniform_real_distribution<scalar_t> sizeDistribution(0.2, 1.5);
+  std::uniform_real_distribution<scalar_t> angleDistribution(-0.3, 0.3);
+
+  const scalar_t halfLength = 0.5 * sizeDistribution(generator);
+  const scalar_t halfWidth = 0.5 * sizeDistribution(generator);
+  const scalar_t margin = 0.05;
+
+  convex_plane_decomposition::CgalPolygon2d boundary;
+  boundary.push_back({-halfLength, -halfWidth});
+  boundary.push_back({halfLength, -halfWidth});
+  boundary.push_back({halfLength, halfWidth});
+  boundary.push_back({-halfLength, halfWidth});
+
+  convex_plane_decomposition::CgalPolygon2d inset;
+  inset.push_back({-halfLength + margin, -halfWidth + margin});
+  inset.push_back({halfLength - margin, -halfWidth + margin});
+  inset.push_back({halfLength - margin, halfWidth - margin});
+  inset.push_back({-halfLength + margin, halfWidth - margin});
+
+  convex_plane_decomposition::PlanarRegion region;
+  region.boundaryWithInset.boundary = convex_plane_decomposition::CgalPolygonWithHoles2d(boundary);
+  region.boundaryWithInset.insets.emplace_back(inset);
+  region.bbox2d = boundary.bbox();
+
+  const Eigen::AngleAxisd roll(angleDistribution(generator), Eigen::Vector3d::UnitX());
+  const Eigen::AngleAxisd pitch(angleDistribution(generator), Eigen::Vector3d::UnitY());
+  const Eigen::AngleAxisd yaw(3.0 * angleDistribution(generator), Eigen::Vector3d::UnitZ());
+  region.transformPlaneToWorld.setIdentity();
+  region.transformPlaneToWorld.linear() = (roll * pitch * yaw).toRotationMatrix();
+  region.transformPlaneToWorld.translation() << positionDistribution(generator), positionDistribution(generator),
+      heightDistribution(generator);
+  return region;
+}
+
+}  // namespace
+
+TEST(TestPlanarRegionIndex, emptyTerrain) {
+  const std::vector<convex_plane_decomposition::PlanarRegion> planarRegions;
+  const PlanarRegionIndex planarRegionIndex(planarRegions);
+
+  const auto projection = planarRegionIndex.getBestPlanarRegionAtPositionInWorld(vector3_t::Zero(), [](const vector3_t&) { return 0.0; });
+  ASSERT_EQ(projection.regionPtr, nullptr);
+}
+
+TEST(TestPlanarRegionIndex, equivalentToExhaustiveSearch) {
+  std::mt19937 generator(0);
+  std::uniform_real_distribution<scalar_t> queryDistribution(-7.0, 7.0);
+  std::uniform_real_distribution<scalar_t> queryHeightDistribution(-1.0, 1.0);
+
+  const auto penaltyFunction = [](const vector3_t& projectionInWorld) { return 0.5 * std::abs(projectionInWorld.z() - 0.2); };
+
+  for (const size_t numRegions : {1, 5, 50, 200}) {
+    std::vector<convex_plane_decomposition::PlanarRegion> planarRegions;
+    planarRegions.reserve(numRegions);
+    for (size_t i = 0; i < numRegions; ++i) {
+      planarRegions.push_back(getRandomRegion(generator));
+    }
+    const PlanarRegionIndex planarRegionIndex(planarRegions);
+
+    for (int query = 0; query < 500; ++query) {
+      const vector3_t positionInWorld{queryDistribution(generator), queryDistribution(generator), queryHeightDistribution(generator)};
+
+      const auto expected =
+          convex_plane_decomposition::getBestPlanarRegionAtPositionInWorld(positionInWorld, planarRegions, penaltyFunction);
+      const auto actual = planarRegionIndex.getBestPlanarRegionAtPositionInWorld(positionInWorld, penaltyFunction);
+
+      ASSERT_EQ(actual.regionPtr, expected.regionPtr) << "numRegions: " << numRegions << ", query: " << positionInWorld.transpose();
+      ASSERT_NEAR(actual.cost, expected.cost, 1e-9);
+      ASSERT_LT((actual.positionInWorld - expected.positionInWorld).norm(), 1e-9);
+    }
+  }
+}
@@ -129,8 +129,8 @@ inline void RaisimRolloutSettings::loadSettings(const std::string& filename, con
     std::cerr << "#### =============================================================================" << std::endl;
   }
 
-  boost::property_tree::ptree pt;
-  boost::property_tree::read_info(filename, pt);
+  const auto ptPtr = loadData::readInfoFile(filename);
+  const auto &pt = *ptPtr;
   const std::string raisimFieldName = fieldName + ".raisim_rollout";
 
   loadData::loadPtreeValue(pt, setSimulatorStateOnRolloutRunAlways_, raisimFieldName + ".setSimulatorStateOnRolloutRunAlways", verbose);
@@ -41,7 +41,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <ocs2_ballbot/BallbotInterface.h>
 #include <ocs2_core/thread_support/ExecuteAndSleep.h>
-#include <ocs2_core/thread_support/SetThreadPriority.h>
+#include <ocs2_core/thread_support/ThreadPlacement.h>
 #include <ocs2_ddp/GaussNewtonDDP_MPC.h>
 #include <ocs2_mpc/MPC_MRT_Interface.h>
 #include <ocs2_ros_interfaces/common/RosMsgConversions.h>
@@ -170,8 +170,8 @@ int main(int argc, char **argv) {
             }
         }
     });
-    ocs2::setThreadPriority(ballbotInterface.ddpSettings().threadPriority_,
-                            mpcThread);
+    ocs2::setThreadPlacement(ballbotInterface.ddpSettings().threadPlacement_,
+                             mpcThread);
 
     /*
      * Main control loop.
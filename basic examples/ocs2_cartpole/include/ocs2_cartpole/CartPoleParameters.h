@@ -54,8 +54,8 @@ namespace ocs2 {
 
             /** Loads the Cart-Pole's parameters. */
             void loadSettings(const std::string &filename, const std::string &fieldName, bool verbose = true) {
-                boost::property_tree::ptree pt;
-                read_info(filename, pt);
+                const auto ptPtr = loadData::readInfoFile(filename);
+                const auto &pt = *ptPtr;
                 if (verbose) {
                     std::cerr << "\n #### Cart-pole Parameters:";
                     std::cerr <<
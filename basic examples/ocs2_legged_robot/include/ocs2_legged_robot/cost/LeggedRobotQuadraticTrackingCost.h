@@ -62,7 +62,7 @@ namespace ocs2::legged_robot {
                                                              const TargetTrajectories &targetTrajectories)
         const override {
             const auto contactFlags = referenceManagerPtr_->getContactFlags(time);
-            const vector_t xNominal = targetTrajectories.getDesiredState(time);
+            const vector_t &xNominal = getTargetTrajectoriesCursor().getDesiredState(targetTrajectories, time);
             const vector_t uNominal = weightCompensatingInput(info_, contactFlags);
             return {state - xNominal, input - uNominal};
         }
@@ -90,7 +90,7 @@ namespace ocs2::legged_robot {
 
         vector_t getStateDeviation(scalar_t time, const vector_t &state,
                                    const TargetTrajectories &targetTrajectories) const override {
-            const vector_t xNominal = targetTrajectories.getDesiredState(time);
+            const vector_t &xNominal = getTargetTrajectoriesCursor().getDesiredState(targetTrajectories, time);
             return state - xNominal;
         }
 
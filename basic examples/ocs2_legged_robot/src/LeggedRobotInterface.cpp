@@ -355,8 +355,8 @@ namespace ocs2::legged_robot {
     std::pair<scalar_t, RelaxedBarrierPenalty::Config>
     LeggedRobotInterface::loadFrictionConeSettings(const std::string &taskFile,
                                                    bool verbose) const {
-        boost::property_tree::ptree pt;
-        read_info(taskFile, pt);
+        const auto ptPtr = loadData::readInfoFile(taskFile);
+        const auto &pt = *ptPtr;
         const std::string prefix = "frictionConeSoftConstraint.";
 
         scalar_t frictionCoefficient = 1.0;
@@ -39,8 +39,8 @@ namespace ocs2::legged_robot {
     ModelSettings loadModelSettings(const std::string &filename, const std::string &fieldName, bool verbose) {
         ModelSettings modelSettings;
 
-        boost::property_tree::ptree pt;
-        read_info(filename, pt);
+        const auto ptPtr = loadData::readInfoFile(filename);
+        const auto &pt = *ptPtr;
 
         if (verbose) {
             std::cerr << "\n #### Legged Robot Model Settings:";
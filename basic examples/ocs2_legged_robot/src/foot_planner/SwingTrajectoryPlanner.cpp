@@ -217,8 +217,8 @@ namespace ocs2::legged_robot {
 
     SwingTrajectoryPlanner::Config loadSwingTrajectorySettings(const std::string &fileName,
                                                                const std::string &fieldName, bool verbose) {
-        boost::property_tree::ptree pt;
-        read_info(fileName, pt);
+        const auto ptPtr = loadData::readInfoFile(fileName);
+        const auto &pt = *ptPtr;
 
         if (verbose) {
             std::cerr << "\n #### Swing Trajectory Config:";
@@ -76,7 +76,8 @@ int main(int argc, char **argv) {
     // Dummy legged robot
     MRT_ROS_Dummy_Loop leggedRobotDummySimulator(
         mrt, interface.mpcSettings().mrtDesiredFrequency_,
-        interface.mpcSettings().mpcDesiredFrequency_);
+        interface.mpcSettings().mpcDesiredFrequency_,
+        interface.mpcSettings().mrtThreadPlacement_);
     leggedRobotDummySimulator.subscribeObservers({leggedRobotVisualizer});
 
     // Initial state
@@ -27,6 +27,7 @@ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  ******************************************************************************/
 
+#include <ocs2_core/misc/StartupProfiler.h>
 #include <ocs2_legged_robot/LeggedRobotInterface.h>
 #include <ocs2_ros_interfaces/mpc/MPC_ROS_Interface.h>
 #include <ocs2_ros_interfaces/synchronized_module/RosReferenceManager.h>
@@ -87,9 +88,12 @@ int main(int argc, char **argv) {
             auto callback = createConstraintCallback(
                 node, {0.0}, topicNames,
                 ros::CallbackInterpolationStrategy::linear_interpolation);
-            return SolverObserver::ConstraintTermObserver(
+            auto observer = SolverObserver::ConstraintTermObserver(
                 SolverObserver::Type::Intermediate, termName,
                 std::move(callback));
+            // Interpolate and publish off the MPC thread
+            observer->enableAsynchronousDispatch();
+            return observer;
         };
         for (size_t i = 0;
              i < interface.getCentroidalModelInfo().numThreeDofContacts; i++) {
@@ -100,6 +104,9 @@ int main(int argc, char **argv) {
         }
     }
 
+    // Time spent in configuration, codegen and model loading until here
+    benchmark::printStartupBreakdown();
+
     // Launch MPC ROS node
     MPC_ROS_Interface mpcNode(mpc, robotName);
     mpcNode.launchNodes(node);
@@ -27,6 +27,7 @@ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 ******************************************************************************/
 
+#include <algorithm>
 #include <string>
 
 #include <pinocchio/fwd.hpp>  // forward declarations must be included first.
@@ -53,6 +54,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "ocs2_mobile_manipulator/MobileManipulatorPreComputation.h"
 #include "ocs2_mobile_manipulator/constraint/EndEffectorConstraint.h"
 #include "ocs2_mobile_manipulator/constraint/MobileManipulatorSelfCollisionConstraint.h"
+#include "ocs2_mobile_manipulator/constraint/MobileManipulatorSphereSelfCollisionConstraint.h"
 #include "ocs2_mobile_manipulator/cost/QuadraticInputCost.h"
 #include "ocs2_mobile_manipulator/dynamics/DefaultManipulatorDynamics.h"
 #include "ocs2_mobile_manipulator/dynamics/FloatingArmManipulatorDynamics.h"
@@ -91,8 +93,8 @@ MobileManipulatorInterface::MobileManipulatorInterface(const std::string& taskFi
   std::cerr << "[MobileManipulatorInterface] Generated library path: " << libraryFolderPath << std::endl;
 
   // read the task file
-  boost::property_tree::ptree pt;
-  boost::property_tree::read_info(taskFile, pt);
+  const auto ptPtr = loadData::readInfoFile(taskFile);
+  const auto &pt = *ptPtr;
   // resolve meta-information about the model
   // read manipulator type
   ManipulatorModelType modelType = mobile_manipulator::loadManipulatorType(taskFile, "model_information.manipulatorModelType");
@@ -259,8 +261,8 @@ std::unique_ptr<StateCost> MobileManipulatorInterface::getEndEffectorConstraint(
   scalar_t muOrientation = 1.0;
   const std::string name = "WRIST_2";
 
-  boost::property_tree::ptree pt;
-  boost::property_tree::read_info(taskFile, pt);
+  const auto ptPtr = loadData::readInfoFile(taskFile);
+  const auto &pt = *ptPtr;
   std::cerr << "\n #### " << prefix << " Settings: ";
   std::cerr << "\n #### =============================================================================\n";
   loadData::loadPtreeValue(pt, muPosition, prefix + ".muPosition", true);
@@ -304,18 +306,52 @@ std::unique_ptr<StateCost> MobileManipulatorInterface::getSelfCollisionConstrain
   scalar_t mu = 1e-2;
   scalar_t delta = 1e-3;
   scalar_t minimumDistance = 0.0;
+  scalar_t activationMargin = std::numeric_limits<scalar_t>::infinity();
+  bool useSphereApproximation = false;
+  scalar_t sphereMaxExcess = 0.05;
+  scalar_t sphereShrinkRatio = 0.7;
 
-  boost::property_tree::ptree pt;
-  boost::property_tree::read_info(taskFile, pt);
+  const auto ptPtr = loadData::readInfoFile(taskFile);
+  const auto &pt = *ptPtr;
   std::cerr << "\n #### SelfCollision Settings: ";
   std::cerr << "\n #### =============================================================================\n";
   loadData::loadPtreeValue(pt, mu, prefix + ".mu", true);
   loadData::loadPtreeValue(pt, delta, prefix + ".delta", true);
   loadData::loadPtreeValue(pt, minimumDistance, prefix + ".minimumDistance", true);
+  loadData::loadPtreeValue(pt, activationMargin, prefix + ".activationMargin", true);
   loadData::loadStdVectorOfPair(taskFile, prefix + ".collisionObjectPairs", collisionObjectPairs, true);
   loadData::loadStdVectorOfPair(taskFile, prefix + ".collisionLinkPairs", collisionLinkPairs, true);
+  loadData::loadPtreeValue(pt, useSphereApproximation, prefix + ".useSphereApproximation", true);
+  loadData::loadPtreeValue(pt, sphereMaxExcess, prefix + ".sphereMaxExcess", true);
+  loadData::loadPtreeValue(pt, sphereShrinkRatio, prefix + ".sphereShrinkRatio", true);
   std::cerr << " #### =============================================================================\n";
 
+  if (useSphereApproximation) {
+    if (!usePreComputation) {
+      throw std::runtime_error(
+          "[MobileManipulatorInterface::getSelfCollisionConstraint] useSphereApproximation requires model_settings.usePreComputation!");
+    }
+
+    // every link appearing in a link pair is approximated with spheres; raw object pairs are not supported
+    std::vector<std::string> collisionLinks;
+    for (const auto& linkPair : collisionLinkPairs) {
+      for (const auto& link : {linkPair.first, linkPair.second}) {
+        if (std::find(collisionLinks.begin(), collisionLinks.end(), link) == collisionLinks.end()) {
+          collisionLinks.push_back(link);
+        }
+      }
+    }
+    const std::vector<scalar_t> maxExcesses(collisionLinks.size(), sphereMaxExcess);
+    PinocchioSphereInterface sphereInterface(pinocchioInterface, std::move(collisionLinks), maxExcesses, sphereShrinkRatio);
+
+    auto constraint = std::make_unique<MobileManipulatorSphereSelfCollisionConstraint>(
+        MobileManipulatorPinocchioMapping(manipulatorModelInfo_), sphereInterface, collisionLinkPairs, minimumDistance);
+    std::cerr << "SelfCollision: Testing for " << constraint->getNumConstraints(0.0) << " sphere pairs\n";
+
+    auto penalty = std::make_unique<RelaxedBarrierPenalty>(RelaxedBarrierPenalty::Config{mu, delta});
+    return std::make_unique<StateSoftConstraint>(std::move(constraint), std::move(penalty));
+  }
+
   PinocchioGeometryInterface geometryInterface(pinocchioInterface, collisionLinkPairs, collisionObjectPairs);
 
   const size_t numCollisionPairs = geometryInterface.getNumCollisionPairs();
@@ -324,7 +360,7 @@ std::unique_ptr<StateCost> MobileManipulatorInterface::getSelfCollisionConstrain
   std::unique_ptr<StateConstraint> constraint;
   if (usePreComputation) {
     constraint = std::make_unique<MobileManipulatorSelfCollisionConstraint>(MobileManipulatorPinocchioMapping(manipulatorModelInfo_),
-                                                                            std::move(geometryInterface), minimumDistance);
+                                                                            std::move(geometryInterface), minimumDistance, activationMargin);
   } else {
     constraint = std::make_unique<SelfCollisionConstraintCppAd>(
         pinocchioInterface, MobileManipulatorPinocchioMapping(manipulatorModelInfo_), std::move(geometryInterface), minimumDistance,
@@ -341,8 +377,8 @@ std::unique_ptr<StateCost> MobileManipulatorInterface::getSelfCollisionConstrain
 /******************************************************************************************************/
 std::unique_ptr<StateInputCost> MobileManipulatorInterface::getJointLimitSoftConstraint(const PinocchioInterface& pinocchioInterface,
                                                                                         const std::string& taskFile) {
-  boost::property_tree::ptree pt;
-  boost::property_tree::read_info(taskFile, pt);
+  const auto ptPtr = loadData::readInfoFile(taskFile);
+  const auto &pt = *ptPtr;
 
   bool activateJointPositionLimit = true;
   loadData::loadPtreeValue(pt, activateJointPositionLimit, "jointPositionLimits.activate", true);
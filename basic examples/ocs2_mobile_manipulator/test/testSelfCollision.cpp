@@ -35,6 +35,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <gtest/gtest.h>
 
+#include <ocs2_core/misc/Benchmark.h>
 #include <ocs2_core/misc/LoadData.h>
 #include <ocs2_robotic_assets/package_path.h>
 #include <ocs2_self_collision/SelfCollision.h>
@@ -156,3 +157,52 @@ TEST_F(TestSelfCollision, testRandomJointPositions) {
     ASSERT_TRUE(Jd1.isApprox(Jd2));
   }
 }
+
+TEST_F(TestSelfCollision, BroadPhaseCulling) {
+  const scalar_t activationMargin = 0.05;
+  const scalar_t activationDistance = minDistance + activationMargin;
+  const scalar_t eps = 1e-6;
+  SelfCollision selfCollision(geometryInterface, minDistance);
+  SelfCollision selfCollisionBroadPhase(geometryInterface, minDistance, activationMargin);
+
+  benchmark::RepeatedTimer timer, timerBroadPhase;
+  for (int i = 0; i < 100; i++) {
+    const vector_t q = vector_t::Random(9);
+    computeLinearApproximation(pinocchioInterface, q);
+
+    vector_t d1, d2;
+    matrix_t Jd1, Jd2;
+    timer.startTimer();
+    std::tie(d1, Jd1) = selfCollision.getLinearApproximation(pinocchioInterface);
+    timer.endTimer();
+    timerBroadPhase.startTimer();
+    std::tie(d2, Jd2) = selfCollisionBroadPhase.getLinearApproximation(pinocchioInterface);
+    timerBroadPhase.endTimer();
+
+    // central differences of the broad phase value
+    matrix_t Jd2FiniteDifference(d2.size(), q.size());
+    for (int k = 0; k < q.size(); k++) {
+      computeValue(pinocchioInterface, q + eps * vector_t::Unit(q.size(), k));
+      const vector_t dPlus = selfCollisionBroadPhase.getValue(pinocchioInterface);
+      computeValue(pinocchioInterface, q - eps * vector_t::Unit(q.size(), k));
+      const vector_t dMinus = selfCollisionBroadPhase.getValue(pinocchioInterface);
+      Jd2FiniteDifference.col(k) = (dPlus - dMinus) / (2.0 * eps);
+    }
+
+    for (int j = 0; j < d1.size(); j++) {
+      // the broad phase value is a lower bound of the exact distance
+      ASSERT_LE(d2[j], d1[j] + 1e-9);
+      if (d2[j] < d1[j] - 1e-9 && d2[j] + minDistance > activationDistance + 1e-3) {
+        // culled pairs, away from the activation boundary: the jacobian is the one of the lower bound
+        ASSERT_TRUE(Jd2.row(j).isApprox(Jd2FiniteDifference.row(j), 1e-4));
+      } else if (d2[j] + minDistance <= activationDistance) {
+        // active pairs are evaluated exactly
+        ASSERT_NEAR(d1[j], d2[j], 1e-9);
+        ASSERT_TRUE(Jd1.row(j).isApprox(Jd2.row(j)));
+      }
+    }
+  }
+
+  std::cerr << "[BroadPhaseCulling] average linear approximation time per node: full: " << timer.getAverageInMilliseconds()
+            << " [ms], broad phase: " << timerBroadPhase.getAverageInMilliseconds() << " [ms]\n";
+}
@@ -79,8 +79,8 @@ int main(int argc, char** argv) {
   std::string urdfPath = node->get_parameter("urdfFile").as_string();
 
   // read the task file
-  boost::property_tree::ptree pt;
-  boost::property_tree::read_info(taskFile, pt);
+  const auto ptPtr = loadData::readInfoFile(taskFile);
+  const auto &pt = *ptPtr;
   // read manipulator type
   ManipulatorModelType modelType = mobile_manipulator::loadManipulatorType(
       taskFile, "model_information.manipulatorModelType");
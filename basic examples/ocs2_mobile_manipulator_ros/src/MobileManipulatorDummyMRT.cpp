@@ -71,7 +71,8 @@ int main(int argc, char** argv) {
 
   // Dummy MRT
   MRT_ROS_Dummy_Loop dummy(mrt, interface.mpcSettings().mrtDesiredFrequency_,
-                           interface.mpcSettings().mpcDesiredFrequency_);
+                           interface.mpcSettings().mpcDesiredFrequency_,
+                           interface.mpcSettings().mrtThreadPlacement_);
   dummy.subscribeObservers({dummyVisualization});
 
   // initial state
@@ -93,8 +93,8 @@ void MobileManipulatorDummyVisualization::launchVisualizerNode() {
   loadData::loadStdVector<std::string>(
       taskFile, "model_information.removeJoints", removeJointNames_, false);
   // read if self-collision checking active
-  boost::property_tree::ptree pt;
-  boost::property_tree::read_info(taskFile, pt);
+  const auto ptPtr = loadData::readInfoFile(taskFile);
+  const auto &pt = *ptPtr;
   bool activateSelfCollision = true;
   loadData::loadPtreeValue(pt, activateSelfCollision, "selfCollision.activate",
                            true);
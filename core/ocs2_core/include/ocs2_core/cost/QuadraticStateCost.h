@@ -60,8 +60,12 @@ class QuadraticStateCost : public StateCost {
    * This method can be overwritten if desiredTrajectory has a different dimensions. */
   virtual vector_t getStateDeviation(scalar_t time, const vector_t& state, const TargetTrajectories& targetTrajectories) const;
 
+  /** Cursor for the lookup of the nominal state. Each thread evaluating this cost term gets its own cursor. */
+  TargetTrajectoriesCursor& getTargetTrajectoriesCursor() const { return targetTrajectoriesCursor_.get(); }
+
  private:
   matrix_t Q_;
+  ThreadLocalTargetTrajectoriesCursor targetTrajectoriesCursor_;
 };
 
 }  // namespace ocs2
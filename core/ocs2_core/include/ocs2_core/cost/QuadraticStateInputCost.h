@@ -66,10 +66,14 @@ class QuadraticStateInputCost : public StateInputCost {
   virtual std::pair<vector_t, vector_t> getStateInputDeviation(scalar_t time, const vector_t& state, const vector_t& input,
                                                                const TargetTrajectories& targetTrajectories) const;
 
+  /** Cursor for the lookup of the nominal state and input. Each thread evaluating this cost term gets its own cursor. */
+  TargetTrajectoriesCursor& getTargetTrajectoriesCursor() const { return targetTrajectoriesCursor_.get(); }
+
  private:
   matrix_t Q_;
   matrix_t R_;
   matrix_t P_;
+  ThreadLocalTargetTrajectoriesCursor targetTrajectoriesCursor_;
 };
 
 }  // namespace ocs2
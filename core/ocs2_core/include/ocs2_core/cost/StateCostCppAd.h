@@ -51,9 +51,11 @@ class StateCostCppAd : public StateCost {
    * @param modelFolder : Folder where the model library files are saved.
    * @param recompileLibraries : If true, always compile the model library, else try to load existing library if available.
    * @param verbose : Print information.
+   * @param approximationOrder : Order of the generated derivatives. With First, the Hessian of the quadratic approximation is zero.
    */
   void initialize(size_t stateDim, size_t parameterDim, const std::string& modelName, const std::string& modelFolder = "/tmp/ocs2",
-                  bool recompileLibraries = true, bool verbose = true);
+                  bool recompileLibraries = true, bool verbose = true,
+                  CppAdInterface::ApproximationOrder approximationOrder = CppAdInterface::ApproximationOrder::Second);
 
   /* Get the parameter vector */
   virtual vector_t getParameters(scalar_t time, const TargetTrajectories& targetTrajectories,
@@ -76,6 +78,7 @@ class StateCostCppAd : public StateCost {
 
  private:
   std::unique_ptr<ocs2::CppAdInterface> adInterfacePtr_;
+  CppAdInterface::ApproximationOrder approximationOrder_ = CppAdInterface::ApproximationOrder::Second;
 };
 
 }  // namespace ocs2
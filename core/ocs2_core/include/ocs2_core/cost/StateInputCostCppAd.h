@@ -52,9 +52,12 @@ class StateInputCostCppAd : public StateInputCost {
    * @param modelFolder : Folder where the model library files are saved.
    * @param recompileLibraries : If true, always compile the model library, else try to load existing library if available.
    * @param verbose : Print information.
+   * @param approximationOrder : Order of the generated derivatives. With First, the Hessian of the quadratic approximation is zero, which
+   *                             is meant for solvers that replace it by a quasi-Newton approximation.
    */
   void initialize(size_t stateDim, size_t inputDim, size_t parameterDim, const std::string& modelName,
-                  const std::string& modelFolder = "/tmp/ocs2", bool recompileLibraries = true, bool verbose = true);
+                  const std::string& modelFolder = "/tmp/ocs2", bool recompileLibraries = true, bool verbose = true,
+                  CppAdInterface::ApproximationOrder approximationOrder = CppAdInterface::ApproximationOrder::Second);
 
   /** Get the parameter vector */
   virtual vector_t getParameters(scalar_t time, const TargetTrajectories& targetTrajectories,
@@ -78,6 +81,7 @@ class StateInputCostCppAd : public StateInputCost {
 
  private:
   std::unique_ptr<ocs2::CppAdInterface> adInterfacePtr_;
+  CppAdInterface::ApproximationOrder approximationOrder_ = CppAdInterface::ApproximationOrder::Second;
 };
 
 }  // namespace ocs2
@@ -29,7 +29,6 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #pragma once
 
-#include <functional>
 #include <limits>
 #include <memory>
 
@@ -45,8 +44,47 @@ namespace ocs2 {
  */
 class IntegratorBase {
  public:
-  using system_func_t = std::function<void(const vector_t& x, vector_t& dxdt, scalar_t t)>;
-  using observer_func_t = std::function<void(const vector_t& x, scalar_t t)>;
+  /**
+   * Evaluates the flow map of the system and throws if the maximum number of function calls is exceeded. This concrete function object
+   * is passed to the steppers instead of a type-erased std::function, such that the calls can be inlined up to the system.
+   */
+  class SystemFunction {
+   public:
+    SystemFunction(OdeBase& system, int maxNumSteps) : systemPtr_(&system), maxNumSteps_(maxNumSteps) {}
+    void operator()(const vector_t& x, vector_t& dxdt, scalar_t t) const;
+
+   private:
+    OdeBase* systemPtr_;
+    int maxNumSteps_;
+  };
+
+  /** Stores the accepted steps in the observer and forwards them to the event handler. */
+  class ObserverFunction {
+   public:
+    ObserverFunction(OdeBase& system, Observer& observer, SystemEventHandler& eventHandler)
+        : systemPtr_(&system), observerPtr_(&observer), eventHandlerPtr_(&eventHandler) {}
+    void operator()(const vector_t& x, scalar_t t) const {
+      if (observerPtr_->observesDerivative()) {
+        observerPtr_->observe(x, systemPtr_->computeFlowMap(t, x), t);
+      } else {
+        observerPtr_->observe(x, t);
+      }
+      eventHandlerPtr_->handleEvent(*systemPtr_, t, x);
+    }
+    /** For steppers which already evaluated the derivative at (t, x). */
+    void operator()(const vector_t& x, const vector_t& dxdt, scalar_t t) const {
+      observerPtr_->observe(x, dxdt, t);
+      eventHandlerPtr_->handleEvent(*systemPtr_, t, x);
+    }
+
+   private:
+    OdeBase* systemPtr_;
+    Observer* observerPtr_;
+    SystemEventHandler* eventHandlerPtr_;
+  };
+
+  using system_func_t = SystemFunction;
+  using observer_func_t = ObserverFunction;
 
   /**
    * Default constructor
@@ -30,11 +30,13 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #pragma once
 
 #include <ocs2_core/Types.h>
+#include <ocs2_core/integration/TrajectoryArena.h>
 
 namespace ocs2 {
 
 /**
- * The Observer class stores data in given containers.
+ * The Observer class stores data in given containers. If a derivative trajectory is given, the time derivatives of the state are
+ * stored as well, such that the trajectory can be evaluated in between the time stamps by cubic Hermite interpolation (dense output).
  */
 class Observer {
  public:
@@ -43,8 +45,11 @@ class Observer {
    *
    * @param stateTrajectoryPtr: A pinter to an state trajectory container to store resulting state trajectory.
    * @param timeTrajectoryPtr: A pinter to an time trajectory container to store resulting time trajectory.
+   * @param stateArenaPtr: An optional arena whose recycled vectors are reused to store the states.
+   * @param derivativeTrajectoryPtr: A pointer to a container to store the time derivative of the state trajectory.
    */
-  explicit Observer(vector_array_t* stateTrajectoryPtr = nullptr, scalar_array_t* timeTrajectoryPtr = nullptr);
+  explicit Observer(vector_array_t* stateTrajectoryPtr = nullptr, scalar_array_t* timeTrajectoryPtr = nullptr,
+                    TrajectoryArena* stateArenaPtr = nullptr, vector_array_t* derivativeTrajectoryPtr = nullptr);
 
   /**
    * Default destructor.
@@ -58,9 +63,22 @@ class Observer {
    */
   void observe(const vector_t& state, scalar_t time);
 
+  /**
+   * Observe function to retrieve the variable of interest and the state derivative.
+   * @param [in] state: Current state.
+   * @param [in] derivative: Time derivative of the current state.
+   * @param [in] time: Current time.
+   */
+  void observe(const vector_t& state, const vector_t& derivative, scalar_t time);
+
+  /** Whether the state derivative is stored, i.e. observe() should be called with the derivative. */
+  bool observesDerivative() const { return derivativeTrajectoryPtr_ != nullptr; }
+
  private:
   scalar_array_t* timeTrajectoryPtr_;
   vector_array_t* stateTrajectoryPtr_;
+  TrajectoryArena* stateArenaPtr_;
+  vector_array_t* derivativeTrajectoryPtr_;
 };
 
 }  // namespace ocs2
@@ -29,6 +29,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #pragma once
 
+#include <memory>
+
 #include <ocs2_core/integration/IntegratorBase.h>
 
 namespace ocs2 {
@@ -37,14 +39,14 @@ namespace ocs2 {
  * 5th order Runge Kutta Dormand-Prince (ode45) Integrator class
  *
  * The implementation is based on the boost odeint integrator with the controlled
- * boost::numeric::odeint::runge_kutta_dopri5 stepper.
+ * boost::numeric::odeint::runge_kutta_dopri5 stepper. The stepper keeps its intermediate vectors between
+ * steps and integrations, such that the integration does not allocate memory once it has run.
  */
 class RungeKuttaDormandPrince5 : public IntegratorBase {
  public:
-  explicit RungeKuttaDormandPrince5(std::shared_ptr<SystemEventHandler> eventHandlerPtr = nullptr)
-      : IntegratorBase(std::move(eventHandlerPtr)){};
+  explicit RungeKuttaDormandPrince5(std::shared_ptr<SystemEventHandler> eventHandlerPtr = nullptr);
 
-  ~RungeKuttaDormandPrince5() override = default;
+  ~RungeKuttaDormandPrince5() override;
 
  private:
   /**
@@ -91,6 +93,13 @@ class RungeKuttaDormandPrince5 : public IntegratorBase {
                          scalar_t dtInitial, scalar_t absTol, scalar_t relTol) override;
 
   static constexpr size_t maxNumStepsRetries_ = 100;
+
+  class Stepper;
+  std::unique_ptr<Stepper> stepperPtr_;
+
+  // State and its derivative during the integration, kept to reuse their memory
+  vector_t x_;
+  vector_t dxdt_;
 };
 
 }  // namespace ocs2
@@ -0,0 +1,84 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+
+#pragma once
+
+#include <ocs2_core/Types.h>
+
+namespace ocs2 {
+
+/**
+ * Keeps the vectors of previous trajectories such that new trajectories can be filled without allocating memory. A rollout recycles the
+ * elements of its output trajectory before overwriting it and then appends the new states through pushBack(), which copies into the memory
+ * of a recycled vector of the same size. Once the arena holds as many vectors as the longest trajectory, filling a trajectory does not
+ * allocate anymore.
+ *
+ * A copy starts with an empty arena, such that cloned rollouts do not share or duplicate the storage.
+ */
+class TrajectoryArena {
+ public:
+  TrajectoryArena() = default;
+  TrajectoryArena(const TrajectoryArena&) : TrajectoryArena() {}
+  TrajectoryArena& operator=(const TrajectoryArena&) { return *this; }
+
+  /** Moves the vectors of the trajectory into the arena and clears the trajectory. */
+  void recycle(vector_array_t& trajectory) {
+    spare_.reserve(spare_.size() + trajectory.size());
+    for (auto& v : trajectory) {
+      spare_.push_back(std::move(v));
+    }
+    trajectory.clear();
+  }
+
+  /** Appends a copy of the value to the trajectory, reusing a recycled vector if available. */
+  void pushBack(vector_array_t& trajectory, const vector_t& value) {
+    if (spare_.empty()) {
+      trajectory.push_back(value);
+    } else {
+      trajectory.push_back(std::move(spare_.back()));
+      spare_.pop_back();
+      trajectory.back() = value;
+    }
+  }
+
+  /** Removes the last element of the trajectory and keeps its memory in the arena. */
+  void popBack(vector_array_t& trajectory) {
+    spare_.push_back(std::move(trajectory.back()));
+    trajectory.pop_back();
+  }
+
+  /** Number of vectors kept in the arena. */
+  size_t size() const { return spare_.size(); }
+
+ private:
+  vector_array_t spare_;
+};
+
+}  // namespace ocs2
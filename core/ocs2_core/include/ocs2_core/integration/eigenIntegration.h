@@ -32,6 +32,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <Eigen/Dense>
 #include <boost/numeric/odeint/algebra/vector_space_algebra.hpp>
+#include <boost/numeric/odeint/stepper/controlled_runge_kutta.hpp>
 
 // Necessary routines for Eigen matrices to work with vector_space_algebra
 // from odeint
@@ -106,6 +107,18 @@ struct vector_space_norm_inf<Eigen::Matrix<double, S1, S2, O, M1, M2>> {
   result_type operator()(const Eigen::Matrix<double, S1, S2, O, M1, M2>& m) const { return m.template lpNorm<Eigen::Infinity>(); }
 };
 
+// computes the relative error in place, the generic implementation copies the vectors in get_unit_value()
+template <>
+template <>
+inline double default_error_checker<double, vector_space_algebra, default_operations>::error(vector_space_algebra& /*algebra*/,
+                                                                                            const Eigen::VectorXd& x_old,
+                                                                                            const Eigen::VectorXd& dxdt_old,
+                                                                                            Eigen::VectorXd& x_err, double dt) const {
+  x_err.array() =
+      x_err.array().abs() / (m_eps_abs + m_eps_rel * (m_a_x * x_old.array().abs() + m_a_dxdt * std::abs(dt) * dxdt_old.array().abs()));
+  return x_err.lpNorm<Eigen::Infinity>();
+}
+
 #else
 
 // old boost
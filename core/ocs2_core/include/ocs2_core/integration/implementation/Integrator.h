@@ -32,6 +32,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <type_traits>
 
 #include <boost/numeric/odeint.hpp>
+#include <boost/ref.hpp>
 
 #include <ocs2_core/integration/Integrator.h>
 #include <ocs2_core/integration/eigenIntegration.h>
@@ -198,10 +199,25 @@ class Integrator final : public IntegratorBase {
   typename std::enable_if<!(std::is_same<S, runge_kutta_dopri5_t>::value), void>::type initializeStepper(vector_t& initialState, scalar_t t,
                                                                                                          scalar_t dt);
 
+  using controlled_runge_kutta_dopri5_t = boost::numeric::odeint::controlled_runge_kutta<runge_kutta_dopri5_t>;
+
+  /**
+   * Returns the error controlled ODE45 stepper, reset for a new integration. The stepper is kept to reuse the memory of its intermediate
+   * vectors and is only rebuilt when the tolerances change.
+   *
+   * @param [in] AbsTol: The absolute tolerance error for ode solver.
+   * @param [in] RelTol: The relative tolerance error for ode solver.
+   */
+  controlled_runge_kutta_dopri5_t& getControlledStepper(scalar_t AbsTol, scalar_t RelTol);
+
   /*
    * Variables
    */
   Stepper stepper_;
+  vector_t state_;  // integrated state, kept to reuse its memory
+  controlled_runge_kutta_dopri5_t controlledStepper_;
+  scalar_t controlledStepperAbsTol_ = -1.0;
+  scalar_t controlledStepperRelTol_ = -1.0;
 };
 
 
@@ -216,10 +232,10 @@ inline void Integrator<Stepper>::runIntegrateConst(system_func_t system, observe
   // vector_t initialStateInternal_init_temp = initialState;
   // initializeStepper(initialStateInternal_init_temp, startTime, dt);
 
-  vector_t initialStateInternal = initialState;
+  state_ = initialState;
   // Ensure that finalTime is included by adding a fraction of dt such that: N * dt <= finalTime < (N + 1) * dt.
   finalTime += 0.1 * dt;
-  boost::numeric::odeint::integrate_const(stepper_, system, initialStateInternal, startTime, finalTime, dt, observer);
+  boost::numeric::odeint::integrate_const(stepper_, system, state_, startTime, finalTime, dt, observer);
 }
 
 
@@ -227,8 +243,8 @@ template <class Stepper>
 inline void Integrator<Stepper>::runIntegrateAdaptive(system_func_t system, observer_func_t observer, const vector_t& initialState,
                                                       scalar_t startTime, scalar_t finalTime, scalar_t dtInitial, scalar_t AbsTol,
                                                       scalar_t RelTol) {
-  vector_t internalStartState = initialState;
-  integrateAdaptiveSpecialized<Stepper>(system, observer, internalStartState, startTime, finalTime, dtInitial, AbsTol, RelTol);
+  state_ = initialState;
+  integrateAdaptiveSpecialized<Stepper>(system, observer, state_, startTime, finalTime, dtInitial, AbsTol, RelTol);
 }
 
 
@@ -237,8 +253,8 @@ inline void Integrator<Stepper>::runIntegrateTimes(system_func_t system, observe
                                                    typename scalar_array_t::const_iterator beginTimeItr,
                                                    typename scalar_array_t::const_iterator endTimeItr, scalar_t dtInitial, scalar_t AbsTol,
                                                    scalar_t RelTol) {
-  vector_t internalStartState = initialState;
-  integrateTimesSpecialized<Stepper>(system, observer, internalStartState, beginTimeItr, endTimeItr, dtInitial, AbsTol, RelTol);
+  state_ = initialState;
+  integrateTimesSpecialized<Stepper>(system, observer, state_, beginTimeItr, endTimeItr, dtInitial, AbsTol, RelTol);
 }
 
 
@@ -247,8 +263,8 @@ template <typename S>
 inline typename std::enable_if<std::is_same<S, runge_kutta_dopri5_t>::value, void>::type Integrator<Stepper>::integrateAdaptiveSpecialized(
     system_func_t system, observer_func_t observer, vector_t& initialState, scalar_t startTime, scalar_t finalTime, scalar_t dtInitial,
     scalar_t AbsTol, scalar_t RelTol) {
-  boost::numeric::odeint::integrate_adaptive(boost::numeric::odeint::make_controlled<S>(AbsTol, RelTol), system, initialState, startTime,
-                                             finalTime, dtInitial, observer);
+  boost::numeric::odeint::integrate_adaptive(boost::ref(getControlledStepper(AbsTol, RelTol)), system, initialState, startTime, finalTime,
+                                             dtInitial, observer);
 }
 
 
@@ -270,11 +286,11 @@ inline typename std::enable_if<std::is_same<S, runge_kutta_dopri5_t>::value, voi
   boost::numeric::odeint::max_step_checker maxStepChecker(
       std::numeric_limits<int>::max());  // maxNumSteps is already checked by event handler.
 
-  boost::numeric::odeint::integrate_times(boost::numeric::odeint::make_controlled<S>(AbsTol, RelTol), system, initialState, beginTimeItr,
-                                          endTimeItr, dtInitial, observer, maxStepChecker);
+  boost::numeric::odeint::integrate_times(boost::ref(getControlledStepper(AbsTol, RelTol)), system, initialState, beginTimeItr, endTimeItr,
+                                          dtInitial, observer, maxStepChecker);
 #else
-  boost::numeric::odeint::integrate_times(boost::numeric::odeint::make_controlled<S>(AbsTol, RelTol), system, initialState, beginTimeItr,
-                                          endTimeItr, dtInitial, observer);
+  boost::numeric::odeint::integrate_times(boost::ref(getControlledStepper(AbsTol, RelTol)), system, initialState, beginTimeItr, endTimeItr,
+                                          dtInitial, observer);
 #endif
 }
 
@@ -311,6 +327,18 @@ typename std::enable_if<!(std::is_same<S, runge_kutta_dopri5_t>::value), void>::
   stepper_.initialize(runge_kutta_dopri5_t(), system, initialState, t, dt);
 }
 
+template <class Stepper>
+inline typename Integrator<Stepper>::controlled_runge_kutta_dopri5_t& Integrator<Stepper>::getControlledStepper(scalar_t AbsTol,
+                                                                                                             scalar_t RelTol) {
+  if (AbsTol != controlledStepperAbsTol_ || RelTol != controlledStepperRelTol_) {
+    controlledStepper_ = boost::numeric::odeint::make_controlled<runge_kutta_dopri5_t>(AbsTol, RelTol);
+    controlledStepperAbsTol_ = AbsTol;
+    controlledStepperRelTol_ = RelTol;
+  }
+  controlledStepper_.reset();  // do not reuse the derivative of the last integration
+  return controlledStepper_;
+}
+
 /**
  * Euler integrator.
  */
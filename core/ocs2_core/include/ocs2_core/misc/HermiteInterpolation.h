@@ -0,0 +1,105 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+
+#pragma once
+
+#include <vector>
+
+#include "ocs2_core/Types.h"
+#include "ocs2_core/misc/LinearInterpolation.h"
+
+
+namespace ocs2::HermiteInterpolation {
+    /**
+     * Cubic Hermite interpolation of a trajectory whose time derivative is known at the time stamps, e.g. the dense output of an
+     * integrator which observes the state derivative. The interval index and interpolation coefficient are the ones of
+     * LinearInterpolation::timeSegment, therefore the lookup and the extrapolation behave as for the linear interpolation.
+     *
+     *  - Single data point implies a constant function
+     *  - Multiple data points are used for cubic interpolation and zero order extrapolation
+     *
+     * @param [in] indexAlpha : index and interpolation coefficient (alpha) pair
+     * @param [in] timeArray: Times vector
+     * @param [in] dataArray: Data vector
+     * @param [in] derivativeArray: Time derivative of the data at the time stamps
+     * @return The interpolation result
+     */
+    inline vector_t interpolate(LinearInterpolation::index_alpha_t indexAlpha, const std::vector<scalar_t> &timeArray,
+                                const vector_array_t &dataArray, const vector_array_t &derivativeArray) {
+        assert(dataArray.size() > 0);
+        assert(dataArray.size() == timeArray.size() && derivativeArray.size() == timeArray.size());
+        if (dataArray.size() == 1) {
+            return dataArray.front();
+        }
+
+        const int index = indexAlpha.first;
+        const scalar_t s = scalar_t(1.0) - indexAlpha.second; // normalized time in the interval
+        const scalar_t h = timeArray[index + 1] - timeArray[index];
+        const scalar_t s2 = s * s;
+        const scalar_t s3 = s2 * s;
+        const scalar_t h00 = 2.0 * s3 - 3.0 * s2 + 1.0;
+        const scalar_t h10 = s3 - 2.0 * s2 + s;
+        const scalar_t h01 = -2.0 * s3 + 3.0 * s2;
+        const scalar_t h11 = s3 - s2;
+        return h00 * dataArray[index] + (h10 * h) * derivativeArray[index] + h01 * dataArray[index + 1] +
+               (h11 * h) * derivativeArray[index + 1];
+    }
+
+    /**
+     * Cubic Hermite interpolation at the given time, see interpolate(indexAlpha, ...).
+     *
+     * @param [in] enquiryTime: The enquiry time for interpolation.
+     * @param [in] timeArray: Times vector
+     * @param [in] dataArray: Data vector
+     * @param [in] derivativeArray: Time derivative of the data at the time stamps
+     * @return The interpolation result
+     */
+    inline vector_t interpolate(scalar_t enquiryTime, const std::vector<scalar_t> &timeArray, const vector_array_t &dataArray,
+                                const vector_array_t &derivativeArray) {
+        return interpolate(LinearInterpolation::timeSegment(enquiryTime, timeArray), timeArray, dataArray, derivativeArray);
+    }
+
+    /**
+     * Same as interpolate(enquiryTime, ...), but the lookup starts at indexHint and indexHint is updated with the result of the lookup.
+     * Reusing the hint for a sequence of monotonic queries avoids a full binary search per query.
+     *
+     * @param [in] enquiryTime: The enquiry time for interpolation.
+     * @param [in] timeArray: Times vector
+     * @param [in] dataArray: Data vector
+     * @param [in] derivativeArray: Time derivative of the data at the time stamps
+     * @param [in, out] indexHint: lookup index of the previous query, see LinearInterpolation::timeSegment.
+     * @return The interpolation result
+     */
+    inline vector_t interpolate(scalar_t enquiryTime, const std::vector<scalar_t> &timeArray, const vector_array_t &dataArray,
+                                const vector_array_t &derivativeArray, int &indexHint) {
+        return interpolate(LinearInterpolation::timeSegment(enquiryTime, timeArray, indexHint), timeArray, dataArray,
+                           derivativeArray);
+    }
+} // namespace ocs2::HermiteInterpolation
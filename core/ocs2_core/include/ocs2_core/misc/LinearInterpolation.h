@@ -52,6 +52,17 @@ namespace ocs2::LinearInterpolation {
      */
     index_alpha_t timeSegment(scalar_t enquiryTime, const std::vector<scalar_t> &timeArray);
 
+    /**
+     * Same as timeSegment, but the lookup starts at indexHint and indexHint is updated with the result of the lookup.
+     * Reusing the hint for a sequence of monotonic queries avoids a full binary search per query.
+     *
+     * @param [in] enquiryTime: The enquiry time for interpolation.
+     * @param [in] timeArray: interpolation time array.
+     * @param [in, out] indexHint: lookup index of the previous query, see lookup::findIndexInTimeArray. Any value is accepted.
+     * @return {index, alpha}
+     */
+    index_alpha_t timeSegment(scalar_t enquiryTime, const std::vector<scalar_t> &timeArray, int &indexHint);
+
     /**
      * Directly uses the index and interpolation coefficient provided by the user
      * @note If sizes in data array are not equal, the interpolation will snap to the data
@@ -37,6 +37,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <boost/property_tree/info_parser.hpp>
 #include <boost/property_tree/ptree.hpp>
 
+#include "ocs2_core/misc/PropertyTreeCache.h"
+
 
 namespace ocs2::loadData {
     /**
@@ -103,8 +105,8 @@ namespace ocs2::loadData {
      */
     template<typename cpp_data_t>
     void loadCppDataType(const std::string &filename, const std::string &dataName, cpp_data_t &value) {
-        boost::property_tree::ptree pt;
-        read_info(filename, pt);
+        const auto ptPtr = readInfoFile(filename);
+        const auto &pt = *ptPtr;
 
         value = pt.get<cpp_data_t>(dataName);
     }
@@ -142,8 +144,8 @@ namespace ocs2::loadData {
                 "[loadEigenMatrix] Loading empty matrix \"" + matrixName + "\" is not allowed.");
         }
 
-        boost::property_tree::ptree pt;
-        read_info(filename, pt);
+        const auto ptPtr = readInfoFile(filename);
+        const auto &pt = *ptPtr;
 
         const scalar_t scaling = pt.get<scalar_t>(matrixName + ".scaling", 1.0);
         const scalar_t defaultValue = pt.get<scalar_t>(matrixName + ".default", 0.0);
@@ -175,8 +177,8 @@ namespace ocs2::loadData {
     template<typename T>
     void loadStdVector(const std::string &filename, const std::string &topicName, std::vector<T> &loadVector,
                        bool verbose = true) {
-        boost::property_tree::ptree pt;
-        read_info(filename, pt);
+        const auto ptPtr = readInfoFile(filename);
+        const auto &pt = *ptPtr;
 
         std::vector<T> backup;
         backup.swap(loadVector);
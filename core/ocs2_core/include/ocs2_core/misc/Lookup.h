@@ -90,6 +90,45 @@ namespace ocs2::lookup {
         return static_cast<int>(firstLargerValueIterator - timeArray.begin());
     }
 
+    /**
+   * Same as findIndexInTimeArray, but starts the search at indexHint. The search gallops away from the hint, such that
+   * a sequence of monotonic queries with small steps takes constant time per query instead of a full binary search.
+   *
+   * @tparam SCALAR : numerical type of time
+   * @param timeArray : sorted time array to perform the lookup in
+   * @param time : enquiry time
+   * @param indexHint : expected index, e.g., the result of the previous query. Any value is accepted.
+   * @return index between [0, size(timeArray)]
+   */
+    template<typename SCALAR = double>
+    int findIndexInTimeArray(const std::vector<SCALAR> &timeArray, SCALAR time, int indexHint) {
+        const int size = static_cast<int>(timeArray.size());
+        int lower = std::min(std::max(indexHint, 0), size);
+        int upper = lower;
+        if (lower > 0 && !(timeArray[lower - 1] < time)) {
+            // The index is before the hint, i.e., in [0, hint - 1]
+            int step = 1;
+            upper = lower - 1;
+            lower = std::max(upper - step, 0);
+            while (lower > 0 && !(timeArray[lower - 1] < time)) {
+                upper = lower - 1;
+                step *= 2;
+                lower = std::max(upper - step, 0);
+            }
+        } else {
+            // The index is at or after the hint, i.e., in [hint, size]
+            int step = 1;
+            while (upper < size && timeArray[upper] < time) {
+                lower = upper + 1;
+                upper = std::min(upper + step, size);
+                step *= 2;
+            }
+        }
+        // The index is in [lower, upper]
+        auto firstLargerValueIterator = std::lower_bound(timeArray.begin() + lower, timeArray.begin() + upper, time);
+        return static_cast<int>(firstLargerValueIterator - timeArray.begin());
+    }
+
     /**
    *  Find interval into a sorted time Array
    *
@@ -0,0 +1,73 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include <boost/property_tree/ptree.hpp>
+
+namespace ocs2::loadData {
+    /**
+     * Returns the property tree of an INFO file. Each file is parsed once and the tree is shared by all loaders, it is only parsed again
+     * if the nanosecond modification time or the size of the file changed. As filesystems may store coarse modification times, the
+     * content of a file modified shortly before it was parsed is compared as well. Thread-safe.
+     *
+     * If a snapshot directory is set, see setPropertyTreeSnapshotDirectory(), the parsed tree is also stored there in a binary format keyed
+     * by the hash of the file content, such that a restart with an unchanged file skips the parsing. Files which contain an #include
+     * directive are not snapshotted, as their tree depends on other files.
+     *
+     * @param [in] filename: File name of the INFO file.
+     * @return The property tree, which is not modified by later calls.
+     */
+    std::shared_ptr<const boost::property_tree::ptree> readInfoFile(const std::string &filename);
+
+    /**
+     * Sets the directory of the binary snapshots, which is created if it does not exist. An empty directory disables the snapshots. The
+     * default is taken from the environment variable OCS2_SETTINGS_SNAPSHOT_DIR, disabled if it is not set.
+     */
+    void setPropertyTreeSnapshotDirectory(const std::string &directory);
+
+    /** Clears the in-memory trees, the binary snapshots are kept. */
+    void clearPropertyTreeCache();
+
+    /**
+     * Writes a property tree to a binary file.
+     * Layout: "OCS2PT" '\0' uint8 version, then recursively per node: data, uint32 number of children, per child: key and node.
+     * Strings are stored as a uint32 length followed by the characters.
+     */
+    void writePropertyTreeSnapshot(const boost::property_tree::ptree &pt, const std::string &filename);
+
+    /**
+     * Reads a property tree written by writePropertyTreeSnapshot().
+     * @return False if the file does not exist or is not a valid snapshot, in which case pt is unspecified.
+     */
+    bool readPropertyTreeSnapshot(const std::string &filename, boost::property_tree::ptree &pt);
+} // namespace ocs2::loadData
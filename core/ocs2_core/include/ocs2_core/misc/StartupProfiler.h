@@ -0,0 +1,76 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#pragma once
+
+#include <chrono>
+#include <iostream>
+
+namespace ocs2::benchmark {
+    /** Phases of the startup of a node */
+    enum class StartupPhase {
+        /** Reading the settings files */
+        Configuration,
+        /** Generating, compiling and loading the auto-differentiated models */
+        Codegen,
+        /** Parsing the robot description and building the kinematic model */
+        ModelLoading,
+        /** Number of phases, keep last */
+        Count
+    };
+
+    /**
+     * Adds the time between its construction and destruction to a startup phase. Timers nested in another startup timer on the same thread
+     * are ignored, such that a phase which calls into another one is not counted twice. The times of concurrent threads are summed.
+     */
+    class ScopedStartupTimer {
+    public:
+        explicit ScopedStartupTimer(StartupPhase phase);
+
+        ~ScopedStartupTimer();
+
+        ScopedStartupTimer(const ScopedStartupTimer &) = delete;
+
+        ScopedStartupTimer &operator=(const ScopedStartupTimer &) = delete;
+
+    private:
+        StartupPhase phase_;
+        bool isOutermost_;
+        std::chrono::steady_clock::time_point startTime_;
+    };
+
+    /** Returns the total time spent in a startup phase in [ms]. */
+    double getStartupPhaseTime(StartupPhase phase);
+
+    /** Returns the time since the library was loaded in [ms], which approximates the time since the start of the process. */
+    double getTimeSinceStartup();
+
+    /** Prints the time spent in each startup phase and the remaining time since the library was loaded. */
+    void printStartupBreakdown(std::ostream &stream = std::cerr);
+} // namespace ocs2::benchmark
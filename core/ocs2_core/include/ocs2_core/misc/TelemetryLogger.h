@@ -0,0 +1,188 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <ocs2_core/Types.h>
+
+namespace ocs2 {
+    /** Telemetry logger settings */
+    struct TelemetryLoggerSettings {
+        /** Number of rows the ring buffer can hold, rounded up to a power of two. Rows appended to a full buffer are dropped. */
+        size_t bufferSize = 4096;
+        /** Maximum number of rows per column chunk in the file. */
+        size_t chunkSize = 1024;
+        /** Period [s] at which the writer thread drains the ring buffer. */
+        scalar_t writePeriod = 0.01;
+        /** Period [s] at which the pending rows are written and the file is flushed. */
+        scalar_t flushPeriod = 1.0;
+        /** Write through a memory-mapped file instead of a file stream. */
+        bool useMemoryMappedFile = false;
+        /** Size [bytes] by which the memory-mapped file grows when it is full. */
+        size_t memoryMappedGrowthSize = 64 * 1024 * 1024;
+    };
+
+    /**
+     * Streams rows of a fixed schema of scalar columns to a binary file, e.g., the robot state from the control loop or the statistics of
+     * the solver iterations.
+     *
+     * append() copies the row into a lock-free multi-producer ring buffer and never blocks or allocates, such that it can be called from
+     * real-time threads. A background thread drains the buffer and writes the rows in column-major chunks. Memory use is therefore bounded
+     * by the buffer size, independent of the duration of the run. Rows are dropped if the buffer is full, see getNumDropped(). If the
+     * writer fails, e.g., because the disk is full, the error is recorded and logging stops, see hasFailed().
+     *
+     * File layout (little endian):
+     *  header : "OCS2TLM" '\0', uint32 version, uint32 number of columns, per column: uint32 name length followed by the name.
+     *  chunks : uint64 number of rows N, followed by the N values of each column in turn (float64).
+     * A chunk with zero rows or the end of the file terminates the data. Use readTelemetry() to read the file back.
+     */
+    class TelemetryLogger {
+    public:
+        /**
+         * Constructor, opens the file and starts the writer thread.
+         * @param [in] fileName: Path of the binary file, which is overwritten.
+         * @param [in] columnNames: Names of the columns.
+         * @param [in] settings: The logger settings.
+         */
+        TelemetryLogger(const std::string &fileName, std::vector<std::string> columnNames, TelemetryLoggerSettings settings = {});
+
+        /** The destructor writes the remaining rows and closes the file. */
+        ~TelemetryLogger();
+
+        TelemetryLogger(const TelemetryLogger &) = delete;
+
+        TelemetryLogger &operator=(const TelemetryLogger &) = delete;
+
+        /**
+         * Appends a row, thread-safe and lock-free.
+         * @param [in] row: Pointer to getNumColumns() values.
+         * @return false if the buffer is full and the row is dropped, or if the logging stopped after a write error.
+         */
+        bool append(const scalar_t *row);
+
+        /** Appends a row, the size of the vector must match the number of columns. */
+        bool append(const vector_t &row);
+
+        const std::string &getFileName() const { return fileName_; }
+
+        const std::vector<std::string> &getColumnNames() const { return columnNames_; }
+
+        size_t getNumColumns() const { return columnNames_.size(); }
+
+        /** Number of rows dropped because the buffer was full. */
+        size_t getNumDropped() const { return numDropped_.load(std::memory_order_relaxed); }
+
+        /** Number of rows written to the file so far. */
+        size_t getNumWritten() const { return numWritten_.load(std::memory_order_relaxed); }
+
+        /** Whether the writer failed to write the file and stopped logging. */
+        bool hasFailed() const { return failed_.load(std::memory_order_acquire); }
+
+        /** The error of the writer, empty unless hasFailed(). */
+        std::string getErrorMessage() const { return hasFailed() ? errorMessage_ : std::string(); }
+
+        /** The format version written to the header. */
+        static constexpr uint32_t formatVersion = 1;
+
+    private:
+        void run();
+
+        /** Moves all rows from the ring buffer to the chunk, writes the chunk when it is full. */
+        void drain();
+
+        void writeChunk();
+
+        void writeBytes(const void *data, size_t numBytes);
+
+        void flushFile();
+
+        void closeFile();
+
+        const std::string fileName_;
+        const std::vector<std::string> columnNames_;
+        const TelemetryLoggerSettings settings_;
+
+        // Ring buffer, sequences_[i] tells whether slot i is free for the producers or ready for the writer
+        size_t capacity_;
+        size_t mask_;
+        std::vector<scalar_t> rows_;
+        std::unique_ptr<std::atomic<size_t>[]> sequences_;
+        alignas(64) std::atomic<size_t> enqueuePosition_{0};
+        alignas(64) size_t dequeuePosition_ = 0;
+        std::atomic<size_t> numDropped_{0};
+        std::atomic<size_t> numWritten_{0};
+
+        // Error of the writer thread, the message is written before failed_ is set
+        std::atomic<bool> failed_{false};
+        std::string errorMessage_;
+
+        // Chunk in column-major order, only accessed by the writer thread
+        std::vector<scalar_t> chunk_;
+        size_t chunkRows_ = 0;
+
+        // File
+        std::ofstream file_;
+        int fileDescriptor_ = -1;
+        char *mappedData_ = nullptr;
+        size_t mappedSize_ = 0;
+        size_t fileSize_ = 0;
+
+        // Writer thread
+        std::mutex stopMutex_;
+        std::condition_variable stopCondition_;
+        bool stop_ = false;
+        std::thread writerThread_;
+    };
+
+    /** Content of a telemetry file. */
+    struct TelemetryData {
+        std::vector<std::string> columnNames;
+        /** One row per logged row, one column per logged column. */
+        matrix_t data;
+    };
+
+    /** Reads a file written by the TelemetryLogger. */
+    TelemetryData readTelemetry(const std::string &fileName);
+
+    /** Writes the telemetry as comma separated values with a header line. */
+    void writeTelemetryCsv(const TelemetryData &telemetry, std::ostream &stream);
+
+    /** Writes the telemetry as a NumPy .npy file of a structured array, the fields are named after the columns. */
+    void writeTelemetryNpy(const TelemetryData &telemetry, const std::string &fileName);
+} // namespace ocs2
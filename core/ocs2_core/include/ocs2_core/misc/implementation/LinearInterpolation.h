@@ -60,13 +60,15 @@ namespace ocs2::LinearInterpolation {
     }
 
 
-    inline index_alpha_t timeSegment(scalar_t enquiryTime, const std::vector<scalar_t> &timeArray) {
+    /**
+   * Helper function that computes the interval index and interpolation coefficient from the result of the interval lookup.
+   */
+    inline index_alpha_t timeSegmentFromInterval(scalar_t enquiryTime, const std::vector<scalar_t> &timeArray, int index) {
         // corner cases (no time set OR single time element)
         if (timeArray.size() <= 1) {
             return {0, scalar_t(1.0)};
         }
 
-        const int index = lookup::findIntervalInTimeArray(timeArray, enquiryTime);
         const auto lastInterval = static_cast<int>(timeArray.size() - 1);
         if (index >= 0) {
             if (index < lastInterval) {
@@ -101,6 +103,17 @@ namespace ocs2::LinearInterpolation {
     }
 
 
+    inline index_alpha_t timeSegment(scalar_t enquiryTime, const std::vector<scalar_t> &timeArray) {
+        return timeSegmentFromInterval(enquiryTime, timeArray, lookup::findIntervalInTimeArray(timeArray, enquiryTime));
+    }
+
+
+    inline index_alpha_t timeSegment(scalar_t enquiryTime, const std::vector<scalar_t> &timeArray, int &indexHint) {
+        indexHint = lookup::findIndexInTimeArray(timeArray, enquiryTime, indexHint);
+        return timeSegmentFromInterval(enquiryTime, timeArray, indexHint - 1);
+    }
+
+
     template<typename Data, class Alloc>
     Data interpolate(index_alpha_t indexAlpha, const std::vector<Data, Alloc> &dataArray) {
         return interpolate(indexAlpha, dataArray, stdAccessFun<Data, Alloc>);
@@ -185,6 +185,17 @@ size_array_t getSizes(const std::vector<LagrangianMetrics>& termsLagrangianMetri
  */
 vector_array_t toConstraintArray(const size_array_t& termsSize, const vector_t& vec);
 
+/**
+ * Deserializes the vector to an array of constraint terms in place. The existing vectors of constraintArray are reused, such that no
+ * memory is allocated if the terms have the same size as in the previous call.
+ *
+ * @param [in] termsSize : An array of constraint terms size. It as the same size as the output array.
+ * @param [in] vec : Serialized array of constraint terms of the format :
+ *                   (..., constraintArray[i], ...)
+ * @param [out] constraintArray : An array of constraint terms.
+ */
+void toConstraintArray(const size_array_t& termsSize, const vector_t& vec, vector_array_t& constraintArray);
+
 /**
  * Deserializes the vector to an array of LagrangianMetrics structures based on size of constraint terms.
  *
@@ -29,6 +29,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #pragma once
 
+#include <array>
+#include <memory>
+
 #include "ocs2_core/Types.h"
 
 namespace ocs2 {
@@ -59,6 +62,55 @@ namespace ocs2 {
         vector_array_t inputTrajectory;
     };
 
+    /**
+     * Cursor for repeated lookups in TargetTrajectories. It remembers the position of the last query in the time trajectory,
+     * such that a sweep over monotonic times does not run a binary search per query, and it interpolates into its own
+     * buffers, such that no memory is allocated once the buffers have the size of the state and input.
+     *
+     * A cursor is not thread safe. An object that may be evaluated from several threads, e.g., a cost term, should hold a
+     * ThreadLocalTargetTrajectoriesCursor instead. The cursor does not keep a reference to the target trajectories, it stays
+     * valid if they are replaced.
+     */
+    class TargetTrajectoriesCursor {
+    public:
+        /** Desired state at the given time, same as TargetTrajectories::getDesiredState. Valid until the next call. */
+        const vector_t &getDesiredState(const TargetTrajectories &targetTrajectories, scalar_t time);
+
+        /** Desired input at the given time, same as TargetTrajectories::getDesiredInput. Valid until the next call. */
+        const vector_t &getDesiredInput(const TargetTrajectories &targetTrajectories, scalar_t time);
+
+    private:
+        int indexHint_ = 0;
+        vector_t desiredState_;
+        vector_t desiredInput_;
+    };
+
+    /**
+     * One TargetTrajectoriesCursor per thread for an owner object. Const methods of an owner that is shared between threads can
+     * use get() without a data race, since each thread sees its own cursor and buffers. A copy refers to new cursors.
+     *
+     * Each running thread holds a slot index, which is handed to another thread once it exits. The owner keeps the cursor of each
+     * slot and releases them on destruction. At most maxNumThreads threads may use cursors at the same time.
+     */
+    class ThreadLocalTargetTrajectoriesCursor {
+    public:
+        static constexpr size_t maxNumThreads = 128;
+
+        ThreadLocalTargetTrajectoriesCursor() = default;
+
+        ThreadLocalTargetTrajectoriesCursor(const ThreadLocalTargetTrajectoriesCursor &) {
+        }
+
+        ThreadLocalTargetTrajectoriesCursor &operator=(const ThreadLocalTargetTrajectoriesCursor &) { return *this; }
+
+        /** The cursor of the calling thread. */
+        TargetTrajectoriesCursor &get() const;
+
+    private:
+        // only the thread holding a slot accesses its cursor
+        mutable std::array<std::unique_ptr<TargetTrajectoriesCursor>, maxNumThreads> cursorPtrs_;
+    };
+
     void swap(TargetTrajectories &lh, TargetTrajectories &rh);
 
     std::ostream &operator<<(std::ostream &out, const TargetTrajectories &targetTrajectories);
@@ -0,0 +1,165 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <stdexcept>
+
+namespace ocs2 {
+
+/** What BoundedQueue::push() does if the queue is full. */
+enum class QueueOverflowPolicy {
+  Block,      // blocks the producer until an element is taken
+  DropOldest  // drops the oldest element to make room for the new one
+};
+
+/**
+ * A bounded multi-producer, multi-consumer queue. If the queue is full, the producer either blocks or the oldest element is dropped:
+ * - QueueOverflowPolicy::Block suits pipelines in which no element may be lost and a slow consumer should throttle the producers,
+ *   e.g., data generation for learning.
+ * - QueueOverflowPolicy::DropOldest never blocks the producer and suits pipelines in which only the latest data is of interest, e.g.,
+ *   sensor data which arrives faster than it can be processed.
+ *
+ * Consumers block in pop() until an element is available or the queue is closed, or poll with tryPop().
+ *
+ * @tparam T : element type
+ */
+template <typename T>
+class BoundedQueue {
+ public:
+  /**
+   * Constructor
+   * @param capacity : Maximum number of elements in the queue, at least 1.
+   * @param overflowPolicy : What push() does if the queue is full.
+   */
+  explicit BoundedQueue(size_t capacity, QueueOverflowPolicy overflowPolicy = QueueOverflowPolicy::Block)
+      : capacity_(capacity), overflowPolicy_(overflowPolicy) {
+    if (capacity_ == 0) {
+      throw std::runtime_error("[BoundedQueue] The capacity must be at least 1.");
+    }
+  }
+
+  /**
+   * Adds an element. If the queue is full, blocks or drops the oldest element depending on the overflow policy. Elements pushed after
+   * close() are discarded.
+   * @return false if the queue is closed.
+   */
+  bool push(T value) {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      if (overflowPolicy_ == QueueOverflowPolicy::Block) {
+        notFull_.wait(lock, [this] { return queue_.size() < capacity_ || closed_; });
+      }
+      if (closed_) {
+        return false;
+      }
+      if (queue_.size() >= capacity_) {
+        queue_.pop_front();
+        ++numDropped_;
+      }
+      queue_.push_back(std::move(value));
+    }
+    notEmpty_.notify_one();
+    return true;
+  }
+  /**
+   * Takes the oldest element. Blocks until an element is available or the queue is closed.
+   * @param [out] value : The element.
+   * @return false if the queue is closed and empty.
+   */
+  bool pop(T& value) {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      notEmpty_.wait(lock, [this] { return !queue_.empty() || closed_; });
+      if (queue_.empty()) {
+        return false;
+      }
+      value = std::move(queue_.front());
+      queue_.pop_front();
+    }
+    notFull_.notify_one();
+    return true;
+  }
+
+  /**
+   * Takes the oldest element if there is one, without blocking.
+   * @param [out] value : The element.
+   * @return false if the queue is empty.
+   */
+  bool tryPop(T& value) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (queue_.empty()) {
+        return false;
+      }
+      value = std::move(queue_.front());
+      queue_.pop_front();
+    }
+    notFull_.notify_one();
+    return true;
+  }
+
+  /** Closes the queue. Blocked producers return, and pop() returns false once the remaining elements are taken. */
+  void close() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      closed_ = true;
+    }
+    notFull_.notify_all();
+    notEmpty_.notify_all();
+  }
+
+  /** Number of elements in the queue. */
+  size_t size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return queue_.size();
+  }
+
+  /** Number of elements dropped because the queue was full, only with QueueOverflowPolicy::DropOldest. */
+  size_t getNumDropped() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return numDropped_;
+  }
+
+ private:
+  const size_t capacity_;
+  const QueueOverflowPolicy overflowPolicy_;
+  mutable std::mutex mutex_;
+  std::condition_variable notFull_;
+  std::condition_variable notEmpty_;
+  std::deque<T> queue_;
+  size_t numDropped_ = 0;
+  bool closed_ = false;
+};
+
+}  // namespace ocs2
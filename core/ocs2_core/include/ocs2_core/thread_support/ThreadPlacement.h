@@ -0,0 +1,153 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#pragma once
+
+#include <pthread.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/property_tree/ptree_fwd.hpp>
+
+namespace ocs2 {
+
+/**
+ * Placement of a group of threads: scheduling policy, priority and CPU affinity, and the real-time memory settings of the process.
+ *
+ * Example of the corresponding field in an .info file:
+ *
+ *   threadPlacement
+ *   {
+ *     schedulingPolicy    SCHED_FIFO
+ *     priority            50
+ *     cpus
+ *     {
+ *       [0]  2
+ *       [1]  3
+ *     }
+ *     pinToSingleCpu      true
+ *     lockMemory          true
+ *     prefaultStackSize   524288
+ *   }
+ */
+struct ThreadPlacement {
+  enum class SchedulingPolicy { OTHER, FIFO };
+
+  /** Scheduling policy of the threads. */
+  SchedulingPolicy schedulingPolicy = SchedulingPolicy::FIFO;
+
+  /** Priority of the threads from 0 (lowest) to 99 (highest). For SCHED_FIFO, 0 leaves the scheduling of the threads unchanged. */
+  int priority = 0;
+
+  /** CPU cores the threads may run on. An empty set leaves the affinity of the threads unchanged. */
+  std::vector<int> cpus;
+
+  /** If true, the i-th thread of the group is pinned to cpus[i % cpus.size()]. Otherwise, all threads may run on all cpus. */
+  bool pinToSingleCpu = false;
+
+  /** Locks the current and future memory pages of the process into RAM (mlockall) and keeps freed heap memory mapped. */
+  bool lockMemory = false;
+
+  /** Size of the stack in bytes which is touched once when the thread starts, such that it does not page fault later. */
+  size_t prefaultStackSize = 0;
+};
+
+/** Gets the name of the scheduling policy, i.e., "SCHED_OTHER" or "SCHED_FIFO". */
+const std::string &toString(ThreadPlacement::SchedulingPolicy schedulingPolicy);
+
+/** Gets the scheduling policy from its name, i.e., "SCHED_OTHER" or "SCHED_FIFO". */
+ThreadPlacement::SchedulingPolicy schedulingPolicyFromString(const std::string &name);
+
+/**
+ * Sets the scheduling policy, the priority and the CPU affinity of a thread.
+ *
+ * @param [in] threadPlacement: The placement of the group of threads.
+ * @param [in] thread: The thread.
+ * @param [in] threadIndex: Index of the thread in its group, used to select the CPU if threadPlacement.pinToSingleCpu is set.
+ */
+void setThreadPlacement(const ThreadPlacement &threadPlacement, pthread_t thread, size_t threadIndex = 0);
+
+/**
+ * Sets the scheduling policy, the priority and the CPU affinity of a thread.
+ *
+ * @param [in] threadPlacement: The placement of the group of threads.
+ * @param [in] thread: A reference to the thread.
+ * @param [in] threadIndex: Index of the thread in its group, used to select the CPU if threadPlacement.pinToSingleCpu is set.
+ */
+inline void setThreadPlacement(const ThreadPlacement &threadPlacement, std::thread &thread, size_t threadIndex = 0) {
+  setThreadPlacement(threadPlacement, thread.native_handle(), threadIndex);
+}
+
+/**
+ * Applies the placement to the thread this function is called from. Besides setThreadPlacement(), it locks the memory of the process
+ * and prefaults the stack of the thread if requested.
+ *
+ * @param [in] threadPlacement: The placement of the group of threads.
+ * @param [in] threadIndex: Index of the thread in its group, used to select the CPU if threadPlacement.pinToSingleCpu is set.
+ */
+void setThisThreadPlacement(const ThreadPlacement &threadPlacement, size_t threadIndex = 0);
+
+/**
+ * Locks the current and future memory pages of the process into RAM and disables returning freed heap memory to the system, such
+ * that buffers which are reused by the solvers do not page fault again.
+ *
+ * @return True if the memory could be locked.
+ */
+bool lockProcessMemory();
+
+/**
+ * Touches the given number of bytes of the stack of the calling thread.
+ *
+ * @param [in] size: Number of bytes.
+ */
+void prefaultStack(size_t size);
+
+/**
+ * Loads the thread placement from a property tree. Fields that are not present keep their value.
+ *
+ * @param [in] pt: The property tree.
+ * @param [in] fieldName: Field name which contains the configuration data.
+ * @param [in, out] threadPlacement: The thread placement.
+ * @param [in] verbose: Flag to determine whether to print out the loaded settings or not.
+ */
+void loadThreadPlacement(const boost::property_tree::ptree &pt, const std::string &fieldName, ThreadPlacement &threadPlacement,
+                         bool verbose = true);
+
+/**
+ * Loads the thread placement from a given file.
+ *
+ * @param [in] filename: File name which contains the configuration data.
+ * @param [in] fieldName: Field name which contains the configuration data.
+ * @param [in] verbose: Flag to determine whether to print out the loaded settings or not.
+ * @return The thread placement.
+ */
+ThreadPlacement loadThreadPlacement(const std::string &filename, const std::string &fieldName, bool verbose = true);
+
+}  // namespace ocs2
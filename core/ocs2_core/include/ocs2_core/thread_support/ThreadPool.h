@@ -36,6 +36,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <thread>
 #include <vector>
 
+#include <ocs2_core/thread_support/ThreadPlacement.h>
+
 namespace ocs2 {
 
 /**
@@ -51,6 +53,15 @@ class ThreadPool {
    */
   explicit ThreadPool(size_t nThreads = 1, int priority = 0);
 
+  /**
+   * Constructor
+   *
+   * @param [in] nThreads: Number of threads to launch in the pool
+   * @param [in] threadPlacement: The placement of the worker threads. Each worker applies it to itself when it starts, with its
+   *                              worker index as the index in the group.
+   */
+  ThreadPool(size_t nThreads, ThreadPlacement threadPlacement);
+
   /**
    * Destructor
    */
@@ -109,6 +120,7 @@ class ThreadPool {
   std::condition_variable taskQueueCondition_;
   std::mutex taskQueueLock_;
 
+  const ThreadPlacement threadPlacement_;
   std::vector<std::thread> workerThreads_;
 };
 
@@ -0,0 +1,237 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ocs2 {
+
+/**
+ * Holds the latest published version of an immutable object and lets readers pin a consistent version without locking.
+ *
+ * - Publishing: A producer wraps a new object in a version and swaps it in with an atomic pointer exchange. Producers are serialized by
+ * a mutex, which readers never take.
+ * - Reading: pin() returns a Snapshot to the latest version, which stays valid and unchanged for the lifetime of the Snapshot, e.g., the
+ * whole duration of a solver run, regardless of newer versions being published in the meantime. Pinning and releasing are wait-free: a
+ * reader announces the current epoch in one of maxNumReaders slots and reads the version pointer.
+ * - Reclamation: A replaced version is retired together with the epoch of its replacement. It is destroyed by a producer once no reader
+ * slot holds an epoch up to the retire epoch, i.e., no reader can still see it. The wrapped object itself is shared, and lives on as long as
+ * some Snapshot::share() copy refers to it.
+ *
+ * All Snapshots have to be released before the VersionedSnapshot is destroyed.
+ *
+ * @tparam T : wrapped type
+ */
+template <typename T>
+class VersionedSnapshot {
+ private:
+  static constexpr uint64_t kFree = std::numeric_limits<uint64_t>::max();
+
+  struct Version {
+    std::shared_ptr<const T> value;
+    uint64_t number;
+  };
+
+  /** A reader slot holds the epoch at which the reader pinned, or kFree. Padded to avoid false sharing between readers. */
+  struct alignas(64) ReaderSlot {
+    std::atomic<uint64_t> epoch{kFree};
+  };
+
+ public:
+  /**
+   * A pinned version. It gives const access to the wrapped object, and releases the pin on destruction.
+   */
+  class Snapshot {
+   public:
+    Snapshot() = default;
+    ~Snapshot() { release(); }
+
+    Snapshot(const Snapshot&) = delete;
+    Snapshot& operator=(const Snapshot&) = delete;
+
+    Snapshot(Snapshot&& other) noexcept : slot_(std::exchange(other.slot_, nullptr)), version_(std::exchange(other.version_, nullptr)) {}
+    Snapshot& operator=(Snapshot&& other) noexcept {
+      if (this != &other) {
+        release();
+        slot_ = std::exchange(other.slot_, nullptr);
+        version_ = std::exchange(other.version_, nullptr);
+      }
+      return *this;
+    }
+
+    /// Const access
+    const T* get() const { return (version_ != nullptr) ? version_->value.get() : nullptr; }
+    const T* operator->() const { return get(); }
+    const T& operator*() const { return *get(); }
+
+    /// Returns a shared pointer to the wrapped object, which keeps the object alive after the Snapshot is released.
+    std::shared_ptr<const T> share() const { return (version_ != nullptr) ? version_->value : nullptr; }
+
+    /// Number of the pinned version, 0 if nothing was published.
+    uint64_t version() const { return (version_ != nullptr) ? version_->number : 0; }
+
+    /// Returns true if the pinned version holds an object.
+    explicit operator bool() const noexcept { return get() != nullptr; }
+
+    /// Releases the pin, the Snapshot is empty afterwards.
+    void release() noexcept {
+      if (slot_ != nullptr) {
+        slot_->store(kFree);
+        slot_ = nullptr;
+      }
+      version_ = nullptr;
+    }
+
+   private:
+    Snapshot(std::atomic<uint64_t>* slot, const Version* version) : slot_(slot), version_(version) {}
+
+    std::atomic<uint64_t>* slot_ = nullptr;
+    const Version* version_ = nullptr;
+
+    friend class VersionedSnapshot;
+  };
+
+  /**
+   * Constructor
+   * @param maxNumReaders : Maximum number of Snapshots that can be pinned at the same time.
+   */
+  explicit VersionedSnapshot(size_t maxNumReaders = 16) : maxNumReaders_(maxNumReaders), readerSlots_(new ReaderSlot[maxNumReaders]) {}
+
+  /**
+   * Constructor which publishes an initial version.
+   * @param value : The initial object.
+   * @param maxNumReaders : Maximum number of Snapshots that can be pinned at the same time.
+   */
+  explicit VersionedSnapshot(std::shared_ptr<const T> value, size_t maxNumReaders = 16) : VersionedSnapshot(maxNumReaders) {
+    publish(std::move(value));
+  }
+
+  /// Destructor : Destroys the current and the retired versions.
+  ~VersionedSnapshot() {
+    delete current_.load();
+    for (const auto& retired : retired_) {
+      delete retired.first;
+    }
+  }
+
+  // Disable copy and move operations, Snapshots point into this object
+  VersionedSnapshot(const VersionedSnapshot&) = delete;
+  VersionedSnapshot& operator=(const VersionedSnapshot&) = delete;
+
+  /**
+   * Publishes a new version. Readers which pin after this call see the new version, Snapshots pinned before keep their version.
+   * @param value : The new object, can be null.
+   * @return The number of the new version.
+   */
+  uint64_t publish(std::shared_ptr<const T> value) {
+    std::lock_guard<std::mutex> lock(publishMutex_);
+    auto* next = new Version{std::move(value), ++numVersions_};
+    Version* previous = current_.exchange(next);
+    if (previous != nullptr) {
+      retired_.emplace_back(previous, epoch_.load());
+    }
+    // readers announcing the new epoch pinned after the exchange, they cannot see the retired version
+    epoch_.fetch_add(1);
+    reclaim();
+    return next->number;
+  }
+
+  /**
+   * Pins the latest version. Thread-safe and wait-free.
+   * @return The pinned version, which may hold no object if nothing or null was published.
+   */
+  Snapshot pin() const {
+    const uint64_t epoch = epoch_.load();
+    for (size_t i = 0; i < maxNumReaders_; i++) {
+      uint64_t expected = kFree;
+      if (readerSlots_[i].epoch.compare_exchange_strong(expected, epoch)) {
+        return Snapshot(&readerSlots_[i].epoch, current_.load());
+      }
+    }
+    throw std::runtime_error("[VersionedSnapshot] More than " + std::to_string(maxNumReaders_) + " snapshots are pinned at the same time.");
+  }
+
+  /// Number of the latest published version, 0 if nothing was published.
+  uint64_t version() const {
+    const Version* current = current_.load();
+    return (current != nullptr) ? current->number : 0;
+  }
+
+  /// Destroys the retired versions which no reader can see anymore. This is done by publish() as well.
+  void collect() {
+    std::lock_guard<std::mutex> lock(publishMutex_);
+    reclaim();
+  }
+
+  /// Number of the retired versions which are not yet destroyed.
+  size_t getNumRetiredVersions() const {
+    std::lock_guard<std::mutex> lock(publishMutex_);
+    return retired_.size();
+  }
+
+ private:
+  /** Destroys the retired versions that are older than the epoch of every pinned reader. Requires publishMutex_. */
+  void reclaim() {
+    uint64_t minReaderEpoch = kFree;
+    for (size_t i = 0; i < maxNumReaders_; i++) {
+      minReaderEpoch = std::min(minReaderEpoch, readerSlots_[i].epoch.load());
+    }
+
+    auto it = retired_.begin();
+    while (it != retired_.end()) {
+      if (it->second < minReaderEpoch) {
+        delete it->first;
+        it = retired_.erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+
+  const size_t maxNumReaders_;
+  std::unique_ptr<ReaderSlot[]> readerSlots_;
+  std::atomic<Version*> current_{nullptr};
+  mutable std::atomic<uint64_t> epoch_{1};
+
+  mutable std::mutex publishMutex_;
+  uint64_t numVersions_ = 0;
+  std::vector<std::pair<Version*, uint64_t>> retired_;  // retired versions and their retire epoch
+};
+
+}  // namespace ocs2
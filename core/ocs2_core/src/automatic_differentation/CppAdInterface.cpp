@@ -28,6 +28,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 ******************************************************************************/
 
 #include <ocs2_core/automatic_differentiation/CppAdInterface.h>
+#include <ocs2_core/misc/StartupProfiler.h>
 
 #include <boost/filesystem.hpp>
 #include <memory>
@@ -66,6 +67,7 @@ namespace ocs2 {
 
 
     void CppAdInterface::createModels(ApproximationOrder approximationOrder, bool verbose) {
+        benchmark::ScopedStartupTimer timer(benchmark::StartupPhase::Codegen);
         createFolderStructure();
 
         // set and declare independent variables and start tape recording
@@ -119,6 +121,7 @@ namespace ocs2 {
 
 
     void CppAdInterface::loadModels(bool verbose) {
+        benchmark::ScopedStartupTimer timer(benchmark::StartupPhase::Codegen);
         if (verbose) {
             std::cerr << "[CppAdInterface] Loading Shared Library: " << libraryName_ + CppAD::cg::system::SystemInfo
                     <>::DYNAMIC_LIB_EXTENSION
@@ -63,6 +63,6 @@ namespace ocs2 {
 
     vector_t QuadraticStateCost::getStateDeviation(scalar_t time, const vector_t &state,
                                                    const TargetTrajectories &targetTrajectories) const {
-        return state - targetTrajectories.getDesiredState(time);
+        return state - getTargetTrajectoriesCursor().getDesiredState(targetTrajectories, time);
     }
 } // namespace ocs2
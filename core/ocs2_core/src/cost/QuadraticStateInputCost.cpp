@@ -90,8 +90,8 @@ namespace ocs2 {
     std::pair<vector_t, vector_t> QuadraticStateInputCost::getStateInputDeviation(
         const scalar_t time, const vector_t &state, const vector_t &input,
         const TargetTrajectories &targetTrajectories) const {
-        const vector_t stateDeviation = state - targetTrajectories.getDesiredState(time);
-        const vector_t inputDeviation = input - targetTrajectories.getDesiredInput(time);
+        const vector_t stateDeviation = state - getTargetTrajectoriesCursor().getDesiredState(targetTrajectories, time);
+        const vector_t inputDeviation = input - getTargetTrajectoriesCursor().getDesiredInput(targetTrajectories, time);
         return {stateDeviation, inputDeviation};
     }
 } // namespace ocs2
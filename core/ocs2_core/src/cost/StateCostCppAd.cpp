@@ -34,7 +34,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 namespace ocs2 {
     void StateCostCppAd::initialize(const size_t stateDim, size_t parameterDim, const std::string &modelName,
                                     const std::string &modelFolder,
-                                    const bool recompileLibraries, const bool verbose) {
+                                    const bool recompileLibraries, const bool verbose,
+                                    const CppAdInterface::ApproximationOrder approximationOrder) {
         auto costAd = [=](const ad_vector_t &x, const ad_vector_t &p, ad_vector_t &y) {
             assert(x.rows() == 1 + stateDim);
             const ad_scalar_t &time = x(0);
@@ -45,16 +46,17 @@ namespace ocs2 {
         adInterfacePtr_ = std::make_unique<ocs2::CppAdInterface>(costAd, 1 + stateDim, parameterDim, modelName,
                                                                  modelFolder);
 
+        approximationOrder_ = approximationOrder;
         if (recompileLibraries) {
-            adInterfacePtr_->createModels(ocs2::CppAdInterface::ApproximationOrder::Second, verbose);
+            adInterfacePtr_->createModels(approximationOrder_, verbose);
         } else {
-            adInterfacePtr_->loadModelsIfAvailable(ocs2::CppAdInterface::ApproximationOrder::Second, verbose);
+            adInterfacePtr_->loadModelsIfAvailable(approximationOrder_, verbose);
         }
     }
 
 
     StateCostCppAd::StateCostCppAd(const StateCostCppAd &rhs)
-        : StateCost(rhs), adInterfacePtr_(new CppAdInterface(*rhs.adInterfacePtr_)) {
+        : StateCost(rhs), adInterfacePtr_(new CppAdInterface(*rhs.adInterfacePtr_)), approximationOrder_(rhs.approximationOrder_) {
     }
 
 
@@ -84,8 +86,12 @@ namespace ocs2 {
         const matrix_t J = adInterfacePtr_->getJacobian(tapedTimeState, params);
         cost.dfdx = J.rightCols(stateDim).transpose();
 
-        const matrix_t H = adInterfacePtr_->getHessian(0, tapedTimeState, params);
-        cost.dfdxx = H.bottomRightCorner(stateDim, stateDim);
+        if (approximationOrder_ == CppAdInterface::ApproximationOrder::Second) {
+            const matrix_t H = adInterfacePtr_->getHessian(0, tapedTimeState, params);
+            cost.dfdxx = H.bottomRightCorner(stateDim, stateDim);
+        } else {
+            cost.dfdxx.setZero(stateDim, stateDim);
+        }
 
         return cost;
     }
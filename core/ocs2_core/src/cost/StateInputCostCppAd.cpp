@@ -33,7 +33,8 @@ namespace ocs2 {
 
 
 void StateInputCostCppAd::initialize(size_t stateDim, size_t inputDim, size_t parameterDim, const std::string& modelName,
-                                     const std::string& modelFolder, bool recompileLibraries, bool verbose) {
+                                     const std::string& modelFolder, bool recompileLibraries, bool verbose,
+                                     CppAdInterface::ApproximationOrder approximationOrder) {
   auto costAd = [=](const ad_vector_t& x, const ad_vector_t& p, ad_vector_t& y) {
     assert(x.rows() == 1 + stateDim + inputDim);
     const ad_scalar_t time = x(0);
@@ -44,16 +45,19 @@ void StateInputCostCppAd::initialize(size_t stateDim, size_t inputDim, size_t pa
   };
   adInterfacePtr_.reset(new ocs2::CppAdInterface(costAd, 1 + stateDim + inputDim, parameterDim, modelName, modelFolder));
 
+  approximationOrder_ = approximationOrder;
   if (recompileLibraries) {
-    adInterfacePtr_->createModels(ocs2::CppAdInterface::ApproximationOrder::Second, verbose);
+    adInterfacePtr_->createModels(approximationOrder_, verbose);
   } else {
-    adInterfacePtr_->loadModelsIfAvailable(ocs2::CppAdInterface::ApproximationOrder::Second, verbose);
+    adInterfacePtr_->loadModelsIfAvailable(approximationOrder_, verbose);
   }
 }
 
 
 StateInputCostCppAd::StateInputCostCppAd(const StateInputCostCppAd& rhs)
-    : StateInputCost(rhs), adInterfacePtr_(new ocs2::CppAdInterface(*rhs.adInterfacePtr_)) {}
+    : StateInputCost(rhs),
+      adInterfacePtr_(new ocs2::CppAdInterface(*rhs.adInterfacePtr_)),
+      approximationOrder_(rhs.approximationOrder_) {}
 
 /******************************************************************************************************/
 /******************************************************************************************************/
@@ -86,10 +90,16 @@ ScalarFunctionQuadraticApproximation StateInputCostCppAd::getQuadraticApproximat
   cost.dfdx = J.middleCols(1, stateDim).transpose();
   cost.dfdu = J.rightCols(inputDim).transpose();
 
-  const matrix_t H = adInterfacePtr_->getHessian(0, tapedTimeStateInput, params);
-  cost.dfdxx = H.block(1, 1, stateDim, stateDim);
-  cost.dfdux = H.block(1 + stateDim, 1, inputDim, stateDim);
-  cost.dfduu = H.bottomRightCorner(inputDim, inputDim);
+  if (approximationOrder_ == CppAdInterface::ApproximationOrder::Second) {
+    const matrix_t H = adInterfacePtr_->getHessian(0, tapedTimeStateInput, params);
+    cost.dfdxx = H.block(1, 1, stateDim, stateDim);
+    cost.dfdux = H.block(1 + stateDim, 1, inputDim, stateDim);
+    cost.dfduu = H.bottomRightCorner(inputDim, inputDim);
+  } else {
+    cost.dfdxx.setZero(stateDim, stateDim);
+    cost.dfdux.setZero(inputDim, stateDim);
+    cost.dfduu.setZero(inputDim, inputDim);
+  }
 
   return cost;
 }
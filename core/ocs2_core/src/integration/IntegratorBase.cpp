@@ -29,6 +29,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <ocs2_core/integration/IntegratorBase.h>
 
+#include <sstream>
+
 namespace ocs2 {
     IntegratorBase::IntegratorBase(std::shared_ptr<SystemEventHandler> eventHandlerPtr /*= nullptr*/)
         : eventHandlerPtr_(std::move(eventHandlerPtr)) {
@@ -38,19 +40,22 @@ namespace ocs2 {
     }
 
 
+    void IntegratorBase::SystemFunction::operator()(const vector_t &x, vector_t &dxdt, scalar_t t) const {
+        dxdt = systemPtr_->computeFlowMap(t, x);
+        // max number of function calls
+        if (systemPtr_->incrementNumFunctionCalls() > maxNumSteps_) {
+            std::stringstream msg;
+            msg <<
+                    "[IntegratorBase] Integration terminated since the maximum number of function calls is reached. State at termination time "
+                    << t << ":\n["
+                    << x.transpose() << "]\n";
+            throw std::runtime_error(msg.str());
+        }
+    }
+
+
     IntegratorBase::system_func_t IntegratorBase::systemFunction(OdeBase &system, int maxNumSteps) const {
-        return [&system, maxNumSteps](const vector_t &x, vector_t &dxdt, scalar_t t) {
-            dxdt = system.computeFlowMap(t, x);
-            // max number of function calls
-            if (system.incrementNumFunctionCalls() > maxNumSteps) {
-                std::stringstream msg;
-                msg <<
-                        "[IntegratorBase] Integration terminated since the maximum number of function calls is reached. State at termination time "
-                        << t << ":\n["
-                        << x.transpose() << "]\n";
-                throw std::runtime_error(msg.str());
-            }
-        };
+        return {system, maxNumSteps};
     }
 
 
@@ -58,10 +63,7 @@ namespace ocs2 {
                                         scalar_t startTime,
                                         scalar_t finalTime, scalar_t dt,
                                         int maxNumSteps /*= std::numeric_limits<int>::max()*/) {
-        observer_func_t callback = [&](const vector_t &x, scalar_t t) {
-            observer.observe(x, t);
-            eventHandlerPtr_->handleEvent(system, t, x);
-        };
+        const observer_func_t callback(system, observer, *eventHandlerPtr_);
         runIntegrateConst(systemFunction(system, maxNumSteps), callback, initialState, startTime, finalTime, dt);
     }
 
@@ -72,10 +74,7 @@ namespace ocs2 {
                                            scalar_t AbsTol /*= 1e-6*/,
                                            scalar_t RelTol /*= 1e-3*/,
                                            int maxNumSteps /*= std::numeric_limits<int>::max()*/) {
-        observer_func_t callback = [&](const vector_t &x, scalar_t t) {
-            observer.observe(x, t);
-            eventHandlerPtr_->handleEvent(system, t, x);
-        };
+        const observer_func_t callback(system, observer, *eventHandlerPtr_);
         runIntegrateAdaptive(systemFunction(system, maxNumSteps), callback, initialState, startTime, finalTime,
                              dtInitial, AbsTol, RelTol);
     }
@@ -87,10 +86,7 @@ namespace ocs2 {
                                         scalar_t dtInitial /*= 0.01*/,
                                         scalar_t AbsTol /*= 1e-6*/, scalar_t RelTol /*= 1e-3*/,
                                         int maxNumSteps /*= std::numeric_limits<int>::max()*/) {
-        observer_func_t callback = [&](const vector_t &x, scalar_t t) {
-            observer.observe(x, t);
-            eventHandlerPtr_->handleEvent(system, t, x);
-        };
+        const observer_func_t callback(system, observer, *eventHandlerPtr_);
         runIntegrateTimes(systemFunction(system, maxNumSteps), callback, initialState, beginTimeItr, endTimeItr,
                           dtInitial, AbsTol, RelTol);
     }
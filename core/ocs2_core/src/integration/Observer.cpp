@@ -32,18 +32,34 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 namespace ocs2 {
 
 
-Observer::Observer(vector_array_t* stateTrajectoryPtr /*= nullptr*/, scalar_array_t* timeTrajectoryPtr /*= nullptr*/)
-    : timeTrajectoryPtr_(timeTrajectoryPtr), stateTrajectoryPtr_(stateTrajectoryPtr) {}
+Observer::Observer(vector_array_t* stateTrajectoryPtr /*= nullptr*/, scalar_array_t* timeTrajectoryPtr /*= nullptr*/,
+                   TrajectoryArena* stateArenaPtr /*= nullptr*/, vector_array_t* derivativeTrajectoryPtr /*= nullptr*/)
+    : timeTrajectoryPtr_(timeTrajectoryPtr),
+      stateTrajectoryPtr_(stateTrajectoryPtr),
+      stateArenaPtr_(stateArenaPtr),
+      derivativeTrajectoryPtr_(derivativeTrajectoryPtr) {}
 
 
 void Observer::observe(const vector_t& state, scalar_t time) {
   // Store data
   if (stateTrajectoryPtr_ != nullptr) {
-    stateTrajectoryPtr_->push_back(state);
+    if (stateArenaPtr_ != nullptr) {
+      stateArenaPtr_->pushBack(*stateTrajectoryPtr_, state);
+    } else {
+      stateTrajectoryPtr_->push_back(state);
+    }
   }
   if (timeTrajectoryPtr_ != nullptr) {
     timeTrajectoryPtr_->push_back(time);
   }
 }
 
+
+void Observer::observe(const vector_t& state, const vector_t& derivative, scalar_t time) {
+  observe(state, time);
+  if (derivativeTrajectoryPtr_ != nullptr) {
+    derivativeTrajectoryPtr_->push_back(derivative);
+  }
+}
+
 }  // namespace ocs2
@@ -63,11 +63,11 @@ scalar_t maxAbs(scalar_t t1, scalar_t t2) {
   }
 }
 
-/** Runge Kutta Dormand-Prince stepper */
-class Stepper {
- public:
-  using system_func_t = IntegratorBase::system_func_t;
+}  // namespace
 
+/** Runge Kutta Dormand-Prince stepper, its intermediate vectors are kept to reuse their memory. */
+class RungeKuttaDormandPrince5::Stepper {
+ public:
   /**
    * Try to perform one step. If the step is accepted, then state (x), derivative (dxdt), time (t) and step size (dt) are updated.
    * Otherwise only the step size (dt) is updated and false is returned.
@@ -96,21 +96,20 @@ class Stepper {
     constexpr scalar_t dc6 = c6 - 187.0 / 2100;
     constexpr scalar_t dc7 = -1.0 / 40;
 
-    vector_t x_out, dxdt_out;
-    doStep(system, x, dxdt, t, dt, x_out, dxdt_out);
+    doStep(system, x, dxdt, t, dt, xOut_, dxdtOut_);
 
     // error estimate
-    const vector_t x_err = dt * (dc1 * k1_ + dc3 * k3_ + dc4 * k4_ + dc5 * k5_ + dc6 * k6_ + dc7 * dxdt_out);
+    xErr_.noalias() = dt * (dc1 * k1_ + dc3 * k3_ + dc4 * k4_ + dc5 * k5_ + dc6 * k6_ + dc7 * dxdtOut_);
 
-    const scalar_t error = maxError(x, dxdt, x_err, dt, absTol, relTol);
+    const scalar_t error = maxError(x, dxdt, xErr_, dt, absTol, relTol);
     if (error > 1.0) {
       dt = decreaseStep(dt, error);
       return false;
     } else {
       // accept the step
       t += dt;
-      x = x_out;
-      dxdt = dxdt_out;
+      x.swap(xOut_);
+      dxdt.swap(dxdtOut_);
       dt = increaseStep(dt, error);
       return true;
     }
@@ -164,7 +163,8 @@ class Stepper {
     constexpr scalar_t c6 = 11.0 / 84;
 
     k1_ = dxdt;  // k1 = system(x, t) from previous iteration
-    vector_t x = x0 + dt * b21 * k1_;
+    auto& x = xStage_;
+    x.noalias() = x0 + dt * b21 * k1_;
     system(x, k2_, t + dt * a2);
     x.noalias() = x0 + dt * b31 * k1_ + dt * b32 * k2_;
     system(x, k3_, t + dt * a3);
@@ -193,8 +193,8 @@ class Stepper {
    */
   static scalar_t maxError(const vector_t& x_old, const vector_t& dxdt_old, const vector_t& x_err, scalar_t dt, scalar_t absTol,
                            scalar_t relTol) {
-    const vector_t err = x_err.array() / (absTol + relTol * (x_old.array().abs() + std::abs(dt) * dxdt_old.array().abs()));
-    return err.lpNorm<Eigen::Infinity>();
+    const auto err = x_err.array() / (absTol + relTol * (x_old.array().abs() + std::abs(dt) * dxdt_old.array().abs()));
+    return err.matrix().lpNorm<Eigen::Infinity>();
   }
 
   /**
@@ -228,9 +228,17 @@ class Stepper {
 
   /** intermediate derivatives during Runge-Kutta step. */
   vector_t k1_, k2_, k3_, k4_, k5_, k6_;
+
+  /** intermediate state, candidate state and derivative, and error estimate of a step. */
+  vector_t xStage_, xOut_, dxdtOut_, xErr_;
 };
 
-}  // namespace
+
+RungeKuttaDormandPrince5::RungeKuttaDormandPrince5(std::shared_ptr<SystemEventHandler> eventHandlerPtr)
+    : IntegratorBase(std::move(eventHandlerPtr)), stepperPtr_(new Stepper) {}
+
+
+RungeKuttaDormandPrince5::~RungeKuttaDormandPrince5() = default;
 
 
 void RungeKuttaDormandPrince5::runIntegrateConst(system_func_t system, observer_func_t observer, const vector_t& initialState,
@@ -240,34 +248,36 @@ void RungeKuttaDormandPrince5::runIntegrateConst(system_func_t system, observer_
   // Ensure that finalTime is included by adding a fraction of dt such that: N * dt <= finalTime < (N + 1) * dt.
   finalTime += 0.1 * dt;
 
-  Stepper stepper;
+  auto& stepper = *stepperPtr_;
   scalar_t t = startTime;
-  vector_t x = initialState;
-  vector_t dxdt;
+  auto& x = x_;
+  auto& dxdt = dxdt_;
+  x = initialState;
   system(x, dxdt, t);
   size_t step = 0;
   while (lessWithSign(t + dt, finalTime, dt)) {
-    observer(x, t);
+    observer(x, dxdt, t);
     stepper.doStep(system, x, dxdt, t, dt, x, dxdt);
     step++;
     t = startTime + step * dt;
   }
-  observer(x, t);
+  observer(x, dxdt, t);
 }
 
 
 void RungeKuttaDormandPrince5::runIntegrateAdaptive(system_func_t system, observer_func_t observer, const vector_t& initialState,
                                                     scalar_t startTime, scalar_t finalTime, scalar_t dtInitial, scalar_t absTol,
                                                     scalar_t relTol) {
-  Stepper stepper;
+  auto& stepper = *stepperPtr_;
   scalar_t t = startTime;
   scalar_t dt = dtInitial;
-  vector_t x = initialState;
-  vector_t dxdt;
+  auto& x = x_;
+  auto& dxdt = dxdt_;
+  x = initialState;
   system(x, dxdt, t);
 
   while (lessWithSign(t, finalTime, dt)) {
-    observer(x, t);
+    observer(x, dxdt, t);
 
     if (lessWithSign(finalTime, t + dt, dt)) {
       dt = finalTime - t;
@@ -281,7 +291,7 @@ void RungeKuttaDormandPrince5::runIntegrateAdaptive(system_func_t system, observ
       }
     }  // end of while loop
   }    // end of while loop
-  observer(x, t);
+  observer(x, dxdt, t);
 }
 
 
@@ -289,15 +299,16 @@ void RungeKuttaDormandPrince5::runIntegrateTimes(system_func_t system, observer_
                                                  typename scalar_array_t::const_iterator beginTimeItr,
                                                  typename scalar_array_t::const_iterator endTimeItr, scalar_t dtInitial, scalar_t absTol,
                                                  scalar_t relTol) {
-  Stepper stepper;
+  auto& stepper = *stepperPtr_;
   scalar_t dt = dtInitial;
-  vector_t x = initialState;
-  vector_t dxdt;
+  auto& x = x_;
+  auto& dxdt = dxdt_;
+  x = initialState;
   system(x, dxdt, *beginTimeItr);
 
   while (true) {
     scalar_t t = *beginTimeItr++;
-    observer(x, t);
+    observer(x, dxdt, t);
 
     if (beginTimeItr == endTimeItr) {
       break;
@@ -142,8 +142,8 @@ namespace ocs2::loopshaping_property_tree {
 
     std::shared_ptr<LoopshapingDefinition> load(const std::string &settingsFile) {
         // Read from settings File
-        boost::property_tree::ptree pt;
-        read_info(settingsFile, pt);
+        const auto ptPtr = ocs2::loadData::readInfoFile(settingsFile);
+        const auto &pt = *ptPtr;
         Filter r_filter = readMIMOFilter(pt, "r_filter");
         Filter s_filter = readMIMOFilter(pt, "s_inv_filter", /*invert=*/true);
 
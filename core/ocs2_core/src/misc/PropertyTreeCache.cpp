@@ -0,0 +1,280 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include "ocs2_core/misc/PropertyTreeCache.h"
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+
+#include <boost/filesystem.hpp>
+#include <boost/property_tree/info_parser.hpp>
+
+#include "ocs2_core/misc/StartupProfiler.h"
+
+namespace ocs2::loadData {
+    namespace {
+        constexpr char snapshotMagic[] = "OCS2PT";
+        constexpr uint8_t snapshotVersion = 1;
+
+        // Filesystems may store coarse modification times, a file cached within this interval after its modification is verified by
+        // its content
+        constexpr int64_t racyInterval = 2'000'000'000; // [ns]
+
+        struct FileStatus {
+            int64_t modificationTime; // [ns]
+            uintmax_t size;
+
+            bool operator==(const FileStatus &other) const {
+                return modificationTime == other.modificationTime && size == other.size;
+            }
+        };
+
+        struct CacheEntry {
+            FileStatus fileStatus;
+            bool verifyContent;
+            uint64_t contentHash;
+            std::shared_ptr<const boost::property_tree::ptree> treePtr;
+        };
+
+        std::mutex cacheMutex;
+        std::unordered_map<std::string, CacheEntry> cache;
+        std::string snapshotDirectory = (std::getenv("OCS2_SETTINGS_SNAPSHOT_DIR") != nullptr)
+                                            ? std::getenv("OCS2_SETTINGS_SNAPSHOT_DIR")
+                                            : "";
+
+        /** 64-bit FNV-1a hash */
+        uint64_t hashContent(const std::string &content) {
+            uint64_t hash = 14695981039346656037ULL;
+            for (const char c: content) {
+                hash ^= static_cast<unsigned char>(c);
+                hash *= 1099511628211ULL;
+            }
+            return hash;
+        }
+
+        bool getFileStatus(const std::string &filename, FileStatus &fileStatus) {
+            struct stat fileStat{};
+            if (::stat(filename.c_str(), &fileStat) != 0) {
+                return false;
+            }
+            fileStatus.modificationTime = static_cast<int64_t>(fileStat.st_mtim.tv_sec) * 1'000'000'000 + fileStat.st_mtim.tv_nsec;
+            fileStatus.size = static_cast<uintmax_t>(fileStat.st_size);
+            return true;
+        }
+
+        /** Whether the file was modified so recently that a later write may keep its status. */
+        bool isRecentlyModified(const FileStatus &fileStatus) {
+            const int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::system_clock::now().time_since_epoch()).count();
+            return now - fileStatus.modificationTime < racyInterval;
+        }
+
+        bool readFile(const std::string &filename, std::string &content) {
+            std::ifstream file(filename, std::ios::binary);
+            std::stringstream stream;
+            stream << file.rdbuf();
+            content = stream.str();
+            return static_cast<bool>(file);
+        }
+
+        void writeString(std::ostream &stream, const std::string &string) {
+            const auto length = static_cast<uint32_t>(string.size());
+            stream.write(reinterpret_cast<const char *>(&length), sizeof(length));
+            stream.write(string.data(), length);
+        }
+
+        /** Reads a string, whose length is bounded by the end of the stream at streamEnd. */
+        bool readString(std::istream &stream, std::streamoff streamEnd, std::string &string) {
+            uint32_t length;
+            if (!stream.read(reinterpret_cast<char *>(&length), sizeof(length))) {
+                return false;
+            }
+            const std::streamoff position = stream.tellg();
+            if (position < 0 || length > streamEnd - position) {
+                return false;
+            }
+            string.resize(length);
+            return static_cast<bool>(stream.read(&string[0], length));
+        }
+
+        void writeNode(std::ostream &stream, const boost::property_tree::ptree &node) {
+            writeString(stream, node.data());
+            const auto numChildren = static_cast<uint32_t>(node.size());
+            stream.write(reinterpret_cast<const char *>(&numChildren), sizeof(numChildren));
+            for (const auto &child: node) {
+                writeString(stream, child.first);
+                writeNode(stream, child.second);
+            }
+        }
+
+        bool readNode(std::istream &stream, std::streamoff streamEnd, boost::property_tree::ptree &node) {
+            if (!readString(stream, streamEnd, node.data())) {
+                return false;
+            }
+            uint32_t numChildren;
+            if (!stream.read(reinterpret_cast<char *>(&numChildren), sizeof(numChildren))) {
+                return false;
+            }
+            std::string key;
+            for (uint32_t i = 0; i < numChildren; i++) {
+                if (!readString(stream, streamEnd, key)) {
+                    return false;
+                }
+                auto &child = node.push_back({key, boost::property_tree::ptree()})->second;
+                if (!readNode(stream, streamEnd, child)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /** Parses the file, or reads it from the snapshot directory if a snapshot of the same content exists. */
+        void parseInfoFile(const std::string &filename, const std::string &content, uint64_t contentHash, const std::string &directory,
+                           boost::property_tree::ptree &pt) {
+            if (directory.empty() || content.find("#include") != std::string::npos) {
+                boost::property_tree::read_info(filename, pt);
+                return;
+            }
+
+            std::stringstream snapshotName;
+            snapshotName << directory << "/" << std::hex << contentHash << ".ptree";
+            if (readPropertyTreeSnapshot(snapshotName.str(), pt)) {
+                return;
+            }
+
+            pt.clear();
+            boost::property_tree::read_info(filename, pt);
+            try {
+                boost::filesystem::create_directories(directory);
+                // write to a temporary file first, such that concurrent processes never read a partial snapshot
+                const auto tmpName = snapshotName.str() + ".tmp" + std::to_string(::getpid());
+                writePropertyTreeSnapshot(pt, tmpName);
+                boost::filesystem::rename(tmpName, snapshotName.str());
+            } catch (const std::exception &e) {
+                std::cerr << "WARNING: Failed to write the settings snapshot of \"" << filename << "\": " << e.what() << "\n";
+            }
+        }
+    } // namespace
+
+    std::shared_ptr<const boost::property_tree::ptree> readInfoFile(const std::string &filename) {
+        benchmark::ScopedStartupTimer timer(benchmark::StartupPhase::Configuration);
+
+        // the status is taken before the content is read, such that a concurrent write changes the status and leads to a new parse
+        FileStatus fileStatus{};
+        if (!getFileStatus(filename, fileStatus)) {
+            // let the parser report the error
+            auto ptPtr = std::make_shared<boost::property_tree::ptree>();
+            boost::property_tree::read_info(filename, *ptPtr);
+            return ptPtr;
+        }
+
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        const auto it = cache.find(filename);
+        const bool statusMatches = it != cache.end() && it->second.fileStatus == fileStatus;
+        if (statusMatches && !it->second.verifyContent) {
+            return it->second.treePtr;
+        }
+
+        std::string content;
+        if (!readFile(filename, content)) {
+            auto ptPtr = std::make_shared<boost::property_tree::ptree>();
+            boost::property_tree::read_info(filename, *ptPtr);
+            return ptPtr;
+        }
+        const auto contentHash = hashContent(content);
+        const bool verifyContent = isRecentlyModified(fileStatus);
+        if (statusMatches && it->second.contentHash == contentHash) {
+            it->second.verifyContent = verifyContent;
+            return it->second.treePtr;
+        }
+
+        auto ptPtr = std::make_shared<boost::property_tree::ptree>();
+        parseInfoFile(filename, content, contentHash, snapshotDirectory, *ptPtr);
+        cache[filename] = CacheEntry{fileStatus, verifyContent, contentHash, ptPtr};
+        return ptPtr;
+    }
+
+    void setPropertyTreeSnapshotDirectory(const std::string &directory) {
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        snapshotDirectory = directory;
+    }
+
+    void clearPropertyTreeCache() {
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        cache.clear();
+    }
+
+    void writePropertyTreeSnapshot(const boost::property_tree::ptree &pt, const std::string &filename) {
+        std::ofstream file(filename, std::ios::binary);
+        if (!file) {
+            throw std::runtime_error("[writePropertyTreeSnapshot] Could not open file: " + filename);
+        }
+        file.write(snapshotMagic, sizeof(snapshotMagic));
+        file.write(reinterpret_cast<const char *>(&snapshotVersion), sizeof(snapshotVersion));
+        writeNode(file, pt);
+        if (!file) {
+            throw std::runtime_error("[writePropertyTreeSnapshot] Could not write file: " + filename);
+        }
+    }
+
+    bool readPropertyTreeSnapshot(const std::string &filename, boost::property_tree::ptree &pt) {
+        std::ifstream file(filename, std::ios::binary | std::ios::ate);
+        if (!file) {
+            return false;
+        }
+        const std::streamoff fileEnd = file.tellg();
+        file.seekg(0);
+
+        char magic[sizeof(snapshotMagic)];
+        uint8_t version;
+        if (!file.read(magic, sizeof(magic)) || !std::equal(magic, magic + sizeof(magic), snapshotMagic) ||
+            !file.read(reinterpret_cast<char *>(&version), sizeof(version)) || version != snapshotVersion) {
+            return false;
+        }
+
+        // a corrupted snapshot is treated as invalid, such that the file is parsed instead
+        try {
+            pt.clear();
+            return readNode(file, fileEnd, pt) && file.peek() == std::char_traits<char>::eof();
+        } catch (const std::exception &e) {
+            std::cerr << "WARNING: Failed to read the settings snapshot \"" << filename << "\": " << e.what() << "\n";
+            return false;
+        }
+    }
+} // namespace ocs2::loadData
@@ -0,0 +1,96 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include "ocs2_core/misc/StartupProfiler.h"
+
+#include <array>
+#include <atomic>
+#include <iomanip>
+
+namespace ocs2::benchmark {
+    namespace {
+        const auto libraryLoadTime = std::chrono::steady_clock::now();
+
+        std::array<std::atomic<int64_t>, static_cast<size_t>(StartupPhase::Count)> phaseTimes{};
+
+        thread_local bool isStartupTimerActive = false;
+
+        const char *toString(StartupPhase phase) {
+            static const char *names[] = {"configuration", "codegen", "model loading"};
+            return names[static_cast<size_t>(phase)];
+        }
+
+        double toMilliseconds(std::chrono::steady_clock::duration duration) {
+            return std::chrono::duration<double, std::milli>(duration).count();
+        }
+    } // namespace
+
+    ScopedStartupTimer::ScopedStartupTimer(StartupPhase phase)
+        : phase_(phase), isOutermost_(!isStartupTimerActive), startTime_(std::chrono::steady_clock::now()) {
+        isStartupTimerActive = true;
+    }
+
+    ScopedStartupTimer::~ScopedStartupTimer() {
+        if (isOutermost_) {
+            phaseTimes[static_cast<size_t>(phase_)] += (std::chrono::steady_clock::now() - startTime_).count();
+            isStartupTimerActive = false;
+        }
+    }
+
+    double getStartupPhaseTime(StartupPhase phase) {
+        return toMilliseconds(std::chrono::steady_clock::duration(phaseTimes[static_cast<size_t>(phase)].load()));
+    }
+
+    double getTimeSinceStartup() {
+        return toMilliseconds(std::chrono::steady_clock::now() - libraryLoadTime);
+    }
+
+    void printStartupBreakdown(std::ostream &stream) {
+        const double totalTime = getTimeSinceStartup();
+        double otherTime = totalTime;
+
+        const auto flags = stream.flags();
+        const auto precision = stream.precision();
+
+        stream << "\n#### Startup breakdown [ms]";
+        stream << "\n#### =============================================================================\n";
+        stream << std::fixed << std::setprecision(1);
+        for (size_t i = 0; i < phaseTimes.size(); i++) {
+            const auto phase = static_cast<StartupPhase>(i);
+            const double phaseTime = getStartupPhaseTime(phase);
+            otherTime -= phaseTime;
+            stream << "#### " << std::setw(16) << toString(phase) << std::setw(12) << phaseTime << "\n";
+        }
+        stream << "#### " << std::setw(16) << "other" << std::setw(12) << otherTime << "\n";
+        stream << "#### " << std::setw(16) << "total" << std::setw(12) << totalTime << "\n";
+        stream << "#### =============================================================================" << std::endl;
+        stream.flags(flags);
+        stream.precision(precision);
+    }
+} // namespace ocs2::benchmark
@@ -0,0 +1,76 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+
+/**
+ * Converts a binary telemetry file of the TelemetryLogger to CSV or to a NumPy .npy file, depending on the extension of the output file.
+ * Usage: ocs2_telemetry_converter <input> <output.csv|output.npy>
+ */
+
+#include <fstream>
+#include <iostream>
+
+#include <ocs2_core/misc/TelemetryLogger.h>
+
+int main(int argc, char **argv) {
+    if (argc < 3) {
+        std::cerr << "Usage: " << argv[0] << " <input> <output.csv|output.npy>\n";
+        return 1;
+    }
+    const std::string inputFileName(argv[1]);
+    const std::string outputFileName(argv[2]);
+
+    const auto hasExtension = [&](const std::string &extension) {
+        return outputFileName.size() >= extension.size() &&
+               outputFileName.compare(outputFileName.size() - extension.size(), extension.size(), extension) == 0;
+    };
+
+    try {
+        const auto telemetry = ocs2::readTelemetry(inputFileName);
+        if (hasExtension(".npy")) {
+            ocs2::writeTelemetryNpy(telemetry, outputFileName);
+        } else if (hasExtension(".csv")) {
+            std::ofstream file(outputFileName);
+            if (!file) {
+                std::cerr << "Unable to open '" << outputFileName << "'\n";
+                return 1;
+            }
+            ocs2::writeTelemetryCsv(telemetry, file);
+        } else {
+            std::cerr << "Unknown output format of '" << outputFileName << "', use .csv or .npy\n";
+            return 1;
+        }
+        std::cerr << "Converted " << telemetry.data.rows() << " rows of " << telemetry.columnNames.size() << " columns to '"
+                << outputFileName << "'\n";
+    } catch (const std::exception &e) {
+        std::cerr << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
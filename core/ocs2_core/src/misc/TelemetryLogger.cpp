@@ -0,0 +1,413 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+
+#include "ocs2_core/misc/TelemetryLogger.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+
+namespace ocs2 {
+    namespace {
+        constexpr char telemetryMagic[8] = {'O', 'C', 'S', '2', 'T', 'L', 'M', '\0'};
+
+        size_t nextPowerOfTwo(size_t n) {
+            size_t p = 1;
+            while (p < n) {
+                p <<= 1;
+            }
+            return p;
+        }
+
+        template<typename T>
+        void readValue(std::istream &stream, T &value) {
+            stream.read(reinterpret_cast<char *>(&value), sizeof(T));
+        }
+    } // unnamed namespace
+
+    TelemetryLogger::TelemetryLogger(const std::string &fileName, std::vector<std::string> columnNames, TelemetryLoggerSettings settings)
+        : fileName_(fileName),
+          columnNames_(std::move(columnNames)),
+          settings_(std::move(settings)),
+          capacity_(nextPowerOfTwo(std::max<size_t>(settings_.bufferSize, 1))),
+          mask_(capacity_ - 1),
+          rows_(capacity_ * columnNames_.size()),
+          sequences_(new std::atomic<size_t>[capacity_]),
+          chunk_(settings_.chunkSize * columnNames_.size()) {
+        if (columnNames_.empty()) {
+            throw std::runtime_error("[TelemetryLogger] At least one column is required.");
+        }
+        if (settings_.chunkSize == 0) {
+            throw std::runtime_error("[TelemetryLogger] The chunk size must be at least 1.");
+        }
+        for (size_t i = 0; i < capacity_; ++i) {
+            sequences_[i].store(i, std::memory_order_relaxed);
+        }
+
+        // Open the file
+        if (settings_.useMemoryMappedFile) {
+            fileDescriptor_ = ::open(fileName_.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+            if (fileDescriptor_ < 0) {
+                throw std::runtime_error("[TelemetryLogger] Unable to open '" + fileName_ + "'");
+            }
+        } else {
+            file_.open(fileName_, std::ios::binary | std::ios::trunc);
+            if (!file_) {
+                throw std::runtime_error("[TelemetryLogger] Unable to open '" + fileName_ + "'");
+            }
+        }
+
+        // Header, the destructor does not run if the constructor throws, hence the file is closed here
+        try {
+            const uint32_t version = formatVersion;
+            const auto numColumns = static_cast<uint32_t>(columnNames_.size());
+            writeBytes(telemetryMagic, sizeof(telemetryMagic));
+            writeBytes(&version, sizeof(version));
+            writeBytes(&numColumns, sizeof(numColumns));
+            for (const auto &name: columnNames_) {
+                const auto length = static_cast<uint32_t>(name.size());
+                writeBytes(&length, sizeof(length));
+                writeBytes(name.data(), name.size());
+            }
+
+            writerThread_ = std::thread([this]() { run(); });
+        } catch (...) {
+            closeFile();
+            throw;
+        }
+    }
+
+    TelemetryLogger::~TelemetryLogger() {
+        {
+            std::lock_guard<std::mutex> lock(stopMutex_);
+            stop_ = true;
+        }
+        stopCondition_.notify_one();
+        writerThread_.join();
+
+        if (getNumDropped() > 0) {
+            std::cerr << "[TelemetryLogger] " << getNumDropped() << " rows were dropped because the buffer was full, consider increasing "
+                    "the buffer size.\n";
+        }
+    }
+
+    bool TelemetryLogger::append(const scalar_t *row) {
+        if (hasFailed()) {
+            return false;
+        }
+
+        size_t position = enqueuePosition_.load(std::memory_order_relaxed);
+        while (true) {
+            const size_t sequence = sequences_[position & mask_].load(std::memory_order_acquire);
+            const auto difference = static_cast<std::ptrdiff_t>(sequence - position);
+            if (difference == 0) {
+                // slot is free, try to claim it
+                if (enqueuePosition_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (difference < 0) {
+                // slot still holds a row of the previous round, the buffer is full
+                numDropped_.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            } else {
+                // another producer claimed the slot
+                position = enqueuePosition_.load(std::memory_order_relaxed);
+            }
+        }
+
+        std::copy(row, row + getNumColumns(), rows_.data() + (position & mask_) * getNumColumns());
+        sequences_[position & mask_].store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool TelemetryLogger::append(const vector_t &row) {
+        if (static_cast<size_t>(row.size()) != getNumColumns()) {
+            throw std::runtime_error("[TelemetryLogger] The row has " + std::to_string(row.size()) + " values, but the logger has " +
+                                     std::to_string(getNumColumns()) + " columns.");
+        }
+        return append(row.data());
+    }
+
+    void TelemetryLogger::run() {
+        const auto writePeriod = std::chrono::duration<scalar_t>(settings_.writePeriod);
+        const auto flushPeriod = std::chrono::duration<scalar_t>(settings_.flushPeriod);
+        auto lastFlush = std::chrono::steady_clock::now();
+
+        // A write error, e.g., a full disk, must not terminate the process. It stops the logging instead.
+        try {
+            std::unique_lock<std::mutex> lock(stopMutex_);
+            while (!stop_) {
+                stopCondition_.wait_for(lock, writePeriod, [this]() { return stop_; });
+                lock.unlock();
+
+                drain();
+                const auto now = std::chrono::steady_clock::now();
+                if (now - lastFlush >= flushPeriod) {
+                    writeChunk();
+                    flushFile();
+                    lastFlush = now;
+                }
+
+                lock.lock();
+            }
+            lock.unlock();
+
+            drain();
+            writeChunk();
+            flushFile();
+        } catch (const std::exception &e) {
+            errorMessage_ = e.what();
+            failed_.store(true, std::memory_order_release);
+            std::cerr << errorMessage_ << ", logging stopped.\n";
+        }
+        closeFile();
+    }
+
+    void TelemetryLogger::drain() {
+        const size_t numColumns = getNumColumns();
+        while (true) {
+            auto &sequence = sequences_[dequeuePosition_ & mask_];
+            if (sequence.load(std::memory_order_acquire) != dequeuePosition_ + 1) {
+                return; // no row ready
+            }
+
+            // transpose into the column-major chunk
+            const scalar_t *row = rows_.data() + (dequeuePosition_ & mask_) * numColumns;
+            for (size_t j = 0; j < numColumns; ++j) {
+                chunk_[j * settings_.chunkSize + chunkRows_] = row[j];
+            }
+            sequence.store(dequeuePosition_ + capacity_, std::memory_order_release);
+            ++dequeuePosition_;
+
+            if (++chunkRows_ == settings_.chunkSize) {
+                writeChunk();
+            }
+        }
+    }
+
+    void TelemetryLogger::writeChunk() {
+        if (chunkRows_ == 0) {
+            return;
+        }
+        const auto numRows = static_cast<uint64_t>(chunkRows_);
+        writeBytes(&numRows, sizeof(numRows));
+        for (size_t j = 0; j < getNumColumns(); ++j) {
+            writeBytes(chunk_.data() + j * settings_.chunkSize, chunkRows_ * sizeof(scalar_t));
+        }
+        numWritten_.fetch_add(chunkRows_, std::memory_order_relaxed);
+        chunkRows_ = 0;
+    }
+
+    void TelemetryLogger::writeBytes(const void *data, size_t numBytes) {
+        if (!settings_.useMemoryMappedFile) {
+            if (!file_.write(static_cast<const char *>(data), numBytes)) {
+                throw std::runtime_error("[TelemetryLogger] Unable to write '" + fileName_ + "'");
+            }
+            return;
+        }
+
+        if (fileSize_ + numBytes > mappedSize_) {
+            // grow the file, the new part reads as zeros, which terminates the data
+            const size_t newSize = mappedSize_ + std::max(settings_.memoryMappedGrowthSize, numBytes);
+            if (mappedData_ != nullptr) {
+                ::munmap(mappedData_, mappedSize_);
+                mappedData_ = nullptr;
+            }
+            void *mappedData = MAP_FAILED;
+            if (::ftruncate(fileDescriptor_, newSize) == 0) {
+                mappedData = ::mmap(nullptr, newSize, PROT_READ | PROT_WRITE, MAP_SHARED, fileDescriptor_, 0);
+            }
+            if (mappedData == MAP_FAILED) {
+                throw std::runtime_error("[TelemetryLogger] Unable to map '" + fileName_ + "'");
+            }
+            mappedData_ = static_cast<char *>(mappedData);
+            mappedSize_ = newSize;
+        }
+        std::memcpy(mappedData_ + fileSize_, data, numBytes);
+        fileSize_ += numBytes;
+    }
+
+    void TelemetryLogger::flushFile() {
+        if (!settings_.useMemoryMappedFile) {
+            if (!file_.flush()) {
+                throw std::runtime_error("[TelemetryLogger] Unable to write '" + fileName_ + "'");
+            }
+        } else if (mappedData_ != nullptr) {
+            ::msync(mappedData_, mappedSize_, MS_ASYNC);
+        }
+    }
+
+    void TelemetryLogger::closeFile() {
+        if (!settings_.useMemoryMappedFile) {
+            if (file_.is_open()) {
+                file_.close();
+            }
+            return;
+        }
+        if (mappedData_ != nullptr) {
+            ::msync(mappedData_, mappedSize_, MS_SYNC);
+            ::munmap(mappedData_, mappedSize_);
+            mappedData_ = nullptr;
+        }
+        if (fileDescriptor_ < 0) {
+            return;
+        }
+        // cut the unused part of the last growth step
+        if (::ftruncate(fileDescriptor_, fileSize_) != 0) {
+            std::cerr << "[TelemetryLogger] Unable to truncate '" << fileName_ << "'\n";
+        }
+        ::close(fileDescriptor_);
+        fileDescriptor_ = -1;
+    }
+
+    TelemetryData readTelemetry(const std::string &fileName) {
+        std::ifstream file(fileName, std::ios::binary);
+        if (!file) {
+            throw std::runtime_error("[readTelemetry] Unable to open '" + fileName + "'");
+        }
+
+        // Header
+        char magic[sizeof(telemetryMagic)];
+        file.read(magic, sizeof(magic));
+        if (!file || std::memcmp(magic, telemetryMagic, sizeof(magic)) != 0) {
+            throw std::runtime_error("[readTelemetry] '" + fileName + "' is not a telemetry file.");
+        }
+        uint32_t version = 0;
+        uint32_t numColumns = 0;
+        readValue(file, version);
+        readValue(file, numColumns);
+        if (version != TelemetryLogger::formatVersion) {
+            throw std::runtime_error("[readTelemetry] Unsupported format version " + std::to_string(version) + " of '" + fileName + "'");
+        }
+
+        TelemetryData telemetry;
+        telemetry.columnNames.resize(numColumns);
+        for (auto &name: telemetry.columnNames) {
+            uint32_t length = 0;
+            readValue(file, length);
+            name.resize(length);
+            file.read(&name[0], length);
+        }
+        if (!file) {
+            throw std::runtime_error("[readTelemetry] The header of '" + fileName + "' is incomplete.");
+        }
+
+        // Chunks, a chunk which was only partially written is ignored
+        std::vector<matrix_t> chunks;
+        size_t numRows = 0;
+        while (true) {
+            uint64_t chunkRows = 0;
+            readValue(file, chunkRows);
+            if (!file || chunkRows == 0) {
+                break;
+            }
+            matrix_t chunk(chunkRows, numColumns); // column-major, as in the file
+            file.read(reinterpret_cast<char *>(chunk.data()), chunk.size() * sizeof(scalar_t));
+            if (!file) {
+                break;
+            }
+            numRows += chunkRows;
+            chunks.push_back(std::move(chunk));
+        }
+
+        telemetry.data.resize(numRows, numColumns);
+        size_t row = 0;
+        for (const auto &chunk: chunks) {
+            telemetry.data.middleRows(row, chunk.rows()) = chunk;
+            row += chunk.rows();
+        }
+        return telemetry;
+    }
+
+    void writeTelemetryCsv(const TelemetryData &telemetry, std::ostream &stream) {
+        const std::string delim = ", ";
+        for (size_t j = 0; j < telemetry.columnNames.size(); ++j) {
+            stream << (j == 0 ? "" : delim) << telemetry.columnNames[j];
+        }
+        stream << "\n";
+
+        stream << std::setprecision(16); // print decimals up to machine epsilon of double (~10^-16)
+        for (int i = 0; i < telemetry.data.rows(); ++i) {
+            for (int j = 0; j < telemetry.data.cols(); ++j) {
+                stream << (j == 0 ? "" : delim) << telemetry.data(i, j);
+            }
+            stream << "\n";
+        }
+    }
+
+    void writeTelemetryNpy(const TelemetryData &telemetry, const std::string &fileName) {
+        // Array description, one float64 field per column
+        std::string header = "{'descr': [";
+        for (const auto &name: telemetry.columnNames) {
+            if (name.find_first_of("'\\") != std::string::npos) {
+                throw std::runtime_error("[writeTelemetryNpy] The column name '" + name + "' contains a quote or a backslash.");
+            }
+            header += "('" + name + "', '<f8'), ";
+        }
+        header += "], 'fortran_order': False, 'shape': (" + std::to_string(telemetry.data.rows()) + ",), }";
+
+        // The header is padded with spaces and ends with a newline such that the data is 64 byte aligned. Version 1.0 stores the header
+        // length as uint16, version 2.0 as uint32.
+        const bool useVersion2 = header.size() + 11 + 64 > 0xFFFF;
+        const size_t prefixSize = useVersion2 ? 12 : 10;
+        const size_t paddedSize = ((prefixSize + header.size() + 1 + 63) / 64) * 64;
+        header.append(paddedSize - prefixSize - header.size() - 1, ' ');
+        header += '\n';
+
+        std::ofstream file(fileName, std::ios::binary | std::ios::trunc);
+        if (!file) {
+            throw std::runtime_error("[writeTelemetryNpy] Unable to open '" + fileName + "'");
+        }
+        file.write("\x93NUMPY", 6);
+        if (useVersion2) {
+            const char version[2] = {2, 0};
+            const auto headerSize = static_cast<uint32_t>(header.size());
+            file.write(version, 2);
+            file.write(reinterpret_cast<const char *>(&headerSize), sizeof(headerSize));
+        } else {
+            const char version[2] = {1, 0};
+            const auto headerSize = static_cast<uint16_t>(header.size());
+            file.write(version, 2);
+            file.write(reinterpret_cast<const char *>(&headerSize), sizeof(headerSize));
+        }
+        file.write(header.data(), header.size());
+
+        // Records are stored row after row
+        const Eigen::Matrix<scalar_t, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> rowMajorData = telemetry.data;
+        file.write(reinterpret_cast<const char *>(rowMajorData.data()), rowMajorData.size() * sizeof(scalar_t));
+    }
+} // namespace ocs2
@@ -118,15 +118,19 @@ namespace ocs2 {
 
     vector_array_t toConstraintArray(const size_array_t &termsSize, const vector_t &vec) {
         vector_array_t constraintArray;
-        constraintArray.reserve(termsSize.size());
+        toConstraintArray(termsSize, vec, constraintArray);
+        return constraintArray;
+    }
+
+
+    void toConstraintArray(const size_array_t &termsSize, const vector_t &vec, vector_array_t &constraintArray) {
+        constraintArray.resize(termsSize.size());
 
         size_t head = 0;
-        for (const auto &l: termsSize) {
-            constraintArray.emplace_back(vec.segment(head, l));
-            head += l;
+        for (size_t i = 0; i < termsSize.size(); ++i) {
+            constraintArray[i] = vec.segment(head, termsSize[i]);
+            head += termsSize[i];
         } // end of i loop
-
-        return constraintArray;
     }
 
 
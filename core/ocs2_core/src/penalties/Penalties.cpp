@@ -40,8 +40,8 @@ namespace ocs2::loadData {
     void loadPenaltyConfig<augmented::SmoothAbsolutePenalty::Config>(
         const std::string &fileName, const std::string &fieldName,
         augmented::SmoothAbsolutePenalty::Config &config, bool verbose) {
-        boost::property_tree::ptree pt;
-        read_info(fileName, pt);
+        const auto ptPtr = ocs2::loadData::readInfoFile(fileName);
+        const auto &pt = *ptPtr;
 
         if (verbose) {
             std::cerr << "\n #### " << fieldName;
@@ -64,8 +64,8 @@ namespace ocs2::loadData {
                                                                 const std::string &fieldName,
                                                                 augmented::QuadraticPenalty::Config &config,
                                                                 bool verbose) {
-        boost::property_tree::ptree pt;
-        read_info(fileName, pt);
+        const auto ptPtr = ocs2::loadData::readInfoFile(fileName);
+        const auto &pt = *ptPtr;
 
         if (verbose) {
             std::cerr << "\n #### " << fieldName;
@@ -87,8 +87,8 @@ namespace ocs2::loadData {
         const std::string &fileName, const std::string &fieldName,
         augmented::ModifiedRelaxedBarrierPenalty::Config &config,
         bool verbose) {
-        boost::property_tree::ptree pt;
-        read_info(fileName, pt);
+        const auto ptPtr = ocs2::loadData::readInfoFile(fileName);
+        const auto &pt = *ptPtr;
 
         if (verbose) {
             std::cerr << "\n #### " << fieldName;
@@ -111,8 +111,8 @@ namespace ocs2::loadData {
         const std::string &fileName, const std::string &fieldName,
         augmented::SlacknessSquaredHingePenalty::Config &config,
         bool verbose) {
-        boost::property_tree::ptree pt;
-        read_info(fileName, pt);
+        const auto ptPtr = ocs2::loadData::readInfoFile(fileName);
+        const auto &pt = *ptPtr;
 
         if (verbose) {
             std::cerr << "\n #### " << fieldName;
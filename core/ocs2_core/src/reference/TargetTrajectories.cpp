@@ -29,6 +29,10 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "ocs2_core/reference/TargetTrajectories.h"
 
+#include <algorithm>
+#include <mutex>
+#include <string>
+
 #include <ocs2_core/misc/Display.h>
 #include <ocs2_core/misc/LinearInterpolation.h>
 
@@ -82,6 +86,108 @@ namespace ocs2 {
     }
 
 
+    namespace {
+        /** Same as LinearInterpolation::interpolate for vector data, but writes into result to reuse its memory. */
+        void interpolateInPlace(LinearInterpolation::index_alpha_t indexAlpha, const vector_array_t &dataArray,
+                                vector_t &result) {
+            if (dataArray.size() > 1) {
+                const auto &lhs = dataArray[indexAlpha.first];
+                const auto &rhs = dataArray[indexAlpha.first + 1];
+                const scalar_t alpha = indexAlpha.second;
+                if (lhs.size() == rhs.size()) {
+                    result.resize(lhs.size());
+                    result.noalias() = alpha * lhs + (scalar_t(1.0) - alpha) * rhs;
+                } else {
+                    result = (alpha > 0.5) ? lhs : rhs;
+                }
+            } else {
+                result = dataArray.front();
+            }
+        }
+    } // namespace
+
+
+    const vector_t &TargetTrajectoriesCursor::getDesiredState(const TargetTrajectories &targetTrajectories,
+                                                              scalar_t time) {
+        if (targetTrajectories.empty()) {
+            throw std::runtime_error("[TargetTrajectoriesCursor] TargetTrajectories is empty!");
+        }
+        const auto indexAlpha = LinearInterpolation::timeSegment(time, targetTrajectories.timeTrajectory, indexHint_);
+        interpolateInPlace(indexAlpha, targetTrajectories.stateTrajectory, desiredState_);
+        return desiredState_;
+    }
+
+
+    const vector_t &TargetTrajectoriesCursor::getDesiredInput(const TargetTrajectories &targetTrajectories,
+                                                              scalar_t time) {
+        if (targetTrajectories.empty()) {
+            throw std::runtime_error("[TargetTrajectoriesCursor] TargetTrajectories is empty!");
+        }
+        if (targetTrajectories.inputTrajectory.empty()) {
+            throw std::runtime_error("[TargetTrajectoriesCursor] TargetTrajectories does not have inputTrajectory!");
+        }
+        const auto indexAlpha = LinearInterpolation::timeSegment(time, targetTrajectories.timeTrajectory, indexHint_);
+        interpolateInPlace(indexAlpha, targetTrajectories.inputTrajectory, desiredInput_);
+        return desiredInput_;
+    }
+
+
+    namespace {
+        /** Hands out the smallest free slot index to each thread and takes it back when the thread exits. */
+        class ThreadSlots {
+        public:
+            size_t acquire() {
+                std::lock_guard<std::mutex> lock(mutex_);
+                const auto it = std::find(isSlotTaken_.begin(), isSlotTaken_.end(), false);
+                if (it == isSlotTaken_.end()) {
+                    throw std::runtime_error("[ThreadLocalTargetTrajectoriesCursor] More than " +
+                                             std::to_string(ThreadLocalTargetTrajectoriesCursor::maxNumThreads) +
+                                             " threads use cursors at the same time!");
+                }
+                *it = true;
+                return std::distance(isSlotTaken_.begin(), it);
+            }
+
+            void release(size_t slot) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                isSlotTaken_[slot] = false;
+            }
+
+        private:
+            std::mutex mutex_;
+            std::array<bool, ThreadLocalTargetTrajectoriesCursor::maxNumThreads> isSlotTaken_{};
+        };
+
+        ThreadSlots &getThreadSlots() {
+            static ThreadSlots threadSlots;
+            return threadSlots;
+        }
+
+        /** The slot of the calling thread. The mutex of ThreadSlots orders the accesses of consecutive holders of a slot. */
+        size_t getThreadSlot() {
+            struct Slot {
+                Slot() : index(getThreadSlots().acquire()) {
+                }
+
+                ~Slot() { getThreadSlots().release(index); }
+
+                const size_t index;
+            };
+            thread_local const Slot slot;
+            return slot.index;
+        }
+    } // namespace
+
+
+    TargetTrajectoriesCursor &ThreadLocalTargetTrajectoriesCursor::get() const {
+        auto &cursorPtr = cursorPtrs_[getThreadSlot()];
+        if (cursorPtr == nullptr) {
+            cursorPtr = std::make_unique<TargetTrajectoriesCursor>();
+        }
+        return *cursorPtr;
+    }
+
+
     void swap(TargetTrajectories &lh, TargetTrajectories &rh) {
         lh.timeTrajectory.swap(rh.timeTrajectory);
         lh.stateTrajectory.swap(rh.stateTrajectory);
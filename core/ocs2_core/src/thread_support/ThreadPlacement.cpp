@@ -0,0 +1,180 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include <ocs2_core/thread_support/ThreadPlacement.h>
+
+#include <alloca.h>
+#include <malloc.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <iostream>
+#include <unordered_map>
+
+#include <ocs2_core/misc/LoadData.h>
+
+namespace ocs2 {
+    const std::string &toString(ThreadPlacement::SchedulingPolicy schedulingPolicy) {
+        static const std::string names[] = {"SCHED_OTHER", "SCHED_FIFO"};
+        return names[static_cast<size_t>(schedulingPolicy)];
+    }
+
+
+    ThreadPlacement::SchedulingPolicy schedulingPolicyFromString(const std::string &name) {
+        static const std::unordered_map<std::string, ThreadPlacement::SchedulingPolicy> policyMap = {
+            {"SCHED_OTHER", ThreadPlacement::SchedulingPolicy::OTHER}, {"SCHED_FIFO", ThreadPlacement::SchedulingPolicy::FIFO}
+        };
+        const auto it = policyMap.find(name);
+        if (it == policyMap.end()) {
+            throw std::runtime_error("[ThreadPlacement] Unknown scheduling policy: " + name);
+        }
+        return it->second;
+    }
+
+
+    void setThreadPlacement(const ThreadPlacement &threadPlacement, pthread_t thread, size_t threadIndex) {
+        // scheduling
+        if (threadPlacement.schedulingPolicy == ThreadPlacement::SchedulingPolicy::OTHER) {
+            sched_param sched{};
+            sched.sched_priority = 0;
+            if (pthread_setschedparam(thread, SCHED_OTHER, &sched) != 0) {
+                std::cerr << "WARNING: Failed to set the scheduling policy of the thread to SCHED_OTHER." << std::endl;
+            }
+        } else if (threadPlacement.priority != 0) {
+            sched_param sched{};
+            sched.sched_priority = threadPlacement.priority;
+            if (pthread_setschedparam(thread, SCHED_FIFO, &sched) != 0) {
+                std::cerr << "WARNING: Failed to set threads priority (one possible reason could be "
+                        "that the user and the group permissions are not set properly.)"
+                        << std::endl;
+            }
+        }
+
+        // affinity
+        if (!threadPlacement.cpus.empty()) {
+            cpu_set_t cpuSet;
+            CPU_ZERO(&cpuSet);
+            if (threadPlacement.pinToSingleCpu) {
+                CPU_SET(threadPlacement.cpus[threadIndex % threadPlacement.cpus.size()], &cpuSet);
+            } else {
+                for (const auto cpu: threadPlacement.cpus) {
+                    CPU_SET(cpu, &cpuSet);
+                }
+            }
+            if (pthread_setaffinity_np(thread, sizeof(cpu_set_t), &cpuSet) != 0) {
+                std::cerr << "WARNING: Failed to set the CPU affinity of the thread." << std::endl;
+            }
+        }
+    }
+
+
+    void setThisThreadPlacement(const ThreadPlacement &threadPlacement, size_t threadIndex) {
+        setThreadPlacement(threadPlacement, pthread_self(), threadIndex);
+        if (threadPlacement.lockMemory) {
+            lockProcessMemory();
+        }
+        if (threadPlacement.prefaultStackSize > 0) {
+            prefaultStack(threadPlacement.prefaultStackSize);
+        }
+    }
+
+
+    bool lockProcessMemory() {
+        // keep freed heap memory in the process, and do not serve large allocations with mmap, which is unmapped on free
+        mallopt(M_TRIM_THRESHOLD, -1);
+        mallopt(M_MMAP_MAX, 0);
+
+        if (mlockall(MCL_CURRENT | MCL_FUTURE) != 0) {
+            std::cerr << "WARNING: Failed to lock the memory of the process (one possible reason could be that the locked memory "
+                    "limit, see ulimit -l, is too low.)"
+                    << std::endl;
+            return false;
+        }
+        return true;
+    }
+
+
+    void prefaultStack(size_t size) {
+        const size_t pageSize = sysconf(_SC_PAGESIZE);
+        auto *stack = static_cast<volatile unsigned char *>(alloca(size));
+        for (size_t i = 0; i < size; i += pageSize) {
+            stack[i] = 0;
+        }
+    }
+
+
+    void loadThreadPlacement(const boost::property_tree::ptree &pt, const std::string &fieldName, ThreadPlacement &threadPlacement,
+                             bool verbose) {
+        std::string schedulingPolicy = toString(threadPlacement.schedulingPolicy); // keep default
+        loadData::loadPtreeValue(pt, schedulingPolicy, fieldName + ".schedulingPolicy", verbose);
+        threadPlacement.schedulingPolicy = schedulingPolicyFromString(schedulingPolicy);
+
+        loadData::loadPtreeValue(pt, threadPlacement.priority, fieldName + ".priority", verbose);
+
+        if (const auto cpusTree = pt.get_child_optional(fieldName + ".cpus")) {
+            threadPlacement.cpus.clear();
+            for (const auto &cpu: *cpusTree) {
+                threadPlacement.cpus.push_back(cpu.second.get_value<int>());
+            }
+        }
+        if (verbose) {
+            std::string cpus;
+            for (const auto cpu: threadPlacement.cpus) {
+                cpus += (cpus.empty() ? "" : ", ") + std::to_string(cpu);
+            }
+            loadData::printValue(std::cerr, "{" + cpus + "}", "cpus", pt.get_child_optional(fieldName + ".cpus").has_value());
+        }
+
+        loadData::loadPtreeValue(pt, threadPlacement.pinToSingleCpu, fieldName + ".pinToSingleCpu", verbose);
+        loadData::loadPtreeValue(pt, threadPlacement.lockMemory, fieldName + ".lockMemory", verbose);
+        loadData::loadPtreeValue(pt, threadPlacement.prefaultStackSize, fieldName + ".prefaultStackSize", verbose);
+    }
+
+
+    ThreadPlacement loadThreadPlacement(const std::string &filename, const std::string &fieldName, bool verbose) {
+        const auto ptPtr = loadData::readInfoFile(filename);
+        const auto &pt = *ptPtr;
+
+        ThreadPlacement threadPlacement;
+
+        if (verbose) {
+            std::cerr << "\n #### Thread Placement:";
+            std::cerr << "\n #### =============================================================================\n";
+        }
+
+        loadThreadPlacement(pt, fieldName, threadPlacement, verbose);
+
+        if (verbose) {
+            std::cerr << " #### =============================================================================" << std::endl;
+        }
+
+        return threadPlacement;
+    }
+} // namespace ocs2
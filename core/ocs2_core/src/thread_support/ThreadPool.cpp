@@ -27,15 +27,26 @@ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 ******************************************************************************/
 
-#include <ocs2_core/thread_support/SetThreadPriority.h>
 #include <ocs2_core/thread_support/ThreadPool.h>
 
 namespace ocs2 {
-    ThreadPool::ThreadPool(size_t nThreads, int priority) {
+    namespace {
+        ThreadPlacement threadPlacementWithPriority(int priority) {
+            ThreadPlacement threadPlacement;
+            threadPlacement.priority = priority;
+            return threadPlacement;
+        }
+    } // namespace
+
+
+    ThreadPool::ThreadPool(size_t nThreads, int priority) : ThreadPool(nThreads, threadPlacementWithPriority(priority)) {
+    }
+
+
+    ThreadPool::ThreadPool(size_t nThreads, ThreadPlacement threadPlacement) : threadPlacement_(std::move(threadPlacement)) {
         workerThreads_.reserve(nThreads);
         for (size_t i = 0; i < nThreads; i++) {
             workerThreads_.emplace_back(&ThreadPool::worker, this, i);
-            setThreadPriority(priority, workerThreads_.back());
         }
     }
 
@@ -55,6 +66,8 @@ namespace ocs2 {
 
 
     void ThreadPool::worker(int workerIndex) {
+        setThisThreadPlacement(threadPlacement_, workerIndex);
+
         while (true) {
             std::unique_ptr<TaskBase> taskPtr; {
                 std::unique_lock lock(taskQueueLock_);
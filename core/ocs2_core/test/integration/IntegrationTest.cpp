@@ -34,6 +34,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ocs2_core/control/LinearController.h>
 #include <ocs2_core/dynamics/LinearSystemDynamics.h>
 #include <ocs2_core/integration/Integrator.h>
+#include <ocs2_core/misc/HermiteInterpolation.h>
 
 using namespace ocs2;
 
@@ -117,6 +118,55 @@ TEST(IntegrationTest, SecondOrderSystem_AdamsBashfortMoulton) {
 
 #endif
 
+void testDenseOutput(IntegratorType integrator_type) {
+  const scalar_t t0 = 0.0;
+  const scalar_t t1 = 10.0;
+  const vector_t x0 = vector_t::Zero(2);
+
+  const scalar_array_t cntTimeStamp{0, 10};
+  const vector_array_t uff(2, vector_t::Ones(1));
+  const matrix_array_t k(2, matrix_t::Zero(1, 2));
+  LinearController controller(cntTimeStamp, uff, k);
+  auto sys = getSystem(controller);
+
+  std::unique_ptr<IntegratorBase> integrator = newIntegrator(integrator_type);
+
+  // Adaptive time integrator with the state derivative
+  scalar_array_t timeTrajectory;
+  vector_array_t stateTrajectory;
+  vector_array_t derivativeTrajectory;
+  auto observer = Observer(&stateTrajectory, &timeTrajectory, nullptr, &derivativeTrajectory);
+  integrator->integrateAdaptive(*sys, observer, x0, t0, t1, 0.01, 1e-9, 1e-6);
+
+  ASSERT_EQ(derivativeTrajectory.size(), timeTrajectory.size());
+  for (size_t i = 0; i < timeTrajectory.size(); i++) {
+    EXPECT_TRUE(derivativeTrajectory[i].isApprox(sys->computeFlowMap(timeTrajectory[i], stateTrajectory[i]), 1e-9));
+  }
+
+  // Evaluate the dense output in between the steps
+  scalar_array_t queryTimes;
+  for (scalar_t t = t0; t < t1; t += 0.0123) {
+    queryTimes.push_back(t);
+  }
+  vector_array_t referenceTrajectory;
+  observer = Observer(&referenceTrajectory);
+  integrator->integrateTimes(*sys, observer, x0, queryTimes.begin(), queryTimes.end(), 0.01, 1e-9, 1e-6);
+
+  int indexHint = 0;
+  for (size_t i = 0; i < queryTimes.size(); i++) {
+    const vector_t x = HermiteInterpolation::interpolate(queryTimes[i], timeTrajectory, stateTrajectory, derivativeTrajectory, indexHint);
+    EXPECT_TRUE(x.isApprox(referenceTrajectory[i], 1e-4)) << "time: " << queryTimes[i];
+  }
+}
+
+TEST(IntegrationTest, DenseOutput_ODE45) {
+  testDenseOutput(IntegratorType::ODE45);
+}
+
+TEST(IntegrationTest, DenseOutput_ODE45_OCS2) {
+  testDenseOutput(IntegratorType::ODE45_OCS2);
+}
+
 TEST(IntegrationTest, integratorType_from_string) {
   IntegratorType type = integrator_type::fromString("ODE45");
   EXPECT_EQ(type, IntegratorType::ODE45);
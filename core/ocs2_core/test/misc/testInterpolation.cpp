@@ -2,6 +2,7 @@
 
 #include <iostream>
 
+#include <ocs2_core/misc/HermiteInterpolation.h>
 #include <ocs2_core/misc/LinearInterpolation.h>
 #include <Eigen/Dense>
 
@@ -132,3 +133,27 @@ TEST(testLinearInterpolation, testDifferentEigenSizes) {
   result = ocs2::LinearInterpolation::interpolate(1.1, times, data);
   EXPECT_TRUE(result.isApprox(data[1]));
 }
+
+TEST(testHermiteInterpolation, testCubicPolynomial) {
+  // a cubic polynomial and its derivative are reproduced exactly
+  const auto f = [](double t) { return (ocs2::vector_t(2) << t * t * t - 2.0 * t, 0.5 * t * t + 1.0).finished(); };
+  const auto dfdt = [](double t) { return (ocs2::vector_t(2) << 3.0 * t * t - 2.0, t).finished(); };
+
+  const std::vector<double> times = {0.0, 0.3, 1.0, 1.0, 2.5};
+  ocs2::vector_array_t data;
+  ocs2::vector_array_t derivative;
+  for (const auto t : times) {
+    data.push_back(f(t));
+    derivative.push_back(dfdt(t));
+  }
+
+  int indexHint = 0;
+  for (double t = 0.0; t <= 2.5; t += 0.05) {
+    EXPECT_TRUE(ocs2::HermiteInterpolation::interpolate(t, times, data, derivative).isApprox(f(t), 1e-9)) << "time: " << t;
+    EXPECT_TRUE(ocs2::HermiteInterpolation::interpolate(t, times, data, derivative, indexHint).isApprox(f(t), 1e-9)) << "time: " << t;
+  }
+
+  // zero order extrapolation
+  EXPECT_TRUE(ocs2::HermiteInterpolation::interpolate(-1.0, times, data, derivative).isApprox(data.front()));
+  EXPECT_TRUE(ocs2::HermiteInterpolation::interpolate(3.0, times, data, derivative).isApprox(data.back()));
+}
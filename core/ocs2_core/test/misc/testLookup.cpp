@@ -74,6 +74,25 @@ TEST(testLookup, findIndexInTimeArray_precision_highNumbers) {
   ASSERT_EQ(findIndexInTimeArray(timeArray, tQueryPlus), 1);
 }
 
+TEST(testLookup, findIndexInTimeArray_withHint) {
+  const std::vector<double> timeArray{-1.0, 0.0, 0.5, 2.0, 2.0, 2.0, 3.0, 4.5, 6.0, 6.5, 7.0};
+  std::vector<double> queries{-2.0, 8.0};
+  for (double t = -1.5; t < 7.5; t += 0.25) {
+    queries.push_back(t);
+  }
+
+  // Same result as the binary search for any hint
+  for (const double t : queries) {
+    const int index = findIndexInTimeArray(timeArray, t);
+    for (int hint = -1; hint <= static_cast<int>(timeArray.size()) + 1; ++hint) {
+      ASSERT_EQ(findIndexInTimeArray(timeArray, t, hint), index) << "t: " << t << ", hint: " << hint;
+    }
+  }
+
+  // Empty time
+  ASSERT_EQ(findIndexInTimeArray(std::vector<double>(), 1.0, 3), 0);
+}
+
 TEST(testLookup, findIntervalInTimeArray) {
   // Normal case
   std::vector<double> timeArray{-1.0, 2.0, 3.0};
@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+
+#include <fstream>
+
+#include <boost/filesystem.hpp>
+
+#include <ocs2_core/misc/LoadData.h>
+#include <ocs2_core/misc/PropertyTreeCache.h>
+#include <ocs2_core/misc/StartupProfiler.h>
+
+using namespace ocs2;
+
+namespace {
+const std::string dataFolder = boost::filesystem::path(__FILE__).parent_path().generic_string() + "/data/";
+
+std::string tempFileName(const std::string& name) {
+  return "/tmp/ocs2_testPropertyTreeCache_" + name;
+}
+
+void writeFile(const std::string& fileName, const std::string& content) {
+  std::ofstream file(fileName);
+  file << content;
+}
+}  // namespace
+
+TEST(testPropertyTreeCache, parsedOnce) {
+  const auto fileName = dataFolder + "pairVectors.info";
+  const auto ptPtr = loadData::readInfoFile(fileName);
+  EXPECT_EQ(ptPtr, loadData::readInfoFile(fileName));
+  EXPECT_EQ(ptPtr->get<std::string>("stringPairs.[0]"), "s1, s2");
+
+  loadData::clearPropertyTreeCache();
+  EXPECT_NE(ptPtr, loadData::readInfoFile(fileName));
+  EXPECT_GT(benchmark::getStartupPhaseTime(benchmark::StartupPhase::Configuration), 0.0);
+}
+
+TEST(testPropertyTreeCache, reloadModifiedFile) {
+  const auto fileName = tempFileName("reload.info");
+  writeFile(fileName, "value 1\n");
+  EXPECT_EQ(loadData::readInfoFile(fileName)->get<int>("value"), 1);
+
+  // same size, possibly within the timestamp resolution of the filesystem
+  writeFile(fileName, "value 3\n");
+  EXPECT_EQ(loadData::readInfoFile(fileName)->get<int>("value"), 3);
+
+  writeFile(fileName, "value 22\n");
+  EXPECT_EQ(loadData::readInfoFile(fileName)->get<int>("value"), 22);
+
+  boost::filesystem::remove(fileName);
+  EXPECT_ANY_THROW(loadData::readInfoFile(fileName));
+}
+
+TEST(testPropertyTreeCache, snapshot) {
+  const auto snapshotDirectory = tempFileName("snapshots");
+  boost::filesystem::remove_all(snapshotDirectory);
+
+  const auto fileName = dataFolder + "pairVectors.info";
+  boost::property_tree::ptree expected;
+  boost::property_tree::read_info(fileName, expected);
+
+  // the first read writes the snapshot, the second one reads it
+  loadData::setPropertyTreeSnapshotDirectory(snapshotDirectory);
+  for (int i = 0; i < 2; i++) {
+    loadData::clearPropertyTreeCache();
+    EXPECT_EQ(*loadData::readInfoFile(fileName), expected);
+    EXPECT_EQ(std::distance(boost::filesystem::directory_iterator(snapshotDirectory), boost::filesystem::directory_iterator()), 1);
+  }
+
+  // a corrupted snapshot falls back to parsing the file
+  const auto snapshotName = boost::filesystem::directory_iterator(snapshotDirectory)->path().string();
+  writeFile(snapshotName, std::string("OCS2PT\0\x01\xf0\xff\xff\xff", 11));
+  loadData::clearPropertyTreeCache();
+  EXPECT_EQ(*loadData::readInfoFile(fileName), expected);
+  loadData::setPropertyTreeSnapshotDirectory("");
+
+  // the loaders see the same values
+  std::vector<std::string> stringPairs;
+  loadData::loadStdVector(fileName, "stringPairs", stringPairs, false);
+  EXPECT_EQ(stringPairs, std::vector<std::string>({"s1, s2", "s3, s4"}));
+
+  boost::filesystem::remove_all(snapshotDirectory);
+}
+
+TEST(testPropertyTreeCache, invalidSnapshot) {
+  const auto fileName = tempFileName("invalid.ptree");
+  boost::property_tree::ptree pt;
+  pt.put("a.b", 1.5);
+  pt.put("a.c", "text");
+  loadData::writePropertyTreeSnapshot(pt, fileName);
+
+  boost::property_tree::ptree readPt;
+  ASSERT_TRUE(loadData::readPropertyTreeSnapshot(fileName, readPt));
+  EXPECT_EQ(readPt, pt);
+
+  // truncated
+  boost::filesystem::resize_file(fileName, boost::filesystem::file_size(fileName) - 1);
+  EXPECT_FALSE(loadData::readPropertyTreeSnapshot(fileName, readPt));
+
+  // string length beyond the end of the file
+  writeFile(fileName, std::string("OCS2PT\0\x01\xf0\xff\xff\xff", 11));
+  EXPECT_FALSE(loadData::readPropertyTreeSnapshot(fileName, readPt));
+
+  boost::filesystem::remove(fileName);
+  EXPECT_FALSE(loadData::readPropertyTreeSnapshot(fileName, readPt));
+}
@@ -0,0 +1,227 @@
+#include <gtest/gtest.h>
+
+#include <sys/resource.h>
+#include <chrono>
+#include <csignal>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+#include <boost/filesystem.hpp>
+
+#include <ocs2_core/misc/TelemetryLogger.h>
+
+using namespace ocs2;
+
+namespace {
+std::string tempFileName(const std::string& name) {
+  return "/tmp/ocs2_testTelemetryLogger_" + name;
+}
+
+/** Each producer logs rows {producer, i, 2 * i}. */
+void logRows(TelemetryLogger& logger, size_t numProducers, size_t numRowsPerProducer) {
+  std::vector<std::thread> producers;
+  for (size_t p = 0; p < numProducers; ++p) {
+    producers.emplace_back([&, p]() {
+      for (size_t i = 0; i < numRowsPerProducer; ++i) {
+        const scalar_t row[3] = {static_cast<scalar_t>(p), static_cast<scalar_t>(i), 2.0 * i};
+        while (!logger.append(row)) {
+          std::this_thread::yield();  // retry dropped rows, the test checks that everything arrives
+        }
+      }
+    });
+  }
+  for (auto& producer : producers) {
+    producer.join();
+  }
+}
+
+/** Appends rows until the writer fails, returns false on timeout. */
+bool appendUntilFailed(TelemetryLogger& logger) {
+  const auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+  while (std::chrono::steady_clock::now() < timeout) {
+    if (!logger.append(vector_t::Ones(logger.getNumColumns())) && logger.hasFailed()) {
+      return true;
+    }
+    std::this_thread::sleep_for(std::chrono::microseconds(100));
+  }
+  return false;
+}
+
+size_t getNumOpenFiles() {
+  return std::distance(boost::filesystem::directory_iterator("/proc/self/fd"), boost::filesystem::directory_iterator());
+}
+
+void checkRows(const TelemetryData& telemetry, size_t numProducers, size_t numRowsPerProducer) {
+  ASSERT_EQ(telemetry.columnNames, std::vector<std::string>({"producer", "index", "value"}));
+  ASSERT_EQ(telemetry.data.rows(), numProducers * numRowsPerProducer);
+  ASSERT_EQ(telemetry.data.cols(), 3);
+
+  // rows of one producer arrive in order
+  std::vector<scalar_t> nextIndex(numProducers, 0.0);
+  for (int i = 0; i < telemetry.data.rows(); ++i) {
+    const auto p = static_cast<size_t>(telemetry.data(i, 0));
+    ASSERT_LT(p, numProducers);
+    ASSERT_EQ(telemetry.data(i, 1), nextIndex[p]);
+    ASSERT_EQ(telemetry.data(i, 2), 2.0 * nextIndex[p]);
+    nextIndex[p] += 1.0;
+  }
+}
+}  // namespace
+
+class testTelemetryLogger : public ::testing::TestWithParam<bool> {};
+
+TEST_P(testTelemetryLogger, multipleProducers) {
+  const size_t numProducers = 4;
+  const size_t numRowsPerProducer = 5000;
+  const auto fileName = tempFileName(GetParam() ? "mapped.bin" : "stream.bin");
+
+  TelemetryLoggerSettings settings;
+  settings.bufferSize = 256;
+  settings.chunkSize = 100;
+  settings.writePeriod = 0.001;
+  settings.flushPeriod = 0.01;
+  settings.useMemoryMappedFile = GetParam();
+  settings.memoryMappedGrowthSize = 4096;  // grow several times
+  {
+    TelemetryLogger logger(fileName, {"producer", "index", "value"}, settings);
+    logRows(logger, numProducers, numRowsPerProducer);
+  }
+
+  checkRows(readTelemetry(fileName), numProducers, numRowsPerProducer);
+  std::remove(fileName.c_str());
+}
+
+INSTANTIATE_TEST_CASE_P(memoryMappedFile, testTelemetryLogger, ::testing::Bool());
+
+TEST(testTelemetryLogger, dropWhenFull) {
+  const auto fileName = tempFileName("drop.bin");
+
+  TelemetryLoggerSettings settings;
+  settings.bufferSize = 5;       // rounded up to 8
+  settings.writePeriod = 100.0;  // the writer does not drain before the destructor
+  {
+    TelemetryLogger logger(fileName, {"x"}, settings);
+    for (int i = 0; i < 10; ++i) {
+      const vector_t row = vector_t::Constant(1, i);
+      EXPECT_EQ(logger.append(row), i < 8);
+    }
+    EXPECT_EQ(logger.getNumDropped(), 2);
+    EXPECT_THROW(logger.append(vector_t::Zero(2)), std::runtime_error);
+  }
+
+  const auto telemetry = readTelemetry(fileName);
+  ASSERT_EQ(telemetry.data.rows(), 8);
+  for (int i = 0; i < 8; ++i) {
+    EXPECT_EQ(telemetry.data(i, 0), i);
+  }
+  std::remove(fileName.c_str());
+}
+
+TEST(testTelemetryLogger, streamWriteError) {
+  TelemetryLoggerSettings settings;
+  settings.writePeriod = 0.001;
+  settings.flushPeriod = 0.001;
+  TelemetryLogger logger("/dev/full", {"x", "y"}, settings);
+  ASSERT_TRUE(appendUntilFailed(logger));
+  EXPECT_FALSE(logger.getErrorMessage().empty());
+}
+
+TEST(testTelemetryLogger, memoryMappedWriteError) {
+  const auto fileName = tempFileName("limited.bin");
+
+  // growing the file beyond the limit fails instead of raising SIGXFSZ
+  rlimit fileSizeLimit{};
+  ASSERT_EQ(::getrlimit(RLIMIT_FSIZE, &fileSizeLimit), 0);
+  const auto signalHandler = std::signal(SIGXFSZ, SIG_IGN);
+  rlimit smallFileSizeLimit = fileSizeLimit;
+  smallFileSizeLimit.rlim_cur = 3 * 4096;
+  ASSERT_EQ(::setrlimit(RLIMIT_FSIZE, &smallFileSizeLimit), 0);
+
+  TelemetryLoggerSettings settings;
+  settings.chunkSize = 10;
+  settings.writePeriod = 0.001;
+  settings.useMemoryMappedFile = true;
+  settings.memoryMappedGrowthSize = 4096;
+  {
+    TelemetryLogger logger(fileName, {"x", "y"}, settings);
+    EXPECT_TRUE(appendUntilFailed(logger));
+    EXPECT_FALSE(logger.getErrorMessage().empty());
+  }
+
+  ASSERT_EQ(::setrlimit(RLIMIT_FSIZE, &fileSizeLimit), 0);
+  std::signal(SIGXFSZ, signalHandler);
+
+  // the rows written before the error are kept
+  const auto telemetry = readTelemetry(fileName);
+  EXPECT_GT(telemetry.data.rows(), 0);
+  std::remove(fileName.c_str());
+}
+
+TEST(testTelemetryLogger, constructorErrorClosesFile) {
+  // the header cannot be mapped to a character device
+  TelemetryLoggerSettings settings;
+  settings.useMemoryMappedFile = true;
+  const auto numOpenFiles = getNumOpenFiles();
+  EXPECT_THROW(TelemetryLogger("/dev/full", {"x"}, settings), std::runtime_error);
+  EXPECT_EQ(getNumOpenFiles(), numOpenFiles);
+}
+
+TEST(testTelemetryLogger, truncatedFile) {
+  const auto fileName = tempFileName("truncated.bin");
+
+  TelemetryLoggerSettings settings;
+  settings.chunkSize = 10;
+  {
+    TelemetryLogger logger(fileName, {"x", "y"}, settings);
+    for (int i = 0; i < 25; ++i) {
+      logger.append(vector_t::Constant(2, i));
+    }
+  }
+
+  // cut the last chunk in half, as if the process died while writing it
+  std::string content;
+  {
+    std::ifstream file(fileName, std::ios::binary);
+    content.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+  }
+  {
+    std::ofstream file(fileName, std::ios::binary | std::ios::trunc);
+    file.write(content.data(), content.size() - 5 * 2 * sizeof(scalar_t));
+  }
+
+  const auto telemetry = readTelemetry(fileName);
+  ASSERT_EQ(telemetry.data.rows(), 20);
+  EXPECT_EQ(telemetry.data(19, 1), 19.0);
+  std::remove(fileName.c_str());
+}
+
+TEST(testTelemetryLogger, convert) {
+  TelemetryData telemetry;
+  telemetry.columnNames = {"time", "value"};
+  telemetry.data.resize(2, 2);
+  telemetry.data << 0.0, 1.5, 0.1, -2.0;
+
+  std::stringstream csv;
+  writeTelemetryCsv(telemetry, csv);
+  EXPECT_EQ(csv.str(), "time, value\n0, 1.5\n0.1, -2\n");
+
+  const auto fileName = tempFileName("convert.npy");
+  writeTelemetryNpy(telemetry, fileName);
+  std::ifstream file(fileName, std::ios::binary);
+  std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+  ASSERT_EQ(content.substr(0, 8), std::string("\x93NUMPY\x01\x00", 8));
+  const size_t headerSize = static_cast<unsigned char>(content[8]) + 256 * static_cast<unsigned char>(content[9]);
+  EXPECT_EQ((10 + headerSize) % 64, 0);
+  EXPECT_NE(content.find("'descr': [('time', '<f8'), ('value', '<f8'), ]"), std::string::npos);
+  EXPECT_NE(content.find("'shape': (2,)"), std::string::npos);
+
+  // records are stored row by row
+  ASSERT_EQ(content.size(), 10 + headerSize + 4 * sizeof(scalar_t));
+  scalar_t data[4];
+  std::memcpy(data, content.data() + 10 + headerSize, sizeof(data));
+  EXPECT_EQ(data[1], 1.5);
+  EXPECT_EQ(data[2], 0.1);
+  std::remove(fileName.c_str());
+}
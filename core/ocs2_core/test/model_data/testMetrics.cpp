@@ -148,6 +148,27 @@ TEST(TestMetrics, testSerialization) {
   EXPECT_TRUE(getSizes(l) == termsSize);
 }
 
+TEST(TestMetrics, testInPlaceConstraintArray) {
+  const ocs2::size_array_t termsSize{0, 2, 0, 0, 3, 5};
+  const size_t length = std::accumulate(termsSize.begin(), termsSize.end(), size_t(0));
+
+  ocs2::vector_array_t constraintArray;
+  ocs2::toConstraintArray(termsSize, ocs2::vector_t::Random(length), constraintArray);
+  const auto* dataPtr = constraintArray[4].data();
+
+  // Same sizes: the storage is reused
+  const ocs2::vector_t randomVec = ocs2::vector_t::Random(length);
+  ocs2::toConstraintArray(termsSize, randomVec, constraintArray);
+  EXPECT_EQ(constraintArray[4].data(), dataPtr);
+  EXPECT_TRUE(ocs2::toVector(constraintArray) == randomVec);
+  EXPECT_TRUE(ocs2::getSizes(constraintArray) == termsSize);
+
+  // Different sizes
+  const ocs2::size_array_t newTermsSize{4, 1};
+  ocs2::toConstraintArray(newTermsSize, ocs2::vector_t::Random(5), constraintArray);
+  EXPECT_TRUE(ocs2::getSizes(constraintArray) == newTermsSize);
+}
+
 TEST(TestMetrics, testSwap) {
   const ocs2::size_array_t termsSize{0, 2, 0, 0, 3, 5};
 
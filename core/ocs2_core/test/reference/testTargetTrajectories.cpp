@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include <ocs2_core/reference/TargetTrajectories.h>
+
+using namespace ocs2;
+
+namespace {
+TargetTrajectories getTargetTrajectories() {
+  const scalar_array_t timeTrajectory{0.0, 0.5, 1.0, 1.0, 2.0, 3.5};
+  vector_array_t stateTrajectory, inputTrajectory;
+  for (size_t i = 0; i < timeTrajectory.size(); ++i) {
+    stateTrajectory.push_back(vector_t::Random(4));
+    inputTrajectory.push_back(vector_t::Random(2));
+  }
+  return {timeTrajectory, stateTrajectory, inputTrajectory};
+}
+}  // namespace
+
+TEST(testTargetTrajectories, cursorMonotonicQueries) {
+  const auto targetTrajectories = getTargetTrajectories();
+  TargetTrajectoriesCursor cursor;
+  for (scalar_t t = -0.5; t < 4.0; t += 0.05) {
+    EXPECT_TRUE(cursor.getDesiredState(targetTrajectories, t).isApprox(targetTrajectories.getDesiredState(t))) << "t: " << t;
+    EXPECT_TRUE(cursor.getDesiredInput(targetTrajectories, t).isApprox(targetTrajectories.getDesiredInput(t))) << "t: " << t;
+  }
+}
+
+TEST(testTargetTrajectories, cursorRandomQueries) {
+  const auto targetTrajectories = getTargetTrajectories();
+  TargetTrajectoriesCursor cursor;
+  for (int i = 0; i < 100; ++i) {
+    const scalar_t t = 2.0 + 2.5 * vector_t::Random(1)(0);
+    EXPECT_TRUE(cursor.getDesiredState(targetTrajectories, t).isApprox(targetTrajectories.getDesiredState(t))) << "t: " << t;
+  }
+
+  // The cursor stays valid when the target trajectories are replaced
+  const TargetTrajectories singlePoint({1.0}, {vector_t::Ones(4)}, {vector_t::Zero(2)});
+  EXPECT_TRUE(cursor.getDesiredState(singlePoint, 3.0).isApprox(vector_t::Ones(4)));
+  EXPECT_TRUE(cursor.getDesiredInput(singlePoint, 0.0).isZero());
+}
+
+TEST(testTargetTrajectories, cursorNoAllocation) {
+  const auto targetTrajectories = getTargetTrajectories();
+  TargetTrajectoriesCursor cursor;
+  const scalar_t* data = cursor.getDesiredState(targetTrajectories, 0.1).data();
+  for (scalar_t t = 0.2; t < 3.0; t += 0.1) {
+    EXPECT_EQ(cursor.getDesiredState(targetTrajectories, t).data(), data);
+  }
+}
+
+TEST(testTargetTrajectories, cursorThrowsOnEmpty) {
+  TargetTrajectoriesCursor cursor;
+  EXPECT_ANY_THROW(cursor.getDesiredState(TargetTrajectories(), 0.0));
+  const TargetTrajectories noInput({0.0}, {vector_t::Zero(2)});
+  EXPECT_ANY_THROW(cursor.getDesiredInput(noInput, 0.0));
+}
+
+TEST(testTargetTrajectories, threadLocalCursor) {
+  const ThreadLocalTargetTrajectoriesCursor threadLocalCursor;
+  const ThreadLocalTargetTrajectoriesCursor copy(threadLocalCursor);
+  EXPECT_EQ(&threadLocalCursor.get(), &threadLocalCursor.get());
+  EXPECT_NE(&threadLocalCursor.get(), &copy.get());
+
+  const TargetTrajectoriesCursor* otherThreadCursor = nullptr;
+  std::thread([&] { otherThreadCursor = &threadLocalCursor.get(); }).join();
+  EXPECT_NE(&threadLocalCursor.get(), otherThreadCursor);
+}
+
+TEST(testTargetTrajectories, threadLocalCursorSlotReuse) {
+  // the slots of exited threads are reused, more threads than slots may use cursors one after the other
+  const ThreadLocalTargetTrajectoriesCursor threadLocalCursor;
+  for (size_t i = 0; i < 2 * ThreadLocalTargetTrajectoriesCursor::maxNumThreads; ++i) {
+    std::thread([&] { EXPECT_NO_THROW(threadLocalCursor.get()); }).join();
+  }
+}
+
+TEST(testTargetTrajectories, threadLocalCursorConcurrentSweeps) {
+  const auto targetTrajectories = getTargetTrajectories();
+  const ThreadLocalTargetTrajectoriesCursor sharedCursor;
+
+  // Each thread sweeps a different time range through the same owner
+  constexpr int numThreads = 4;
+  std::vector<int> numMismatches(numThreads, 0);
+  std::vector<std::thread> threads;
+  for (int i = 0; i < numThreads; ++i) {
+    threads.emplace_back([&, i] {
+      for (int repeat = 0; repeat < 100; ++repeat) {
+        for (scalar_t t = 0.8 * i; t < 0.8 * i + 1.0; t += 0.01) {
+          const vector_t& desiredState = sharedCursor.get().getDesiredState(targetTrajectories, t);
+          if (!desiredState.isApprox(targetTrajectories.getDesiredState(t))) {
+            ++numMismatches[i];
+          }
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  for (int i = 0; i < numThreads; ++i) {
+    EXPECT_EQ(numMismatches[i], 0) << "thread: " << i;
+  }
+}
@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <ocs2_core/thread_support/BoundedQueue.h>
+
+using namespace ocs2;
+
+TEST(testBoundedQueue, tryPop) {
+  BoundedQueue<int> queue(2);
+  int value;
+  EXPECT_FALSE(queue.tryPop(value));
+
+  EXPECT_TRUE(queue.push(1));
+  EXPECT_TRUE(queue.push(2));
+  EXPECT_EQ(queue.size(), 2);
+  ASSERT_TRUE(queue.tryPop(value));
+  EXPECT_EQ(value, 1);
+  ASSERT_TRUE(queue.tryPop(value));
+  EXPECT_EQ(value, 2);
+  EXPECT_FALSE(queue.tryPop(value));
+
+  EXPECT_THROW(BoundedQueue<int>(0), std::runtime_error);
+}
+
+TEST(testBoundedQueue, close) {
+  BoundedQueue<int> queue(1);
+  queue.push(1);
+
+  // a producer blocked on the full queue returns when it is closed
+  std::thread producer([&]() { EXPECT_FALSE(queue.push(2)); });
+  queue.close();
+  producer.join();
+
+  // remaining elements are still taken after closing
+  int value;
+  ASSERT_TRUE(queue.pop(value));
+  EXPECT_EQ(value, 1);
+  EXPECT_FALSE(queue.pop(value));
+}
+
+TEST(testBoundedQueue, blockingProducers) {
+  constexpr int numProducers = 4;
+  constexpr int numElements = 1000;
+  BoundedQueue<int> queue(2);
+
+  std::atomic_int maxSize(0);
+  std::vector<std::thread> producers;
+  for (int p = 0; p < numProducers; p++) {
+    producers.emplace_back([&, p]() {
+      for (int i = 0; i < numElements; i++) {
+        queue.push(p * numElements + i);
+        maxSize = std::max(maxSize.load(), static_cast<int>(queue.size()));
+      }
+    });
+  }
+
+  // no element is lost
+  std::vector<int> count(numProducers * numElements, 0);
+  int value;
+  for (int i = 0; i < numProducers * numElements; i++) {
+    ASSERT_TRUE(queue.pop(value));
+    ++count[value];
+  }
+  for (auto& producer : producers) {
+    producer.join();
+  }
+  EXPECT_TRUE(std::all_of(count.begin(), count.end(), [](int c) { return c == 1; }));
+  EXPECT_LE(maxSize, 2);
+  EXPECT_EQ(queue.getNumDropped(), 0);
+}
+
+TEST(testBoundedQueue, dropOldest) {
+  BoundedQueue<int> queue(2, QueueOverflowPolicy::DropOldest);
+  EXPECT_TRUE(queue.push(1));
+  EXPECT_TRUE(queue.push(2));
+  EXPECT_TRUE(queue.push(3));  // drops 1
+  EXPECT_EQ(queue.size(), 2);
+  EXPECT_EQ(queue.getNumDropped(), 1);
+
+  int value;
+  ASSERT_TRUE(queue.pop(value));
+  EXPECT_EQ(value, 2);
+  ASSERT_TRUE(queue.pop(value));
+  EXPECT_EQ(value, 3);
+
+  EXPECT_THROW(BoundedQueue<int>(0, QueueOverflowPolicy::DropOldest), std::runtime_error);
+}
+
+TEST(testBoundedQueue, closeDropOldest) {
+  BoundedQueue<int> queue(1, QueueOverflowPolicy::DropOldest);
+  queue.push(1);
+  queue.close();
+  EXPECT_FALSE(queue.push(2));  // discarded
+
+  // remaining elements are still taken after closing
+  int value;
+  ASSERT_TRUE(queue.pop(value));
+  EXPECT_EQ(value, 1);
+  EXPECT_FALSE(queue.pop(value));
+}
+
+TEST(testBoundedQueue, blockingConsumerDropOldest) {
+  BoundedQueue<int> queue(1, QueueOverflowPolicy::DropOldest);
+  std::vector<int> received;
+  std::thread consumer([&]() {
+    int value;
+    while (queue.pop(value)) {
+      received.push_back(value);
+    }
+  });
+
+  for (int i = 1; i <= 1000; i++) {
+    queue.push(i);
+  }
+  queue.close();
+  consumer.join();
+
+  // the consumer sees an increasing subsequence which ends with the last element
+  ASSERT_FALSE(received.empty());
+  EXPECT_EQ(received.back(), 1000);
+  EXPECT_TRUE(std::is_sorted(received.begin(), received.end()));
+  EXPECT_EQ(received.size() + queue.getNumDropped(), 1000);
+}
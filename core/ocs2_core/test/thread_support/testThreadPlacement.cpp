@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+
+#include <sched.h>
+#include <sstream>
+
+#include <boost/property_tree/info_parser.hpp>
+#include <boost/property_tree/ptree.hpp>
+
+#include <ocs2_core/thread_support/ThreadPlacement.h>
+#include <ocs2_core/thread_support/ThreadPool.h>
+
+using namespace ocs2;
+
+namespace {
+/** Returns the first CPU the calling thread may run on. */
+int getFirstAllowedCpu() {
+  cpu_set_t cpuSet;
+  CPU_ZERO(&cpuSet);
+  pthread_getaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuSet);
+  for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+    if (CPU_ISSET(cpu, &cpuSet)) {
+      return cpu;
+    }
+  }
+  return -1;
+}
+}  // namespace
+
+TEST(testThreadPlacement, testLoad) {
+  std::stringstream info;
+  info << "placement\n"
+       << "{\n"
+       << "  schedulingPolicy  SCHED_OTHER\n"
+       << "  cpus\n"
+       << "  {\n"
+       << "    [0]  2\n"
+       << "    [1]  5\n"
+       << "  }\n"
+       << "  pinToSingleCpu  true\n"
+       << "  prefaultStackSize  65536\n"
+       << "}\n";
+  boost::property_tree::ptree pt;
+  boost::property_tree::read_info(info, pt);
+
+  ThreadPlacement threadPlacement;
+  threadPlacement.priority = 10;
+  loadThreadPlacement(pt, "placement", threadPlacement, false);
+
+  EXPECT_EQ(threadPlacement.schedulingPolicy, ThreadPlacement::SchedulingPolicy::OTHER);
+  EXPECT_EQ(threadPlacement.priority, 10);  // not in the file, keeps its value
+  EXPECT_EQ(threadPlacement.cpus, std::vector<int>({2, 5}));
+  EXPECT_TRUE(threadPlacement.pinToSingleCpu);
+  EXPECT_FALSE(threadPlacement.lockMemory);
+  EXPECT_EQ(threadPlacement.prefaultStackSize, 65536);
+}
+
+TEST(testThreadPlacement, testSchedulingPolicyNames) {
+  for (const auto policy : {ThreadPlacement::SchedulingPolicy::OTHER, ThreadPlacement::SchedulingPolicy::FIFO}) {
+    EXPECT_EQ(schedulingPolicyFromString(toString(policy)), policy);
+  }
+  EXPECT_THROW(schedulingPolicyFromString("SCHED_RR"), std::runtime_error);
+}
+
+TEST(testThreadPlacement, testThreadPoolAffinity) {
+  const int cpu = getFirstAllowedCpu();
+  ASSERT_GE(cpu, 0);
+
+  ThreadPlacement threadPlacement;
+  threadPlacement.schedulingPolicy = ThreadPlacement::SchedulingPolicy::OTHER;
+  threadPlacement.cpus = {cpu};
+  threadPlacement.pinToSingleCpu = true;
+  threadPlacement.prefaultStackSize = 64 * 1024;
+  ThreadPool pool(2, threadPlacement);
+
+  for (int i = 0; i < 4; i++) {
+    const int workerCpu = pool.run([](int) { return getFirstAllowedCpu(); }).get();
+    EXPECT_EQ(workerCpu, cpu);
+  }
+}
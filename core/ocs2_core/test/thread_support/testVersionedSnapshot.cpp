@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <ocs2_core/thread_support/VersionedSnapshot.h>
+
+using namespace ocs2;
+
+namespace {
+/** Counts the number of living objects. */
+struct Counted {
+  explicit Counted(int v) : value(v) { ++numAlive; }
+  ~Counted() { --numAlive; }
+  int value;
+  static std::atomic_int numAlive;
+};
+std::atomic_int Counted::numAlive{0};
+}  // namespace
+
+TEST(testVersionedSnapshot, construction) {
+  VersionedSnapshot<double> empty;
+  EXPECT_EQ(empty.version(), 0);
+  EXPECT_FALSE(empty.pin());
+  EXPECT_EQ(empty.pin().version(), 0);
+
+  VersionedSnapshot<double> initialized(std::make_shared<double>(1.0));
+  EXPECT_EQ(initialized.version(), 1);
+  const auto snapshot = initialized.pin();
+  ASSERT_TRUE(snapshot);
+  EXPECT_EQ(*snapshot, 1.0);
+  EXPECT_EQ(snapshot.version(), 1);
+}
+
+TEST(testVersionedSnapshot, pinnedVersionIsKept) {
+  {
+    VersionedSnapshot<Counted> versionedSnapshot(std::make_shared<Counted>(1));
+    auto first = versionedSnapshot.pin();
+
+    EXPECT_EQ(versionedSnapshot.publish(std::make_shared<Counted>(2)), 2);
+    EXPECT_EQ(versionedSnapshot.publish(std::make_shared<Counted>(3)), 3);
+
+    // the pinned version does not change, and a new pin sees the latest version
+    EXPECT_EQ(first->value, 1);
+    EXPECT_EQ(first.version(), 1);
+    EXPECT_EQ(versionedSnapshot.pin()->value, 3);
+
+    // the versions the first reader might see are retired, not destroyed
+    EXPECT_EQ(versionedSnapshot.getNumRetiredVersions(), 2);
+    EXPECT_EQ(Counted::numAlive, 3);
+
+    // shared objects outlive their version
+    const auto shared = first.share();
+    first.release();
+    versionedSnapshot.collect();
+    EXPECT_EQ(versionedSnapshot.getNumRetiredVersions(), 0);
+    EXPECT_EQ(Counted::numAlive, 2);
+    EXPECT_EQ(shared->value, 1);
+  }
+  EXPECT_EQ(Counted::numAlive, 0);
+}
+
+TEST(testVersionedSnapshot, maxNumReaders) {
+  VersionedSnapshot<double> versionedSnapshot(std::make_shared<double>(1.0), 2);
+  auto first = versionedSnapshot.pin();
+  auto second = versionedSnapshot.pin();
+  EXPECT_THROW(versionedSnapshot.pin(), std::runtime_error);
+
+  // moving a snapshot keeps its slot, releasing it frees the slot
+  auto moved = std::move(first);
+  EXPECT_FALSE(first);
+  EXPECT_THROW(versionedSnapshot.pin(), std::runtime_error);
+  moved.release();
+  EXPECT_NO_THROW(versionedSnapshot.pin());
+}
+
+TEST(testVersionedSnapshot, concurrentReaders) {
+  constexpr int numReaders = 4;
+  constexpr int numVersions = 2000;
+  {
+    // every entry of a version holds the version number
+    VersionedSnapshot<std::vector<Counted>> versionedSnapshot(numReaders);
+    std::atomic_bool stop{false};
+    std::atomic_int numInconsistent{0};
+
+    std::vector<std::thread> readers;
+    for (int r = 0; r < numReaders; r++) {
+      readers.emplace_back([&]() {
+        uint64_t lastVersion = 0;
+        while (!stop) {
+          const auto snapshot = versionedSnapshot.pin();
+          if (!snapshot) {
+            continue;
+          }
+          for (const auto& entry : *snapshot) {
+            if (entry.value != static_cast<int>(snapshot.version())) {
+              ++numInconsistent;
+            }
+          }
+          if (snapshot.version() < lastVersion) {
+            ++numInconsistent;
+          }
+          lastVersion = snapshot.version();
+        }
+      });
+    }
+
+    for (int v = 1; v <= numVersions; v++) {
+      auto value = std::make_shared<std::vector<Counted>>();
+      value->reserve(16);
+      for (int i = 0; i < 16; i++) {
+        value->emplace_back(v);
+      }
+      versionedSnapshot.publish(std::move(value));
+    }
+    stop = true;
+    for (auto& reader : readers) {
+      reader.join();
+    }
+
+    EXPECT_EQ(numInconsistent, 0);
+    versionedSnapshot.collect();
+    EXPECT_EQ(versionedSnapshot.getNumRetiredVersions(), 0);
+    EXPECT_EQ(Counted::numAlive, 16);
+  }
+  EXPECT_EQ(Counted::numAlive, 0);
+}
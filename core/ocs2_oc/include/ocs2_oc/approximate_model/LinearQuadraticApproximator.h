@@ -252,4 +252,88 @@ Metrics computeFinalMetrics(OptimalControlProblem& problem, const scalar_t time,
 Metrics computeFinalMetrics(OptimalControlProblem& problem, const scalar_t time, const vector_t& state,
                             const MultiplierCollection& multipliers);
 
+/**
+ * Compute the intermediate-time Metrics in place. The vectors of metrics are reused, such that the Metrics do not allocate when the
+ * constraint terms keep their sizes. Only the values returned by the constraint collections are temporaries.
+ *
+ * @note It is assumed that the precomputation request is already made.
+ * problem.preComputationPtr->request(Request::Cost + Request::Constraint + Request::SoftConstraint, t, x, u)
+ *
+ * @param [in] problem: The optimal control probelm
+ * @param [in] time: The current time.
+ * @param [in] state: The current state.
+ * @param [in] input: The current input.
+ * @param [in] dynamicsViolation: The violation of dynamics. It depends on the transcription method.
+ * @param [out] metrics: The output Metrics.
+ */
+void computeIntermediateMetrics(OptimalControlProblem& problem, const scalar_t time, const vector_t& state, const vector_t& input,
+                                vector_t&& dynamicsViolation, Metrics& metrics);
+
+/**
+ * Compute the intermediate-time Metrics including the Lagrangians in place, reusing the vectors of metrics.
+ *
+ * @param [in] problem: The optimal control probelm
+ * @param [in] time: The current time.
+ * @param [in] state: The current state.
+ * @param [in] input: The current input.
+ * @param [in] multipliers: The current multipliers associated to the equality and inequality Lagrangians.
+ * @param [in] dynamicsViolation: The violation of dynamics. It depends on the transcription method.
+ * @param [out] metrics: The output Metrics.
+ */
+void computeIntermediateMetrics(OptimalControlProblem& problem, const scalar_t time, const vector_t& state, const vector_t& input,
+                                const MultiplierCollection& multipliers, vector_t&& dynamicsViolation, Metrics& metrics);
+
+/**
+ * Compute the event-time Metrics in place, reusing the vectors of metrics.
+ *
+ * @note It is assumed that the precomputation request is already made.
+ * problem.preComputationPtr->requestPreJump(Request::Cost + Request::Constraint + Request::SoftConstraint, t, x)
+ *
+ * @param [in] problem: The optimal control probelm
+ * @param [in] time: The current time.
+ * @param [in] state: The current state.
+ * @param [in] dynamicsViolation: The violation of dynamics. It depends on the transcription method.
+ * @param [out] metrics: The output Metrics.
+ */
+void computePreJumpMetrics(OptimalControlProblem& problem, const scalar_t time, const vector_t& state, vector_t&& dynamicsViolation,
+                           Metrics& metrics);
+
+/**
+ * Compute the event-time Metrics including the Lagrangians in place, reusing the vectors of metrics.
+ *
+ * @param [in] problem: The optimal control probelm
+ * @param [in] time: The current time.
+ * @param [in] state: The current state.
+ * @param [in] multipliers: The current multipliers associated to the equality and inequality Lagrangians.
+ * @param [in] dynamicsViolation: The violation of dynamics. It depends on the transcription method.
+ * @param [out] metrics: The output Metrics.
+ */
+void computePreJumpMetrics(OptimalControlProblem& problem, const scalar_t time, const vector_t& state,
+                           const MultiplierCollection& multipliers, vector_t&& dynamicsViolation, Metrics& metrics);
+
+/**
+ * Compute the final-time Metrics in place, reusing the vectors of metrics.
+ *
+ * @note It is assumed that the precomputation request is already made.
+ * problem.preComputationPtr->requestFinal(Request::Cost + Request::Constraint + Request::SoftConstraint, t, x)
+ *
+ * @param [in] problem: The optimal control probelm
+ * @param [in] time: The current time.
+ * @param [in] state: The current state.
+ * @param [out] metrics: The output Metrics.
+ */
+void computeFinalMetrics(OptimalControlProblem& problem, const scalar_t time, const vector_t& state, Metrics& metrics);
+
+/**
+ * Compute the final-time Metrics including the Lagrangians in place, reusing the vectors of metrics.
+ *
+ * @param [in] problem: The optimal control probelm
+ * @param [in] time: The current time.
+ * @param [in] state: The current state.
+ * @param [in] multipliers: The current multipliers associated to the equality and inequality Lagrangians.
+ * @param [out] metrics: The output Metrics.
+ */
+void computeFinalMetrics(OptimalControlProblem& problem, const scalar_t time, const vector_t& state,
+                         const MultiplierCollection& multipliers, Metrics& metrics);
+
 }  // namespace ocs2
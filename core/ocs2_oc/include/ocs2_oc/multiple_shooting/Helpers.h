@@ -111,5 +111,15 @@ PrimalSolution toPrimalSolution(const std::vector<AnnotatedTime>& time, ModeSche
  */
 ProblemMetrics toProblemMetrics(const std::vector<AnnotatedTime>& time, std::vector<Metrics>&& metrics);
 
+/**
+ * Constructs a ProblemMetrics from an array of metrics by swapping the metrics of each node. The previous content of problemMetrics is
+ * swapped into metrics, such that the memory of both is recycled in the next solver call instead of being released.
+ *
+ * @param [in] time : The annotated time trajectory
+ * @param [in, out] metrics: The metrics array, contains previous metrics of problemMetrics on return (in unspecified order).
+ * @param [in, out] problemMetrics: The ProblemMetrics.
+ */
+void toProblemMetrics(const std::vector<AnnotatedTime>& time, std::vector<Metrics>& metrics, ProblemMetrics& problemMetrics);
+
 }  // namespace multiple_shooting
 }  // namespace ocs2
@@ -94,5 +94,24 @@ void initializeStateInputTrajectories(const vector_t& initState, const std::vect
                                       const PrimalSolution& primalSolution, Initializer& initializer, vector_array_t& stateTrajectory,
                                       vector_array_t& inputTrajectory);
 
+/**
+ * Initializes the state-input trajectories by shifting the previous solution, if the time discretization is a shift of the discretization
+ * of the previous solution, i.e., the nodes of both discretizations which overlap in time are the same within the tolerance. The shared
+ * nodes are copied without interpolation, and only the new tail of the horizon is filled using the initializer. The previous solution is
+ * not modified. The nodes are assigned to the existing vectors of the output trajectories, such that passing the buffers of an earlier
+ * solution of the same size avoids any allocation.
+ *
+ * @param [in] timeDiscretization : The annotated time trajectory
+ * @param [in] tolerance : Maximum time difference between the nodes of the two discretizations. A negative value disables the shift.
+ * @param [in] primalSolution : previous solution
+ * @param [in] initializer : System initializer
+ * @param [in, out] stateTrajectory : The initialized state trajectory, its vectors are reused
+ * @param [in, out] inputTrajectory : The initialized input trajectory, its vectors are reused
+ * @return true if the previous solution is shifted, false if the discretization is not a shift, in which case nothing is modified.
+ */
+bool shiftStateInputTrajectories(const std::vector<AnnotatedTime>& timeDiscretization, scalar_t tolerance,
+                                 const PrimalSolution& primalSolution, Initializer& initializer, vector_array_t& stateTrajectory,
+                                 vector_array_t& inputTrajectory);
+
 }  // namespace multiple_shooting
 }  // namespace ocs2
@@ -60,6 +60,28 @@ Metrics computeMetrics(const EventTranscription& transcription);
  */
 Metrics computeMetrics(const TerminalTranscription& transcription);
 
+/**
+ * Compute the Metrics for a single intermediate node in place. The memory of metrics is reused, such that no memory is allocated if the
+ * constraint terms have the same size as in the previous call.
+ * @param transcription: multiple shooting transcription for an intermediate node.
+ * @param metrics: Metrics for a single intermediate node.
+ */
+void computeMetrics(const Transcription& transcription, Metrics& metrics);
+
+/**
+ * Compute the Metrics for the event node in place, reusing the memory of metrics.
+ * @param transcription: multiple shooting transcription for event node.
+ * @param metrics: Metrics for a event node.
+ */
+void computeMetrics(const EventTranscription& transcription, Metrics& metrics);
+
+/**
+ * Compute the Metrics for the terminal node in place, reusing the memory of metrics.
+ * @param transcription: multiple shooting transcription for terminal node.
+ * @param metrics: Metrics for a terminal node.
+ */
+void computeMetrics(const TerminalTranscription& transcription, Metrics& metrics);
+
 /**
  * Compute the Metrics for a single intermediate node.
  * @param optimalControlProblem : Definition of the optimal control problem
@@ -93,5 +115,39 @@ Metrics computeEventMetrics(OptimalControlProblem& optimalControlProblem, scalar
  */
 Metrics computeTerminalMetrics(OptimalControlProblem& optimalControlProblem, scalar_t t, const vector_t& x);
 
+/**
+ * Compute the Metrics for a single intermediate node in place, reusing the memory of metrics.
+ * @param optimalControlProblem : Definition of the optimal control problem
+ * @param discretizer : Integrator to use for creating the discrete dynamics.
+ * @param t : Start of the discrete interval
+ * @param dt : Duration of the interval
+ * @param x : State at start of the interval
+ * @param x_next : State at the end of the interval
+ * @param u : Input, taken to be constant across the interval.
+ * @param metrics : Metrics for a single intermediate node.
+ */
+void computeIntermediateMetrics(OptimalControlProblem& optimalControlProblem, DynamicsDiscretizer& discretizer, scalar_t t, scalar_t dt,
+                                const vector_t& x, const vector_t& x_next, const vector_t& u, Metrics& metrics);
+
+/**
+ * Compute the Metrics for the event node in place, reusing the memory of metrics.
+ * @param optimalControlProblem : Definition of the optimal control problem
+ * @param t : Time at the event node
+ * @param x : Pre-event state
+ * @param x_next : Post-event state
+ * @param metrics : Metrics for the event node.
+ */
+void computeEventMetrics(OptimalControlProblem& optimalControlProblem, scalar_t t, const vector_t& x, const vector_t& x_next,
+                         Metrics& metrics);
+
+/**
+ * Compute the Metrics for the terminal node in place, reusing the memory of metrics.
+ * @param optimalControlProblem : Definition of the optimal control problem
+ * @param t : Time at the terminal node
+ * @param x : Terminal state
+ * @param metrics : Metrics for the terminal node.
+ */
+void computeTerminalMetrics(OptimalControlProblem& optimalControlProblem, scalar_t t, const vector_t& x, Metrics& metrics);
+
 }  // namespace multiple_shooting
 }  // namespace ocs2
@@ -0,0 +1,121 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#pragma once
+
+#include <ocs2_core/Types.h>
+
+#include "ocs2_oc/oc_data/TimeDiscretization.h"
+
+namespace ocs2 {
+namespace multiple_shooting {
+
+/**
+ * Per-node quasi-Newton approximation of the Hessian of the cost with respect to the node variables z = [x; u]. Each node keeps a dense
+ * BFGS matrix which is updated with the secant pair (s, y) = (z_k - z_{k-1}, dfdz_k - dfdz_{k-1}) every time the node is linearized.
+ * Powell's damping replaces y by a convex combination of y and B * s whenever the curvature s' * y is too small, so the approximation
+ * stays positive definite even if the cost is not convex along s.
+ *
+ * As the rest of the multiple-shooting transcription ignores the second-order derivatives of the dynamics and the constraints, the
+ * approximated part of the Lagrangian Hessian is the one of the cost. This allows the cost to be generated with first-order derivatives
+ * only (see StateInputCostCppAd::initialize).
+ *
+ * The nodes are matched by time when the discretization changes, such that the approximation carries over between the MPC iterations
+ * for a shifted horizon. Updates of different nodes are independent and can be called from different threads.
+ */
+class QuasiNewtonHessian {
+ public:
+  /**
+   * Constructor
+   * @param initialScaling : Scaling of the identity matrix the approximation of a node starts from, until the first secant pair is
+   *                         available. After the first pair, the approximation is reinitialized with the Shanno-Phua scaling y'y / s'y.
+   */
+  explicit QuasiNewtonHessian(scalar_t initialScaling = 1.0) : initialScaling_(initialScaling) {}
+
+  /** Clears the approximation of all nodes. */
+  void reset() { nodes_.clear(); }
+
+  /**
+   * Sets the discretization the node indices of update() refer to. Nodes with the same time and event type as a node of the previous
+   * discretization keep their approximation and their last secant point. The other nodes start from the approximation of the closest
+   * previous node in time.
+   *
+   * @param [in] timeDiscretization : The annotated time trajectory
+   * @param [in] tolerance : Maximum time difference between two matched nodes.
+   */
+  void setTimeDiscretization(const std::vector<AnnotatedTime>& timeDiscretization, scalar_t tolerance = 1e-6);
+
+  /**
+   * Updates the approximation of a node with the gradient of its cost and overwrites the Hessian of the cost (dfdxx, dfdux, dfduu)
+   * with the approximation.
+   *
+   * @param [in] i : Index of the node in the time discretization.
+   * @param [in] x : State at the node.
+   * @param [in] u : Input at the node, empty for event and terminal nodes, which only have the state-state block.
+   * @param [in, out] cost : Quadratic approximation of the cost at the node.
+   */
+  void update(size_t i, const vector_t& x, const vector_t& u, ScalarFunctionQuadraticApproximation& cost);
+
+  /** Gets the current approximation of a node. */
+  const matrix_t& getHessian(size_t i) const { return nodes_[i].hessian; }
+
+ private:
+  struct Node {
+    scalar_t time = 0.0;
+    AnnotatedTime::Event event = AnnotatedTime::Event::None;
+    bool hasSecantPoint = false;
+    bool isScaled = false;
+    vector_t z;
+    vector_t gradient;
+    matrix_t hessian;
+    // buffers
+    vector_t s;
+    vector_t y;
+    vector_t Bs;
+  };
+
+  scalar_t initialScaling_;
+  std::vector<Node> nodes_;
+  std::vector<Node> nodesBuffer_;
+};
+
+/**
+ * Damped BFGS update of a positive definite matrix with the secant pair (s, y), Procedure 18.2 in Nocedal & Wright, Numerical
+ * Optimization. The update is skipped if s is too small to carry curvature information.
+ *
+ * @param [in] s : Step.
+ * @param [in] y : Change of the gradient along the step. It is overwritten by the damped y.
+ * @param [in, out] B : The matrix to update.
+ * @param [out] Bs : Buffer for B * s.
+ * @return true if B is updated.
+ */
+bool dampedBfgsUpdate(const vector_t& s, vector_t& y, matrix_t& B, vector_t& Bs);
+
+}  // namespace multiple_shooting
+}  // namespace ocs2
@@ -31,6 +31,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <ocs2_core/NumericTraits.h>
 #include <ocs2_core/Types.h>
+#include <ocs2_core/model_data/Metrics.h>
 
 namespace ocs2 {
 
@@ -76,6 +77,40 @@ std::vector<AnnotatedTime> timeDiscretizationWithEvents(scalar_t initTime, scala
                                                         const scalar_array_t& eventTimes,
                                                         scalar_t dt_min = 10.0 * numeric_traits::limitEpsilon<scalar_t>());
 
+/**
+ * Decides on a non-uniform time discretization along the horizon. The step grows linearly with the time from the start of the horizon,
+ * dt(t) = min(dt + dtGrowthRate * (t - initTime), dtMax), such that the grid is dense near the current time and coarse towards the end of
+ * the horizon. Event times are part of the discretization as in the uniform case. Afterwards, every interval which contains one of the
+ * refinement times is bisected.
+ *
+ * @param initTime : start time.
+ * @param finalTime : final time.
+ * @param dt : discretization step at the start of the horizon.
+ * @param dtGrowthRate : growth of the discretization step per unit of time. Zero results in the uniform discretization.
+ * @param dtMax : maximum discretization step. A non-positive value means no limit.
+ * @param eventTimes : Event times where a time discretization must be made.
+ * @param refinementTimes : Sorted times whose containing interval is split into two.
+ * @param dt_min : minimum discretization step. Smaller intervals will be merged. Needs to be bigger than limitEpsilon to avoid
+ * interpolation problems
+ * @return vector of discrete time points
+ */
+std::vector<AnnotatedTime> timeDiscretizationWithEvents(scalar_t initTime, scalar_t finalTime, scalar_t dt, scalar_t dtGrowthRate,
+                                                        scalar_t dtMax, const scalar_array_t& eventTimes,
+                                                        const scalar_array_t& refinementTimes,
+                                                        scalar_t dt_min = 10.0 * numeric_traits::limitEpsilon<scalar_t>());
+
+/**
+ * Selects the intervals of a solution whose dynamics violation is above a tolerance, as an error estimate of the discretization.
+ * Event nodes are skipped since their violation belongs to the jump map.
+ *
+ * @param timeDiscretization : The time discretization of the solution.
+ * @param metrics : The metrics of the nodes of the solution, where metrics[i].dynamicsViolation is the defect of the interval i.
+ * @param tolerance : The tolerance on the norm of the dynamics violation.
+ * @return The sorted midpoints of the intervals that violate the tolerance, to be passed as refinementTimes.
+ */
+scalar_array_t getRefinementTimes(const std::vector<AnnotatedTime>& timeDiscretization, const std::vector<Metrics>& metrics,
+                                  scalar_t tolerance);
+
 /**
  * Extracts the time trajectory from the annotated time trajectory.
  *
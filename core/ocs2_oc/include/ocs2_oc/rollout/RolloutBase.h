@@ -34,6 +34,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <ocs2_core/Types.h>
 #include <ocs2_core/control/ControllerBase.h>
+#include <ocs2_core/integration/TrajectoryArena.h>
 #include "ocs2_core/reference/ModeSchedule.h"
 
 #include "ocs2_oc/rollout/RolloutSettings.h"
@@ -124,11 +125,18 @@ class RolloutBase {
   std::vector<std::pair<scalar_t, scalar_t>> findActiveModesTimeInterval(scalar_t initTime, scalar_t finalTime,
                                                                          const scalar_array_t& eventTimes) const;
 
+  /** Extracts the rollout's start and final times for each active mode into the given array, reusing its memory. */
+  void findActiveModesTimeInterval(scalar_t initTime, scalar_t finalTime, const scalar_array_t& eventTimes,
+                                   std::vector<std::pair<scalar_t, scalar_t>>& timeIntervalArray) const;
+
   /** Checks for the numerical stability if rollout::Settings::checkNumericalStability is true. */
   void checkNumericalStability(const ControllerBase& controller, const scalar_array_t& timeTrajectory, const size_array_t& postEventIndices,
                                const vector_array_t& stateTrajectory, const vector_array_t& inputTrajectory) const;
 
   const rollout::Settings rolloutSettings_;
+
+  // Keeps the state vectors of previous rollouts to fill the state trajectory without allocations
+  TrajectoryArena stateTrajectoryArena_;
 };
 
 }  // namespace ocs2
@@ -80,5 +80,9 @@ namespace ocs2 {
         std::shared_ptr<SystemEventHandler> systemEventHandlersPtr_;
 
         std::unique_ptr<IntegratorBase> dynamicsIntegratorPtr_;
+
+        // Kept to reuse their memory between rollouts
+        std::vector<std::pair<scalar_t, scalar_t> > timeIntervalArray_;
+        vector_t beginState_;
     };
 } // namespace ocs2
@@ -56,6 +56,9 @@ class SolverObserver {
    */
   explicit SolverObserver(PrivateToken token) {}
 
+  /** Destructor, waits for the background thread to finish the queued callbacks if the dispatch is asynchronous. */
+  ~SolverObserver();
+
   /** The time of the metric that will be observed. */
   enum class Type {
     Final,
@@ -100,7 +103,27 @@ class SolverObserver {
                                                                 LagrangianCallbackType&& lagrangianCallback,
                                                                 MultiplierCallbackType&& multiplierCallback = multiplier_callback_t());
 
+  /**
+   * Moves the callbacks off the solver thread. The solver then only copies the extracted term into a preallocated ring buffer
+   * and returns, while a background thread runs the callbacks in order. The background thread sets SCHED_OTHER and a nice value
+   * of at least 10 for itself, rather than inheriting the (possibly real-time) scheduling of the calling thread. If the background
+   * thread falls behind and the buffer is full, new samples are dropped rather than blocking the solver. The destructor waits
+   * for the queued samples to be processed.
+   *
+   * @param [in] bufferSize: The number of samples in the ring buffer, including the one the background thread is processing.
+   */
+  void enableAsynchronousDispatch(size_t bufferSize = 4);
+
+  /** Returns the number of samples dropped because the ring buffer of the asynchronous dispatch was full. */
+  size_t getNumDroppedSamples() const;
+
  private:
+  class AsynchronousDispatcher;
+  /** Deleter defined next to AsynchronousDispatcher, such that the template constructor does not need the complete type. */
+  struct AsynchronousDispatcherDeleter {
+    void operator()(AsynchronousDispatcher* dispatcherPtr) const;
+  };
+
   /**
    * Constructor.
    * @param [in] termsName: The name of the term used to add it to OptimalControlProblem.
@@ -142,6 +165,11 @@ class SolverObserver {
    */
   void extractTermMultipliers(const OptimalControlProblem& ocp, const DualSolution& dualSolution);
 
+  /** Calls the callback directly or queues a copy of the extracted term for the background thread. */
+  void dispatch(const scalar_array_t& timeArray, const std::vector<std::reference_wrapper<const vector_t>>& termConstraintArray);
+  void dispatch(const scalar_array_t& timeArray, const std::vector<LagrangianMetricsConstRef>& termLagrangianMetricsArray);
+  void dispatch(const scalar_array_t& timeArray, const std::vector<MultiplierConstRef>& termMultiplierArray);
+
   /**
    * Variables
    */
@@ -150,6 +178,7 @@ class SolverObserver {
   constraint_callback_t constraintCallback_;
   lagrangian_callback_t lagrangianCallback_;
   multiplier_callback_t multiplierCallback_;
+  std::unique_ptr<AsynchronousDispatcher, AsynchronousDispatcherDeleter> asynchronousDispatcherPtr_;
 
   /** SolverBase needs to call extractXXX private methods. */
   friend class SolverBase;
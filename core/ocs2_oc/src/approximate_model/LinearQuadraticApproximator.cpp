@@ -272,9 +272,55 @@ namespace ocs2 {
     Metrics computeIntermediateMetrics(OptimalControlProblem &problem, const scalar_t time, const vector_t &state,
                                        const vector_t &input,
                                        vector_t &&dynamicsViolation) {
-        auto &preComputation = *problem.preComputationPtr;
+        Metrics metrics;
+        computeIntermediateMetrics(problem, time, state, input, std::move(dynamicsViolation), metrics);
+        return metrics;
+    }
+
+
+    Metrics computeIntermediateMetrics(OptimalControlProblem &problem, const scalar_t time, const vector_t &state,
+                                       const vector_t &input,
+                                       const MultiplierCollection &multipliers, vector_t &&dynamicsViolation) {
+        Metrics metrics;
+        computeIntermediateMetrics(problem, time, state, input, multipliers, std::move(dynamicsViolation), metrics);
+        return metrics;
+    }
+
+
+    Metrics computePreJumpMetrics(OptimalControlProblem &problem, const scalar_t time, const vector_t &state,
+                                  vector_t &&dynamicsViolation) {
+        Metrics metrics;
+        computePreJumpMetrics(problem, time, state, std::move(dynamicsViolation), metrics);
+        return metrics;
+    }
+
 
+    Metrics computePreJumpMetrics(OptimalControlProblem &problem, const scalar_t time, const vector_t &state,
+                                  const MultiplierCollection &multipliers, vector_t &&dynamicsViolation) {
         Metrics metrics;
+        computePreJumpMetrics(problem, time, state, multipliers, std::move(dynamicsViolation), metrics);
+        return metrics;
+    }
+
+
+    Metrics computeFinalMetrics(OptimalControlProblem &problem, const scalar_t time, const vector_t &state) {
+        Metrics metrics;
+        computeFinalMetrics(problem, time, state, metrics);
+        return metrics;
+    }
+
+
+    Metrics computeFinalMetrics(OptimalControlProblem &problem, const scalar_t time, const vector_t &state,
+                                const MultiplierCollection &multipliers) {
+        Metrics metrics;
+        computeFinalMetrics(problem, time, state, multipliers, metrics);
+        return metrics;
+    }
+
+
+    void computeIntermediateMetrics(OptimalControlProblem &problem, const scalar_t time, const vector_t &state,
+                                    const vector_t &input, vector_t &&dynamicsViolation, Metrics &metrics) {
+        auto &preComputation = *problem.preComputationPtr;
 
         // Cost
         metrics.cost = computeCost(problem, time, state, input);
@@ -282,138 +328,174 @@ namespace ocs2 {
         // Dynamics violation
         metrics.dynamicsViolation = std::move(dynamicsViolation);
 
-        // Equality constraints
+        // Equality constraints. The copy assignment reuses the vectors of metrics.
         if (!problem.stateEqualityConstraintPtr->empty()) {
-            metrics.stateEqConstraint = problem.stateEqualityConstraintPtr->getValue(time, state, preComputation);
+            const auto values = problem.stateEqualityConstraintPtr->getValue(time, state, preComputation);
+            metrics.stateEqConstraint = values;
+        } else {
+            metrics.stateEqConstraint.clear();
         }
         if (!problem.equalityConstraintPtr->empty()) {
-            metrics.stateInputEqConstraint = problem.equalityConstraintPtr->
-                    getValue(time, state, input, preComputation);
+            const auto values = problem.equalityConstraintPtr->getValue(time, state, input, preComputation);
+            metrics.stateInputEqConstraint = values;
+        } else {
+            metrics.stateInputEqConstraint.clear();
         }
 
         // Inequality constraints
         if (!problem.stateInequalityConstraintPtr->empty()) {
-            metrics.stateIneqConstraint = problem.stateInequalityConstraintPtr->getValue(time, state, preComputation);
+            const auto values = problem.stateInequalityConstraintPtr->getValue(time, state, preComputation);
+            metrics.stateIneqConstraint = values;
+        } else {
+            metrics.stateIneqConstraint.clear();
         }
         if (!problem.inequalityConstraintPtr->empty()) {
-            metrics.stateInputIneqConstraint = problem.inequalityConstraintPtr->getValue(
-                time, state, input, preComputation);
+            const auto values = problem.inequalityConstraintPtr->getValue(time, state, input, preComputation);
+            metrics.stateInputIneqConstraint = values;
+        } else {
+            metrics.stateInputIneqConstraint.clear();
         }
 
-        return metrics;
+        // Lagrangians
+        metrics.stateEqLagrangian.clear();
+        metrics.stateIneqLagrangian.clear();
+        metrics.stateInputEqLagrangian.clear();
+        metrics.stateInputIneqLagrangian.clear();
     }
 
 
-    Metrics computeIntermediateMetrics(OptimalControlProblem &problem, const scalar_t time, const vector_t &state,
-                                       const vector_t &input,
-                                       const MultiplierCollection &multipliers, vector_t &&dynamicsViolation) {
+    void computeIntermediateMetrics(OptimalControlProblem &problem, const scalar_t time, const vector_t &state,
+                                    const vector_t &input, const MultiplierCollection &multipliers,
+                                    vector_t &&dynamicsViolation, Metrics &metrics) {
         auto &preComputation = *problem.preComputationPtr;
 
         // cost, dynamics violation, equlaity constraints, inequlaity constraints
-        auto metrics = computeIntermediateMetrics(problem, time, state, input, std::move(dynamicsViolation));
+        computeIntermediateMetrics(problem, time, state, input, std::move(dynamicsViolation), metrics);
 
         // Equality Lagrangians
-        metrics.stateEqLagrangian = problem.stateEqualityLagrangianPtr->getValue(
+        const auto stateEqLagrangian = problem.stateEqualityLagrangianPtr->getValue(
             time, state, multipliers.stateEq, preComputation);
-        metrics.stateInputEqLagrangian = problem.equalityLagrangianPtr->getValue(
+        metrics.stateEqLagrangian = stateEqLagrangian;
+        const auto stateInputEqLagrangian = problem.equalityLagrangianPtr->getValue(
             time, state, input, multipliers.stateInputEq, preComputation);
+        metrics.stateInputEqLagrangian = stateInputEqLagrangian;
 
         // Inequality Lagrangians
-        metrics.stateIneqLagrangian = problem.stateInequalityLagrangianPtr->getValue(
+        const auto stateIneqLagrangian = problem.stateInequalityLagrangianPtr->getValue(
             time, state, multipliers.stateIneq, preComputation);
-        metrics.stateInputIneqLagrangian =
-                problem.inequalityLagrangianPtr->getValue(time, state, input, multipliers.stateInputIneq,
-                                                          preComputation);
-
-        return metrics;
+        metrics.stateIneqLagrangian = stateIneqLagrangian;
+        const auto stateInputIneqLagrangian = problem.inequalityLagrangianPtr->getValue(
+            time, state, input, multipliers.stateInputIneq, preComputation);
+        metrics.stateInputIneqLagrangian = stateInputIneqLagrangian;
     }
 
 
-    Metrics computePreJumpMetrics(OptimalControlProblem &problem, const scalar_t time, const vector_t &state,
-                                  vector_t &&dynamicsViolation) {
+    void computePreJumpMetrics(OptimalControlProblem &problem, const scalar_t time, const vector_t &state,
+                               vector_t &&dynamicsViolation, Metrics &metrics) {
         auto &preComputation = *problem.preComputationPtr;
 
-        Metrics metrics;
-
         // Cost
         metrics.cost = computeEventCost(problem, time, state);
 
         // Dynamics violation
         metrics.dynamicsViolation = std::move(dynamicsViolation);
 
-        // Equality constraint
+        // Equality constraint. The copy assignment reuses the vectors of metrics.
         if (!problem.preJumpEqualityConstraintPtr->empty()) {
-            metrics.stateEqConstraint = problem.preJumpEqualityConstraintPtr->getValue(time, state, preComputation);
+            const auto values = problem.preJumpEqualityConstraintPtr->getValue(time, state, preComputation);
+            metrics.stateEqConstraint = values;
+        } else {
+            metrics.stateEqConstraint.clear();
         }
+        metrics.stateInputEqConstraint.clear();
 
         // Inequality constraint
         if (!problem.preJumpInequalityConstraintPtr->empty()) {
-            metrics.stateIneqConstraint = problem.preJumpInequalityConstraintPtr->getValue(time, state, preComputation);
+            const auto values = problem.preJumpInequalityConstraintPtr->getValue(time, state, preComputation);
+            metrics.stateIneqConstraint = values;
+        } else {
+            metrics.stateIneqConstraint.clear();
         }
+        metrics.stateInputIneqConstraint.clear();
 
-        return metrics;
+        // Lagrangians
+        metrics.stateEqLagrangian.clear();
+        metrics.stateIneqLagrangian.clear();
+        metrics.stateInputEqLagrangian.clear();
+        metrics.stateInputIneqLagrangian.clear();
     }
 
 
-    Metrics computePreJumpMetrics(OptimalControlProblem &problem, const scalar_t time, const vector_t &state,
-                                  const MultiplierCollection &multipliers, vector_t &&dynamicsViolation) {
+    void computePreJumpMetrics(OptimalControlProblem &problem, const scalar_t time, const vector_t &state,
+                               const MultiplierCollection &multipliers, vector_t &&dynamicsViolation, Metrics &metrics) {
         auto &preComputation = *problem.preComputationPtr;
 
         // cost, dynamics violation, equlaity constraints, inequlaity constraints
-        auto metrics = computePreJumpMetrics(problem, time, state, std::move(dynamicsViolation));
+        computePreJumpMetrics(problem, time, state, std::move(dynamicsViolation), metrics);
 
         // Equality Lagrangians
-        metrics.stateEqLagrangian = problem.preJumpEqualityLagrangianPtr->getValue(
+        const auto stateEqLagrangian = problem.preJumpEqualityLagrangianPtr->getValue(
             time, state, multipliers.stateEq, preComputation);
+        metrics.stateEqLagrangian = stateEqLagrangian;
 
         // Inequality Lagrangians
-        metrics.stateIneqLagrangian = problem.preJumpInequalityLagrangianPtr->getValue(
+        const auto stateIneqLagrangian = problem.preJumpInequalityLagrangianPtr->getValue(
             time, state, multipliers.stateIneq, preComputation);
-
-        return metrics;
+        metrics.stateIneqLagrangian = stateIneqLagrangian;
     }
 
 
-    Metrics computeFinalMetrics(OptimalControlProblem &problem, const scalar_t time, const vector_t &state) {
+    void computeFinalMetrics(OptimalControlProblem &problem, const scalar_t time, const vector_t &state,
+                             Metrics &metrics) {
         auto &preComputation = *problem.preComputationPtr;
 
-        Metrics metrics;
-
         // Cost
         metrics.cost = computeFinalCost(problem, time, state);
 
         // Dynamics violation
-        // metrics.dynamicsViolation = vector_t();
+        metrics.dynamicsViolation.resize(0);
 
-        // Equality constraint
+        // Equality constraint. The copy assignment reuses the vectors of metrics.
         if (!problem.finalEqualityConstraintPtr->empty()) {
-            metrics.stateEqConstraint = problem.finalEqualityConstraintPtr->getValue(time, state, preComputation);
+            const auto values = problem.finalEqualityConstraintPtr->getValue(time, state, preComputation);
+            metrics.stateEqConstraint = values;
+        } else {
+            metrics.stateEqConstraint.clear();
         }
+        metrics.stateInputEqConstraint.clear();
 
         // Inequality constraint
         if (!problem.finalInequalityConstraintPtr->empty()) {
-            metrics.stateIneqConstraint = problem.finalInequalityConstraintPtr->getValue(time, state, preComputation);
+            const auto values = problem.finalInequalityConstraintPtr->getValue(time, state, preComputation);
+            metrics.stateIneqConstraint = values;
+        } else {
+            metrics.stateIneqConstraint.clear();
         }
+        metrics.stateInputIneqConstraint.clear();
 
-        return metrics;
+        // Lagrangians
+        metrics.stateEqLagrangian.clear();
+        metrics.stateIneqLagrangian.clear();
+        metrics.stateInputEqLagrangian.clear();
+        metrics.stateInputIneqLagrangian.clear();
     }
 
 
-    Metrics computeFinalMetrics(OptimalControlProblem &problem, const scalar_t time, const vector_t &state,
-                                const MultiplierCollection &multipliers) {
+    void computeFinalMetrics(OptimalControlProblem &problem, const scalar_t time, const vector_t &state,
+                             const MultiplierCollection &multipliers, Metrics &metrics) {
         auto &preComputation = *problem.preComputationPtr;
 
         // cost, equlaity constraints, inequlaity constraints
-        auto metrics = computeFinalMetrics(problem, time, state);
+        computeFinalMetrics(problem, time, state, metrics);
 
         // Equality Lagrangians
-        metrics.stateEqLagrangian = problem.finalEqualityLagrangianPtr->getValue(
+        const auto stateEqLagrangian = problem.finalEqualityLagrangianPtr->getValue(
             time, state, multipliers.stateEq, preComputation);
+        metrics.stateEqLagrangian = stateEqLagrangian;
 
         // Inequality Lagrangians
-        metrics.stateIneqLagrangian = problem.finalInequalityLagrangianPtr->getValue(
+        const auto stateIneqLagrangian = problem.finalInequalityLagrangianPtr->getValue(
             time, state, multipliers.stateIneq, preComputation);
-
-        return metrics;
+        metrics.stateIneqLagrangian = stateIneqLagrangian;
     }
 } // namespace ocs2
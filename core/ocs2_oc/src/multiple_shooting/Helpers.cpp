@@ -32,6 +32,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ocs2_core/control/FeedforwardController.h>
 #include <ocs2_core/control/LinearController.h>
 
+#include <algorithm>
 #include <memory>
 
 
@@ -149,4 +150,31 @@ namespace ocs2::multiple_shooting {
 
         return problemMetrics;
     }
+
+    void toProblemMetrics(const std::vector<AnnotatedTime> &time, std::vector<Metrics> &metrics,
+                          ProblemMetrics &problemMetrics) {
+        assert(time.size() > 1);
+        assert(metrics.size() == time.size());
+
+        // Problem horizon
+        const int N = static_cast<int>(time.size()) - 1;
+        const auto numPreJumps = static_cast<size_t>(std::count_if(time.begin(), std::prev(time.end()), [](const AnnotatedTime &t) {
+            return t.event == AnnotatedTime::Event::PreEvent;
+        }));
+
+        // resize, keeps the memory of the remaining elements
+        problemMetrics.intermediates.resize(N - numPreJumps);
+        problemMetrics.preJumps.resize(numPreJumps);
+        problemMetrics.final.swap(metrics.back());
+
+        size_t intermediateIndex = 0;
+        size_t preJumpIndex = 0;
+        for (int i = 0; i < N; ++i) {
+            if (time[i].event == AnnotatedTime::Event::PreEvent) {
+                problemMetrics.preJumps[preJumpIndex++].swap(metrics[i]);
+            } else {
+                problemMetrics.intermediates[intermediateIndex++].swap(metrics[i]);
+            }
+        }
+    }
 } // namespace ocs2::multiple_shooting
@@ -29,6 +29,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "ocs2_oc/multiple_shooting/Initialization.h"
 
+#include <algorithm>
+#include <cmath>
 
 namespace ocs2::multiple_shooting {
     void initializeStateInputTrajectories(const vector_t &initState,
@@ -45,7 +47,8 @@ namespace ocs2::multiple_shooting {
         // Determine till when to use the previous solution
         scalar_t interpolateStateTill = timeDiscretization.front().time;
         scalar_t interpolateInputTill = timeDiscretization.front().time;
-        if (primalSolution.timeTrajectory_.size() >= 2) {
+        if (primalSolution.timeTrajectory_.size() >= 2 &&
+            primalSolution.stateTrajectory_.size() == primalSolution.timeTrajectory_.size()) {
             interpolateStateTill = primalSolution.timeTrajectory_.back();
             interpolateInputTill = primalSolution.timeTrajectory_[primalSolution.timeTrajectory_.size() - 2];
         }
@@ -83,4 +86,81 @@ namespace ocs2::multiple_shooting {
             }
         }
     }
+
+    bool shiftStateInputTrajectories(const std::vector<AnnotatedTime> &timeDiscretization, scalar_t tolerance,
+                                     const PrimalSolution &primalSolution, Initializer &initializer,
+                                     vector_array_t &stateTrajectory, vector_array_t &inputTrajectory) {
+        const auto &oldTime = primalSolution.timeTrajectory_;
+        const size_t oldSize = oldTime.size();
+        if (tolerance < 0.0 || oldSize < 2 || primalSolution.stateTrajectory_.size() != oldSize ||
+            primalSolution.inputTrajectory_.size() != oldSize) {
+            return false;
+        }
+
+        const auto &postEventIndices = primalSolution.postEventIndices_;
+        const auto oldEvent = [&](size_t j) {
+            if (std::binary_search(postEventIndices.cbegin(), postEventIndices.cend(), j)) {
+                return AnnotatedTime::Event::PostEvent;
+            } else if (std::binary_search(postEventIndices.cbegin(), postEventIndices.cend(), j + 1)) {
+                return AnnotatedTime::Event::PreEvent;
+            } else {
+                return AnnotatedTime::Event::None;
+            }
+        };
+
+        // The node of the previous solution at the start of the new horizon
+        const scalar_t initTime = timeDiscretization.front().time;
+        size_t offset = std::lower_bound(oldTime.cbegin(), oldTime.cend(), initTime - tolerance) - oldTime.cbegin();
+        if (offset + 1 >= oldSize || oldTime[offset] > initTime + tolerance) {
+            return false;
+        }
+        if (oldEvent(offset) == AnnotatedTime::Event::PreEvent) {
+            offset++; // the horizon starts after the event
+        }
+
+        // Number of nodes shared by both discretizations
+        const size_t N = timeDiscretization.size() - 1; // size of the input trajectory
+        size_t numSharedNodes = std::min(N + 1, oldSize - offset);
+        for (size_t i = 1; i < numSharedNodes; i++) {
+            if (std::abs(oldTime[offset + i] - timeDiscretization[i].time) > tolerance ||
+                oldEvent(offset + i) != timeDiscretization[i].event) {
+                if (offset + i + 1 == oldSize) {
+                    numSharedNodes = i; // the final time of the previous horizon is not on the new grid
+                } else {
+                    return false;
+                }
+            }
+        }
+        if (numSharedNodes < 2) {
+            return false;
+        }
+
+        // Copy the shared nodes, the assignments reuse the memory of the existing vectors
+        stateTrajectory.resize(N + 1);
+        inputTrajectory.resize(N);
+        for (size_t i = 0; i < numSharedNodes; i++) {
+            stateTrajectory[i] = primalSolution.stateTrajectory_[offset + i];
+        }
+        for (size_t i = 0; i + 1 < numSharedNodes; i++) {
+            if (timeDiscretization[i].event == AnnotatedTime::Event::PreEvent) {
+                inputTrajectory[i].resize(0); // No input at event nodes
+            } else {
+                inputTrajectory[i] = primalSolution.inputTrajectory_[offset + i];
+            }
+        }
+
+        // Fill the tail using the initializer
+        for (size_t i = numSharedNodes - 1; i < N; i++) {
+            if (timeDiscretization[i].event == AnnotatedTime::Event::PreEvent) {
+                inputTrajectory[i].resize(0);
+                stateTrajectory[i + 1] = initializeEventNode(timeDiscretization[i].time, stateTrajectory[i]);
+            } else {
+                const scalar_t time = getIntervalStart(timeDiscretization[i]);
+                const scalar_t nextTime = getIntervalEnd(timeDiscretization[i + 1]);
+                initializer.compute(time, stateTrajectory[i], nextTime, inputTrajectory[i], stateTrajectory[i + 1]);
+            }
+        }
+
+        return true;
+    }
 } // namespace ocs2::multiple_shooting
@@ -33,10 +33,36 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 
 namespace ocs2::multiple_shooting {
+    namespace {
+        /** The multiple shooting transcription does not use Lagrangian terms. Clearing keeps the capacity of the arrays. */
+        void clearLagrangians(Metrics &metrics) {
+            metrics.stateEqLagrangian.clear();
+            metrics.stateIneqLagrangian.clear();
+            metrics.stateInputEqLagrangian.clear();
+            metrics.stateInputIneqLagrangian.clear();
+        }
+    } // namespace
+
     Metrics computeMetrics(const Transcription &transcription) {
-        const auto &constraintsSize = transcription.constraintsSize;
+        Metrics metrics;
+        computeMetrics(transcription, metrics);
+        return metrics;
+    }
 
+    Metrics computeMetrics(const EventTranscription &transcription) {
         Metrics metrics;
+        computeMetrics(transcription, metrics);
+        return metrics;
+    }
+
+    Metrics computeMetrics(const TerminalTranscription &transcription) {
+        Metrics metrics;
+        computeMetrics(transcription, metrics);
+        return metrics;
+    }
+
+    void computeMetrics(const Transcription &transcription, Metrics &metrics) {
+        const auto &constraintsSize = transcription.constraintsSize;
 
         // Cost
         metrics.cost = transcription.cost.f;
@@ -45,24 +71,22 @@ namespace ocs2::multiple_shooting {
         metrics.dynamicsViolation = transcription.dynamics.f;
 
         // Equality constraints
-        metrics.stateEqConstraint = toConstraintArray(constraintsSize.stateEq, transcription.stateEqConstraints.f);
-        metrics.stateInputEqConstraint = toConstraintArray(constraintsSize.stateInputEq,
-                                                           transcription.stateInputEqConstraints.f);
+        toConstraintArray(constraintsSize.stateEq, transcription.stateEqConstraints.f, metrics.stateEqConstraint);
+        toConstraintArray(constraintsSize.stateInputEq, transcription.stateInputEqConstraints.f,
+                          metrics.stateInputEqConstraint);
 
         // Inequality constraints.
-        metrics.stateIneqConstraint =
-                toConstraintArray(constraintsSize.stateIneq, transcription.stateIneqConstraints.f);
-        metrics.stateInputIneqConstraint = toConstraintArray(constraintsSize.stateInputIneq,
-                                                             transcription.stateInputIneqConstraints.f);
+        toConstraintArray(constraintsSize.stateIneq, transcription.stateIneqConstraints.f, metrics.stateIneqConstraint);
+        toConstraintArray(constraintsSize.stateInputIneq, transcription.stateInputIneqConstraints.f,
+                          metrics.stateInputIneqConstraint);
 
-        return metrics;
+        // Lagrangians
+        clearLagrangians(metrics);
     }
 
-    Metrics computeMetrics(const EventTranscription &transcription) {
+    void computeMetrics(const EventTranscription &transcription, Metrics &metrics) {
         const auto &constraintsSize = transcription.constraintsSize;
 
-        Metrics metrics;
-
         // Cost
         metrics.cost = transcription.cost.f;
 
@@ -70,34 +94,62 @@ namespace ocs2::multiple_shooting {
         metrics.dynamicsViolation = transcription.dynamics.f;
 
         // Equality constraints
-        metrics.stateEqConstraint = toConstraintArray(constraintsSize.stateEq, transcription.eqConstraints.f);
+        toConstraintArray(constraintsSize.stateEq, transcription.eqConstraints.f, metrics.stateEqConstraint);
+        metrics.stateInputEqConstraint.clear();
 
         // Inequality constraints.
-        metrics.stateIneqConstraint = toConstraintArray(constraintsSize.stateIneq, transcription.ineqConstraints.f);
+        toConstraintArray(constraintsSize.stateIneq, transcription.ineqConstraints.f, metrics.stateIneqConstraint);
+        metrics.stateInputIneqConstraint.clear();
 
-        return metrics;
+        // Lagrangians
+        clearLagrangians(metrics);
     }
 
-    Metrics computeMetrics(const TerminalTranscription &transcription) {
+    void computeMetrics(const TerminalTranscription &transcription, Metrics &metrics) {
         const auto &constraintsSize = transcription.constraintsSize;
 
-        Metrics metrics;
-
         // Cost
         metrics.cost = transcription.cost.f;
 
+        // Dynamics
+        metrics.dynamicsViolation.resize(0);
+
         // Equality constraints
-        metrics.stateEqConstraint = toConstraintArray(constraintsSize.stateEq, transcription.eqConstraints.f);
+        toConstraintArray(constraintsSize.stateEq, transcription.eqConstraints.f, metrics.stateEqConstraint);
+        metrics.stateInputEqConstraint.clear();
 
         // Inequality constraints.
-        metrics.stateIneqConstraint = toConstraintArray(constraintsSize.stateIneq, transcription.ineqConstraints.f);
+        toConstraintArray(constraintsSize.stateIneq, transcription.ineqConstraints.f, metrics.stateIneqConstraint);
+        metrics.stateInputIneqConstraint.clear();
 
-        return metrics;
+        // Lagrangians
+        clearLagrangians(metrics);
     }
 
     Metrics computeIntermediateMetrics(OptimalControlProblem &optimalControlProblem, DynamicsDiscretizer &discretizer,
                                        scalar_t t, scalar_t dt,
                                        const vector_t &x, const vector_t &x_next, const vector_t &u) {
+        Metrics metrics;
+        computeIntermediateMetrics(optimalControlProblem, discretizer, t, dt, x, x_next, u, metrics);
+        return metrics;
+    }
+
+    Metrics computeTerminalMetrics(OptimalControlProblem &optimalControlProblem, scalar_t t, const vector_t &x) {
+        Metrics metrics;
+        computeTerminalMetrics(optimalControlProblem, t, x, metrics);
+        return metrics;
+    }
+
+    Metrics computeEventMetrics(OptimalControlProblem &optimalControlProblem, scalar_t t, const vector_t &x,
+                                const vector_t &x_next) {
+        Metrics metrics;
+        computeEventMetrics(optimalControlProblem, t, x, x_next, metrics);
+        return metrics;
+    }
+
+    void computeIntermediateMetrics(OptimalControlProblem &optimalControlProblem, DynamicsDiscretizer &discretizer,
+                                    scalar_t t, scalar_t dt, const vector_t &x, const vector_t &x_next,
+                                    const vector_t &u, Metrics &metrics) {
         // Dynamics
         auto dynamicsViolation = discretizer(*optimalControlProblem.dynamicsPtr, t, x, u, dt);
         dynamicsViolation -= x_next;
@@ -107,22 +159,21 @@ namespace ocs2::multiple_shooting {
         optimalControlProblem.preComputationPtr->request(request, t, x, u);
 
         // Compute metrics
-        auto metrics = computeIntermediateMetrics(optimalControlProblem, t, x, u, std::move(dynamicsViolation));
+        ocs2::computeIntermediateMetrics(optimalControlProblem, t, x, u, std::move(dynamicsViolation), metrics);
         metrics.cost *= dt; // consider dt
-
-        return metrics;
     }
 
-    Metrics computeTerminalMetrics(OptimalControlProblem &optimalControlProblem, scalar_t t, const vector_t &x) {
+    void computeTerminalMetrics(OptimalControlProblem &optimalControlProblem, scalar_t t, const vector_t &x,
+                                Metrics &metrics) {
         // Precomputation
         constexpr auto request = Request::Cost + Request::SoftConstraint + Request::Constraint;
         optimalControlProblem.preComputationPtr->requestFinal(request, t, x);
 
-        return computeFinalMetrics(optimalControlProblem, t, x);
+        computeFinalMetrics(optimalControlProblem, t, x, metrics);
     }
 
-    Metrics computeEventMetrics(OptimalControlProblem &optimalControlProblem, scalar_t t, const vector_t &x,
-                                const vector_t &x_next) {
+    void computeEventMetrics(OptimalControlProblem &optimalControlProblem, scalar_t t, const vector_t &x,
+                             const vector_t &x_next, Metrics &metrics) {
         // Precomputation
         constexpr auto request = Request::Cost + Request::SoftConstraint + Request::Constraint + Request::Dynamics;
         optimalControlProblem.preComputationPtr->requestPreJump(request, t, x);
@@ -131,6 +182,6 @@ namespace ocs2::multiple_shooting {
         auto dynamicsViolation = optimalControlProblem.dynamicsPtr->computeJumpMap(t, x);
         dynamicsViolation -= x_next;
 
-        return computePreJumpMetrics(optimalControlProblem, t, x, std::move(dynamicsViolation));
+        computePreJumpMetrics(optimalControlProblem, t, x, std::move(dynamicsViolation), metrics);
     }
 } // namespace ocs2::multiple_shooting
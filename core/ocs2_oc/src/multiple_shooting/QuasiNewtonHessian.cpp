@@ -0,0 +1,169 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include "ocs2_oc/multiple_shooting/QuasiNewtonHessian.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace ocs2::multiple_shooting {
+    void QuasiNewtonHessian::setTimeDiscretization(const std::vector<AnnotatedTime> &timeDiscretization,
+                                                   scalar_t tolerance) {
+        const size_t N = timeDiscretization.size();
+        std::vector<int> matches(N, -1);
+
+        // Match the nodes which are in both discretizations
+        size_t j = 0;
+        for (size_t i = 0; i < N; i++) {
+            const auto &annotatedTime = timeDiscretization[i];
+            while (j < nodes_.size() && nodes_[j].time < annotatedTime.time - tolerance) {
+                j++;
+            }
+            // pre- and post-event nodes share the same time
+            for (size_t k = j; k < nodes_.size() && nodes_[k].time <= annotatedTime.time + tolerance; k++) {
+                if (nodes_[k].event == annotatedTime.event) {
+                    matches[i] = static_cast<int>(k);
+                    j = k + 1;
+                    break;
+                }
+            }
+        }
+
+        // The other nodes start from the closest previous node
+        nodesBuffer_.resize(N);
+        for (size_t i = 0; i < N; i++) {
+            if (matches[i] >= 0) {
+                continue;
+            }
+            auto &node = nodesBuffer_[i];
+            node.hasSecantPoint = false;
+            if (nodes_.empty()) {
+                node.isScaled = false;
+                node.hessian.resize(0, 0);
+            } else {
+                const scalar_t time = timeDiscretization[i].time;
+                const auto it = std::lower_bound(nodes_.begin(), nodes_.end(), time,
+                                                 [](const Node &n, scalar_t t) { return n.time < t; });
+                auto closest = (it == nodes_.end()) ? std::prev(it) : it;
+                if (it != nodes_.begin() && it != nodes_.end() && time - std::prev(it)->time < it->time - time) {
+                    closest = std::prev(it);
+                }
+                node.isScaled = closest->isScaled;
+                node.hessian = closest->hessian;
+            }
+        }
+
+        // Move the matched nodes without copying their buffers
+        for (size_t i = 0; i < N; i++) {
+            if (matches[i] >= 0) {
+                std::swap(nodesBuffer_[i], nodes_[matches[i]]);
+            }
+            nodesBuffer_[i].time = timeDiscretization[i].time;
+            nodesBuffer_[i].event = timeDiscretization[i].event;
+        }
+
+        nodes_.swap(nodesBuffer_);
+    }
+
+
+    void QuasiNewtonHessian::update(size_t i, const vector_t &x, const vector_t &u,
+                                    ScalarFunctionQuadraticApproximation &cost) {
+        auto &node = nodes_[i];
+        const auto nx = x.size();
+        const auto nu = u.size();
+        const auto nz = nx + nu;
+
+        if (node.hessian.rows() != nz) {
+            node.hessian.setIdentity(nz, nz);
+            node.hessian *= initialScaling_;
+            node.isScaled = false;
+            node.hasSecantPoint = false;
+        }
+
+        if (node.hasSecantPoint) {
+            node.s.resize(nz);
+            node.y.resize(nz);
+            node.s.head(nx) = x - node.z.head(nx);
+            node.y.head(nx) = cost.dfdx - node.gradient.head(nx);
+            if (nu > 0) {
+                node.s.tail(nu) = u - node.z.tail(nu);
+                node.y.tail(nu) = cost.dfdu - node.gradient.tail(nu);
+            }
+
+            // Shanno-Phua scaling of the initial approximation
+            const scalar_t sy = node.s.dot(node.y);
+            if (!node.isScaled && sy > std::numeric_limits<scalar_t>::epsilon() * node.s.squaredNorm()) {
+                node.hessian.setIdentity();
+                node.hessian *= node.y.squaredNorm() / sy;
+                node.isScaled = true;
+            }
+
+            dampedBfgsUpdate(node.s, node.y, node.hessian, node.Bs);
+        }
+
+        // Secant point for the next update
+        node.z.resize(nz);
+        node.gradient.resize(nz);
+        node.z.head(nx) = x;
+        node.gradient.head(nx) = cost.dfdx;
+        if (nu > 0) {
+            node.z.tail(nu) = u;
+            node.gradient.tail(nu) = cost.dfdu;
+        }
+        node.hasSecantPoint = true;
+
+        cost.dfdxx = node.hessian.topLeftCorner(nx, nx);
+        if (nu > 0) {
+            cost.dfdux = node.hessian.bottomLeftCorner(nu, nx);
+            cost.dfduu = node.hessian.bottomRightCorner(nu, nu);
+        }
+    }
+
+
+    bool dampedBfgsUpdate(const vector_t &s, vector_t &y, matrix_t &B, vector_t &Bs) {
+        Bs.noalias() = B * s;
+        const scalar_t sBs = s.dot(Bs);
+        if (sBs <= std::numeric_limits<scalar_t>::epsilon() * s.squaredNorm()) {
+            return false;
+        }
+
+        // Powell's damping, keeps s'y >= 0.2 * s'Bs > 0
+        scalar_t sy = s.dot(y);
+        if (sy < 0.2 * sBs) {
+            const scalar_t theta = 0.8 * sBs / (sBs - sy);
+            y = theta * y + (1.0 - theta) * Bs;
+            sy = s.dot(y);
+        }
+
+        B.noalias() -= (Bs / sBs) * Bs.transpose();
+        B.noalias() += (y / sy) * y.transpose();
+        return true;
+    }
+} // namespace ocs2::multiple_shooting
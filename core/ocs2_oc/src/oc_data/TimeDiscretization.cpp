@@ -29,6 +29,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "ocs2_oc/oc_data/TimeDiscretization.h"
 
+#include <algorithm>
+
 #include <ocs2_core/misc/Lookup.h>
 
 namespace ocs2 {
@@ -59,7 +61,14 @@ scalar_t getIntervalDuration(const AnnotatedTime& start, const AnnotatedTime& en
 
 std::vector<AnnotatedTime> timeDiscretizationWithEvents(scalar_t initTime, scalar_t finalTime, scalar_t dt,
                                                         const scalar_array_t& eventTimes, scalar_t dt_min) {
+  return timeDiscretizationWithEvents(initTime, finalTime, dt, 0.0, 0.0, eventTimes, scalar_array_t(), dt_min);
+}
+
+std::vector<AnnotatedTime> timeDiscretizationWithEvents(scalar_t initTime, scalar_t finalTime, scalar_t dt, scalar_t dtGrowthRate,
+                                                        scalar_t dtMax, const scalar_array_t& eventTimes,
+                                                        const scalar_array_t& refinementTimes, scalar_t dt_min) {
   assert(dt > 0);
+  assert(dtGrowthRate >= 0);
   assert(finalTime > initTime);
   std::vector<AnnotatedTime> timeDiscretization;
 
@@ -70,7 +79,11 @@ std::vector<AnnotatedTime> timeDiscretizationWithEvents(scalar_t initTime, scala
   // Fill iteratively with pre event, post events are added later
   AnnotatedTime nextNode = timeDiscretization.back();
   while (timeDiscretization.back().time < finalTime) {
-    nextNode.time = nextNode.time + dt;
+    scalar_t step = dt + dtGrowthRate * (nextNode.time - initTime);
+    if (dtMax > 0.0) {
+      step = std::min(step, std::max(dtMax, dt));
+    }
+    nextNode.time = nextNode.time + step;
     nextNode.event = AnnotatedTime::Event::None;
 
     // Check if an event has passed
@@ -98,21 +111,50 @@ std::vector<AnnotatedTime> timeDiscretizationWithEvents(scalar_t initTime, scala
     timeDiscretization.front().event = AnnotatedTime::Event::PostEvent;
   }
 
-  // Duplicate all preEvents to postEvents
+  // Duplicate all preEvents to postEvents, and bisect the intervals that contain a refinement time
   std::vector<AnnotatedTime> timeDiscretizationWithDoubleEvents;
-  timeDiscretizationWithDoubleEvents.reserve(2 * timeDiscretization.size());  // upper bound on size
+  timeDiscretizationWithDoubleEvents.reserve(2 * timeDiscretization.size() + refinementTimes.size());  // upper bound on size
 
-  for (const auto& t : timeDiscretization) {
+  auto refinementTimeIt = std::upper_bound(refinementTimes.cbegin(), refinementTimes.cend(), initTime);
+  for (size_t i = 0; i < timeDiscretization.size(); i++) {
+    const auto& t = timeDiscretization[i];
     timeDiscretizationWithDoubleEvents.push_back(t);
     if (t.event == AnnotatedTime::Event::PreEvent) {
       timeDiscretizationWithDoubleEvents.push_back(t);
       timeDiscretizationWithDoubleEvents.back().event = AnnotatedTime::Event::PostEvent;
     }
+
+    if (i + 1 < timeDiscretization.size()) {
+      const scalar_t intervalEnd = timeDiscretization[i + 1].time;
+      if (refinementTimeIt != refinementTimes.cend() && *refinementTimeIt < intervalEnd) {
+        const scalar_t midTime = 0.5 * (t.time + intervalEnd);
+        if (midTime > t.time + dt_min && midTime < intervalEnd - dt_min) {
+          timeDiscretizationWithDoubleEvents.emplace_back(midTime, AnnotatedTime::Event::None);
+        }
+      }
+      // Skip the refinement times of this interval
+      while (refinementTimeIt != refinementTimes.cend() && *refinementTimeIt < intervalEnd) {
+        ++refinementTimeIt;
+      }
+    }
   }
 
   return timeDiscretizationWithDoubleEvents;
 }
 
+scalar_array_t getRefinementTimes(const std::vector<AnnotatedTime>& timeDiscretization, const std::vector<Metrics>& metrics,
+                                  scalar_t tolerance) {
+  scalar_array_t refinementTimes;
+  const size_t N = std::min(timeDiscretization.size(), metrics.size());
+  for (size_t i = 0; i + 1 < N; i++) {
+    if (timeDiscretization[i].event != AnnotatedTime::Event::PreEvent && metrics[i].dynamicsViolation.size() > 0 &&
+        metrics[i].dynamicsViolation.norm() > tolerance) {
+      refinementTimes.push_back(0.5 * (timeDiscretization[i].time + timeDiscretization[i + 1].time));
+    }
+  }
+  return refinementTimes;
+}
+
 scalar_array_t toTime(const std::vector<AnnotatedTime>& annotatedTime) {
   scalar_array_t timeTrajectory;
   timeTrajectory.reserve(annotatedTime.size());
@@ -31,6 +31,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <algorithm>
 #include <iomanip>
+#include <iterator>
 #include <iostream>
 
 #include <ocs2_core/NumericTraits.h>
@@ -40,30 +41,32 @@ namespace ocs2 {
     std::vector<std::pair<scalar_t, scalar_t> > RolloutBase::findActiveModesTimeInterval(
         scalar_t initTime, scalar_t finalTime,
         const scalar_array_t &eventTimes) const {
+        std::vector<std::pair<scalar_t, scalar_t> > timeIntervalArray;
+        findActiveModesTimeInterval(initTime, finalTime, eventTimes, timeIntervalArray);
+        return timeIntervalArray;
+    }
+
+
+    void RolloutBase::findActiveModesTimeInterval(scalar_t initTime, scalar_t finalTime, const scalar_array_t &eventTimes,
+                                                  std::vector<std::pair<scalar_t, scalar_t> > &timeIntervalArray) const {
         // switching times
         const auto firstIndex = std::upper_bound(eventTimes.cbegin(), eventTimes.cend(), initTime);
         // no event at initial time
         const auto lastIndex = std::upper_bound(eventTimes.cbegin(), eventTimes.cend(), finalTime);
         // can be an event at final time
-        scalar_array_t switchingTimes;
-        switchingTimes.push_back(initTime);
-        switchingTimes.insert(switchingTimes.end(), firstIndex, lastIndex);
-        switchingTimes.push_back(finalTime);
-
-        // constructing the rollout time intervals
-        const int numSubsystems = switchingTimes.size() - 1; // switchingTimes contains at least two elements
-        std::vector<std::pair<scalar_t, scalar_t> > timeIntervalArray(numSubsystems);
+
+        // constructing the rollout time intervals between initTime, the switching times, and finalTime
+        const int numSubsystems = std::distance(firstIndex, lastIndex) + 1;
+        timeIntervalArray.resize(numSubsystems);
         for (int i = 0; i < numSubsystems; i++) {
-            const auto &beginTime = switchingTimes[i];
-            const auto &endTime = switchingTimes[i + 1];
+            const scalar_t beginTime = (i == 0) ? initTime : *(firstIndex + (i - 1));
+            const scalar_t endTime = (i + 1 == numSubsystems) ? finalTime : *(firstIndex + i);
             timeIntervalArray[i] = std::make_pair(beginTime, endTime);
 
             // adjusting the start time to correct for subsystem recognition
             constexpr auto eps = numeric_traits::weakEpsilon<scalar_t>();
             timeIntervalArray[i].first = std::min(beginTime + eps, endTime);
         } // end of for loop
-
-        return timeIntervalArray;
     }
 
 
@@ -37,8 +37,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 namespace ocs2::rollout {
     Settings loadSettings(const std::string &filename, const std::string &fieldName, bool verbose) {
-        boost::property_tree::ptree pt;
-        read_info(filename, pt);
+        const auto ptPtr = loadData::readInfoFile(filename);
+        const auto &pt = *ptPtr;
 
         Settings settings;
 
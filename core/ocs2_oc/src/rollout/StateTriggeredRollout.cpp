@@ -64,7 +64,7 @@ namespace ocs2 {
         modeSchedule.clear();
         timeTrajectory.clear();
         timeTrajectory.reserve(maxNumSteps + 1);
-        stateTrajectory.clear();
+        stateTrajectoryArena_.recycle(stateTrajectory);
         stateTrajectory.reserve(maxNumSteps + 1);
         inputTrajectory.clear();
         inputTrajectory.reserve(maxNumSteps + 1);
@@ -103,7 +103,7 @@ namespace ocs2 {
             // keeps looping until end time condition is fulfilled, after which the loop is broken
             bool triggered = false;
             try {
-                Observer observer(&stateTrajectory, &timeTrajectory); // concatenate trajectory
+                Observer observer(&stateTrajectory, &timeTrajectory, &stateTrajectoryArena_); // concatenate trajectory
                 dynamicsIntegratorPtr_->integrateAdaptive(*systemDynamicsPtr_, observer, x0, t0, t1,
                                                           this->settings().timeStep,
                                                           this->settings().absTolODE, this->settings().relTolODE,
@@ -129,7 +129,7 @@ namespace ocs2 {
             // (Due to checking in EventHandler this can only happen to the last element of the trajectory)
             // Exception is when the element is outside the guardSurface but within tolerance
             if (triggered && !accuracyCondition) {
-                stateTrajectory.pop_back();
+                stateTrajectoryArena_.popBack(stateTrajectory);
                 timeTrajectory.pop_back();
             }
             triggered = false;
@@ -190,7 +190,7 @@ namespace ocs2 {
                 t0 = timeTrajectory.back();
                 x0 = stateTrajectory.back();
 
-                stateTrajectory.pop_back();
+                stateTrajectoryArena_.popBack(stateTrajectory);
                 timeTrajectory.pop_back();
                 inputTrajectory.pop_back();
                 k_u--;
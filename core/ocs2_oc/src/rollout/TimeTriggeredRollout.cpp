@@ -52,7 +52,8 @@ namespace ocs2 {
         }
 
         // extract sub-systems
-        const auto timeIntervalArray = findActiveModesTimeInterval(initTime, finalTime, modeSchedule.eventTimes);
+        auto &timeIntervalArray = timeIntervalArray_;
+        findActiveModesTimeInterval(initTime, finalTime, modeSchedule.eventTimes, timeIntervalArray);
         const int numSubsystems = timeIntervalArray.size();
         const int numEvents = numSubsystems - 1;
 
@@ -60,10 +61,10 @@ namespace ocs2 {
         const auto maxNumSteps = static_cast<size_t>(this->settings().maxNumStepsPerSecond * std::max(
                                                          1.0, finalTime - initTime));
 
-        // clearing the output trajectories
+        // clearing the output trajectories, the memory of the states is kept in the arena
         timeTrajectory.clear();
         timeTrajectory.reserve(maxNumSteps + 1);
-        stateTrajectory.clear();
+        stateTrajectoryArena_.recycle(stateTrajectory);
         stateTrajectory.reserve(maxNumSteps + 1);
         inputTrajectory.clear();
         inputTrajectory.reserve(maxNumSteps + 1);
@@ -79,11 +80,12 @@ namespace ocs2 {
         // reset the event class
         systemEventHandlersPtr_->reset();
 
-        vector_t beginState = initState;
+        auto &beginState = beginState_;
+        beginState = initState;
         int k_u = 0; // control input iterator
         for (int i = 0; i < numSubsystems; i++) {
             if (timeIntervalArray[i].first < timeIntervalArray[i].second) {
-                Observer observer(&stateTrajectory, &timeTrajectory); // concatenate trajectory
+                Observer observer(&stateTrajectory, &timeTrajectory, &stateTrajectoryArena_); // concatenate trajectory
                 // integrate controlled system
                 dynamicsIntegratorPtr_->integrateAdaptive(*systemDynamicsPtr_, observer, beginState,
                                                           timeIntervalArray[i].first,
@@ -92,7 +94,7 @@ namespace ocs2 {
                                                           this->settings().relTolODE, maxNumSteps);
             } else {
                 timeTrajectory.push_back(timeIntervalArray[i].second);
-                stateTrajectory.push_back(beginState);
+                stateTrajectoryArena_.pushBack(stateTrajectory, beginState);
             }
 
             // compute control input trajectory and concatenate to inputTrajectory
@@ -29,6 +29,18 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "ocs2_oc/synchronized_module/SolverObserver.h"
 
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <condition_variable>
+#include <iostream>
+#include <mutex>
+#include <thread>
+
+#include <ocs2_core/thread_support/ThreadPlacement.h>
+
 #include "ocs2_oc/oc_problem/OptimalControlProblemHelperFunction.h"
 
 namespace ocs2 {
@@ -45,9 +57,220 @@ namespace ocs2 {
                     throw std::runtime_error("[SolverObserver::toString] undefined type!");
             }
         }
+
+        /**
+         * Sets SCHED_OTHER and a low priority (nice value) for the calling thread. A new thread inherits the scheduling of its creator,
+         * which is SCHED_FIFO if the dispatch is enabled from a real-time MPC thread.
+         */
+        void setBackgroundScheduling() {
+            constexpr int backgroundNiceValue = 10;
+
+            ThreadPlacement threadPlacement;
+            threadPlacement.schedulingPolicy = ThreadPlacement::SchedulingPolicy::OTHER;
+            setThreadPlacement(threadPlacement, pthread_self());
+
+            // On Linux, the nice value of PRIO_PROCESS with a thread id only applies to that thread
+            const auto threadId = static_cast<id_t>(syscall(SYS_gettid));
+            errno = 0;
+            const int niceValue = getpriority(PRIO_PROCESS, threadId);
+            if (errno == 0 && niceValue < backgroundNiceValue && setpriority(PRIO_PROCESS, threadId, backgroundNiceValue) != 0) {
+                std::cerr << "WARNING: Failed to lower the priority of the SolverObserver dispatch thread." << std::endl;
+            }
+        }
     } // unnamed namespace
 
 
+    /**
+     * Single producer, single consumer ring buffer of copied terms, consumed by a background thread. The solver thread
+     * only takes the lock to claim and publish a slot, the copy itself happens outside of the lock. The memory of the
+     * slots is reused, such that the copies do not allocate once the sizes of the observed term have settled.
+     */
+    class SolverObserver::AsynchronousDispatcher {
+    public:
+        struct Sample {
+            scalar_array_t timeArray;
+            vector_array_t constraints;
+            std::vector<LagrangianMetrics> lagrangianMetrics;
+            std::vector<Multiplier> multipliers;
+            // Which of the arrays is valid
+            enum class Kind { Constraint, LagrangianMetrics, Multiplier } kind = Kind::Constraint;
+        };
+
+        AsynchronousDispatcher(size_t bufferSize, std::function<void(const Sample &)> consumer)
+            : samples_(bufferSize), consumer_(std::move(consumer)), workerThread_([this]() { run(); }) {
+        }
+
+        ~AsynchronousDispatcher() {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                stop_ = true;
+            }
+            newSampleCondition_.notify_one();
+            workerThread_.join();
+        }
+
+        /** Returns a free slot, or nullptr if the buffer is full. The slot must be handed back with publish(). */
+        Sample *claim() {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (numQueued_ == samples_.size()) {
+                ++numDropped_;
+                return nullptr;
+            }
+            return &samples_[(head_ + numQueued_) % samples_.size()];
+        }
+
+        void publish() {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                ++numQueued_;
+            }
+            newSampleCondition_.notify_one();
+        }
+
+        size_t getNumDropped() const {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return numDropped_;
+        }
+
+    private:
+        void run() {
+            setBackgroundScheduling();
+
+            std::unique_lock<std::mutex> lock(mutex_);
+            while (true) {
+                newSampleCondition_.wait(lock, [this]() { return stop_ || numQueued_ > 0; });
+                if (numQueued_ == 0) {
+                    return; // stop_ is set and the queue is drained
+                }
+                const Sample &sample = samples_[head_];
+                lock.unlock();
+                consumer_(sample);
+                lock.lock();
+                head_ = (head_ + 1) % samples_.size();
+                --numQueued_;
+            }
+        }
+
+        std::vector<Sample> samples_;
+        std::function<void(const Sample &)> consumer_;
+        mutable std::mutex mutex_;
+        std::condition_variable newSampleCondition_;
+        size_t head_ = 0;
+        size_t numQueued_ = 0;
+        size_t numDropped_ = 0;
+        bool stop_ = false;
+        std::thread workerThread_; // last member, started after everything else is initialized
+    };
+
+
+    void SolverObserver::AsynchronousDispatcherDeleter::operator()(AsynchronousDispatcher *dispatcherPtr) const {
+        delete dispatcherPtr;
+    }
+
+
+    SolverObserver::~SolverObserver() = default;
+
+
+    void SolverObserver::enableAsynchronousDispatch(size_t bufferSize) {
+        if (bufferSize == 0) {
+            throw std::runtime_error("[SolverObserver::enableAsynchronousDispatch] bufferSize should be positive!");
+        }
+
+        using Sample = AsynchronousDispatcher::Sample;
+        auto consumer = [this](const Sample &sample) {
+            switch (sample.kind) {
+                case Sample::Kind::Constraint: {
+                    const std::vector<std::reference_wrapper<const vector_t> > termConstraintArray(
+                        sample.constraints.cbegin(), sample.constraints.cend());
+                    constraintCallback_(sample.timeArray, termConstraintArray);
+                    break;
+                }
+                case Sample::Kind::LagrangianMetrics: {
+                    const std::vector<LagrangianMetricsConstRef> termLagrangianMetricsArray(
+                        sample.lagrangianMetrics.cbegin(), sample.lagrangianMetrics.cend());
+                    lagrangianCallback_(sample.timeArray, termLagrangianMetricsArray);
+                    break;
+                }
+                case Sample::Kind::Multiplier: {
+                    const std::vector<MultiplierConstRef> termMultiplierArray(
+                        sample.multipliers.cbegin(), sample.multipliers.cend());
+                    multiplierCallback_(sample.timeArray, termMultiplierArray);
+                    break;
+                }
+            }
+        };
+        asynchronousDispatcherPtr_.reset(); // finish the callbacks of a previous dispatcher
+        asynchronousDispatcherPtr_.reset(new AsynchronousDispatcher(bufferSize, std::move(consumer)));
+    }
+
+
+    size_t SolverObserver::getNumDroppedSamples() const {
+        return asynchronousDispatcherPtr_ != nullptr ? asynchronousDispatcherPtr_->getNumDropped() : 0;
+    }
+
+
+    void SolverObserver::dispatch(const scalar_array_t &timeArray,
+                                  const std::vector<std::reference_wrapper<const vector_t> > &termConstraintArray) {
+        if (asynchronousDispatcherPtr_ == nullptr) {
+            constraintCallback_(timeArray, termConstraintArray);
+            return;
+        }
+
+        auto *samplePtr = asynchronousDispatcherPtr_->claim();
+        if (samplePtr != nullptr) {
+            samplePtr->kind = AsynchronousDispatcher::Sample::Kind::Constraint;
+            samplePtr->timeArray = timeArray;
+            samplePtr->constraints.resize(termConstraintArray.size());
+            for (size_t i = 0; i < termConstraintArray.size(); i++) {
+                samplePtr->constraints[i] = termConstraintArray[i].get();
+            }
+            asynchronousDispatcherPtr_->publish();
+        }
+    }
+
+
+    void SolverObserver::dispatch(const scalar_array_t &timeArray,
+                                  const std::vector<LagrangianMetricsConstRef> &termLagrangianMetricsArray) {
+        if (asynchronousDispatcherPtr_ == nullptr) {
+            lagrangianCallback_(timeArray, termLagrangianMetricsArray);
+            return;
+        }
+
+        auto *samplePtr = asynchronousDispatcherPtr_->claim();
+        if (samplePtr != nullptr) {
+            samplePtr->kind = AsynchronousDispatcher::Sample::Kind::LagrangianMetrics;
+            samplePtr->timeArray = timeArray;
+            samplePtr->lagrangianMetrics.resize(termLagrangianMetricsArray.size());
+            for (size_t i = 0; i < termLagrangianMetricsArray.size(); i++) {
+                samplePtr->lagrangianMetrics[i].penalty = termLagrangianMetricsArray[i].penalty;
+                samplePtr->lagrangianMetrics[i].constraint = termLagrangianMetricsArray[i].constraint;
+            }
+            asynchronousDispatcherPtr_->publish();
+        }
+    }
+
+
+    void SolverObserver::dispatch(const scalar_array_t &timeArray,
+                                  const std::vector<MultiplierConstRef> &termMultiplierArray) {
+        if (asynchronousDispatcherPtr_ == nullptr) {
+            multiplierCallback_(timeArray, termMultiplierArray);
+            return;
+        }
+
+        auto *samplePtr = asynchronousDispatcherPtr_->claim();
+        if (samplePtr != nullptr) {
+            samplePtr->kind = AsynchronousDispatcher::Sample::Kind::Multiplier;
+            samplePtr->timeArray = timeArray;
+            samplePtr->multipliers.resize(termMultiplierArray.size());
+            for (size_t i = 0; i < termMultiplierArray.size(); i++) {
+                samplePtr->multipliers[i].penalty = termMultiplierArray[i].penalty;
+                samplePtr->multipliers[i].lagrangian = termMultiplierArray[i].lagrangian;
+            }
+            asynchronousDispatcherPtr_->publish();
+        }
+    }
+
+
     void SolverObserver::extractTermConstraint(const OptimalControlProblem &ocp, const PrimalSolution &primalSolution,
                                                const ProblemMetrics &problemMetrics) {
         if (!constraintCallback_ || primalSolution.timeTrajectory_.empty()) {
@@ -62,7 +285,7 @@ namespace ocs2 {
                 if (termIsFound) {
                     const scalar_array_t timeArray{primalSolution.timeTrajectory_.back()};
                     const std::vector<std::reference_wrapper<const vector_t> > termConstraintArray{*termConstraintPtr};
-                    constraintCallback_(timeArray, termConstraintArray);
+                    dispatch(timeArray, termConstraintArray);
                 }
                 break;
             }
@@ -77,7 +300,7 @@ namespace ocs2 {
                                    [&](size_t postInd) -> scalar_t {
                                        return primalSolution.timeTrajectory_[postInd - 1];
                                    });
-                    constraintCallback_(timeArray, termConstraintArray);
+                    dispatch(timeArray, termConstraintArray);
                 }
                 break;
             }
@@ -86,7 +309,7 @@ namespace ocs2 {
                 termIsFound = extractIntermediateTermConstraint(ocp, termName_, problemMetrics.intermediates,
                                                                 termConstraintArray);
                 if (termIsFound) {
-                    constraintCallback_(primalSolution.timeTrajectory_, termConstraintArray);
+                    dispatch(primalSolution.timeTrajectory_, termConstraintArray);
                 }
                 break;
             }
@@ -119,7 +342,7 @@ namespace ocs2 {
                 if (termIsFound) {
                     const scalar_array_t timeArray{primalSolution.timeTrajectory_.back()};
                     const std::vector<LagrangianMetricsConstRef> termLagrangianMetricsArray{*lagrangianMetricsPtr};
-                    lagrangianCallback_(timeArray, termLagrangianMetricsArray);
+                    dispatch(timeArray, termLagrangianMetricsArray);
                 }
                 break;
             }
@@ -134,7 +357,7 @@ namespace ocs2 {
                                    [&](size_t postInd) -> scalar_t {
                                        return primalSolution.timeTrajectory_[postInd - 1];
                                    });
-                    lagrangianCallback_(timeArray, termLagrangianMetricsArray);
+                    dispatch(timeArray, termLagrangianMetricsArray);
                 }
                 break;
             }
@@ -143,7 +366,7 @@ namespace ocs2 {
                 termIsFound = extractIntermediateTermLagrangianMetrics(ocp, termName_, problemMetrics.intermediates,
                                                                        termLagrangianMetricsArray);
                 if (termIsFound) {
-                    lagrangianCallback_(primalSolution.timeTrajectory_, termLagrangianMetricsArray);
+                    dispatch(primalSolution.timeTrajectory_, termLagrangianMetricsArray);
                 }
                 break;
             }
@@ -172,7 +395,7 @@ namespace ocs2 {
                 if (termIsFound) {
                     const scalar_array_t timeArray{dualSolution.timeTrajectory.back()};
                     const std::vector<MultiplierConstRef> termMultiplierArray{*multiplierPtr};
-                    multiplierCallback_(timeArray, termMultiplierArray);
+                    dispatch(timeArray, termMultiplierArray);
                 }
                 break;
             }
@@ -186,7 +409,7 @@ namespace ocs2 {
                                    [&](size_t postInd) -> scalar_t {
                                        return dualSolution.timeTrajectory[postInd - 1];
                                    });
-                    multiplierCallback_(timeArray, termMultiplierArray);
+                    dispatch(timeArray, termMultiplierArray);
                 }
                 break;
             }
@@ -195,7 +418,7 @@ namespace ocs2 {
                 termIsFound = extractIntermediateTermMultiplier(ocp, termName_, dualSolution.intermediates,
                                                                 termMultiplierArray);
                 if (termIsFound) {
-                    multiplierCallback_(dualSolution.timeTrajectory, termMultiplierArray);
+                    dispatch(dualSolution.timeTrajectory, termMultiplierArray);
                 }
                 break;
             }
@@ -0,0 +1,86 @@
+/******************************************************************************
+Copyright (c) 2017, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#pragma once
+
+#include <ocs2_core/cost/StateInputCost.h>
+#include <ocs2_core/dynamics/LinearSystemDynamics.h>
+#include <ocs2_oc/oc_problem/OptimalControlProblem.h>
+
+namespace ocs2 {
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+/**
+ * This example defines an optimal control problem where a kinematically modeled particle is attracted to the unit circle
+ * by a quartic cost. Started away from the circle, the Gauss-Newton steps overshoot, such that a linesearch rejects full steps.
+ */
+class RingCost final : public StateInputCost {
+ public:
+  RingCost() = default;
+  ~RingCost() override = default;
+
+  RingCost* clone() const override { return new RingCost(*this); }
+
+  scalar_t getValue(scalar_t t, const vector_t& x, const vector_t& u, const TargetTrajectories&, const PreComputation&) const override {
+    const scalar_t r = x.squaredNorm() - 1.0;
+    return 10.0 * r * r + 0.01 * u.squaredNorm();
+  }
+
+  ScalarFunctionQuadraticApproximation getQuadraticApproximation(scalar_t t, const vector_t& x, const vector_t& u,
+                                                                 const TargetTrajectories& targetTrajectories,
+                                                                 const PreComputation& preComp) const override {
+    const scalar_t r = x.squaredNorm() - 1.0;
+    ScalarFunctionQuadraticApproximation cost;
+    cost.f = getValue(t, x, u, targetTrajectories, preComp);
+    cost.dfdx = 40.0 * r * x;
+    cost.dfdu = 0.02 * u;
+    cost.dfdxx = 4.0 * x * x.transpose() + 1e-3 * matrix_t::Identity(x.size(), x.size());
+    cost.dfduu = 0.02 * matrix_t::Identity(u.size(), u.size());
+    cost.dfdux.setZero(u.size(), x.size());
+    return cost;
+  }
+};
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+inline OptimalControlProblem createRingProblem() {
+  // optimal control problem
+  OptimalControlProblem problem;
+  problem.dynamicsPtr.reset(new LinearSystemDynamics(matrix_t::Zero(2, 2), matrix_t::Identity(2, 2)));
+
+  // cost function
+  problem.costPtr->add("cost", std::make_unique<RingCost>());
+
+  return problem;
+}
+
+}  // namespace ocs2
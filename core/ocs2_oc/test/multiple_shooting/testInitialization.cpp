@@ -0,0 +1,115 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <ocs2_core/initialization/DefaultInitializer.h>
+#include <ocs2_oc/multiple_shooting/Initialization.h>
+
+using namespace ocs2;
+
+namespace {
+/** Creates a solution on the given discretization whose state and input at node i are filled with the time of the node. */
+PrimalSolution getPrimalSolution(const std::vector<AnnotatedTime>& timeDiscretization) {
+  PrimalSolution primalSolution;
+  primalSolution.timeTrajectory_ = toTime(timeDiscretization);
+  primalSolution.postEventIndices_ = toPostEventIndices(timeDiscretization);
+  for (const auto t : primalSolution.timeTrajectory_) {
+    primalSolution.stateTrajectory_.push_back(vector_t::Constant(2, t));
+    primalSolution.inputTrajectory_.push_back(vector_t::Constant(1, t));
+  }
+  return primalSolution;
+}
+}  // namespace
+
+TEST(test_initialization, shift) {
+  const scalar_array_t eventTimes{0.45};
+  const auto oldTimeDiscretization = timeDiscretizationWithEvents(0.0, 1.0, 0.1, eventTimes);
+  const auto newTimeDiscretization = timeDiscretizationWithEvents(0.2, 1.2, 0.1, eventTimes);
+  const auto primalSolution = getPrimalSolution(oldTimeDiscretization);
+
+  // Buffers of an earlier solution of the same size
+  DefaultInitializer initializer(1);
+  auto buffers = getPrimalSolution(newTimeDiscretization);
+  vector_array_t x = std::move(buffers.stateTrajectory_);
+  vector_array_t u = std::move(buffers.inputTrajectory_);
+  u.pop_back();
+  const auto* firstState = x[0].data();
+  const auto* lastState = x.back().data();
+
+  ASSERT_TRUE(multiple_shooting::shiftStateInputTrajectories(newTimeDiscretization, 1e-6, primalSolution, initializer, x, u));
+  ASSERT_EQ(x.size(), newTimeDiscretization.size());
+  ASSERT_EQ(u.size(), newTimeDiscretization.size() - 1);
+
+  // The previous solution is kept, and the buffers are reused
+  ASSERT_EQ(primalSolution.stateTrajectory_.size(), oldTimeDiscretization.size());
+  ASSERT_EQ(x[0].data(), firstState);
+  ASSERT_EQ(x.back().data(), lastState);
+
+  // The first two nodes are dropped, and the final time of the previous horizon, 1.0, is not on the new grid
+  const size_t numSharedNodes = oldTimeDiscretization.size() - 3;
+  for (size_t i = 0; i < numSharedNodes; i++) {
+    EXPECT_DOUBLE_EQ(x[i](0), newTimeDiscretization[i].time);
+  }
+  for (size_t i = 0; i + 1 < numSharedNodes; i++) {
+    if (newTimeDiscretization[i].event == AnnotatedTime::Event::PreEvent) {
+      EXPECT_EQ(u[i].size(), 0);
+    } else {
+      EXPECT_DOUBLE_EQ(u[i](0), newTimeDiscretization[i].time);
+    }
+  }
+
+  // The tail is filled by the initializer, which keeps the state and sets the input to zero
+  for (size_t i = numSharedNodes - 1; i < u.size(); i++) {
+    EXPECT_TRUE(u[i].isZero());
+    EXPECT_TRUE(x[i + 1].isApprox(x[numSharedNodes - 1]));
+  }
+}
+
+TEST(test_initialization, noShift) {
+  const auto oldTimeDiscretization = timeDiscretizationWithEvents(0.0, 1.0, 0.1, {});
+  auto primalSolution = getPrimalSolution(oldTimeDiscretization);
+  DefaultInitializer initializer(1);
+  vector_array_t x, u;
+
+  // Not on the previous grid
+  const auto offGrid = timeDiscretizationWithEvents(0.25, 1.25, 0.1, {});
+  ASSERT_FALSE(multiple_shooting::shiftStateInputTrajectories(offGrid, 1e-6, primalSolution, initializer, x, u));
+
+  // An event which the previous solution does not have
+  const auto withEvent = timeDiscretizationWithEvents(0.2, 1.2, 0.1, {0.55});
+  ASSERT_FALSE(multiple_shooting::shiftStateInputTrajectories(withEvent, 1e-6, primalSolution, initializer, x, u));
+
+  // Disabled
+  const auto shifted = timeDiscretizationWithEvents(0.2, 1.2, 0.1, {});
+  ASSERT_FALSE(multiple_shooting::shiftStateInputTrajectories(shifted, -1.0, primalSolution, initializer, x, u));
+
+  ASSERT_EQ(primalSolution.stateTrajectory_.size(), oldTimeDiscretization.size());
+  ASSERT_EQ(primalSolution.inputTrajectory_.size(), oldTimeDiscretization.size());
+}
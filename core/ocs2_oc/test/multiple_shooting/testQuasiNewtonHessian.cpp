@@ -0,0 +1,181 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <ocs2_oc/multiple_shooting/QuasiNewtonHessian.h>
+
+using namespace ocs2;
+
+namespace {
+bool isPositiveDefinite(const matrix_t& B) {
+  const Eigen::LLT<matrix_t> llt(0.5 * (B + B.transpose()));
+  return llt.info() == Eigen::Success;
+}
+
+/** Quadratic approximation of the cost 0.5 * z' * H * z + g' * z at z = [x; u]. */
+ScalarFunctionQuadraticApproximation getCost(const matrix_t& H, const vector_t& g, const vector_t& x, const vector_t& u) {
+  vector_t z(x.size() + u.size());
+  z << x, u;
+  const vector_t gradient = H * z + g;
+  ScalarFunctionQuadraticApproximation cost;
+  cost.f = 0.5 * z.dot(H * z) + g.dot(z);
+  cost.dfdx = gradient.head(x.size());
+  cost.dfdu = gradient.tail(u.size());
+  return cost;
+}
+
+std::vector<AnnotatedTime> getTimeDiscretization(scalar_t initTime, size_t N) {
+  std::vector<AnnotatedTime> timeDiscretization;
+  for (size_t i = 0; i <= N; i++) {
+    timeDiscretization.emplace_back(initTime + 0.1 * i, AnnotatedTime::Event::None);
+  }
+  return timeDiscretization;
+}
+}  // namespace
+
+TEST(testQuasiNewtonHessian, dampedBfgsUpdate) {
+  const size_t n = 5;
+  matrix_t B = matrix_t::Identity(n, n);
+  vector_t Bs;
+
+  // positive curvature: the secant equation holds
+  const matrix_t A = matrix_t::Random(n, n);
+  const matrix_t H = A * A.transpose() + matrix_t::Identity(n, n);
+  const vector_t s = vector_t::Random(n);
+  vector_t y = H * s;
+  ASSERT_TRUE(multiple_shooting::dampedBfgsUpdate(s, y, B, Bs));
+  EXPECT_TRUE((B * s).isApprox(H * s));
+  EXPECT_TRUE(B.isApprox(B.transpose()));
+  EXPECT_TRUE(isPositiveDefinite(B));
+
+  // negative curvature: the damping keeps the approximation positive definite
+  for (int k = 0; k < 20; k++) {
+    const vector_t sk = vector_t::Random(n);
+    vector_t yk = -sk;
+    multiple_shooting::dampedBfgsUpdate(sk, yk, B, Bs);
+    EXPECT_TRUE(isPositiveDefinite(B));
+  }
+
+  // zero step is skipped
+  const matrix_t Bprevious = B;
+  vector_t y0 = vector_t::Ones(n);
+  EXPECT_FALSE(multiple_shooting::dampedBfgsUpdate(vector_t::Zero(n), y0, B, Bs));
+  EXPECT_TRUE(B.isApprox(Bprevious));
+}
+
+TEST(testQuasiNewtonHessian, secantUpdateOfNode) {
+  const size_t nx = 3;
+  const size_t nu = 2;
+  const matrix_t A = matrix_t::Random(nx + nu, nx + nu);
+  const matrix_t H = A * A.transpose() + matrix_t::Identity(nx + nu, nx + nu);
+  const vector_t g = vector_t::Random(nx + nu);
+
+  multiple_shooting::QuasiNewtonHessian quasiNewtonHessian(2.0);
+  quasiNewtonHessian.setTimeDiscretization(getTimeDiscretization(0.0, 1));
+
+  // first linearization: scaled identity
+  vector_t x = vector_t::Random(nx);
+  vector_t u = vector_t::Random(nu);
+  auto cost = getCost(H, g, x, u);
+  quasiNewtonHessian.update(0, x, u, cost);
+  EXPECT_TRUE(cost.dfdxx.isApprox(2.0 * matrix_t::Identity(nx, nx)));
+  EXPECT_TRUE(cost.dfdux.isZero());
+  EXPECT_TRUE(cost.dfduu.isApprox(2.0 * matrix_t::Identity(nu, nu)));
+
+  // the following linearizations satisfy the secant equation of the last step
+  for (int k = 0; k < 10; k++) {
+    const vector_t dx = vector_t::Random(nx);
+    const vector_t du = vector_t::Random(nu);
+    x += dx;
+    u += du;
+    cost = getCost(H, g, x, u);
+    quasiNewtonHessian.update(0, x, u, cost);
+
+    vector_t s(nx + nu);
+    s << dx, du;
+    const matrix_t& B = quasiNewtonHessian.getHessian(0);
+    EXPECT_TRUE((B * s).isApprox(H * s));
+    EXPECT_TRUE(isPositiveDefinite(B));
+    EXPECT_TRUE(cost.dfdxx.isApprox(B.topLeftCorner(nx, nx)));
+    EXPECT_TRUE(cost.dfdux.isApprox(B.bottomLeftCorner(nu, nx)));
+    EXPECT_TRUE(cost.dfduu.isApprox(B.bottomRightCorner(nu, nu)));
+  }
+
+  // state-only node
+  multiple_shooting::QuasiNewtonHessian terminalHessian;
+  terminalHessian.setTimeDiscretization(getTimeDiscretization(0.0, 0));
+  const matrix_t Hx = H.topLeftCorner(nx, nx);
+  x.setRandom();
+  for (int k = 0; k < 3; k++) {
+    ScalarFunctionQuadraticApproximation terminalCost;
+    terminalCost.dfdx = Hx * x;
+    terminalHessian.update(0, x, vector_t(), terminalCost);
+    ASSERT_EQ(terminalCost.dfdxx.rows(), nx);
+    EXPECT_TRUE(isPositiveDefinite(terminalCost.dfdxx));
+    x.setRandom();
+  }
+}
+
+TEST(testQuasiNewtonHessian, shiftedTimeDiscretization) {
+  const size_t nx = 2;
+  const size_t nu = 1;
+  const size_t N = 4;
+
+  multiple_shooting::QuasiNewtonHessian quasiNewtonHessian;
+  quasiNewtonHessian.setTimeDiscretization(getTimeDiscretization(0.0, N));
+
+  // different approximation at each node, the terminal node is state-only
+  for (size_t i = 0; i <= N; i++) {
+    const size_t nz = (i < N) ? nx + nu : nx;
+    const matrix_t H = (1.0 + i) * matrix_t::Identity(nz, nz);
+    const vector_t g = vector_t::Zero(nz);
+    for (int k = 0; k < 2; k++) {
+      const vector_t x = vector_t::Random(nx);
+      const vector_t u = (i < N) ? vector_t(vector_t::Random(nu)) : vector_t();
+      auto cost = getCost(H, g, x, u);
+      quasiNewtonHessian.update(i, x, u, cost);
+    }
+  }
+  std::vector<matrix_t> hessians;
+  for (size_t i = 0; i <= N; i++) {
+    hessians.push_back(quasiNewtonHessian.getHessian(i));
+  }
+
+  // shift by one node, the new terminal node starts from the closest previous one
+  quasiNewtonHessian.setTimeDiscretization(getTimeDiscretization(0.1, N));
+  for (size_t i = 0; i < N; i++) {
+    EXPECT_TRUE(quasiNewtonHessian.getHessian(i).isApprox(hessians[i + 1])) << "node " << i;
+  }
+  EXPECT_TRUE(quasiNewtonHessian.getHessian(N).isApprox(hessians[N]));
+
+  quasiNewtonHessian.reset();
+  quasiNewtonHessian.setTimeDiscretization(getTimeDiscretization(0.1, N));
+  EXPECT_EQ(quasiNewtonHessian.getHessian(0).size(), 0);
+}
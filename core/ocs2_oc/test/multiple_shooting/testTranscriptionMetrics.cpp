@@ -63,6 +63,14 @@ TEST(test_transcription_metrics, intermediate) {
   const auto metrics = multiple_shooting::computeIntermediateMetrics(problem, discretizer, t, dt, x, x_next, u);
 
   ASSERT_TRUE(metrics.isApprox(multiple_shooting::computeMetrics(transcription), 1e-12));
+
+  // in place, the second evaluation reuses the memory of the first one
+  Metrics metricsInPlace;
+  multiple_shooting::computeIntermediateMetrics(problem, discretizer, t, dt, x, x_next, u, metricsInPlace);
+  const scalar_t* stateEqConstraintData = metricsInPlace.stateEqConstraint.front().data();
+  multiple_shooting::computeIntermediateMetrics(problem, discretizer, t, dt, x, x_next, u, metricsInPlace);
+  ASSERT_TRUE(metricsInPlace.isApprox(metrics, 1e-12));
+  ASSERT_EQ(metricsInPlace.stateEqConstraint.front().data(), stateEqConstraintData);
 }
 
 TEST(test_transcription_metrics, event) {
@@ -93,6 +101,13 @@ TEST(test_transcription_metrics, event) {
   const auto metrics = multiple_shooting::computeEventMetrics(problem, t, x, x_next);
 
   ASSERT_TRUE(metrics.isApprox(multiple_shooting::computeMetrics(transcription), 1e-12));
+
+  // in place, terms of a previous intermediate node are cleared
+  Metrics metricsInPlace;
+  metricsInPlace.stateInputEqConstraint.push_back(vector_t::Ones(2));
+  metricsInPlace.stateInputIneqConstraint.push_back(vector_t::Ones(3));
+  multiple_shooting::computeEventMetrics(problem, t, x, x_next, metricsInPlace);
+  ASSERT_TRUE(metricsInPlace.isApprox(metrics, 1e-12));
 }
 
 TEST(test_transcription_metrics, terminal) {
@@ -118,4 +133,11 @@ TEST(test_transcription_metrics, terminal) {
   const auto metrics = multiple_shooting::computeTerminalMetrics(problem, t, x);
 
   ASSERT_TRUE(metrics.isApprox(multiple_shooting::computeMetrics(transcription), 1e-12));
+
+  // in place, the dynamics violation and the terms of a previous intermediate node are cleared
+  Metrics metricsInPlace;
+  metricsInPlace.dynamicsViolation = vector_t::Ones(nx);
+  metricsInPlace.stateInputEqConstraint.push_back(vector_t::Ones(2));
+  multiple_shooting::computeTerminalMetrics(problem, t, x, metricsInPlace);
+  ASSERT_TRUE(metricsInPlace.isApprox(metrics, 1e-12));
 }
@@ -127,4 +127,91 @@ TEST(test_time_discretization, withEvents) {
   ASSERT_EQ(time[12].event, AnnotatedTime::Event::PreEvent);
   ASSERT_EQ(time[13].event, AnnotatedTime::Event::PostEvent);
   ASSERT_EQ(time[14].event, AnnotatedTime::Event::None);
-}
\ No newline at end of file
+}
+
+TEST(test_time_discretization, growingSteps) {
+  scalar_t initTime = 1.0;
+  scalar_t finalTime = 2.0;
+  scalar_t dt = 0.05;
+  scalar_t dtGrowthRate = 0.5;
+  scalar_t dtMax = 0.15;
+  scalar_array_t eventTimes{1.55};
+
+  auto time = timeDiscretizationWithEvents(initTime, finalTime, dt, dtGrowthRate, dtMax, eventTimes, {});
+  ASSERT_EQ(time.front().time, initTime);
+  ASSERT_EQ(time.back().time, finalTime);
+
+  // Steps grow until they reach dtMax, and are only shortened by the event and the final time
+  scalar_t previousStep = 0.0;
+  for (size_t i = 0; i + 1 < time.size(); i++) {
+    if (time[i].event == AnnotatedTime::Event::PreEvent) {
+      ASSERT_EQ(time[i].time, eventTimes[0]);
+      ASSERT_EQ(time[i + 1].event, AnnotatedTime::Event::PostEvent);
+      continue;
+    }
+    const scalar_t step = time[i + 1].time - time[i].time;
+    if (time[i + 1].event == AnnotatedTime::Event::None && i + 2 < time.size()) {
+      ASSERT_NEAR(step, std::min(dt + dtGrowthRate * (time[i].time - initTime), dtMax), 1e-12) << "at node " << i;
+      ASSERT_GE(step, previousStep - 1e-12);
+      previousStep = step;
+    } else {
+      ASSERT_LE(step, dtMax + 1e-12);
+    }
+  }
+  ASSERT_LT(time.size(), (finalTime - initTime) / dt);
+}
+
+TEST(test_time_discretization, zeroGrowthIsUniform) {
+  scalar_t initTime = 3.0;
+  scalar_t finalTime = 4.0;
+  scalar_t dt = 0.1;
+  scalar_array_t eventTimes{3.25, 3.4, 3.8999999999999999999, 4.02, 4.5};
+
+  auto uniform = timeDiscretizationWithEvents(initTime, finalTime, dt, eventTimes);
+  auto nonUniform = timeDiscretizationWithEvents(initTime, finalTime, dt, 0.0, 0.0, eventTimes, {});
+  ASSERT_EQ(uniform.size(), nonUniform.size());
+  for (size_t i = 0; i < uniform.size(); i++) {
+    ASSERT_EQ(uniform[i].time, nonUniform[i].time);
+    ASSERT_EQ(uniform[i].event, nonUniform[i].event);
+  }
+}
+
+TEST(test_time_discretization, refinement) {
+  scalar_t initTime = 0.0;
+  scalar_t finalTime = 1.0;
+  scalar_t dt = 0.1;
+  scalar_array_t eventTimes{0.5};
+  scalar_array_t refinementTimes{0.12, 0.17, 0.55, 0.91};
+
+  auto time = timeDiscretizationWithEvents(initTime, finalTime, dt, 0.0, 0.0, eventTimes, refinementTimes);
+  // timeDiscretization = {0.0, ..., 0.1, 0.15, 0.2, ..., 0.5, 0.5, 0.55, 0.6, ..., 0.9, 0.95, 1.0}
+  ASSERT_EQ(time.size(), 11 + 1 + 3);
+  ASSERT_DOUBLE_EQ(time[2].time, 0.15);
+  ASSERT_EQ(time[2].event, AnnotatedTime::Event::None);
+  ASSERT_DOUBLE_EQ(time[3].time, 0.2);
+  ASSERT_EQ(time[6].time, eventTimes[0]);
+  ASSERT_EQ(time[6].event, AnnotatedTime::Event::PreEvent);
+  ASSERT_EQ(time[7].event, AnnotatedTime::Event::PostEvent);
+  ASSERT_DOUBLE_EQ(time[8].time, 0.55);
+  ASSERT_DOUBLE_EQ(time[9].time, 0.6);
+  ASSERT_DOUBLE_EQ(time[13].time, 0.95);
+  ASSERT_EQ(time[14].time, finalTime);
+  for (size_t i = 0; i + 1 < time.size(); i++) {
+    ASSERT_LE(time[i].time, time[i + 1].time);
+  }
+}
+
+TEST(test_time_discretization, refinementTimesFromMetrics) {
+  const std::vector<AnnotatedTime> time{AnnotatedTime(0.0), AnnotatedTime(0.1), AnnotatedTime(0.2, AnnotatedTime::Event::PreEvent),
+                                        AnnotatedTime(0.2, AnnotatedTime::Event::PostEvent), AnnotatedTime(0.3)};
+  std::vector<Metrics> metrics(time.size());
+  metrics[0].dynamicsViolation = vector_t::Constant(2, 1e-6);
+  metrics[1].dynamicsViolation = vector_t::Constant(2, 1e-2);
+  metrics[2].dynamicsViolation = vector_t::Constant(2, 1.0);  // event, skipped
+  metrics[3].dynamicsViolation = vector_t::Constant(2, 1e-2);
+
+  const auto refinementTimes = getRefinementTimes(time, metrics, 1e-3);
+  ASSERT_EQ(refinementTimes.size(), 2);
+  ASSERT_DOUBLE_EQ(refinementTimes[0], 0.15);
+  ASSERT_DOUBLE_EQ(refinementTimes[1], 0.25);
+}
@@ -0,0 +1,186 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+
+#include <atomic>
+#include <cerrno>
+#include <cstdlib>
+#include <iostream>
+
+#include <gtest/gtest.h>
+
+#include <ocs2_core/Types.h>
+#include <ocs2_core/control/ControllerBase.h>
+#include <ocs2_core/dynamics/LinearSystemDynamics.h>
+#include <ocs2_oc/rollout/TimeTriggeredRollout.h>
+
+/*
+ * Counts the heap allocations of the whole binary by wrapping the allocation functions of glibc. This test is therefore built as a
+ * separate executable.
+ */
+namespace {
+std::atomic<size_t> numAllocations{0};
+}  // namespace
+
+extern "C" {
+void* __libc_malloc(size_t size);
+void* __libc_calloc(size_t num, size_t size);
+void* __libc_realloc(void* ptr, size_t size);
+void* __libc_memalign(size_t alignment, size_t size);
+
+void* malloc(size_t size) {
+  numAllocations.fetch_add(1, std::memory_order_relaxed);
+  return __libc_malloc(size);
+}
+
+void* calloc(size_t num, size_t size) {
+  numAllocations.fetch_add(1, std::memory_order_relaxed);
+  return __libc_calloc(num, size);
+}
+
+void* realloc(void* ptr, size_t size) {
+  numAllocations.fetch_add(1, std::memory_order_relaxed);
+  return __libc_realloc(ptr, size);
+}
+
+void* aligned_alloc(size_t alignment, size_t size) {
+  numAllocations.fetch_add(1, std::memory_order_relaxed);
+  return __libc_memalign(alignment, size);
+}
+
+int posix_memalign(void** ptr, size_t alignment, size_t size) {
+  numAllocations.fetch_add(1, std::memory_order_relaxed);
+  *ptr = __libc_memalign(alignment, size);
+  return (*ptr == nullptr) ? ENOMEM : 0;
+}
+}
+
+using namespace ocs2;
+
+namespace {
+/** Allocations of the user dynamics and controller, which return their vectors by value. */
+size_t numUserAllocations = 0;
+
+class CountingSystemDynamics final : public LinearSystemDynamics {
+ public:
+  using LinearSystemDynamics::LinearSystemDynamics;
+  CountingSystemDynamics* clone() const override { return new CountingSystemDynamics(*this); }
+
+  vector_t computeFlowMap(scalar_t t, const vector_t& x, const vector_t& u, const PreComputation& preComp) override {
+    const size_t n = numAllocations;
+    vector_t dxdt = LinearSystemDynamics::computeFlowMap(t, x, u, preComp);
+    numUserAllocations += numAllocations - n;
+    return dxdt;
+  }
+
+  vector_t computeJumpMap(scalar_t t, const vector_t& x, const PreComputation& preComp) override {
+    const size_t n = numAllocations;
+    vector_t jumpedState = LinearSystemDynamics::computeJumpMap(t, x, preComp);
+    numUserAllocations += numAllocations - n;
+    return jumpedState;
+  }
+};
+
+/** Time-invariant linear controller u = uff + K * x. */
+class CountingController final : public ControllerBase {
+ public:
+  CountingController(vector_t uff, matrix_t K) : uff_(std::move(uff)), K_(std::move(K)) {}
+  CountingController* clone() const override { return new CountingController(*this); }
+
+  vector_t computeInput(scalar_t t, const vector_t& x) override {
+    const size_t n = numAllocations;
+    vector_t u = uff_ + K_ * x;
+    numUserAllocations += numAllocations - n;
+    return u;
+  }
+
+  void concatenate(const ControllerBase* otherController, int index, int length) override {}
+  int size() const override { return 1; }
+  ControllerType getType() const override { return ControllerType::LINEAR; }
+  void clear() override {}
+  bool empty() const override { return false; }
+
+ private:
+  vector_t uff_;
+  matrix_t K_;
+};
+}  // namespace
+
+class RolloutAllocationsTest : public testing::TestWithParam<IntegratorType> {};
+
+TEST_P(RolloutAllocationsTest, steadyState) {
+  constexpr size_t nx = 2;
+  constexpr size_t nu = 1;
+  constexpr size_t numWarmUps = 2;
+  constexpr size_t numRollouts = 10;
+  const scalar_t initTime = 0.0;
+  const scalar_t finalTime = 5.0;
+  const vector_t initState = vector_t::Ones(nx);
+  ModeSchedule modeSchedule({1.0, 2.5}, {0, 1, 2});
+
+  const matrix_t A = (matrix_t(nx, nx) << -2.0, -1.0, 1.0, 0.0).finished();
+  const matrix_t B = (matrix_t(nx, nu) << 1.0, 0.0).finished();
+  CountingSystemDynamics systemDynamics(A, B);
+
+  CountingController controller(vector_t::Ones(nu), -matrix_t::Ones(nu, nx));
+
+  rollout::Settings rolloutSettings;
+  rolloutSettings.integratorType = GetParam();
+  rolloutSettings.absTolODE = 1e-7;
+  rolloutSettings.relTolODE = 1e-5;
+  rolloutSettings.maxNumStepsPerSecond = 10000;
+  TimeTriggeredRollout rollout(systemDynamics, rolloutSettings);
+
+  scalar_array_t timeTrajectory;
+  size_array_t postEventIndices;
+  vector_array_t stateTrajectory;
+  vector_array_t inputTrajectory;
+  for (size_t i = 0; i < numWarmUps + numRollouts; i++) {
+    numUserAllocations = 0;
+    const size_t n = numAllocations;
+    const vector_t finalState =
+        rollout.run(initTime, initState, finalTime, &controller, modeSchedule, timeTrajectory, postEventIndices, stateTrajectory, inputTrajectory);
+    const size_t numRolloutAllocations = numAllocations - n - numUserAllocations;
+
+    if (i >= numWarmUps) {
+      std::cerr << "[RolloutAllocationsTest] " << integrator_type::toString(GetParam()) << " with " << timeTrajectory.size()
+                << " nodes: " << numRolloutAllocations << " allocations in the rollout, " << numUserAllocations
+                << " in the dynamics and controller.\n";
+      // only the returned final state is allocated
+      EXPECT_EQ(numRolloutAllocations, 1);
+    }
+    ASSERT_EQ(timeTrajectory.size(), stateTrajectory.size());
+    ASSERT_EQ(timeTrajectory.size(), inputTrajectory.size());
+    ASSERT_EQ(postEventIndices.size(), 2);
+    ASSERT_TRUE(finalState.isApprox(stateTrajectory.back()));
+  }
+}
+
+INSTANTIATE_TEST_CASE_P(RolloutAllocationsTestCase, RolloutAllocationsTest, testing::Values(IntegratorType::ODE45, IntegratorType::ODE45_OCS2),
+                        [](const testing::TestParamInfo<IntegratorType>& info) { return integrator_type::toString(info.param); });
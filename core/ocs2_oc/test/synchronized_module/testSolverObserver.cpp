@@ -0,0 +1,229 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <pthread.h>
+#include <sched.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <thread>
+
+#include <ocs2_core/constraint/LinearStateConstraint.h>
+
+#include "ocs2_oc/oc_solver/SolverBase.h"
+#include "ocs2_oc/synchronized_module/SolverObserver.h"
+
+using namespace ocs2;
+
+namespace {
+
+/** A solver which only fills the final state equality constraint "term" of its metrics with the initial state. */
+class FinalConstraintSolver final : public SolverBase {
+ public:
+  FinalConstraintSolver() {
+    problem_.finalEqualityConstraintPtr->add("term", std::make_unique<LinearStateConstraint>(vector_t::Zero(1), matrix_t::Identity(1, 1)));
+  }
+
+  void reset() override {}
+  const OptimalControlProblem& getOptimalControlProblem() const override { return problem_; }
+  const PerformanceIndex& getPerformanceIndeces() const override { return performanceIndex_; }
+  size_t getNumIterations() const override { return 1; }
+  const std::vector<PerformanceIndex>& getIterationsLog() const override { return iterationsLog_; }
+  scalar_t getFinalTime() const override { return primalSolution_.timeTrajectory_.back(); }
+  void getPrimalSolution(scalar_t finalTime, PrimalSolution* primalSolutionPtr) const override { *primalSolutionPtr = primalSolution_; }
+  const ProblemMetrics& getSolutionMetrics() const override { return problemMetrics_; }
+  ScalarFunctionQuadraticApproximation getValueFunction(scalar_t time, const vector_t& state) const override { return {}; }
+  ScalarFunctionQuadraticApproximation getHamiltonian(scalar_t time, const vector_t& state, const vector_t& input) override { return {}; }
+  vector_t getStateInputEqualityConstraintLagrangian(scalar_t time, const vector_t& state) const override { return {}; }
+  MultiplierCollection getIntermediateDualSolution(scalar_t time) const override { return {}; }
+
+ private:
+  void runImpl(scalar_t initTime, const vector_t& initState, scalar_t finalTime) override {
+    primalSolution_.timeTrajectory_ = {initTime, finalTime};
+    primalSolution_.stateTrajectory_ = {initState, initState};
+    primalSolution_.inputTrajectory_ = {vector_t::Zero(1), vector_t::Zero(1)};
+    problemMetrics_.final.stateEqConstraint = {initState};
+  }
+  void runImpl(scalar_t initTime, const vector_t& initState, scalar_t finalTime, const ControllerBase* externalControllerPtr) override {
+    runImpl(initTime, initState, finalTime);
+  }
+  void runImpl(scalar_t initTime, const vector_t& initState, scalar_t finalTime, const PrimalSolution& primalSolution) override {
+    runImpl(initTime, initState, finalTime);
+  }
+
+  OptimalControlProblem problem_;
+  PerformanceIndex performanceIndex_;
+  std::vector<PerformanceIndex> iterationsLog_;
+  PrimalSolution primalSolution_;
+  ProblemMetrics problemMetrics_;
+};
+
+/** Runs the solver with the sample index as the observed constraint value. */
+void runSamples(SolverBase& solver, size_t beginIndex, size_t endIndex) {
+  for (size_t i = beginIndex; i < endIndex; i++) {
+    solver.run(0.0, vector_t::Constant(1, static_cast<scalar_t>(i)), 1.0);
+  }
+}
+
+/** Waits until the counter reaches the value, or fails after a second. */
+void waitFor(const std::atomic_size_t& counter, size_t value) {
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+  while (counter < value && std::chrono::steady_clock::now() < deadline) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  ASSERT_GE(counter, value);
+}
+
+}  // unnamed namespace
+
+TEST(testSolverObserver, asynchronousDispatchOrderAndScheduling) {
+  constexpr size_t numSamples = 50;
+  std::vector<size_t> receivedSamples;
+  std::atomic_bool onSolverThread(false);
+  int policy = -1;
+  int niceValue = 0;
+
+  const auto solverThreadId = std::this_thread::get_id();
+  auto observerPtr = SolverObserver::ConstraintTermObserver(
+      SolverObserver::Type::Final, "term",
+      [&](const scalar_array_t& timeArray, const std::vector<std::reference_wrapper<const vector_t>>& termConstraintArray) {
+        onSolverThread = onSolverThread || std::this_thread::get_id() == solverThreadId;
+        sched_param param{};
+        pthread_getschedparam(pthread_self(), &policy, &param);
+        niceValue = getpriority(PRIO_PROCESS, static_cast<id_t>(syscall(SYS_gettid)));
+        receivedSamples.push_back(static_cast<size_t>(termConstraintArray.front().get()(0)));
+      });
+
+  // The background thread should not inherit a real-time scheduling of the solver thread. Setting SCHED_FIFO needs privileges, if
+  // it fails, the test only checks that the scheduling is SCHED_OTHER.
+  sched_param fifoParam{};
+  fifoParam.sched_priority = 1;
+  const bool isFifo = pthread_setschedparam(pthread_self(), SCHED_FIFO, &fifoParam) == 0;
+  observerPtr->enableAsynchronousDispatch(numSamples);
+  if (isFifo) {
+    sched_param otherParam{};
+    pthread_setschedparam(pthread_self(), SCHED_OTHER, &otherParam);
+  }
+
+  {
+    FinalConstraintSolver solver;
+    solver.addSolverObserver(std::move(observerPtr));
+    runSamples(solver, 0, numSamples);
+  }  // the observer drains the queue on destruction
+
+  EXPECT_FALSE(onSolverThread);
+  EXPECT_EQ(policy, SCHED_OTHER);
+  EXPECT_GE(niceValue, 10);
+  ASSERT_EQ(receivedSamples.size(), numSamples);
+  for (size_t i = 0; i < numSamples; i++) {
+    EXPECT_EQ(receivedSamples[i], i);
+  }
+}
+
+TEST(testSolverObserver, asynchronousDispatchOverflow) {
+  constexpr size_t bufferSize = 3;
+  std::mutex receivedSamplesMutex;
+  std::vector<size_t> receivedSamples;
+  std::atomic_size_t numStartedCallbacks(0);
+  std::promise<void> release;
+  const std::shared_future<void> released = release.get_future().share();
+
+  auto observerPtr = SolverObserver::ConstraintTermObserver(
+      SolverObserver::Type::Final, "term",
+      [&](const scalar_array_t& timeArray, const std::vector<std::reference_wrapper<const vector_t>>& termConstraintArray) {
+        ++numStartedCallbacks;
+        released.wait();
+        std::lock_guard<std::mutex> lock(receivedSamplesMutex);
+        receivedSamples.push_back(static_cast<size_t>(termConstraintArray.front().get()(0)));
+      });
+  observerPtr->enableAsynchronousDispatch(bufferSize);
+  const auto* observerRawPtr = observerPtr.get();
+
+  FinalConstraintSolver solver;
+  solver.addSolverObserver(std::move(observerPtr));
+
+  // The first sample blocks the background thread, two more fit into the buffer, the rest is dropped without blocking the solver
+  runSamples(solver, 0, 1);
+  waitFor(numStartedCallbacks, 1);
+  runSamples(solver, 1, 6);
+  EXPECT_EQ(observerRawPtr->getNumDroppedSamples(), 3);
+
+  release.set_value();
+  waitFor(numStartedCallbacks, bufferSize);
+
+  // The buffer has space again
+  runSamples(solver, 6, 7);
+  waitFor(numStartedCallbacks, bufferSize + 1);
+  EXPECT_EQ(observerRawPtr->getNumDroppedSamples(), 3);
+
+  std::lock_guard<std::mutex> lock(receivedSamplesMutex);
+  EXPECT_EQ(receivedSamples, (std::vector<size_t>{0, 1, 2, 6}));
+}
+
+TEST(testSolverObserver, asynchronousDispatchDrainsOnDestruction) {
+  constexpr size_t numSamples = 5;
+  std::vector<size_t> receivedSamples;
+  std::atomic_size_t numStartedCallbacks(0);
+  std::promise<void> release;
+  const std::shared_future<void> released = release.get_future().share();
+
+  auto observerPtr = SolverObserver::ConstraintTermObserver(
+      SolverObserver::Type::Final, "term",
+      [&](const scalar_array_t& timeArray, const std::vector<std::reference_wrapper<const vector_t>>& termConstraintArray) {
+        ++numStartedCallbacks;
+        released.wait();
+        receivedSamples.push_back(static_cast<size_t>(termConstraintArray.front().get()(0)));
+      });
+  observerPtr->enableAsynchronousDispatch(numSamples);
+
+  std::thread releaseThread;
+  {
+    FinalConstraintSolver solver;
+    solver.addSolverObserver(std::move(observerPtr));
+    runSamples(solver, 0, 1);
+    waitFor(numStartedCallbacks, 1);
+    runSamples(solver, 1, numSamples);
+
+    // all samples are queued, the destructor has to wait for them
+    releaseThread = std::thread([&]() {
+      std::this_thread::sleep_for(std::chrono::milliseconds(20));
+      release.set_value();
+    });
+  }
+  releaseThread.join();
+
+  EXPECT_EQ(receivedSamples, (std::vector<size_t>{0, 1, 2, 3, 4}));
+}
@@ -33,6 +33,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <ocs2_core/Types.h>
 #include <ocs2_core/integration/Integrator.h>
+#include <ocs2_core/thread_support/ThreadPlacement.h>
 
 #include "ocs2_ddp/search_strategy/StrategySettings.h"
 
@@ -64,8 +65,9 @@ namespace ocs2::ddp {
 
         /** Number of threads used in the multi-threading scheme. */
         size_t nThreads_ = 1;
-        /** Priority of threads used in the multi-threading scheme. */
-        int threadPriority_ = 99;
+        /** Placement of threads used in the multi-threading scheme. The priority is loaded from threadPriority and can be
+         * overwritten in threadPlacement. */
+        ThreadPlacement threadPlacement_ = {ThreadPlacement::SchedulingPolicy::FIFO, 99};
 
         /** Maximum number of iterations of DDP. */
         size_t maxNumIterations_ = 15;
@@ -93,6 +95,10 @@ namespace ocs2::ddp {
         scalar_t timeStep_ = 1e-2;
         /** The backward pass integrator type: SLQ uses it for solving Riccati equation and ILQR uses it for discretizing LQ approximation. */
         IntegratorType backwardPassIntegratorType_ = IntegratorType::ODE45;
+        /** If true, SLQ integrates the Riccati equation with the steps chosen by the adaptive integrator and evaluates it at the nominal
+         * time stamps by cubic Hermite interpolation of the dense output, instead of stepping to every time stamp of the forward rollout.
+         * It is ignored by the fixed time step integrators. */
+        bool riccatiDenseOutput_ = false;
 
         /** The initial coefficient of the quadratic penalty function in the merit function. It should be greater than one. */
         scalar_t constraintPenaltyInitialValue_ = 2.0;
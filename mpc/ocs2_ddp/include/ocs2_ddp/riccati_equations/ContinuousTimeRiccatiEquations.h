@@ -241,6 +241,8 @@ namespace ocs2 {
         const std::vector<ModelData> *modelDataEventTimesPtr_ = nullptr;
         const std::vector<riccati_modification::Data> *riccatiModificationPtr_ = nullptr;
         scalar_array_t eventTimes_;
+        // lookup index of the last flow map evaluation, the integrator queries the time stamps monotonically
+        int timeIndexHint_ = 0;
 
         ContinuousTimeRiccatiData continuousTimeRiccatiData_;
     };
@@ -67,33 +67,39 @@ namespace ocs2 {
         const auto &uTrajectory = primalSolution.inputTrajectory_;
         const auto &postEventIndices = primalSolution.postEventIndices_;
 
-        problemMetrics.clear();
-        problemMetrics.preJumps.reserve(postEventIndices.size());
-        problemMetrics.intermediates.reserve(tTrajectory.size());
+        // The metrics are computed in place, such that the memory of a reused problemMetrics is recycled
+        problemMetrics.intermediates.resize(tTrajectory.size());
+        size_t numPreJumps = 0;
 
         auto nextPostEventIndexItr = postEventIndices.begin();
         constexpr auto request = Request::Cost + Request::Constraint + Request::SoftConstraint;
         for (size_t k = 0; k < tTrajectory.size(); k++) {
             // intermediate time cost and constraints
             problem.preComputationPtr->request(request, tTrajectory[k], xTrajectory[k], uTrajectory[k]);
-            problemMetrics.intermediates.push_back(
-                computeIntermediateMetrics(problem, tTrajectory[k], xTrajectory[k], uTrajectory[k],
-                                           dualSolution.intermediates[k]));
+            computeIntermediateMetrics(problem, tTrajectory[k], xTrajectory[k], uTrajectory[k],
+                                       dualSolution.intermediates[k], vector_t(), problemMetrics.intermediates[k]);
 
             // event time cost and constraints
             if (nextPostEventIndexItr != postEventIndices.end() && k + 1 == *nextPostEventIndexItr) {
                 const auto m = dualSolution.preJumps[std::distance(postEventIndices.begin(), nextPostEventIndexItr)];
                 problem.preComputationPtr->requestPreJump(request, tTrajectory[k], xTrajectory[k]);
-                problemMetrics.preJumps.push_back(computePreJumpMetrics(problem, tTrajectory[k], xTrajectory[k], m));
+                if (problemMetrics.preJumps.size() <= numPreJumps) {
+                    problemMetrics.preJumps.emplace_back();
+                }
+                computePreJumpMetrics(problem, tTrajectory[k], xTrajectory[k], m, vector_t(),
+                                      problemMetrics.preJumps[numPreJumps++]);
                 nextPostEventIndexItr++;
             }
         }
+        problemMetrics.preJumps.resize(numPreJumps);
 
         // final time cost and constraints
         if (!tTrajectory.empty()) {
             problem.preComputationPtr->requestFinal(request, tTrajectory.back(), xTrajectory.back());
-            problemMetrics.final = computeFinalMetrics(problem, tTrajectory.back(), xTrajectory.back(),
-                                                       dualSolution.final);
+            computeFinalMetrics(problem, tTrajectory.back(), xTrajectory.back(), dualSolution.final,
+                                problemMetrics.final);
+        } else {
+            problemMetrics.final.clear();
         }
     }
 
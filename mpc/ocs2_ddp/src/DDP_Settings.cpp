@@ -56,8 +56,8 @@ namespace ocs2::ddp {
     }
 
     Settings loadSettings(const std::string &filename, const std::string &fieldName, bool verbose) {
-        boost::property_tree::ptree pt;
-        read_info(filename, pt);
+        const auto ptPtr = loadData::readInfoFile(filename);
+        const auto &pt = *ptPtr;
 
         Settings settings;
 
@@ -71,7 +71,8 @@ namespace ocs2::ddp {
         settings.algorithm_ = fromAlgorithmName(algorithmName);
 
         loadData::loadPtreeValue(pt, settings.nThreads_, fieldName + ".nThreads", verbose);
-        loadData::loadPtreeValue(pt, settings.threadPriority_, fieldName + ".threadPriority", verbose);
+        loadData::loadPtreeValue(pt, settings.threadPlacement_.priority, fieldName + ".threadPriority", verbose);
+        loadThreadPlacement(pt, fieldName + ".threadPlacement", settings.threadPlacement_, verbose);
 
         loadData::loadPtreeValue(pt, settings.maxNumIterations_, fieldName + ".maxNumIterations", verbose);
         loadData::loadPtreeValue(pt, settings.minRelCost_, fieldName + ".minRelCost", verbose);
@@ -90,6 +91,7 @@ namespace ocs2::ddp {
         auto integratorName = integrator_type::toString(settings.backwardPassIntegratorType_); // keep default
         loadData::loadPtreeValue(pt, integratorName, fieldName + ".backwardPassIntegratorType", verbose);
         settings.backwardPassIntegratorType_ = integrator_type::fromString(integratorName);
+        loadData::loadPtreeValue(pt, settings.riccatiDenseOutput_, fieldName + ".riccatiDenseOutput", verbose);
 
         loadData::loadPtreeValue(pt, settings.constraintPenaltyInitialValue_,
                                  fieldName + ".constraintPenaltyInitialValue", verbose);
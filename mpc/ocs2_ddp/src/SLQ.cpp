@@ -29,6 +29,11 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <ocs2_ddp/SLQ.h>
 
+#include <algorithm>
+#include <iterator>
+
+#include <ocs2_core/misc/HermiteInterpolation.h>
+
 #include <ocs2_ddp/DDP_HelperFunctions.h>
 #include <ocs2_ddp/riccati_equations/RiccatiModificationInterpolation.h>
 #include <ocs2_oc/approximate_model/LinearQuadraticApproximator.h>
@@ -281,6 +286,14 @@ namespace ocs2 {
         }
         SsNormalizedSwitchingTimesIndices.back().second = SsNormalizedTime.cend();
 
+        // dense output is only used with the adaptive integrators
+        const bool denseOutput = settings().riccatiDenseOutput_ &&
+                                 settings().backwardPassIntegratorType_ != IntegratorType::RK4;
+        scalar_array_t denseTime;
+        vector_array_t denseSs;
+        vector_array_t denseDerivative;
+        scalar_t dtInitial = settings().timeStep_;
+
         // integrating the Riccati equations
         allSsTrajectory.clear();
         allSsTrajectory.reserve(nominalTimeSize);
@@ -289,12 +302,40 @@ namespace ocs2 {
             auto endTimeItr = SsNormalizedSwitchingTimesIndices[i].second;
 
             // solve Riccati equations
-            Observer observer(&allSsTrajectory);
             const auto maxNumTimeSteps = static_cast<size_t>(settings().maxNumStepsPerSecond_ * std::max(
                                                                  1.0, partitionDuration));
-            riccatiIntegrator.integrateTimes(riccatiEquation, observer, allSsFinal, beginTimeItr, endTimeItr,
-                                             settings().timeStep_,
-                                             settings().absTolODE_, settings().relTolODE_, maxNumTimeSteps);
+            if (denseOutput && std::distance(beginTimeItr, endTimeItr) > 1) {
+                denseTime.clear();
+                denseSs.clear();
+                denseDerivative.clear();
+                Observer observer(&denseSs, &denseTime, nullptr, &denseDerivative);
+                riccatiIntegrator.integrateAdaptive(riccatiEquation, observer, allSsFinal, *beginTimeItr, *std::prev(endTimeItr),
+                                                    dtInitial, settings().absTolODE_, settings().relTolODE_, maxNumTimeSteps);
+
+                // evaluate at the nominal time stamps, the boundaries are taken as they are
+                int indexHint = 0;
+                allSsTrajectory.push_back(denseSs.front());
+                for (auto timeItr = std::next(beginTimeItr); timeItr != std::prev(endTimeItr); ++timeItr) {
+                    allSsTrajectory.push_back(
+                        HermiteInterpolation::interpolate(*timeItr, denseTime, denseSs, denseDerivative, indexHint));
+                }
+                allSsTrajectory.push_back(denseSs.back());
+
+                // continue the next interval with the last step size, the final step is clipped to the end of the interval and
+                // may be shorter than the one before
+                const size_t denseSize = denseTime.size();
+                if (denseSize > 1) {
+                    dtInitial = denseTime[denseSize - 1] - denseTime[denseSize - 2];
+                }
+                if (denseSize > 2) {
+                    dtInitial = std::max(dtInitial, denseTime[denseSize - 2] - denseTime[denseSize - 3]);
+                }
+            } else {
+                Observer observer(&allSsTrajectory);
+                riccatiIntegrator.integrateTimes(riccatiEquation, observer, allSsFinal, beginTimeItr, endTimeItr,
+                                                 settings().timeStep_,
+                                                 settings().absTolODE_, settings().relTolODE_, maxNumTimeSteps);
+            }
 
             if (i < numEvents) {
                 allSsFinal = riccatiEquation.computeJumpMap(*endTimeItr, allSsTrajectory.back());
@@ -112,6 +112,7 @@ namespace ocs2 {
         projectedModelDataPtr_ = projectedModelDataPtr;
         modelDataEventTimesPtr_ = modelDataEventTimesPtr;
         riccatiModificationPtr_ = riccatiModificationPtr;
+        timeIndexHint_ = 0;
 
         eventTimes_.clear();
         eventTimes_.reserve(eventsPastTheEndIndecesPtr->size());
@@ -142,7 +143,7 @@ namespace ocs2 {
     vector_t ContinuousTimeRiccatiEquations::computeFlowMap(scalar_t z, const vector_t &allSs) {
         // index
         const scalar_t t = -z; // denormalized time
-        const auto indexAlpha = LinearInterpolation::timeSegment(t, *timeStampPtr_);
+        const auto indexAlpha = LinearInterpolation::timeSegment(t, *timeStampPtr_, timeIndexHint_);
 
         convert2Matrix(allSs, continuousTimeRiccatiData_.Sm_, continuousTimeRiccatiData_.Sv_,
                        continuousTimeRiccatiData_.s_);
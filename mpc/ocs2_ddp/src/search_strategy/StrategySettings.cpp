@@ -60,8 +60,8 @@ namespace ocs2 {
 
     namespace line_search {
         Settings load(const std::string &filename, const std::string &fieldName, bool verbose) {
-            boost::property_tree::ptree pt;
-            read_info(filename, pt);
+            const auto ptPtr = loadData::readInfoFile(filename);
+            const auto &pt = *ptPtr;
             if (verbose) {
                 std::cerr << " #### LINE_SEARCH Settings: {\n";
             }
@@ -93,8 +93,8 @@ namespace ocs2 {
 
     namespace levenberg_marquardt {
         Settings load(const std::string &filename, const std::string &fieldName, bool verbose) {
-            boost::property_tree::ptree pt;
-            read_info(filename, pt);
+            const auto ptPtr = loadData::readInfoFile(filename);
+            const auto &pt = *ptPtr;
             if (verbose) {
                 std::cerr << " #### LEVENBERG_MARQUARDT Settings: {\n";
             }
@@ -231,6 +231,55 @@ TEST_P(Exp1, SLQ) {
   performanceIndexTest(ddpSettings, performanceIndex);
 }
 
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+TEST_P(Exp1, SLQ_riccatiDenseOutput) {
+  // ddp settings
+  auto ddpSettings = getSettings(ocs2::ddp::Algorithm::SLQ, getNumThreads(), getSearchStrategy());
+  ddpSettings.riccatiDenseOutput_ = true;
+  ddpSettings.maxNumIterations_ = 50;
+  ddpSettings.minRelCost_ = 1e-6;  // converge both solutions such that they can be compared
+
+  // dynamics and rollout, the fixed step rollout gives both solutions on the same time stamps
+  auto fixedStepRolloutSettings = rolloutSettings();
+  fixedStepRolloutSettings.integratorType = ocs2::IntegratorType::RK4;
+  ocs2::EXP1_System systemDynamics(referenceManagerPtr);
+  ocs2::TimeTriggeredRollout rollout(systemDynamics, fixedStepRolloutSettings);
+
+  // instantiate
+  ocs2::SLQ ddp(ddpSettings, rollout, problem, *initializerPtr);
+  ddp.setReferenceManager(referenceManagerPtr);
+
+  if (ddpSettings.displayInfo_ || ddpSettings.displayShortSummary_) {
+    std::cerr << "\n" << getTestName(ddpSettings) << "\n";
+  }
+
+  // run ddp
+  ddp.run(startTime, initState, finalTime);
+  // get performance index
+  const auto performanceIndex = ddp.getPerformanceIndeces();
+
+  // performanceIndeces test
+  performanceIndexTest(ddpSettings, performanceIndex);
+
+  // the solution matches the one of the Riccati equations integrated at the nominal time stamps
+  const ocs2::scalar_t solutionTolerance = 1e-4;
+  ddpSettings.riccatiDenseOutput_ = false;
+  ocs2::SLQ ddpReference(ddpSettings, rollout, problem, *initializerPtr);
+  ddpReference.setReferenceManager(referenceManagerPtr);
+  ddpReference.run(startTime, initState, finalTime);
+
+  const auto solution = ddp.primalSolution(finalTime);
+  const auto referenceSolution = ddpReference.primalSolution(finalTime);
+  ASSERT_EQ(solution.timeTrajectory_, referenceSolution.timeTrajectory_);
+  for (size_t i = 0; i < solution.timeTrajectory_.size(); i++) {
+    const auto time = solution.timeTrajectory_[i];
+    EXPECT_TRUE(solution.stateTrajectory_[i].isApprox(referenceSolution.stateTrajectory_[i], solutionTolerance)) << "time: " << time;
+    EXPECT_TRUE(solution.inputTrajectory_[i].isApprox(referenceSolution.inputTrajectory_[i], solutionTolerance)) << "time: " << time;
+  }
+}
+
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
@@ -31,6 +31,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <ocs2_core/Types.h>
 #include <ocs2_core/integration/SensitivityIntegrator.h>
+#include <ocs2_core/thread_support/ThreadPlacement.h>
 
 #include <hpipm_colcon/HpipmInterfaceSettings.h>
 
@@ -46,6 +47,7 @@ struct Settings {
   // Linesearch - step size rules
   scalar_t alpha_decay = 0.5;  // multiply the step size by this factor every time a linesearch step is rejected.
   scalar_t alpha_min = 1e-4;   // terminate linesearch if the attempted step size is below this threshold
+  size_t linesearchCandidates = 1;  // number of step sizes of the backtracking sequence that are evaluated concurrently
 
   // Linesearch - step acceptance criteria with c = costs, g = the norm of constraint violation, and w = [x; u]
   scalar_t g_max = 1e6;          // (1): IF g{i+1} > g_max REQUIRE g{i+1} < (1-gamma_c) * g{i}
@@ -64,7 +66,14 @@ struct Settings {
 
   // Discretization method
   scalar_t dt = 0.01;  // user-defined time discretization
+  scalar_t dtGrowthRate = 0.0;  // growth of the time step per second along the horizon, zero for a uniform discretization
+  scalar_t dtMax = 0.0;  // maximum time step of the non-uniform discretization, non-positive for no limit
+  scalar_t refinementTolerance = 0.0;  // intervals whose dynamics violation exceeds it are bisected in the next call, non-positive to disable
+  scalar_t shiftTolerance = 1e-6;  // [s] the previous solution is shifted instead of interpolated if its nodes match the new ones up to it, negative to disable
   SensitivityIntegratorType integratorType = SensitivityIntegratorType::RK2;
+  bool quasiNewtonHessian = false;  // replace the cost Hessian of each node by a damped BFGS approximation, the cost may then be
+                                    // generated with first-order derivatives only
+  scalar_t quasiNewtonInitialScaling = 1.0;  // scaling of the identity the quasi-Newton approximation starts from
 
   // Barrier strategy of the primal-dual interior point method. Conventions follows Ipopt.
   scalar_t initialBarrierParameter = 1.0e-02;  // Initial value of the barrier parameter
@@ -94,7 +103,8 @@ struct Settings {
 
   // Threading
   size_t nThreads = 4;
-  int threadPriority = 50;
+  // Placement of the worker threads, the priority is loaded from threadPriority and can be overwritten in threadPlacement
+  ThreadPlacement threadPlacement = {ThreadPlacement::SchedulingPolicy::FIFO, 50};
 };
 
 /**
@@ -59,6 +59,8 @@ ipm::Settings rectifySettings(const OptimalControlProblem& ocp, ipm::Settings&&
       ocp.finalInequalityConstraintPtr->empty()) {
     settings.targetBarrierParameter = settings.initialBarrierParameter;
   }
+  // At least one linesearch candidate is needed to take a step.
+  settings.linesearchCandidates = std::max(settings.linesearchCandidates, static_cast<size_t>(1));
   return settings;
 }
 }  // anonymous namespace
@@ -66,10 +68,12 @@ ipm::Settings rectifySettings(const OptimalControlProblem& ocp, ipm::Settings&&
 IpmSolver::IpmSolver(ipm::Settings settings, const OptimalControlProblem& optimalControlProblem, const Initializer& initializer)
     : settings_(rectifySettings(optimalControlProblem, std::move(settings))),
       hpipmInterface_(OcpSize(), settings_.hpipmSettings),
-      threadPool_(std::max(settings_.nThreads, static_cast<size_t>(1)) - 1, settings_.threadPriority) {
+      threadPool_(std::max(settings_.nThreads, static_cast<size_t>(1)) - 1, settings_.threadPlacement) {
   Eigen::setNbThreads(1);  // No multithreading within Eigen.
   Eigen::initParallel();
 
+  quasiNewtonHessian_ = multiple_shooting::QuasiNewtonHessian(settings_.quasiNewtonInitialScaling);
+
   // Dynamics discretization
   discretizer_ = selectDynamicsDiscretization(settings_.integratorType);
   sensitivityDiscretizer_ = selectDynamicsSensitivityDiscretization(settings_.integratorType);
@@ -104,6 +108,8 @@ void IpmSolver::reset() {
   dualIneqTrajectory_.clear();
   valueFunction_.clear();
   performanceIndeces_.clear();
+  refinementTimes_.clear();
+  quasiNewtonHessian_.reset();
 
   // reset timers
   totalNumIterations_ = 0;
@@ -209,7 +215,11 @@ void IpmSolver::runImpl(scalar_t initTime, const vector_t& initState, scalar_t f
 
   // Determine time discretization, taking into account event times.
   const auto& eventTimes = this->getReferenceManager().getModeSchedule().eventTimes;
-  const auto timeDiscretization = timeDiscretizationWithEvents(initTime, finalTime, settings_.dt, eventTimes);
+  const auto timeDiscretization = timeDiscretizationWithEvents(initTime, finalTime, settings_.dt, settings_.dtGrowthRate, settings_.dtMax,
+                                                               eventTimes, refinementTimes_);
+  if (settings_.quasiNewtonHessian) {
+    quasiNewtonHessian_.setTimeDiscretization(timeDiscretization);
+  }
 
   // Initialize references
   for (auto& ocpDefinition : ocpDefinitions_) {
@@ -222,12 +232,18 @@ void IpmSolver::runImpl(scalar_t initTime, const vector_t& initState, scalar_t f
   const auto& newModeSchedule = this->getReferenceManager().getModeSchedule();
 
   initializationTimer_.startTimer();
-  // Initialize the state and input
-  if (!primalSolution_.timeTrajectory_.empty()) {
-    std::ignore = trajectorySpread(oldModeSchedule, newModeSchedule, primalSolution_);
-  }
+  // Initialize the state and input, shifting the previous solution if the discretization is a shift of its discretization. The
+  // vectors of the solution before the previous one are reused, the previous solution is kept until the new one is written.
   vector_array_t x, u;
-  multiple_shooting::initializeStateInputTrajectories(initState, timeDiscretization, primalSolution_, *initializerPtr_, x, u);
+  x.swap(stateTrajectoryBuffer_);
+  u.swap(inputTrajectoryBuffer_);
+  if (!multiple_shooting::shiftStateInputTrajectories(timeDiscretization, settings_.shiftTolerance, primalSolution_, *initializerPtr_, x,
+                                                      u)) {
+    if (!primalSolution_.timeTrajectory_.empty()) {
+      std::ignore = trajectorySpread(oldModeSchedule, newModeSchedule, primalSolution_);
+    }
+    multiple_shooting::initializeStateInputTrajectories(initState, timeDiscretization, primalSolution_, *initializerPtr_, x, u);
+  }
 
   // Initialize the slack and dual variables of the interior point method
   if (!slackIneqTrajectory_.timeTrajectory.empty()) {
@@ -249,7 +265,7 @@ void IpmSolver::runImpl(scalar_t initTime, const vector_t& initState, scalar_t f
 
   // Bookkeeping
   performanceIndeces_.clear();
-  std::vector<Metrics> metrics;
+  auto& metrics = metrics_;  // member to reuse the memory between iterations and calls
 
   int iter = 0;
   ipm::Convergence convergence = ipm::Convergence::FALSE;
@@ -295,12 +311,19 @@ void IpmSolver::runImpl(scalar_t initTime, const vector_t& initState, scalar_t f
   }
 
   computeControllerTimer_.startTimer();
-  primalSolution_ = toPrimalSolution(timeDiscretization, std::move(x), std::move(u));
+  auto primalSolution = toPrimalSolution(timeDiscretization, std::move(x), std::move(u));
+  stateTrajectoryBuffer_.swap(primalSolution_.stateTrajectory_);
+  inputTrajectoryBuffer_.swap(primalSolution_.inputTrajectory_);
+  primalSolution_ = std::move(primalSolution);
   costateTrajectory_ = std::move(lmd);
   projectionMultiplierTrajectory_ = std::move(nu);
   slackIneqTrajectory_ = ipm::toDualSolution(timeDiscretization, constraintsSize_, slackStateIneq, slackStateInputIneq);
   dualIneqTrajectory_ = ipm::toDualSolution(timeDiscretization, constraintsSize_, dualStateIneq, dualStateInputIneq);
-  problemMetrics_ = multiple_shooting::toProblemMetrics(timeDiscretization, std::move(metrics));
+  // before toProblemMetrics() swaps the metrics into problemMetrics_
+  if (settings_.refinementTolerance > 0.0) {
+    refinementTimes_ = getRefinementTimes(timeDiscretization, metrics, settings_.refinementTolerance);
+  }
+  multiple_shooting::toProblemMetrics(timeDiscretization, metrics, problemMetrics_);
   computeControllerTimer_.endTimer();
 
   if (settings_.printSolverStatus || settings_.printLinesearch) {
@@ -632,7 +655,10 @@ PerformanceIndex IpmSolver::setupQuadraticSubproblem(const std::vector<Annotated
       if (time[i].event == AnnotatedTime::Event::PreEvent) {
         // Event node
         auto result = multiple_shooting::setupEventNode(ocpDefinition, time[i].time, x[i], x[i + 1]);
-        metrics[i] = multiple_shooting::computeMetrics(result);
+        if (settings_.quasiNewtonHessian) {
+          quasiNewtonHessian_.update(i, x[i], vector_t(), result.cost);
+        }
+        multiple_shooting::computeMetrics(result, metrics[i]);
         performance[workerId] += ipm::computePerformanceIndex(result, barrierParam, slackStateIneq[i]);
         dynamics_[i] = std::move(result.dynamics);
         stateInputEqConstraints_[i].resize(0, x[i].size());
@@ -656,12 +682,15 @@ PerformanceIndex IpmSolver::setupQuadraticSubproblem(const std::vector<Annotated
         const scalar_t ti = getIntervalStart(time[i]);
         const scalar_t dt = getIntervalDuration(time[i], time[i + 1]);
         auto result = multiple_shooting::setupIntermediateNode(ocpDefinition, sensitivityDiscretizer_, ti, dt, x[i], x[i + 1], u[i]);
+        if (settings_.quasiNewtonHessian) {
+          quasiNewtonHessian_.update(i, x[i], u[i], result.cost);
+        }
         // Disable the state-only inequality constraints at the initial node
         if (i == 0) {
           result.stateIneqConstraints.setZero(0, x[i].size());
           std::fill(result.constraintsSize.stateIneq.begin(), result.constraintsSize.stateIneq.end(), 0);
         }
-        metrics[i] = multiple_shooting::computeMetrics(result);
+        multiple_shooting::computeMetrics(result, metrics[i]);
         performance[workerId] += ipm::computePerformanceIndex(result, dt, barrierParam, slackStateIneq[i], slackStateInputIneq[i]);
         multiple_shooting::projectTranscription(result, settings_.computeLagrangeMultipliers);
         dynamics_[i] = std::move(result.dynamics);
@@ -694,7 +723,10 @@ PerformanceIndex IpmSolver::setupQuadraticSubproblem(const std::vector<Annotated
     if (i == N) {  // Only one worker will execute this
       const scalar_t tN = getIntervalStart(time[N]);
       auto result = multiple_shooting::setupTerminalNode(ocpDefinition, tN, x[N]);
-      metrics[i] = multiple_shooting::computeMetrics(result);
+      if (settings_.quasiNewtonHessian) {
+        quasiNewtonHessian_.update(N, x[N], vector_t(), result.cost);
+      }
+      multiple_shooting::computeMetrics(result, metrics[i]);
       performance[workerId] += ipm::computePerformanceIndex(result, barrierParam, slackStateIneq[N]);
       stateInputEqConstraints_[i].resize(0, x[i].size());
       stateIneqConstraints_[i] = std::move(result.ineqConstraints);
@@ -723,57 +755,71 @@ PerformanceIndex IpmSolver::setupQuadraticSubproblem(const std::vector<Annotated
   return totalPerformance;
 }
 
-PerformanceIndex IpmSolver::computePerformance(const std::vector<AnnotatedTime>& time, const vector_t& initState, const vector_array_t& x,
-                                               const vector_array_t& u, scalar_t barrierParam, const vector_array_t& slackStateIneq,
-                                               const vector_array_t& slackStateInputIneq, std::vector<Metrics>& metrics) {
+std::vector<PerformanceIndex> IpmSolver::computePerformance(const std::vector<AnnotatedTime>& time, const vector_t& initState,
+                                                            size_t numCandidates, const std::vector<vector_array_t>& x,
+                                                            const std::vector<vector_array_t>& u, scalar_t barrierParam,
+                                                            const std::vector<vector_array_t>& slackStateIneq,
+                                                            const std::vector<vector_array_t>& slackStateInputIneq,
+                                                            std::vector<std::vector<Metrics>>& metrics) {
   // Problem horizon
   const int N = static_cast<int>(time.size()) - 1;
-  metrics.resize(N + 1);
+  for (size_t c = 0; c < numCandidates; c++) {
+    metrics[c].resize(N + 1);
+  }
 
-  std::vector<PerformanceIndex> performance(settings_.nThreads, PerformanceIndex());
-  std::atomic_int timeIndex{0};
+  // The tasks are the nodes of all candidates, task k is node (k % (N + 1)) of candidate (k / (N + 1))
+  const int numTasks = static_cast<int>(numCandidates) * (N + 1);
+  std::vector<PerformanceIndex> performance(settings_.nThreads * numCandidates, PerformanceIndex());
+  std::atomic_int taskIndex{0};
   auto parallelTask = [&](int workerId) {
     // Get worker specific resources
     OptimalControlProblem& ocpDefinition = ocpDefinitions_[workerId];
 
-    int i = timeIndex++;
-    while (i < N) {
-      if (time[i].event == AnnotatedTime::Event::PreEvent) {
+    int k = taskIndex++;
+    while (k < numTasks) {
+      const int c = k / (N + 1);
+      const int i = k % (N + 1);
+      auto& workerPerformance = performance[workerId * numCandidates + c];
+      auto& nodeMetrics = metrics[c][i];
+      if (i == N) {
+        // Terminal node
+        const scalar_t tN = getIntervalStart(time[N]);
+        multiple_shooting::computeTerminalMetrics(ocpDefinition, tN, x[c][N], nodeMetrics);
+        workerPerformance += ipm::toPerformanceIndex(nodeMetrics, barrierParam, slackStateIneq[c][N]);
+      } else if (time[i].event == AnnotatedTime::Event::PreEvent) {
         // Event node
-        metrics[i] = multiple_shooting::computeEventMetrics(ocpDefinition, time[i].time, x[i], x[i + 1]);
-        performance[workerId] += ipm::toPerformanceIndex(metrics[i], barrierParam, slackStateIneq[i]);
+        multiple_shooting::computeEventMetrics(ocpDefinition, time[i].time, x[c][i], x[c][i + 1], nodeMetrics);
+        workerPerformance += ipm::toPerformanceIndex(nodeMetrics, barrierParam, slackStateIneq[c][i]);
       } else {
         // Normal, intermediate node
         const scalar_t ti = getIntervalStart(time[i]);
         const scalar_t dt = getIntervalDuration(time[i], time[i + 1]);
-        const bool enableStateInequalityConstraints = (i > 0);
-        metrics[i] = multiple_shooting::computeIntermediateMetrics(ocpDefinition, discretizer_, ti, dt, x[i], x[i + 1], u[i]);
+        multiple_shooting::computeIntermediateMetrics(ocpDefinition, discretizer_, ti, dt, x[c][i], x[c][i + 1], u[c][i], nodeMetrics);
         // Disable the state-only inequality constraints at the initial node
         if (i == 0) {
-          metrics[i].stateIneqConstraint.clear();
+          nodeMetrics.stateIneqConstraint.clear();
         }
-        performance[workerId] += ipm::toPerformanceIndex(metrics[i], dt, barrierParam, slackStateIneq[i], slackStateInputIneq[i]);
+        workerPerformance += ipm::toPerformanceIndex(nodeMetrics, dt, barrierParam, slackStateIneq[c][i], slackStateInputIneq[c][i]);
       }
 
-      i = timeIndex++;
-    }
-
-    if (i == N) {  // Only one worker will execute this
-      const scalar_t tN = getIntervalStart(time[N]);
-      metrics[N] = multiple_shooting::computeTerminalMetrics(ocpDefinition, tN, x[N]);
-      performance[workerId] += ipm::toPerformanceIndex(metrics[N], barrierParam, slackStateIneq[N]);
+      k = taskIndex++;
     }
   };
   runParallel(std::move(parallelTask));
 
-  // Account for initial state in performance
-  const vector_t initDynamicsViolation = initState - x.front();
-  metrics.front().dynamicsViolation += initDynamicsViolation;
-  performance.front().dynamicsViolationSSE += initDynamicsViolation.squaredNorm();
+  std::vector<PerformanceIndex> totalPerformance(numCandidates);
+  for (size_t c = 0; c < numCandidates; c++) {
+    // Account for initial state in performance
+    const vector_t initDynamicsViolation = initState - x[c].front();
+    metrics[c].front().dynamicsViolation += initDynamicsViolation;
+    totalPerformance[c].dynamicsViolationSSE += initDynamicsViolation.squaredNorm();
 
-  // Sum performance of the threads
-  PerformanceIndex totalPerformance = std::accumulate(std::next(performance.begin()), performance.end(), performance.front());
-  totalPerformance.merit = totalPerformance.cost + totalPerformance.equalityLagrangian + totalPerformance.inequalityLagrangian;
+    // Sum performance of the threads
+    for (size_t w = 0; w < settings_.nThreads; w++) {
+      totalPerformance[c] += performance[w * numCandidates + c];
+    }
+    totalPerformance[c].merit = totalPerformance[c].cost + totalPerformance[c].equalityLagrangian + totalPerformance[c].inequalityLagrangian;
+  }
   return totalPerformance;
 }
 
@@ -805,66 +851,92 @@ ipm::StepInfo IpmSolver::takePrimalStep(const PerformanceIndex& baseline, const
   const auto deltaUnorm = multiple_shooting::trajectoryNorm(du);
   const auto deltaXnorm = multiple_shooting::trajectoryNorm(dx);
 
+  // Buffers of the step candidates, members to reuse the memory between line searches
+  const size_t maxNumCandidates = settings_.linesearchCandidates;
+  xCandidates_.resize(maxNumCandidates);
+  uCandidates_.resize(maxNumCandidates);
+  slackStateIneqCandidates_.resize(maxNumCandidates);
+  slackStateInputIneqCandidates_.resize(maxNumCandidates);
+  metricsCandidates_.resize(maxNumCandidates);
+  scalar_array_t alphaCandidates;
+  alphaCandidates.reserve(maxNumCandidates);
+
+  // The maximum step size is always tried, even if it is below alpha_min, the tests only apply to the smaller steps
   scalar_t alpha = subproblemSolution.maxPrimalStepSize;
-  vector_array_t xNew(x.size());
-  vector_array_t uNew(u.size());
-  vector_array_t slackStateIneqNew(slackStateIneq.size());
-  vector_array_t slackStateInputIneqNew(slackStateInputIneq.size());
-  std::vector<Metrics> metricsNew(metrics.size());
+  bool isStepSizeTooSmall = false;
+  bool hasNextCandidate = true;
   do {
-    // Compute step
-    multiple_shooting::incrementTrajectory(u, du, alpha, uNew);
-    multiple_shooting::incrementTrajectory(x, dx, alpha, xNew);
-    multiple_shooting::incrementTrajectory(slackStateIneq, deltaSlackStateIneq, alpha, slackStateIneqNew);
-    multiple_shooting::incrementTrajectory(slackStateInputIneq, deltaSlackStateInputIneq, alpha, slackStateInputIneqNew);
+    // Collect the next step sizes of the backtracking sequence, they are evaluated concurrently
+    alphaCandidates.clear();
+    while (alphaCandidates.size() < maxNumCandidates && hasNextCandidate) {
+      alphaCandidates.push_back(alpha);
+      // Try smaller step
+      alpha *= settings_.alpha_decay;
+      // Detect too small step size during back-tracking to escape early. Prevents going all the way to alpha_min
+      isStepSizeTooSmall = alpha * deltaXnorm < settings_.deltaTol && alpha * deltaUnorm < settings_.deltaTol;
+      hasNextCandidate = alpha >= settings_.alpha_min && !isStepSizeTooSmall;
+    }
 
-    // Compute cost and constraints
-    const PerformanceIndex performanceNew =
-        computePerformance(timeDiscretization, initState, xNew, uNew, barrierParam, slackStateIneqNew, slackStateInputIneqNew, metricsNew);
-
-    // Step acceptance and record step type
-    bool stepAccepted;
-    StepType stepType;
-    std::tie(stepAccepted, stepType) =
-        filterLinesearch_.acceptStep(baseline, performanceNew, alpha * subproblemSolution.armijoDescentMetric);
-
-    if (settings_.printLinesearch) {
-      std::cerr << "Step size: " << alpha << ", Step Type: " << toString(stepType)
-                << (stepAccepted ? std::string{" (Accepted)"} : std::string{" (Rejected)"}) << "\n";
-      std::cerr << "|dx| = " << alpha * deltaXnorm << "\t|du| = " << alpha * deltaUnorm << "\n";
-      std::cerr << performanceNew << "\n";
+    // Compute step
+    for (size_t c = 0; c < alphaCandidates.size(); c++) {
+      xCandidates_[c].resize(x.size());
+      uCandidates_[c].resize(u.size());
+      slackStateIneqCandidates_[c].resize(slackStateIneq.size());
+      slackStateInputIneqCandidates_[c].resize(slackStateInputIneq.size());
+      multiple_shooting::incrementTrajectory(u, du, alphaCandidates[c], uCandidates_[c]);
+      multiple_shooting::incrementTrajectory(x, dx, alphaCandidates[c], xCandidates_[c]);
+      multiple_shooting::incrementTrajectory(slackStateIneq, deltaSlackStateIneq, alphaCandidates[c], slackStateIneqCandidates_[c]);
+      multiple_shooting::incrementTrajectory(slackStateInputIneq, deltaSlackStateInputIneq, alphaCandidates[c],
+                                             slackStateInputIneqCandidates_[c]);
     }
 
-    if (stepAccepted) {  // Return if step accepted
-      x = std::move(xNew);
-      u = std::move(uNew);
-      slackStateIneq = std::move(slackStateIneqNew);
-      slackStateInputIneq = std::move(slackStateInputIneqNew);
-      metrics = std::move(metricsNew);
-
-      // Prepare step info
-      ipm::StepInfo stepInfo;
-      stepInfo.primalStepSize = alpha;
-      stepInfo.stepType = stepType;
-      stepInfo.dx_norm = alpha * deltaXnorm;
-      stepInfo.du_norm = alpha * deltaUnorm;
-      stepInfo.performanceAfterStep = performanceNew;
-      stepInfo.totalConstraintViolationAfterStep = FilterLinesearch::totalConstraintViolation(performanceNew);
-      return stepInfo;
-
-    } else {  // Try smaller step
-      alpha *= settings_.alpha_decay;
+    // Compute cost and constraints
+    const auto performanceCandidates =
+        computePerformance(timeDiscretization, initState, alphaCandidates.size(), xCandidates_, uCandidates_, barrierParam,
+                           slackStateIneqCandidates_, slackStateInputIneqCandidates_, metricsCandidates_);
+
+    // Step acceptance in the order of decreasing step size, the largest accepted step is taken
+    for (size_t c = 0; c < alphaCandidates.size(); c++) {
+      const scalar_t alphaCandidate = alphaCandidates[c];
+      const PerformanceIndex& performanceNew = performanceCandidates[c];
+
+      // Step acceptance and record step type
+      bool stepAccepted;
+      StepType stepType;
+      std::tie(stepAccepted, stepType) =
+          filterLinesearch_.acceptStep(baseline, performanceNew, alphaCandidate * subproblemSolution.armijoDescentMetric);
+
+      if (settings_.printLinesearch) {
+        std::cerr << "Step size: " << alphaCandidate << ", Step Type: " << toString(stepType)
+                  << (stepAccepted ? std::string{" (Accepted)"} : std::string{" (Rejected)"}) << "\n";
+        std::cerr << "|dx| = " << alphaCandidate * deltaXnorm << "\t|du| = " << alphaCandidate * deltaUnorm << "\n";
+        std::cerr << performanceNew << "\n";
+      }
 
-      // Detect too small step size during back-tracking to escape early. Prevents going all the way to alpha_min
-      if (alpha * deltaXnorm < settings_.deltaTol && alpha * deltaUnorm < settings_.deltaTol) {
-        if (settings_.printLinesearch) {
-          std::cerr << "Exiting linesearch early due to too small primal steps |dx|: " << alpha * deltaXnorm
-                    << ", and or |du|: " << alpha * deltaUnorm << " are below deltaTol: " << settings_.deltaTol << "\n";
-        }
-        break;
+      if (stepAccepted) {  // Return if step accepted
+        x.swap(xCandidates_[c]);
+        u.swap(uCandidates_[c]);
+        slackStateIneq.swap(slackStateIneqCandidates_[c]);
+        slackStateInputIneq.swap(slackStateInputIneqCandidates_[c]);
+        metrics.swap(metricsCandidates_[c]);
+
+        // Prepare step info
+        ipm::StepInfo stepInfo;
+        stepInfo.primalStepSize = alphaCandidate;
+        stepInfo.stepType = stepType;
+        stepInfo.dx_norm = alphaCandidate * deltaXnorm;
+        stepInfo.du_norm = alphaCandidate * deltaUnorm;
+        stepInfo.performanceAfterStep = performanceNew;
+        stepInfo.totalConstraintViolationAfterStep = FilterLinesearch::totalConstraintViolation(performanceNew);
+        return stepInfo;
       }
     }
-  } while (alpha >= settings_.alpha_min);
+
+    if (isStepSizeTooSmall && settings_.printLinesearch) {
+      std::cerr << "Exiting linesearch early due to too small primal steps |dx|: " << alpha * deltaXnorm
+                << ", and or |du|: " << alpha * deltaUnorm << " are below deltaTol: " << settings_.deltaTol << "\n";
+    }
+  } while (hasNextCandidate);
 
   // Alpha_min reached -> Don't take a step
   ipm::StepInfo stepInfo;
@@ -0,0 +1,151 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <ocs2_core/thread_support/ThreadPlacement.h>
+#include <ocs2_oc/synchronized_module/ReferenceManagerInterface.h>
+
+#include "ocs2_mpc/MPC_BASE.h"
+
+namespace ocs2 {
+    /**
+     * Runs an ensemble of MPCs concurrently on the same observation and selects the policy with the lowest merit.
+     *
+     * The members can differ in anything that does not change the meaning of the merit, e.g., the solver, the time horizon, the
+     * initialization or a mode schedule hypothesis injected through a SolverSynchronizedModule. Each member runs on its own thread,
+     * which can be pinned to a CPU core through the ThreadPlacement. A round waits for all members or until the deadline has
+     * passed. Members that are late are excluded from the selection, finish in the background and only rejoin the ensemble in the
+     * first round after they are done.
+     *
+     * All members share one ReferenceManager. The ensemble updates it once per round on the calling thread and copies the active
+     * references into the own ReferenceManager of each member before the member starts. The constructor replaces the
+     * ReferenceManager of the members' solvers accordingly. Changes of the references by a member, e.g., a mode schedule
+     * hypothesis set by one of its SolverSynchronizedModules, stay within that member for the current round. New references from
+     * outside have to be set on the shared ReferenceManager.
+     *
+     * getSolverPtr() returns the solver of the member that was selected in the last round.
+     */
+    class MPC_Ensemble final : public MPC_BASE {
+    public:
+        /** Settings of the ensemble. */
+        struct Settings {
+            /** Time budget of a round in seconds. Any non-positive number waits for all the members. */
+            scalar_t deadline = 0.0;
+            /** Placement of the members' threads. The index of a member is its index in the group of threads. */
+            ThreadPlacement threadPlacement;
+        };
+
+        /** Statistics of an ensemble member. */
+        struct MemberStatistics {
+            /** Number of rounds in which the member has been started. */
+            size_t numRuns = 0;
+            /** Number of rounds in which the member's policy has been selected. */
+            size_t numSelected = 0;
+            /** Number of rounds in which the member did not finish before the deadline. */
+            size_t numMissedDeadlines = 0;
+            /** Number of rounds in which the member failed, i.e., MPC_BASE::run() returned false or threw. */
+            size_t numFailures = 0;
+            /** Merit of the member's solution in the last round it finished. */
+            scalar_t lastMerit = std::numeric_limits<scalar_t>::quiet_NaN();
+            /** Solve time of the member in the last round it finished. */
+            scalar_t lastSolveTimeInMilliseconds = 0.0;
+        };
+
+        /**
+         * Constructor
+         *
+         * @param [in] mpcSettings: Settings of the ensemble as an MPC. The time horizon is used for updating the references and
+         * should be the longest time horizon of the members.
+         * @param [in] settings: Settings of the ensemble.
+         * @param [in] members: The members of the ensemble. Must be non-empty.
+         * @param [in] referenceManagerPtr: The ReferenceManager shared by all members.
+         */
+        MPC_Ensemble(const mpc::Settings &mpcSettings, Settings settings, std::vector<std::unique_ptr<MPC_BASE> > members,
+                     std::shared_ptr<ReferenceManagerInterface> referenceManagerPtr);
+
+        /** Destructor. Waits for the members to finish. */
+        ~MPC_Ensemble() override;
+
+        /**
+         * Resets the ensemble and all its members. Waits for late members to finish.
+         * @note reset() must not be called while the solver is running.
+         */
+        void reset() override;
+
+        SolverBase *getSolverPtr() override;
+
+        const SolverBase *getSolverPtr() const override;
+
+        /** Gets the number of members. */
+        size_t getNumMembers() const { return members_.size(); }
+
+        /** Gets the index of the member that was selected in the last round. */
+        size_t getSelectedIndex() const { return selectedIndex_; }
+
+        /** Gets a member. It must not be accessed while it is running, see isMemberRunning(). */
+        MPC_BASE &getMember(size_t index);
+
+        /** Whether a member is still running, e.g., because it missed the deadline of the last round. */
+        bool isMemberRunning(size_t index) const;
+
+        /** Gets the statistics of a member. */
+        const MemberStatistics &getMemberStatistics(size_t index) const;
+
+    protected:
+        void calculateController(scalar_t initTime, const vector_t &initState, scalar_t finalTime) override;
+
+    private:
+        class MemberReferenceManager;
+        struct Member;
+
+        void worker(Member &member, size_t memberIndex);
+
+        /** Waits until no member is running. */
+        void waitForAllMembers();
+
+        Settings settings_;
+        std::shared_ptr<ReferenceManagerInterface> referenceManagerPtr_;
+        std::vector<std::unique_ptr<Member> > members_;
+        std::atomic_size_t selectedIndex_{0};
+
+        mutable std::mutex mutex_;
+        std::condition_variable memberStartCondition_;
+        std::condition_variable memberFinishedCondition_;
+        bool stop_ = false;
+    };
+} // namespace ocs2
@@ -32,6 +32,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <string>
 
 #include <ocs2_core/Types.h>
+#include <ocs2_core/thread_support/ThreadPlacement.h>
 
 namespace ocs2::mpc {
     /**
@@ -65,6 +66,11 @@ namespace ocs2::mpc {
          * set to a positive number which can be interpreted as the tracking controller's frequency.
          */
         scalar_t mrtDesiredFrequency_ = 100.0;
+
+        /** Placement of the thread which runs the MPC, e.g., the spinning thread of MPC_ROS_Interface, and its helper threads. */
+        ThreadPlacement mpcThreadPlacement_;
+        /** Placement of the thread which runs the MRT loop. */
+        ThreadPlacement mrtThreadPlacement_;
     };
 
     /**
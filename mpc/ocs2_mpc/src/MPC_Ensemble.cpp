@@ -0,0 +1,312 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include "ocs2_mpc/MPC_Ensemble.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <exception>
+
+namespace ocs2 {
+    /**
+     * ReferenceManager of a member. It holds the member's own copy of the references, which the ensemble sets from a snapshot of
+     * the shared ReferenceManager before the member is started. The setters only change this copy, such that a mode schedule or
+     * target trajectories hypothesis of a member, e.g., set by one of its SolverSynchronizedModules, neither reaches the other
+     * members nor the shared ReferenceManager.
+     */
+    class MPC_Ensemble::MemberReferenceManager final : public ReferenceManagerInterface {
+    public:
+        /** The shared ReferenceManager is updated by the ensemble. */
+        void preSolverRun(scalar_t initTime, scalar_t finalTime, const vector_t &initState) override {
+        }
+
+        const ModeSchedule &getModeSchedule() const override { return modeSchedule_; }
+
+        void setModeSchedule(const ModeSchedule &modeSchedule) override { modeSchedule_ = modeSchedule; }
+
+        void setModeSchedule(ModeSchedule &&modeSchedule) override { modeSchedule_ = std::move(modeSchedule); }
+
+        const TargetTrajectories &getTargetTrajectories() const override { return targetTrajectories_; }
+
+        void setTargetTrajectories(const TargetTrajectories &targetTrajectories) override { targetTrajectories_ = targetTrajectories; }
+
+        void setTargetTrajectories(TargetTrajectories &&targetTrajectories) override {
+            targetTrajectories_ = std::move(targetTrajectories);
+        }
+
+    private:
+        ModeSchedule modeSchedule_;
+        TargetTrajectories targetTrajectories_;
+    };
+
+
+    struct MPC_Ensemble::Member {
+        std::unique_ptr<MPC_BASE> mpcPtr;
+        std::shared_ptr<MemberReferenceManager> referenceManagerPtr;
+        std::thread thread;
+
+        // Only accessed by the calling thread
+        MemberStatistics statistics;
+        bool isLate = false;
+
+        // Guarded by mutex_
+        bool hasJob = false;
+        bool isRunning = false;
+
+        // Written by the calling thread before the job is started, and by the worker before it finishes
+        scalar_t initTime = 0.0;
+        vector_t initState;
+        bool isSuccessful = false;
+        std::exception_ptr exceptionPtr;
+        scalar_t solveTimeInMilliseconds = 0.0;
+    };
+
+
+    MPC_Ensemble::MPC_Ensemble(const mpc::Settings &mpcSettings, Settings settings,
+                               std::vector<std::unique_ptr<MPC_BASE> > members,
+                               std::shared_ptr<ReferenceManagerInterface> referenceManagerPtr)
+        : MPC_BASE(mpcSettings), settings_(std::move(settings)), referenceManagerPtr_(std::move(referenceManagerPtr)) {
+        if (members.empty()) {
+            throw std::runtime_error("[MPC_Ensemble] The ensemble must have at least one member!");
+        }
+        if (referenceManagerPtr_ == nullptr) {
+            throw std::runtime_error("[MPC_Ensemble] ReferenceManager pointer cannot be a nullptr!");
+        }
+
+        members_.reserve(members.size());
+        for (auto &mpcPtr: members) {
+            if (mpcPtr == nullptr) {
+                throw std::runtime_error("[MPC_Ensemble] Member pointer cannot be a nullptr!");
+            }
+            members_.emplace_back(new Member);
+            auto &member = *members_.back();
+            member.mpcPtr = std::move(mpcPtr);
+            member.referenceManagerPtr = std::make_shared<MemberReferenceManager>();
+            member.mpcPtr->getSolverPtr()->setReferenceManager(member.referenceManagerPtr);
+        }
+
+        for (size_t i = 0; i < members_.size(); i++) {
+            auto &member = *members_[i];
+            member.thread = std::thread(&MPC_Ensemble::worker, this, std::ref(member), i);
+        }
+    }
+
+
+    MPC_Ensemble::~MPC_Ensemble() { {
+            std::lock_guard lock(mutex_);
+            stop_ = true;
+        }
+        memberStartCondition_.notify_all();
+        for (auto &member: members_) {
+            if (member->thread.joinable()) {
+                member->thread.join();
+            }
+        }
+    }
+
+
+    void MPC_Ensemble::reset() {
+        waitForAllMembers();
+        for (auto &member: members_) {
+            member->mpcPtr->reset();
+            member->statistics = MemberStatistics();
+            member->isLate = false;
+        }
+        selectedIndex_ = 0;
+        MPC_BASE::reset();
+    }
+
+
+    SolverBase *MPC_Ensemble::getSolverPtr() {
+        return members_[selectedIndex_]->mpcPtr->getSolverPtr();
+    }
+
+
+    const SolverBase *MPC_Ensemble::getSolverPtr() const {
+        return members_[selectedIndex_]->mpcPtr->getSolverPtr();
+    }
+
+
+    MPC_BASE &MPC_Ensemble::getMember(size_t index) {
+        return *members_[index]->mpcPtr;
+    }
+
+
+    bool MPC_Ensemble::isMemberRunning(size_t index) const {
+        std::lock_guard lock(mutex_);
+        return members_[index]->isRunning;
+    }
+
+
+    const MPC_Ensemble::MemberStatistics &MPC_Ensemble::getMemberStatistics(size_t index) const {
+        return members_[index]->statistics;
+    }
+
+
+    void MPC_Ensemble::calculateController(scalar_t initTime, const vector_t &initState, scalar_t finalTime) {
+        // Start all members that are not running anymore. If all of them are late, wait for the first one.
+        std::vector<Member *> startedMembers;
+        startedMembers.reserve(members_.size()); {
+            std::unique_lock lock(mutex_);
+            const auto isAnyMemberIdle = [this] {
+                return std::any_of(members_.begin(), members_.end(), [](const auto &member) { return !member->isRunning; });
+            };
+            memberFinishedCondition_.wait(lock, isAnyMemberIdle);
+            for (auto &member: members_) {
+                if (!member->isRunning) {
+                    startedMembers.push_back(member.get());
+                }
+            }
+        }
+
+        // Each started member gets its own copy of this round's references before it is dispatched. Late members keep the copy of
+        // the round they were started in and never access the shared ReferenceManager, which is only updated on this thread.
+        referenceManagerPtr_->preSolverRun(initTime, finalTime, initState);
+        const ModeSchedule modeSchedule = referenceManagerPtr_->getModeSchedule();
+        const TargetTrajectories targetTrajectories = referenceManagerPtr_->getTargetTrajectories();
+        for (auto *member: startedMembers) {
+            if (member->isLate) {
+                // Results of the round the member was late for are discarded.
+                member->isLate = false;
+                member->statistics.lastSolveTimeInMilliseconds = member->solveTimeInMilliseconds;
+            }
+            member->referenceManagerPtr->setModeSchedule(modeSchedule);
+            member->referenceManagerPtr->setTargetTrajectories(targetTrajectories);
+            member->initTime = initTime;
+            member->initState = initState;
+            member->statistics.numRuns++;
+        } {
+            std::lock_guard lock(mutex_);
+            for (auto *member: startedMembers) {
+                member->hasJob = true;
+                member->isRunning = true;
+            }
+        }
+        memberStartCondition_.notify_all();
+
+        // Wait for the members or the deadline, but at least for one member.
+        {
+            std::unique_lock lock(mutex_);
+            const auto areAllMembersFinished = [&] {
+                return std::none_of(startedMembers.begin(), startedMembers.end(), [](const Member *member) { return member->isRunning; });
+            };
+            const auto isAnyMemberFinished = [&] {
+                return std::any_of(startedMembers.begin(), startedMembers.end(), [](const Member *member) { return !member->isRunning; });
+            };
+            if (settings_.deadline > 0.0) {
+                const auto deadline = std::chrono::steady_clock::now() + std::chrono::duration<scalar_t>(settings_.deadline);
+                if (!memberFinishedCondition_.wait_until(lock, deadline, areAllMembersFinished)) {
+                    memberFinishedCondition_.wait(lock, isAnyMemberFinished);
+                }
+            } else {
+                memberFinishedCondition_.wait(lock, areAllMembersFinished);
+            }
+            for (auto *member: startedMembers) {
+                member->isLate = member->isRunning;
+            }
+        }
+
+        // Select the member with the lowest merit
+        Member *selectedMember = nullptr;
+        std::exception_ptr exceptionPtr;
+        for (auto *member: startedMembers) {
+            auto &statistics = member->statistics;
+            if (member->isLate) {
+                statistics.numMissedDeadlines++;
+                continue;
+            }
+            statistics.lastSolveTimeInMilliseconds = member->solveTimeInMilliseconds;
+            if (!member->isSuccessful) {
+                statistics.numFailures++;
+                if (exceptionPtr == nullptr) {
+                    exceptionPtr = member->exceptionPtr;
+                }
+                continue;
+            }
+            statistics.lastMerit = member->mpcPtr->getSolverPtr()->getPerformanceIndeces().merit;
+            if (std::isfinite(statistics.lastMerit) &&
+                (selectedMember == nullptr || statistics.lastMerit < selectedMember->statistics.lastMerit)) {
+                selectedMember = member;
+            }
+        }
+
+        if (selectedMember == nullptr) {
+            if (exceptionPtr != nullptr) {
+                std::rethrow_exception(exceptionPtr);
+            }
+            throw std::runtime_error("[MPC_Ensemble] None of the members found a solution!");
+        }
+
+        selectedMember->statistics.numSelected++;
+        for (size_t i = 0; i < members_.size(); i++) {
+            if (members_[i].get() == selectedMember) {
+                selectedIndex_ = i;
+            }
+        }
+    }
+
+
+    void MPC_Ensemble::worker(Member &member, size_t memberIndex) {
+        setThisThreadPlacement(settings_.threadPlacement, memberIndex);
+
+        std::unique_lock lock(mutex_);
+        while (true) {
+            memberStartCondition_.wait(lock, [&] { return member.hasJob || stop_; });
+            if (stop_) {
+                break;
+            }
+            member.hasJob = false;
+            lock.unlock();
+
+            const auto startTime = std::chrono::steady_clock::now();
+            try {
+                member.isSuccessful = member.mpcPtr->run(member.initTime, member.initState);
+                member.exceptionPtr = nullptr;
+            } catch (...) {
+                member.isSuccessful = false;
+                member.exceptionPtr = std::current_exception();
+            }
+            member.solveTimeInMilliseconds = std::chrono::duration<scalar_t, std::milli>(
+                std::chrono::steady_clock::now() - startTime).count();
+
+            lock.lock();
+            member.isRunning = false;
+            memberFinishedCondition_.notify_all();
+        }
+    }
+
+
+    void MPC_Ensemble::waitForAllMembers() {
+        std::unique_lock lock(mutex_);
+        memberFinishedCondition_.wait(lock, [this] {
+            return std::none_of(members_.begin(), members_.end(), [](const auto &member) { return member->isRunning; });
+        });
+    }
+} // namespace ocs2
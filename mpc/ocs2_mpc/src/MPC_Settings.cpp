@@ -36,8 +36,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 namespace ocs2::mpc {
     Settings loadSettings(const std::string &filename, const std::string &fieldName, bool verbose) {
-        boost::property_tree::ptree pt;
-        read_info(filename, pt);
+        const auto ptPtr = loadData::readInfoFile(filename);
+        const auto &pt = *ptPtr;
 
         Settings settings;
 
@@ -55,6 +55,9 @@ namespace ocs2::mpc {
         loadData::loadPtreeValue(pt, settings.mpcDesiredFrequency_, fieldName + ".mpcDesiredFrequency", verbose);
         loadData::loadPtreeValue(pt, settings.mrtDesiredFrequency_, fieldName + ".mrtDesiredFrequency", verbose);
 
+        loadThreadPlacement(pt, fieldName + ".mpcThreadPlacement", settings.mpcThreadPlacement_, verbose);
+        loadThreadPlacement(pt, fieldName + ".mrtThreadPlacement", settings.mrtThreadPlacement_, verbose);
+
         if (verbose) {
             std::cerr << " #### =============================================================================" <<
                     std::endl;
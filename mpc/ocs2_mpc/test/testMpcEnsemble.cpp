@@ -0,0 +1,257 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cmath>
+#include <future>
+#include <limits>
+#include <thread>
+
+#include <ocs2_oc/synchronized_module/ReferenceManager.h>
+
+#include "ocs2_mpc/MPC_Ensemble.h"
+
+using namespace ocs2;
+
+namespace {
+
+/** References are tagged by the first mode of the mode schedule and the first time of the target trajectories. */
+ModeSchedule taggedModeSchedule(size_t tag) {
+  return ModeSchedule({}, {tag});
+}
+
+TargetTrajectories taggedTargetTrajectories(scalar_t tag) {
+  return TargetTrajectories({tag}, {vector_t::Zero(1)}, {vector_t::Zero(1)});
+}
+
+/** A solver with a given merit, which records the references it sees. It optionally blocks until it is released. */
+class RecordingSolver final : public SolverBase {
+ public:
+  struct Record {
+    size_t modeTag;
+    scalar_t targetTag;
+    bool isReferenceUnchanged;  // whether the references were the same at the end of the run
+  };
+
+  explicit RecordingSolver(scalar_t merit) { performanceIndex_.merit = merit; }
+
+  void setMerit(scalar_t merit) { performanceIndex_.merit = merit; }
+  void blockUntil(std::shared_future<void> released) { released_ = std::move(released); }
+  const std::vector<Record>& getRecords() const { return records_; }
+
+  void reset() override {}
+  const OptimalControlProblem& getOptimalControlProblem() const override { return problem_; }
+  const PerformanceIndex& getPerformanceIndeces() const override { return performanceIndex_; }
+  size_t getNumIterations() const override { return 1; }
+  const std::vector<PerformanceIndex>& getIterationsLog() const override { return iterationsLog_; }
+  scalar_t getFinalTime() const override { return finalTime_; }
+  void getPrimalSolution(scalar_t finalTime, PrimalSolution* primalSolutionPtr) const override {}
+  const ProblemMetrics& getSolutionMetrics() const override { return problemMetrics_; }
+  ScalarFunctionQuadraticApproximation getValueFunction(scalar_t time, const vector_t& state) const override { return {}; }
+  ScalarFunctionQuadraticApproximation getHamiltonian(scalar_t time, const vector_t& state, const vector_t& input) override { return {}; }
+  vector_t getStateInputEqualityConstraintLagrangian(scalar_t time, const vector_t& state) const override { return {}; }
+  MultiplierCollection getIntermediateDualSolution(scalar_t time) const override { return {}; }
+
+ private:
+  void runImpl(scalar_t initTime, const vector_t& initState, scalar_t finalTime) override {
+    const auto& referenceManager = getReferenceManager();
+    const size_t modeTag = referenceManager.getModeSchedule().modeSequence.front();
+    const scalar_t targetTag = referenceManager.getTargetTrajectories().timeTrajectory.front();
+    if (released_.valid()) {
+      released_.wait();
+      released_ = std::shared_future<void>();
+    }
+    const bool isReferenceUnchanged = referenceManager.getModeSchedule().modeSequence.front() == modeTag &&
+                                      referenceManager.getTargetTrajectories().timeTrajectory.front() == targetTag;
+    records_.push_back({modeTag, targetTag, isReferenceUnchanged});
+    finalTime_ = finalTime;
+  }
+  void runImpl(scalar_t initTime, const vector_t& initState, scalar_t finalTime, const ControllerBase* externalControllerPtr) override {
+    runImpl(initTime, initState, finalTime);
+  }
+  void runImpl(scalar_t initTime, const vector_t& initState, scalar_t finalTime, const PrimalSolution& primalSolution) override {
+    runImpl(initTime, initState, finalTime);
+  }
+
+  OptimalControlProblem problem_;
+  PerformanceIndex performanceIndex_;
+  std::vector<PerformanceIndex> iterationsLog_;
+  ProblemMetrics problemMetrics_;
+  scalar_t finalTime_ = 0.0;
+  std::shared_future<void> released_;
+  std::vector<Record> records_;
+};
+
+class RecordingMpc final : public MPC_BASE {
+ public:
+  RecordingMpc(const mpc::Settings& mpcSettings, scalar_t merit) : MPC_BASE(mpcSettings), solver_(merit) {}
+
+  RecordingSolver* getSolverPtr() override { return &solver_; }
+  const RecordingSolver* getSolverPtr() const override { return &solver_; }
+
+ protected:
+  void calculateController(scalar_t initTime, const vector_t& initState, scalar_t finalTime) override {
+    solver_.run(initTime, initState, finalTime);
+  }
+
+ private:
+  RecordingSolver solver_;
+};
+
+/** Sets a mode schedule and target trajectories hypothesis on the ReferenceManager of the solver, like a gait receiver does. */
+class HypothesisModule final : public SolverSynchronizedModule {
+ public:
+  HypothesisModule(SolverBase& solver, size_t modeTag, scalar_t targetTag) : solver_(solver), modeTag_(modeTag), targetTag_(targetTag) {}
+
+  void preSolverRun(scalar_t initTime, scalar_t finalTime, const vector_t& initState,
+                    const ReferenceManagerInterface& referenceManager) override {
+    solver_.getReferenceManager().setModeSchedule(taggedModeSchedule(modeTag_));
+    solver_.getReferenceManager().setTargetTrajectories(taggedTargetTrajectories(targetTag_));
+  }
+  void postSolverRun(const PrimalSolution& primalSolution) override {}
+
+ private:
+  SolverBase& solver_;
+  size_t modeTag_;
+  scalar_t targetTag_;
+};
+
+mpc::Settings mpcSettings() {
+  mpc::Settings settings;
+  settings.timeHorizon_ = 1.0;
+  return settings;
+}
+
+std::unique_ptr<MPC_Ensemble> createEnsemble(const std::vector<scalar_t>& merits, std::shared_ptr<ReferenceManager> referenceManagerPtr,
+                                             scalar_t deadline = 0.0) {
+  std::vector<std::unique_ptr<MPC_BASE>> members;
+  for (const auto merit : merits) {
+    members.emplace_back(new RecordingMpc(mpcSettings(), merit));
+  }
+  MPC_Ensemble::Settings settings;
+  settings.deadline = deadline;
+  settings.threadPlacement.schedulingPolicy = ThreadPlacement::SchedulingPolicy::OTHER;
+  return std::make_unique<MPC_Ensemble>(mpcSettings(), settings, std::move(members), std::move(referenceManagerPtr));
+}
+
+RecordingSolver& getMemberSolver(MPC_Ensemble& ensemble, size_t index) {
+  return *static_cast<RecordingSolver*>(ensemble.getMember(index).getSolverPtr());
+}
+
+}  // unnamed namespace
+
+TEST(testMpcEnsemble, memberIsolation) {
+  auto referenceManagerPtr = std::make_shared<ReferenceManager>(taggedTargetTrajectories(0.0), taggedModeSchedule(0));
+  auto ensemblePtr = createEnsemble({1.0, 2.0}, referenceManagerPtr);
+  auto& hypothesisSolver = getMemberSolver(*ensemblePtr, 0);
+  hypothesisSolver.addSynchronizedModule(std::make_shared<HypothesisModule>(hypothesisSolver, 5, 5.0));
+
+  ASSERT_TRUE(ensemblePtr->run(0.0, vector_t::Zero(1)));
+  referenceManagerPtr->setTargetTrajectories(taggedTargetTrajectories(1.0));
+  ASSERT_TRUE(ensemblePtr->run(0.1, vector_t::Zero(1)));
+
+  // The hypothesis stays within its member
+  for (const auto& record : hypothesisSolver.getRecords()) {
+    EXPECT_EQ(record.modeTag, 5);
+    EXPECT_EQ(record.targetTag, 5.0);
+  }
+  const auto& records = getMemberSolver(*ensemblePtr, 1).getRecords();
+  ASSERT_EQ(records.size(), 2);
+  EXPECT_EQ(records[0].modeTag, 0);
+  EXPECT_EQ(records[0].targetTag, 0.0);
+  EXPECT_EQ(records[1].modeTag, 0);
+  EXPECT_EQ(records[1].targetTag, 1.0);
+  EXPECT_EQ(referenceManagerPtr->getModeSchedule().modeSequence.front(), 0);
+  EXPECT_EQ(referenceManagerPtr->getTargetTrajectories().timeTrajectory.front(), 1.0);
+}
+
+TEST(testMpcEnsemble, winnerSelection) {
+  constexpr scalar_t nan = std::numeric_limits<scalar_t>::quiet_NaN();
+  auto referenceManagerPtr = std::make_shared<ReferenceManager>(taggedTargetTrajectories(0.0), taggedModeSchedule(0));
+  auto ensemblePtr = createEnsemble({3.0, 1.0, nan, 2.0}, referenceManagerPtr);
+
+  ASSERT_TRUE(ensemblePtr->run(0.0, vector_t::Zero(1)));
+  EXPECT_EQ(ensemblePtr->getSelectedIndex(), 1);
+  EXPECT_EQ(ensemblePtr->getSolverPtr(), ensemblePtr->getMember(1).getSolverPtr());
+
+  // The member with a non-finite merit is never selected
+  getMemberSolver(*ensemblePtr, 1).setMerit(4.0);
+  getMemberSolver(*ensemblePtr, 2).setMerit(-nan);
+  ASSERT_TRUE(ensemblePtr->run(0.1, vector_t::Zero(1)));
+  EXPECT_EQ(ensemblePtr->getSelectedIndex(), 3);
+  EXPECT_EQ(ensemblePtr->getSolverPtr(), ensemblePtr->getMember(3).getSolverPtr());
+
+  for (size_t i = 0; i < ensemblePtr->getNumMembers(); i++) {
+    const auto& statistics = ensemblePtr->getMemberStatistics(i);
+    EXPECT_EQ(statistics.numRuns, 2);
+    EXPECT_EQ(statistics.numSelected, (i == 1 || i == 3) ? 1 : 0);
+    EXPECT_EQ(statistics.numMissedDeadlines, 0);
+  }
+  EXPECT_EQ(ensemblePtr->getMemberStatistics(3).lastMerit, 2.0);
+  EXPECT_TRUE(std::isnan(ensemblePtr->getMemberStatistics(2).lastMerit));
+}
+
+TEST(testMpcEnsemble, lateMemberKeepsReferences) {
+  auto referenceManagerPtr = std::make_shared<ReferenceManager>(taggedTargetTrajectories(0.0), taggedModeSchedule(0));
+  auto ensemblePtr = createEnsemble({2.0, 1.0}, referenceManagerPtr, 0.01);
+  std::promise<void> release;
+  auto& lateSolver = getMemberSolver(*ensemblePtr, 1);
+  lateSolver.blockUntil(release.get_future().share());
+
+  // The late member is started with the references of the first round and misses its deadline
+  ASSERT_TRUE(ensemblePtr->run(0.0, vector_t::Zero(1)));
+  EXPECT_EQ(ensemblePtr->getSelectedIndex(), 0);
+  EXPECT_TRUE(ensemblePtr->isMemberRunning(1));
+
+  // The shared references change while the late member is still running
+  referenceManagerPtr->setModeSchedule(taggedModeSchedule(1));
+  referenceManagerPtr->setTargetTrajectories(taggedTargetTrajectories(1.0));
+  ASSERT_TRUE(ensemblePtr->run(0.1, vector_t::Zero(1)));
+  EXPECT_EQ(ensemblePtr->getSelectedIndex(), 0);
+  release.set_value();
+
+  // The late member rejoins once it is done, with the references of that round
+  while (ensemblePtr->isMemberRunning(1)) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  ASSERT_TRUE(ensemblePtr->run(0.2, vector_t::Zero(1)));
+  EXPECT_EQ(ensemblePtr->getSelectedIndex(), 1);
+  EXPECT_EQ(ensemblePtr->getMemberStatistics(1).numMissedDeadlines, 1);
+
+  const auto& records = lateSolver.getRecords();
+  ASSERT_EQ(records.size(), 2);
+  EXPECT_EQ(records[0].modeTag, 0);
+  EXPECT_EQ(records[0].targetTag, 0.0);
+  EXPECT_TRUE(records[0].isReferenceUnchanged);
+  EXPECT_EQ(records[1].modeTag, 1);
+  EXPECT_EQ(records[1].targetTag, 1.0);
+  EXPECT_TRUE(records[1].isReferenceUnchanged);
+}
@@ -31,6 +31,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <ocs2_oc/oc_problem/OptimalControlProblem.h>
 
+#include "ocs2_qp_solver/QpSolverTypes.h"
 #include "ocs2_qp_solver/QpTrajectories.h"
 
 namespace ocs2::qp_solver {
@@ -41,9 +42,11 @@ namespace ocs2::qp_solver {
     * @param optimalControProblem: The optimal control problem definition.
     * @param nominalTrajectory : time, state and input trajectory to make the linear quadratic approximation around
     * @param initialState : state at the start of the horizon.
+    * @param backend : linear algebra used to solve the KKT system, use KktBackend::Sparse for long horizons.
     * @return time, state, and input solution.
     */
     ContinuousTrajectory solveLinearQuadraticOptimalControlProblem(OptimalControlProblem &optimalControProblem,
                                                                    const ContinuousTrajectory &nominalTrajectory,
-                                                                   const vector_t &initialState);
+                                                                   const vector_t &initialState,
+                                                                   KktBackend backend = KktBackend::Dense);
 }
@@ -29,21 +29,28 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #pragma once
 
+#include <Eigen/Sparse>
+
+#include <ocs2_oc/oc_problem/OcpSize.h>
+
 #include "ocs2_qp_solver/QpSolverTypes.h"
 #include "ocs2_qp_solver/QpTrajectories.h"
 
 namespace ocs2::qp_solver {
     /**
-    * Solves the discretized linear quadratic optimal control problem by constructing a dense QP and inverting the full KKT system.
-    * The decision vector is defined as w = [dx[0], du[0], dx[1],  du[1], ..., dx[N]]
+    * Solves the discretized linear quadratic optimal control problem by constructing a QP and inverting the full KKT system.
+    * With the dense backend, the decision vector is defined as w = [dx[0], du[0], dx[1],  du[1], ..., dx[N]].
+    * With the sparse backend, the initial state is eliminated and the KKT system is built with getCostMatrixSparse and
+    * getConstraintMatrixSparse of ocs2_oc, which makes it usable for long horizons.
     *
     * @param lqApproximation : vector of stage-wise discrete quadratic cost and linear dynamics
     * @param dx0 : initial state deviation from the nominal trajectories.
+    * @param backend : linear algebra used to solve the KKT system.
     * @return trajectory of state and inputs (in relative coordinates), .i.e. dx(t), du(t)
     */
     std::pair<vector_array_t, vector_array_t> solveLinearQuadraticProblem(
         const std::vector<LinearQuadraticStage> &lqApproximation,
-        const vector_t &dx0);
+        const vector_t &dx0, KktBackend backend = KktBackend::Dense);
 
     /**
     * Constructs the matrix of stacked dynamic constraints A w + b = 0
@@ -97,6 +104,21 @@ namespace ocs2::qp_solver {
         const std::vector<LinearQuadraticStage> &lqp,
         const vector_t &dx0);
 
+    /**
+    * Constructs the sparse equality constrained QP from the discretized linear quadratic control problem, in which the initial state is
+    * eliminated. The decision vector is defined as w = [du[0], dx[1], du[1], ..., dx[N]].
+    * min_w  1/2 w' H w + h' w
+    *   s.t. G w = g
+    *
+    * @param lqp : linear quadratic problem.
+    * @param dx0 : initial state deviation from the nominal trajectories.
+    * @param [out] H, h : cost matrices.
+    * @param [out] G, g : constraint matrices.
+    * @return the sizes of the problem, to extract the trajectories from w with toOcpSolution of ocs2_oc.
+    */
+    OcpSize getSparseQp(const std::vector<LinearQuadraticStage> &lqp, const vector_t &dx0,
+                        Eigen::SparseMatrix<scalar_t> &H, vector_t &h, Eigen::SparseMatrix<scalar_t> &G, vector_t &g);
+
     /**
     * Solves the equality constrained QP
     * min_w  1/2 w' H w + g' w
@@ -109,6 +131,18 @@ namespace ocs2::qp_solver {
     std::pair<vector_t, vector_t> solveDenseQp(const ScalarFunctionQuadraticApproximation &cost,
                                                const VectorFunctionLinearApproximation &constraints);
 
+    /**
+    * Solves the equality constrained QP with a sparse factorization of the KKT matrix
+    * min_w  1/2 w' H w + h' w
+    *   s.t. G w = g
+    *
+    *   Assumes H is positive definite on the null space of G, rows of G are linearly independent.
+    *
+    * @return {w, lambda} at the solution, where w is the vector of decision variables, and lambda is the vector of lagrange multipliers
+    */
+    std::pair<vector_t, vector_t> solveSparseQp(const Eigen::SparseMatrix<scalar_t> &H, const vector_t &h,
+                                                const Eigen::SparseMatrix<scalar_t> &G, const vector_t &g);
+
     /**
     * Reconstructs the optimal state and input trajectory recursively based on the full qp solution vector
     * @param numStates : number of states per stage
@@ -48,4 +48,12 @@ namespace ocs2::qp_solver {
             : cost(std::move(c)), dynamics(std::move(d)), constraints(std::move(g)) {
         }
     };
+
+    /** Linear algebra used to solve the KKT system of the QP */
+    enum class KktBackend {
+        /** Dense KKT matrix with a full LU factorization, O((N (nx + nu))^3) */
+        Dense,
+        /** Sparse KKT matrix with a fill-reducing sparse LU factorization, which preserves the stage-wise banded structure */
+        Sparse
+    };
 }
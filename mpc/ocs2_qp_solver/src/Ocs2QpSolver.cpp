@@ -35,7 +35,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 namespace ocs2::qp_solver {
     ContinuousTrajectory solveLinearQuadraticOptimalControlProblem(OptimalControlProblem &optimalControProblem,
                                                                    const ContinuousTrajectory &nominalTrajectory,
-                                                                   const vector_t &initialState) {
+                                                                   const vector_t &initialState, KktBackend backend) {
         // Approximate
         const auto lqApproximation = getLinearQuadraticApproximation(optimalControProblem, nominalTrajectory);
 
@@ -43,7 +43,8 @@ namespace ocs2::qp_solver {
         ContinuousTrajectory deltaSolution;
         deltaSolution.timeTrajectory = nominalTrajectory.timeTrajectory;
         std::tie(deltaSolution.stateTrajectory, deltaSolution.inputTrajectory) =
-                solveLinearQuadraticProblem(lqApproximation, initialState - nominalTrajectory.stateTrajectory.front());
+                solveLinearQuadraticProblem(lqApproximation, initialState - nominalTrajectory.stateTrajectory.front(),
+                                            backend);
 
         // Take a full step: Add update to nominal trajectory
         return nominalTrajectory + deltaSolution;
@@ -30,9 +30,13 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "ocs2_qp_solver/QpSolver.h"
 
 #include <Eigen/LU>
+#include <Eigen/SparseLU>
 #include <numeric>
 #include <tuple>
 
+#include <ocs2_oc/oc_problem/OcpSize.h>
+#include <ocs2_oc/oc_problem/OcpToKkt.h>
+
 namespace ocs2::qp_solver {
     /**
    * Extracts the problem state and inputs dimensions as well as number of constraints from a linear quadratic approximation
@@ -78,9 +82,33 @@ namespace ocs2::qp_solver {
                    numConstraints.begin(), numConstraints.end(), 0);
     }
 
-    std::pair<vector_array_t, vector_array_t> solveLinearQuadraticProblem(
+    /** Solves the problem with the sparse KKT system of ocs2_oc, in which the initial state is eliminated */
+    static std::pair<vector_array_t, vector_array_t> solveLinearQuadraticProblemSparse(
         const std::vector<LinearQuadraticStage> &lqApproximation,
         const vector_t &dx0) {
+        // Construct QP
+        Eigen::SparseMatrix<scalar_t> H;
+        Eigen::SparseMatrix<scalar_t> G;
+        vector_t h;
+        vector_t g;
+        const auto ocpSize = getSparseQp(lqApproximation, dx0, H, h, G, g);
+
+        // Solve
+        const auto primalDualSolution = solveSparseQp(H, h, G, g);
+
+        // Extract solution
+        std::pair<vector_array_t, vector_array_t> stateInputTrajectory;
+        toOcpSolution(ocpSize, primalDualSolution.first, dx0, stateInputTrajectory.first, stateInputTrajectory.second);
+        return stateInputTrajectory;
+    }
+
+    std::pair<vector_array_t, vector_array_t> solveLinearQuadraticProblem(
+        const std::vector<LinearQuadraticStage> &lqApproximation,
+        const vector_t &dx0, KktBackend backend) {
+        if (backend == KktBackend::Sparse) {
+            return solveLinearQuadraticProblemSparse(lqApproximation, dx0);
+        }
+
         auto [numStates, numInputs, numConstraints] = getNumStatesInputsConstraints(lqApproximation);
         const auto numDecisionVariables = getNumDecisionVariables(numStates, numInputs);
         const auto numQpConstraints = getNumConstraints(numStates, numConstraints);
@@ -239,6 +267,74 @@ namespace ocs2::qp_solver {
         return {sol.head(n), sol.tail(m)};
     }
 
+    OcpSize getSparseQp(const std::vector<LinearQuadraticStage> &lqp, const vector_t &dx0,
+                        Eigen::SparseMatrix<scalar_t> &H, vector_t &h, Eigen::SparseMatrix<scalar_t> &G, vector_t &g) {
+        if (lqp.size() < 2) {
+            throw std::runtime_error("[getSparseQp] The sparse QP requires at least one stage.");
+        }
+
+        const auto [numStates, numInputs, numConstraints] = getNumStatesInputsConstraints(lqp);
+        const int N = lqp.size() - 1;
+
+        OcpSize ocpSize(N);
+        ocpSize.numStates = numStates;
+        ocpSize.numInputs = numInputs;
+        ocpSize.numInputs.push_back(0);
+        ocpSize.numIneqConstraints = numConstraints;
+
+        std::vector<ScalarFunctionQuadraticApproximation> cost;
+        std::vector<VectorFunctionLinearApproximation> dynamics;
+        std::vector<VectorFunctionLinearApproximation> constraints;
+        cost.reserve(N + 1);
+        dynamics.reserve(N);
+        constraints.reserve(N + 1);
+        for (const auto &stage: lqp) {
+            cost.push_back(stage.cost);
+            constraints.push_back(stage.constraints);
+        }
+        for (int k = 0; k < N; ++k) {
+            dynamics.push_back(lqp[k].dynamics);
+        }
+
+        getCostMatrixSparse(ocpSize, dx0, cost, H, h);
+        getConstraintMatrixSparse(ocpSize, dx0, dynamics, &constraints, nullptr, G, g);
+        return ocpSize;
+    }
+
+    std::pair<vector_t, vector_t> solveSparseQp(const Eigen::SparseMatrix<scalar_t> &H, const vector_t &h,
+                                                const Eigen::SparseMatrix<scalar_t> &G, const vector_t &g) {
+        const int m = G.rows();
+        const int n = G.cols();
+
+        // Assemble KKT condition
+        std::vector<Eigen::Triplet<scalar_t> > tripletList;
+        tripletList.reserve(H.nonZeros() + 2 * G.nonZeros());
+        for (int j = 0; j < H.outerSize(); ++j) {
+            for (Eigen::SparseMatrix<scalar_t>::InnerIterator it(H, j); it; ++it) {
+                tripletList.emplace_back(it.row(), it.col(), it.value());
+            }
+        }
+        for (int j = 0; j < G.outerSize(); ++j) {
+            for (Eigen::SparseMatrix<scalar_t>::InnerIterator it(G, j); it; ++it) {
+                tripletList.emplace_back(n + it.row(), it.col(), it.value());
+                tripletList.emplace_back(it.col(), n + it.row(), it.value());
+            }
+        }
+        Eigen::SparseMatrix<scalar_t> kktMatrix(n + m, n + m);
+        kktMatrix.setFromTriplets(tripletList.begin(), tripletList.end());
+        vector_t kktRhs(n + m);
+        kktRhs << -h, g;
+
+        // The KKT matrix is indefinite, a pivoting LU factorization is used. The column ordering keeps the fill-in local to the stages.
+        Eigen::SparseLU<Eigen::SparseMatrix<scalar_t>, Eigen::COLAMDOrdering<int> > solver;
+        solver.compute(kktMatrix);
+        if (solver.info() != Eigen::Success) {
+            throw std::runtime_error("KKT matrix is not full rank");
+        }
+        vector_t sol = solver.solve(kktRhs);
+        return {sol.head(n), sol.tail(m)};
+    }
+
     std::pair<vector_array_t, vector_array_t> getStateAndInputTrajectory(
         const std::vector<int> &numStates, const std::vector<int> &numInputs,
         const vector_t &w) {
@@ -74,3 +74,59 @@ TEST_F(QpSolverTest, costMatrixFullRank) {
 TEST_F(QpSolverTest, constraintMatrixFullRank) {
     ASSERT_TRUE(constraints.dfdx.fullPivLu().rank() == constraints.dfdx.rows());
 }
+
+TEST_F(QpSolverTest, sparseBackendMatchesDense) {
+    ocs2::vector_array_t xDense, uDense, xSparse, uSparse;
+    std::tie(xDense, uDense) = ocs2::qp_solver::solveLinearQuadraticProblem(lqProblem, x0, ocs2::qp_solver::KktBackend::Dense);
+    std::tie(xSparse, uSparse) = ocs2::qp_solver::solveLinearQuadraticProblem(lqProblem, x0, ocs2::qp_solver::KktBackend::Sparse);
+
+    ASSERT_EQ(xDense.size(), xSparse.size());
+    ASSERT_EQ(uDense.size(), uSparse.size());
+    for (size_t k = 0; k < xDense.size(); ++k) {
+        ASSERT_TRUE(xDense[k].isApprox(xSparse[k], 1e-6));
+    }
+    for (size_t k = 0; k < uDense.size(); ++k) {
+        ASSERT_TRUE(uDense[k].isApprox(uSparse[k], 1e-6));
+    }
+}
+
+TEST(QpSolverSparseTest, longHorizon) {
+    constexpr int N = 1000;
+    constexpr int nx = 4;
+    constexpr int nu = 3;
+    constexpr int nc = 1;
+    const auto lqProblem = ocs2::qp_solver::generateRandomLqProblem(N, nx, nu, nc);
+    const ocs2::vector_t x0 = ocs2::vector_t::Random(nx);
+
+    ocs2::vector_array_t x, u;
+    std::tie(x, u) = ocs2::qp_solver::solveLinearQuadraticProblem(lqProblem, x0, ocs2::qp_solver::KktBackend::Sparse);
+
+    // Check feasibility of the solution
+    ASSERT_EQ(x.size(), N + 1);
+    ASSERT_EQ(u.size(), N);
+    ASSERT_TRUE(x.front().isApprox(x0));
+    for (int k = 0; k < N; ++k) {
+        const auto &dynamics = lqProblem[k].dynamics;
+        const auto &constraints = lqProblem[k].constraints;
+        const ocs2::vector_t xNext = dynamics.dfdx * x[k] + dynamics.dfdu * u[k] + dynamics.f;
+        ASSERT_LT((xNext - x[k + 1]).lpNorm<Eigen::Infinity>(), 1e-6);
+        ASSERT_LT((constraints.dfdx * x[k] + constraints.dfdu * u[k] + constraints.f).lpNorm<Eigen::Infinity>(), 1e-6);
+    }
+    const auto &constraints = lqProblem[N].constraints;
+    ASSERT_LT((constraints.dfdx * x[N] + constraints.f).lpNorm<Eigen::Infinity>(), 1e-6);
+
+    // Check optimality with the multipliers of the sparse QP: H w + h + G' lambda = 0
+    Eigen::SparseMatrix<ocs2::scalar_t> H, G;
+    ocs2::vector_t h, g;
+    ocs2::qp_solver::getSparseQp(lqProblem, x0, H, h, G, g);
+    ocs2::vector_t w, lambda;
+    std::tie(w, lambda) = ocs2::qp_solver::solveSparseQp(H, h, G, g);
+    ASSERT_LT((H * w + h + G.transpose() * lambda).lpNorm<Eigen::Infinity>(), 1e-6);
+
+    // The multipliers belong to the returned solution w = [u[0], x[1], u[1], ..., x[N]]
+    ASSERT_EQ(w.size(), N * (nx + nu));
+    for (int k = 0; k < N; ++k) {
+        ASSERT_TRUE(w.segment(k * (nx + nu), nu).isApprox(u[k]));
+        ASSERT_TRUE(w.segment(k * (nx + nu) + nu, nx).isApprox(x[k + 1]));
+    }
+}
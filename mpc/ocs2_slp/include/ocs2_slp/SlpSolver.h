@@ -35,6 +35,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ocs2_core/thread_support/ThreadPool.h>
 
 #include <ocs2_oc/multiple_shooting/ProjectionMultiplierCoefficients.h>
+#include <ocs2_oc/multiple_shooting/QuasiNewtonHessian.h>
 #include <ocs2_oc/oc_data/TimeDiscretization.h>
 #include <ocs2_oc/oc_problem/OptimalControlProblem.h>
 #include <ocs2_oc/oc_solver/SolverBase.h>
@@ -124,9 +125,13 @@ class SlpSolver : public SolverBase {
   PerformanceIndex setupQuadraticSubproblem(const std::vector<AnnotatedTime>& time, const vector_t& initState, const vector_array_t& x,
                                             const vector_array_t& u, std::vector<Metrics>& metrics);
 
-  /** Computes only the performance metrics at the current {t, x(t), u(t)} */
-  PerformanceIndex computePerformance(const std::vector<AnnotatedTime>& time, const vector_t& initState, const vector_array_t& x,
-                                      const vector_array_t& u, std::vector<Metrics>& metrics);
+  /**
+   * Computes only the performance metrics at the first numCandidates linesearch candidates {t, x_c(t), u_c(t)}.
+   * The nodes of all candidates are distributed over the threads together.
+   */
+  std::vector<PerformanceIndex> computePerformance(const std::vector<AnnotatedTime>& time, const vector_t& initState, size_t numCandidates,
+                                                   const std::vector<vector_array_t>& x, const std::vector<vector_array_t>& u,
+                                                   std::vector<std::vector<Metrics>>& metrics);
 
   /** Returns solution of the QP subproblem in delta coordinates: */
   struct OcpSubproblemSolution {
@@ -163,6 +168,9 @@ class SlpSolver : public SolverBase {
 
   // Solution
   PrimalSolution primalSolution_;
+  // State and input vectors of an earlier solution, reused for the initialization of the next one
+  vector_array_t stateTrajectoryBuffer_;
+  vector_array_t inputTrajectoryBuffer_;
 
   // LQ approximation
   std::vector<ScalarFunctionQuadraticApproximation> cost_;
@@ -181,6 +189,20 @@ class SlpSolver : public SolverBase {
   // The ProblemMetrics associated to primalSolution_
   ProblemMetrics problemMetrics_;
 
+  // Metrics of the current iterate, kept to reuse their memory
+  std::vector<Metrics> metrics_;
+
+  // Times of the intervals of the previous solution with a large dynamics violation, refined in the next discretization
+  scalar_array_t refinementTimes_;
+
+  // Quasi-Newton approximation of the cost Hessian of each node, used if settings.quasiNewtonHessian is set
+  multiple_shooting::QuasiNewtonHessian quasiNewtonHessian_;
+
+  // Linesearch candidates, kept to reuse their memory
+  std::vector<vector_array_t> xCandidates_;
+  std::vector<vector_array_t> uCandidates_;
+  std::vector<std::vector<Metrics>> metricsCandidates_;
+
   // Benchmarking
   size_t numProblems_{0};
   size_t totalNumIterations_{0};
@@ -48,10 +48,12 @@ namespace ocs2 {
 SlpSolver::SlpSolver(slp::Settings settings, const OptimalControlProblem& optimalControlProblem, const Initializer& initializer)
     : settings_(std::move(settings)),
       pipgSolver_(settings_.pipgSettings),
-      threadPool_(std::max(settings_.nThreads - 1, static_cast<size_t>(1)) - 1, settings_.threadPriority) {
+      threadPool_(std::max(settings_.nThreads - 1, static_cast<size_t>(1)) - 1, settings_.threadPlacement) {
   Eigen::setNbThreads(1);  // No multithreading within Eigen.
   Eigen::initParallel();
 
+  quasiNewtonHessian_ = multiple_shooting::QuasiNewtonHessian(settings_.quasiNewtonInitialScaling);
+
   // Dynamics discretization
   discretizer_ = selectDynamicsDiscretization(settings_.integratorType);
   sensitivityDiscretizer_ = selectDynamicsSensitivityDiscretization(settings_.integratorType);
@@ -81,6 +83,8 @@ void SlpSolver::reset() {
   // Clear solution
   primalSolution_ = PrimalSolution();
   performanceIndeces_.clear();
+  refinementTimes_.clear();
+  quasiNewtonHessian_.reset();
 
   // reset timers
   numProblems_ = 0;
@@ -165,7 +169,11 @@ void SlpSolver::runImpl(scalar_t initTime, const vector_t& initState, scalar_t f
 
   // Determine time discretization, taking into account event times.
   const auto& eventTimes = this->getReferenceManager().getModeSchedule().eventTimes;
-  const auto timeDiscretization = timeDiscretizationWithEvents(initTime, finalTime, settings_.dt, eventTimes);
+  const auto timeDiscretization = timeDiscretizationWithEvents(initTime, finalTime, settings_.dt, settings_.dtGrowthRate, settings_.dtMax,
+                                                               eventTimes, refinementTimes_);
+  if (settings_.quasiNewtonHessian) {
+    quasiNewtonHessian_.setTimeDiscretization(timeDiscretization);
+  }
 
   // Initialize references
   for (auto& ocpDefinition : ocpDefinitions_) {
@@ -173,18 +181,23 @@ void SlpSolver::runImpl(scalar_t initTime, const vector_t& initState, scalar_t f
     ocpDefinition.targetTrajectoriesPtr = &targetTrajectories;
   }
 
-  // Trajectory spread of primalSolution_
-  if (!primalSolution_.timeTrajectory_.empty()) {
-    std::ignore = trajectorySpread(primalSolution_.modeSchedule_, this->getReferenceManager().getModeSchedule(), primalSolution_);
-  }
-
-  // Initialize the state and input
+  // Initialize the state and input, shifting the previous solution if the discretization is a shift of its discretization. The
+  // vectors of the solution before the previous one are reused, the previous solution is kept until the new one is written.
   vector_array_t x, u;
-  multiple_shooting::initializeStateInputTrajectories(initState, timeDiscretization, primalSolution_, *initializerPtr_, x, u);
+  x.swap(stateTrajectoryBuffer_);
+  u.swap(inputTrajectoryBuffer_);
+  if (!multiple_shooting::shiftStateInputTrajectories(timeDiscretization, settings_.shiftTolerance, primalSolution_, *initializerPtr_, x,
+                                                      u)) {
+    // Trajectory spread of primalSolution_
+    if (!primalSolution_.timeTrajectory_.empty()) {
+      std::ignore = trajectorySpread(primalSolution_.modeSchedule_, this->getReferenceManager().getModeSchedule(), primalSolution_);
+    }
+    multiple_shooting::initializeStateInputTrajectories(initState, timeDiscretization, primalSolution_, *initializerPtr_, x, u);
+  }
 
   // Bookkeeping
   performanceIndeces_.clear();
-  std::vector<Metrics> metrics;
+  auto& metrics = metrics_;  // member to reuse the memory between iterations and calls
 
   int iter = 0;
   slp::Convergence convergence = slp::Convergence::FALSE;
@@ -218,8 +231,15 @@ void SlpSolver::runImpl(scalar_t initTime, const vector_t& initState, scalar_t f
   }
 
   computeControllerTimer_.startTimer();
-  primalSolution_ = toPrimalSolution(timeDiscretization, std::move(x), std::move(u));
-  problemMetrics_ = multiple_shooting::toProblemMetrics(timeDiscretization, std::move(metrics));
+  auto primalSolution = toPrimalSolution(timeDiscretization, std::move(x), std::move(u));
+  stateTrajectoryBuffer_.swap(primalSolution_.stateTrajectory_);
+  inputTrajectoryBuffer_.swap(primalSolution_.inputTrajectory_);
+  primalSolution_ = std::move(primalSolution);
+  // before toProblemMetrics() swaps the metrics into problemMetrics_
+  if (settings_.refinementTolerance > 0.0) {
+    refinementTimes_ = getRefinementTimes(timeDiscretization, metrics, settings_.refinementTolerance);
+  }
+  multiple_shooting::toProblemMetrics(timeDiscretization, metrics, problemMetrics_);
   computeControllerTimer_.endTimer();
 
   ++numProblems_;
@@ -324,7 +344,10 @@ PerformanceIndex SlpSolver::setupQuadraticSubproblem(const std::vector<Annotated
       if (time[i].event == AnnotatedTime::Event::PreEvent) {
         // Event node
         auto result = multiple_shooting::setupEventNode(ocpDefinition, time[i].time, x[i], x[i + 1]);
-        metrics[i] = multiple_shooting::computeMetrics(result);
+        if (settings_.quasiNewtonHessian) {
+          quasiNewtonHessian_.update(i, x[i], vector_t(), result.cost);
+        }
+        multiple_shooting::computeMetrics(result, metrics[i]);
         workerPerformance += multiple_shooting::computePerformanceIndex(result);
         cost_[i] = std::move(result.cost);
         dynamics_[i] = std::move(result.dynamics);
@@ -338,7 +361,10 @@ PerformanceIndex SlpSolver::setupQuadraticSubproblem(const std::vector<Annotated
         const scalar_t ti = getIntervalStart(time[i]);
         const scalar_t dt = getIntervalDuration(time[i], time[i + 1]);
         auto result = multiple_shooting::setupIntermediateNode(ocpDefinition, sensitivityDiscretizer_, ti, dt, x[i], x[i + 1], u[i]);
-        metrics[i] = multiple_shooting::computeMetrics(result);
+        if (settings_.quasiNewtonHessian) {
+          quasiNewtonHessian_.update(i, x[i], u[i], result.cost);
+        }
+        multiple_shooting::computeMetrics(result, metrics[i]);
         workerPerformance += multiple_shooting::computePerformanceIndex(result, dt);
         multiple_shooting::projectTranscription(result, settings_.extractProjectionMultiplier);
         cost_[i] = std::move(result.cost);
@@ -356,7 +382,10 @@ PerformanceIndex SlpSolver::setupQuadraticSubproblem(const std::vector<Annotated
     if (i == N) {  // Only one worker will execute this
       const scalar_t tN = getIntervalStart(time[N]);
       auto result = multiple_shooting::setupTerminalNode(ocpDefinition, tN, x[N]);
-      metrics[i] = multiple_shooting::computeMetrics(result);
+      if (settings_.quasiNewtonHessian) {
+        quasiNewtonHessian_.update(N, x[N], vector_t(), result.cost);
+      }
+      multiple_shooting::computeMetrics(result, metrics[i]);
       workerPerformance += multiple_shooting::computePerformanceIndex(result);
       cost_[i] = std::move(result.cost);
       stateIneqConstraints_[i] = std::move(result.ineqConstraints);
@@ -377,51 +406,64 @@ PerformanceIndex SlpSolver::setupQuadraticSubproblem(const std::vector<Annotated
   return totalPerformance;
 }
 
-PerformanceIndex SlpSolver::computePerformance(const std::vector<AnnotatedTime>& time, const vector_t& initState, const vector_array_t& x,
-                                               const vector_array_t& u, std::vector<Metrics>& metrics) {
+std::vector<PerformanceIndex> SlpSolver::computePerformance(const std::vector<AnnotatedTime>& time, const vector_t& initState,
+                                                            size_t numCandidates, const std::vector<vector_array_t>& x,
+                                                            const std::vector<vector_array_t>& u, std::vector<std::vector<Metrics>>& metrics) {
   // Problem size
   const int N = static_cast<int>(time.size()) - 1;
-  metrics.resize(N + 1);
+  for (size_t c = 0; c < numCandidates; c++) {
+    metrics[c].resize(N + 1);
+  }
 
-  std::vector<PerformanceIndex> performance(settings_.nThreads, PerformanceIndex());
-  std::atomic_int timeIndex{0};
+  // The tasks are the nodes of all candidates, task k is node (k % (N + 1)) of candidate (k / (N + 1))
+  const int numTasks = static_cast<int>(numCandidates) * (N + 1);
+  std::vector<PerformanceIndex> performance(settings_.nThreads * numCandidates, PerformanceIndex());
+  std::atomic_int taskIndex{0};
   auto parallelTask = [&](int workerId) {
     // Get worker specific resources
     OptimalControlProblem& ocpDefinition = ocpDefinitions_[workerId];
 
-    int i = timeIndex++;
-    while (i < N) {
-      if (time[i].event == AnnotatedTime::Event::PreEvent) {
+    int k = taskIndex++;
+    while (k < numTasks) {
+      const int c = k / (N + 1);
+      const int i = k % (N + 1);
+      auto& workerPerformance = performance[workerId * numCandidates + c];
+      auto& nodeMetrics = metrics[c][i];
+      if (i == N) {
+        // Terminal node
+        const scalar_t tN = getIntervalStart(time[N]);
+        multiple_shooting::computeTerminalMetrics(ocpDefinition, tN, x[c][N], nodeMetrics);
+        workerPerformance += toPerformanceIndex(nodeMetrics);
+      } else if (time[i].event == AnnotatedTime::Event::PreEvent) {
         // Event node
-        metrics[i] = multiple_shooting::computeEventMetrics(ocpDefinition, time[i].time, x[i], x[i + 1]);
-        performance[workerId] += toPerformanceIndex(metrics[i]);
+        multiple_shooting::computeEventMetrics(ocpDefinition, time[i].time, x[c][i], x[c][i + 1], nodeMetrics);
+        workerPerformance += toPerformanceIndex(nodeMetrics);
       } else {
         // Normal, intermediate node
         const scalar_t ti = getIntervalStart(time[i]);
         const scalar_t dt = getIntervalDuration(time[i], time[i + 1]);
-        metrics[i] = multiple_shooting::computeIntermediateMetrics(ocpDefinition, discretizer_, ti, dt, x[i], x[i + 1], u[i]);
-        performance[workerId] += toPerformanceIndex(metrics[i], dt);
+        multiple_shooting::computeIntermediateMetrics(ocpDefinition, discretizer_, ti, dt, x[c][i], x[c][i + 1], u[c][i], nodeMetrics);
+        workerPerformance += toPerformanceIndex(nodeMetrics, dt);
       }
 
-      i = timeIndex++;
-    }
-
-    if (i == N) {  // Only one worker will execute this
-      const scalar_t tN = getIntervalStart(time[N]);
-      metrics[N] = multiple_shooting::computeTerminalMetrics(ocpDefinition, tN, x[N]);
-      performance[workerId] += toPerformanceIndex(metrics[N]);
+      k = taskIndex++;
     }
   };
   runParallel(std::move(parallelTask));
 
-  // Account for initial state in performance
-  const vector_t initDynamicsViolation = initState - x.front();
-  metrics.front().dynamicsViolation += initDynamicsViolation;
-  performance.front().dynamicsViolationSSE += initDynamicsViolation.squaredNorm();
+  std::vector<PerformanceIndex> totalPerformance(numCandidates);
+  for (size_t c = 0; c < numCandidates; c++) {
+    // Account for initial state in performance
+    const vector_t initDynamicsViolation = initState - x[c].front();
+    metrics[c].front().dynamicsViolation += initDynamicsViolation;
+    totalPerformance[c].dynamicsViolationSSE += initDynamicsViolation.squaredNorm();
 
-  // Sum performance of the threads
-  PerformanceIndex totalPerformance = std::accumulate(std::next(performance.begin()), performance.end(), performance.front());
-  totalPerformance.merit = totalPerformance.cost + totalPerformance.equalityLagrangian + totalPerformance.inequalityLagrangian;
+    // Sum performance of the threads
+    for (size_t w = 0; w < settings_.nThreads; w++) {
+      totalPerformance[c] += performance[w * numCandidates + c];
+    }
+    totalPerformance[c].merit = totalPerformance[c].cost + totalPerformance[c].equalityLagrangian + totalPerformance[c].inequalityLagrangian;
+  }
   return totalPerformance;
 }
 
@@ -450,59 +492,79 @@ slp::StepInfo SlpSolver::takeStep(const PerformanceIndex& baseline, const std::v
   const auto deltaUnorm = multiple_shooting::trajectoryNorm(du);
   const auto deltaXnorm = multiple_shooting::trajectoryNorm(dx);
 
+  // Buffers of the step candidates, members to reuse the memory between line searches
+  const size_t maxNumCandidates = std::max(settings_.linesearchCandidates, static_cast<size_t>(1));
+  xCandidates_.resize(maxNumCandidates);
+  uCandidates_.resize(maxNumCandidates);
+  metricsCandidates_.resize(maxNumCandidates);
+  scalar_array_t alphaCandidates;
+  alphaCandidates.reserve(maxNumCandidates);
+
   scalar_t alpha = 1.0;
-  vector_array_t xNew(x.size());
-  vector_array_t uNew(u.size());
-  std::vector<Metrics> metricsNew(metrics.size());
+  bool isStepSizeTooSmall = false;
   do {
-    // Compute step
-    multiple_shooting::incrementTrajectory(u, du, alpha, uNew);
-    multiple_shooting::incrementTrajectory(x, dx, alpha, xNew);
+    // Collect the next step sizes of the backtracking sequence, they are evaluated concurrently
+    alphaCandidates.clear();
+    while (alphaCandidates.size() < maxNumCandidates && alpha >= settings_.alpha_min && !isStepSizeTooSmall) {
+      alphaCandidates.push_back(alpha);
+      // Try smaller step
+      alpha *= settings_.alpha_decay;
+      // Detect too small step size during back-tracking to escape early. Prevents going all the way to alpha_min
+      isStepSizeTooSmall = alpha * deltaXnorm < settings_.deltaTol && alpha * deltaUnorm < settings_.deltaTol;
+    }
 
-    // Compute cost and constraints
-    const PerformanceIndex performanceNew = computePerformance(timeDiscretization, initState, xNew, uNew, metricsNew);
-
-    // Step acceptance and record step type
-    bool stepAccepted;
-    StepType stepType;
-    std::tie(stepAccepted, stepType) =
-        filterLinesearch_.acceptStep(baseline, performanceNew, alpha * subproblemSolution.armijoDescentMetric);
-
-    if (settings_.printLinesearch) {
-      std::cerr << "Step size: " << alpha << ", Step Type: " << toString(stepType)
-                << (stepAccepted ? std::string{" (Accepted)"} : std::string{" (Rejected)"}) << "\n";
-      std::cerr << "|dx| = " << alpha * deltaXnorm << "\t|du| = " << alpha * deltaUnorm << "\n";
-      std::cerr << performanceNew << "\n";
+    // Compute step
+    for (size_t c = 0; c < alphaCandidates.size(); c++) {
+      xCandidates_[c].resize(x.size());
+      uCandidates_[c].resize(u.size());
+      multiple_shooting::incrementTrajectory(u, du, alphaCandidates[c], uCandidates_[c]);
+      multiple_shooting::incrementTrajectory(x, dx, alphaCandidates[c], xCandidates_[c]);
     }
 
-    if (stepAccepted) {  // Return if step accepted
-      x = std::move(xNew);
-      u = std::move(uNew);
-      metrics = std::move(metricsNew);
-
-      // Prepare step info
-      slp::StepInfo stepInfo;
-      stepInfo.stepSize = alpha;
-      stepInfo.stepType = stepType;
-      stepInfo.dx_norm = alpha * deltaXnorm;
-      stepInfo.du_norm = alpha * deltaUnorm;
-      stepInfo.performanceAfterStep = performanceNew;
-      stepInfo.totalConstraintViolationAfterStep = FilterLinesearch::totalConstraintViolation(performanceNew);
-      return stepInfo;
-
-    } else {  // Try smaller step
-      alpha *= settings_.alpha_decay;
+    // Compute cost and constraints
+    const auto performanceCandidates =
+        computePerformance(timeDiscretization, initState, alphaCandidates.size(), xCandidates_, uCandidates_, metricsCandidates_);
+
+    // Step acceptance in the order of decreasing step size, the largest accepted step is taken
+    for (size_t c = 0; c < alphaCandidates.size(); c++) {
+      const scalar_t alphaCandidate = alphaCandidates[c];
+      const PerformanceIndex& performanceNew = performanceCandidates[c];
+
+      // Step acceptance and record step type
+      bool stepAccepted;
+      StepType stepType;
+      std::tie(stepAccepted, stepType) =
+          filterLinesearch_.acceptStep(baseline, performanceNew, alphaCandidate * subproblemSolution.armijoDescentMetric);
+
+      if (settings_.printLinesearch) {
+        std::cerr << "Step size: " << alphaCandidate << ", Step Type: " << toString(stepType)
+                  << (stepAccepted ? std::string{" (Accepted)"} : std::string{" (Rejected)"}) << "\n";
+        std::cerr << "|dx| = " << alphaCandidate * deltaXnorm << "\t|du| = " << alphaCandidate * deltaUnorm << "\n";
+        std::cerr << performanceNew << "\n";
+      }
 
-      // Detect too small step size during back-tracking to escape early. Prevents going all the way to alpha_min
-      if (alpha * deltaXnorm < settings_.deltaTol && alpha * deltaUnorm < settings_.deltaTol) {
-        if (settings_.printLinesearch) {
-          std::cerr << "Exiting linesearch early due to too small primal steps |dx|: " << alpha * deltaXnorm
-                    << ", and or |du|: " << alpha * deltaUnorm << " are below deltaTol: " << settings_.deltaTol << "\n";
-        }
-        break;
+      if (stepAccepted) {  // Return if step accepted
+        x.swap(xCandidates_[c]);
+        u.swap(uCandidates_[c]);
+        metrics.swap(metricsCandidates_[c]);
+
+        // Prepare step info
+        slp::StepInfo stepInfo;
+        stepInfo.stepSize = alphaCandidate;
+        stepInfo.stepType = stepType;
+        stepInfo.dx_norm = alphaCandidate * deltaXnorm;
+        stepInfo.du_norm = alphaCandidate * deltaUnorm;
+        stepInfo.performanceAfterStep = performanceNew;
+        stepInfo.totalConstraintViolationAfterStep = FilterLinesearch::totalConstraintViolation(performanceNew);
+        return stepInfo;
       }
     }
-  } while (alpha >= settings_.alpha_min);
+
+    if (isStepSizeTooSmall && settings_.printLinesearch) {
+      std::cerr << "Exiting linesearch early due to too small primal steps |dx|: " << alpha * deltaXnorm
+                << ", and or |du|: " << alpha * deltaUnorm << " are below deltaTol: " << settings_.deltaTol << "\n";
+    }
+  } while (alpha >= settings_.alpha_min && !isStepSizeTooSmall);
 
   // Alpha_min reached -> Don't take a step
   slp::StepInfo stepInfo;
@@ -0,0 +1,88 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+/**
+ * Times the SLP solver on the ring problem, where the full step is rejected in the first iterations, for different numbers of linesearch
+ * candidates evaluated in parallel per batch.
+ * Usage: benchmark_linesearch_candidates [numRepetitions]
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <ocs2_core/initialization/DefaultInitializer.h>
+#include <ocs2_oc/test/ring_problem.h>
+
+#include "ocs2_slp/SlpSolver.h"
+
+using namespace ocs2;
+
+int main(int argc, char* argv[]) {
+  const size_t numRepetitions = (argc > 1) ? std::stoul(argv[1]) : 5;
+
+  auto problem = createRingProblem();
+  const TargetTrajectories targetTrajectories({0.0}, {vector_t::Zero(2)}, {vector_t::Zero(2)});
+  problem.targetTrajectoriesPtr = &targetTrajectories;
+  const DefaultInitializer zeroInitializer(2);
+  const vector_t initState = (vector_t(2) << 3.0, 0.5).finished();
+
+  std::cout << std::setw(12) << "candidates" << std::setw(14) << "median [ms]" << std::setw(12) << "iterations" << std::setw(16)
+            << "final merit\n";
+  for (const size_t linesearchCandidates : {1, 2, 4, 8}) {
+    slp::Settings settings;
+    settings.dt = 0.01;
+    settings.slpIteration = 20;
+    settings.nThreads = 4;
+    settings.linesearchCandidates = linesearchCandidates;
+    settings.pipgSettings.maxNumIterations = 30000;
+    settings.pipgSettings.absoluteTolerance = 1e-4;
+    settings.pipgSettings.relativeTolerance = 1e-2;
+
+    std::vector<double> timings;
+    std::vector<PerformanceIndex> iterationsLog;
+    for (size_t i = 0; i < numRepetitions; i++) {
+      SlpSolver solver(settings, problem, zeroInitializer);
+      const auto start = std::chrono::steady_clock::now();
+      solver.run(0.0, initState, 1.0);
+      timings.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+      iterationsLog = solver.getIterationsLog();
+    }
+    std::sort(timings.begin(), timings.end());
+
+    std::cout << std::setw(12) << linesearchCandidates << std::setw(14) << std::fixed << std::setprecision(2)
+              << timings[timings.size() / 2] << std::setw(12) << iterationsLog.size() << std::setw(16) << std::scientific
+              << std::setprecision(6) << iterationsLog.back().merit << "\n";
+  }
+
+  return 0;
+}
@@ -29,8 +29,13 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+
 #include <ocs2_core/initialization/DefaultInitializer.h>
 #include <ocs2_oc/synchronized_module/ReferenceManager.h>
+#include <ocs2_oc/test/ring_problem.h>
 #include <ocs2_oc/test/testProblemsGeneration.h>
 
 #include "ocs2_slp/SlpSolver.h"
@@ -40,7 +45,8 @@ namespace {
 
 std::pair<PrimalSolution, std::vector<PerformanceIndex>> solve(const VectorFunctionLinearApproximation& dynamicsMatrices,
                                                                const ScalarFunctionQuadraticApproximation& costMatrices,
-                                                               const ocs2::scalar_t tol) {
+                                                               const ocs2::scalar_t tol, size_t linesearchCandidates = 1,
+                                                               ocs2::scalar_t dtGrowthRate = 0.0, bool quasiNewtonHessian = false) {
   int n = dynamicsMatrices.dfdu.rows();
   int m = dynamicsMatrices.dfdu.cols();
 
@@ -78,12 +84,15 @@ std::pair<PrimalSolution, std::vector<PerformanceIndex>> solve(const VectorFunct
   const auto slpSettings = [&]() {
     ocs2::slp::Settings settings;
     settings.dt = 0.05;
-    settings.slpIteration = 10;
+    settings.dtGrowthRate = dtGrowthRate;
+    settings.quasiNewtonHessian = quasiNewtonHessian;
+    settings.slpIteration = quasiNewtonHessian ? 50 : 10;
     settings.scalingIteration = 3;
     settings.printSolverStatistics = true;
     settings.printSolverStatus = true;
     settings.printLinesearch = true;
     settings.nThreads = 100;
+    settings.linesearchCandidates = linesearchCandidates;
     settings.pipgSettings = getPipgSettings();
     return settings;
   }();
@@ -102,6 +111,58 @@ std::pair<PrimalSolution, std::vector<PerformanceIndex>> solve(const VectorFunct
   return {solver.primalSolution(finalTime), solver.getIterationsLog()};
 }
 
+/** Kinematics with a cubic drag, dx/dt = u - x^3. Its defects do not close after a single SLP iteration. */
+class CubicDragDynamics final : public SystemDynamicsBase {
+ public:
+  CubicDragDynamics* clone() const override { return new CubicDragDynamics(*this); }
+
+  vector_t computeFlowMap(scalar_t t, const vector_t& x, const vector_t& u, const PreComputation&) override {
+    return u - x.array().cube().matrix();
+  }
+
+  VectorFunctionLinearApproximation linearApproximation(scalar_t t, const vector_t& x, const vector_t& u,
+                                                        const PreComputation& preComp) override {
+    VectorFunctionLinearApproximation dynamics;
+    dynamics.f = computeFlowMap(t, x, u, preComp);
+    dynamics.dfdx = (-3.0 * x.array().square()).matrix().asDiagonal();
+    dynamics.dfdu = matrix_t::Identity(u.size(), u.size());
+    return dynamics;
+  }
+};
+
+/** Solves the ring problem. Returns the iterations log and the step sizes accepted by the linesearch, parsed from its printout. */
+std::pair<std::vector<PerformanceIndex>, scalar_array_t> solveRingProblem(size_t linesearchCandidates) {
+  auto problem = createRingProblem();
+  const TargetTrajectories targetTrajectories({0.0}, {vector_t::Zero(2)}, {vector_t::Zero(2)});
+  problem.targetTrajectoriesPtr = &targetTrajectories;
+  const DefaultInitializer zeroInitializer(2);
+
+  slp::Settings settings;
+  settings.dt = 0.01;
+  settings.slpIteration = 20;
+  settings.nThreads = 4;
+  settings.linesearchCandidates = linesearchCandidates;
+  settings.printLinesearch = true;
+  settings.pipgSettings.maxNumIterations = 30000;
+  settings.pipgSettings.absoluteTolerance = 1e-4;
+  settings.pipgSettings.relativeTolerance = 1e-2;
+
+  SlpSolver solver(settings, problem, zeroInitializer);
+  const vector_t initState = (vector_t(2) << 3.0, 0.5).finished();
+  testing::internal::CaptureStderr();
+  solver.run(0.0, initState, 1.0);
+  std::istringstream output(testing::internal::GetCapturedStderr());
+
+  scalar_array_t acceptedStepSizes;
+  const std::string stepSizeKey = "Step size: ";
+  for (std::string line; std::getline(output, line);) {
+    if (line.compare(0, stepSizeKey.size(), stepSizeKey) == 0 && line.find("(Accepted)") != std::string::npos) {
+      acceptedStepSizes.push_back(std::stod(line.substr(stepSizeKey.size())));
+    }
+  }
+  return {solver.getIterationsLog(), acceptedStepSizes};
+}
+
 }  // namespace
 }  // namespace ocs2
 
@@ -121,3 +182,114 @@ TEST(testSlpSolver, test_unconstrained) {
   ASSERT_LE(result.second.size(), 2);
   ASSERT_LT(result.second.back().dynamicsViolationSSE, tol);
 }
+
+TEST(testSlpSolver, test_linesearchCandidates) {
+  int n = 3;
+  int m = 2;
+  const double tol = 1e-9;
+  const auto dynamics = ocs2::getRandomDynamics(n, m);
+  const auto costs = ocs2::getRandomCost(n, m);
+  const auto result = ocs2::solve(dynamics, costs, tol);
+  const auto resultWithCandidates = ocs2::solve(dynamics, costs, tol, 3);
+
+  // Evaluating several step sizes at once does not change the accepted steps
+  ASSERT_EQ(result.second.size(), resultWithCandidates.second.size());
+  for (size_t i = 0; i < result.second.size(); i++) {
+    EXPECT_NEAR(result.second[i].merit, resultWithCandidates.second[i].merit, tol);
+  }
+  for (size_t i = 0; i < result.first.stateTrajectory_.size(); i++) {
+    EXPECT_TRUE(result.first.stateTrajectory_[i].isApprox(resultWithCandidates.first.stateTrajectory_[i]));
+  }
+}
+
+TEST(testSlpSolver, test_nonUniformDiscretization) {
+  int n = 3;
+  int m = 2;
+  const double tol = 1e-9;
+  const auto dynamics = ocs2::getRandomDynamics(n, m);
+  const auto costs = ocs2::getRandomCost(n, m);
+  const auto result = ocs2::solve(dynamics, costs, tol);
+  const auto resultNonUniform = ocs2::solve(dynamics, costs, tol, 1, 0.5);
+
+  // Growing steps need fewer nodes, and the linear dynamics are still satisfied after the step
+  ASSERT_LT(resultNonUniform.first.timeTrajectory_.size(), result.first.timeTrajectory_.size());
+  ASSERT_DOUBLE_EQ(resultNonUniform.first.timeTrajectory_[1] - resultNonUniform.first.timeTrajectory_[0], 0.05);
+  ASSERT_LT(resultNonUniform.second.back().dynamicsViolationSSE, tol);
+}
+
+TEST(testSlpSolver, test_quasiNewtonHessian) {
+  int n = 3;
+  int m = 2;
+  const double tol = 1e-9;
+  const auto dynamics = ocs2::getRandomDynamics(n, m);
+  const auto costs = ocs2::getRandomCost(n, m);
+  const auto result = ocs2::solve(dynamics, costs, tol);
+  const auto resultQuasiNewton = ocs2::solve(dynamics, costs, tol, 1, 0.0, true);
+
+  // Starting from the identity, the approximation needs more iterations but reaches the same solution
+  ASSERT_GT(resultQuasiNewton.second.size(), result.second.size());
+  ASSERT_LT(resultQuasiNewton.second.back().dynamicsViolationSSE, tol);
+  EXPECT_NEAR(resultQuasiNewton.second.back().cost, result.second.back().cost, 1e-3 * std::abs(result.second.back().cost));
+}
+
+TEST(testSlpSolver, test_linesearchCandidatesRejectedFullStep) {
+  const auto serial = ocs2::solveRingProblem(1);
+  const auto batched = ocs2::solveRingProblem(4);
+
+  // The full step is rejected, such that a smaller candidate of a batch has to win
+  const auto& stepSizes = serial.second;
+  ASSERT_FALSE(stepSizes.empty());
+  ASSERT_TRUE(std::any_of(stepSizes.begin(), stepSizes.end(), [](ocs2::scalar_t alpha) { return alpha < 1.0; }));
+
+  // The largest accepted candidate of each batch is the step of the serial backtracking
+  ASSERT_EQ(batched.second.size(), stepSizes.size());
+  for (size_t i = 0; i < stepSizes.size(); i++) {
+    EXPECT_DOUBLE_EQ(batched.second[i], stepSizes[i]) << "iteration: " << i;
+  }
+  ASSERT_EQ(batched.first.size(), serial.first.size());
+  for (size_t i = 0; i < serial.first.size(); i++) {
+    EXPECT_NEAR(batched.first[i].merit, serial.first[i].merit, 1e-9);
+  }
+}
+
+TEST(testSlpSolver, test_refinement) {
+  auto problem = ocs2::createRingProblem();
+  problem.dynamicsPtr.reset(new ocs2::CubicDragDynamics);
+  const ocs2::TargetTrajectories targetTrajectories({0.0}, {ocs2::vector_t::Zero(2)}, {ocs2::vector_t::Zero(2)});
+  problem.targetTrajectoriesPtr = &targetTrajectories;
+  const ocs2::DefaultInitializer zeroInitializer(2);
+
+  ocs2::slp::Settings settings;
+  settings.dt = 0.05;
+  settings.slpIteration = 1;
+  settings.refinementTolerance = 0.15;  // between the smallest and the largest defect after one iteration
+  settings.pipgSettings.maxNumIterations = 30000;
+  settings.pipgSettings.absoluteTolerance = 1e-4;
+  settings.pipgSettings.relativeTolerance = 1e-2;
+
+  ocs2::SlpSolver solver(settings, problem, zeroInitializer);
+  const ocs2::vector_t initState = (ocs2::vector_t(2) << 1.5, 0.5).finished();
+  solver.run(0.0, initState, 1.0);
+  const auto time = solver.primalSolution(1.0).timeTrajectory_;
+
+  // Midpoints of the intervals whose defect exceeds the tolerance
+  const auto& intermediates = solver.getSolutionMetrics().intermediates;
+  ASSERT_EQ(intermediates.size(), time.size() - 1);
+  ocs2::scalar_array_t refinementTimes;
+  for (size_t i = 0; i + 1 < time.size(); i++) {
+    if (intermediates[i].dynamicsViolation.norm() > settings.refinementTolerance) {
+      refinementTimes.push_back(0.5 * (time[i] + time[i + 1]));
+    }
+  }
+  ASSERT_FALSE(refinementTimes.empty());
+  ASSERT_LT(refinementTimes.size(), time.size() - 1);
+
+  // The next solve bisects exactly these intervals
+  solver.run(0.0, initState, 1.0);
+  const auto refinedTime = solver.primalSolution(1.0).timeTrajectory_;
+  ASSERT_EQ(refinedTime.size(), time.size() + refinementTimes.size());
+  for (const auto refinementTime : refinementTimes) {
+    EXPECT_TRUE(std::any_of(refinedTime.begin(), refinedTime.end(), [&](ocs2::scalar_t t) { return std::abs(t - refinementTime) < 1e-9; }))
+        << "refinement time: " << refinementTime;
+  }
+}
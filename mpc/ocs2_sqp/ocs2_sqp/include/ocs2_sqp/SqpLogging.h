@@ -29,7 +29,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #pragma once
 
+#include <array>
 #include <string>
+#include <vector>
 
 #include <ocs2_core/Types.h>
 
@@ -51,6 +53,9 @@ namespace ocs2::sqp {
         scalar_t solveQpTime = 0.0;
         scalar_t linesearchTime = 0.0;
 
+        // Fraction of the nodes whose LQ approximation is reused from the previous iteration
+        scalar_t lqReuseFraction = 0.0;
+
         // Line search
         PerformanceIndex baselinePerformanceIndex; // before taking the step
         scalar_t totalConstraintViolationBaseline; // constraint metric used in the line search
@@ -64,6 +69,15 @@ namespace ocs2::sqp {
 
     std::string logHeader();
 
+    /** Number of columns of a log entry streamed as telemetry row. */
+    constexpr size_t numLogColumns = 20;
+
+    /** Names of the telemetry columns, the same as in logHeader(). */
+    std::vector<std::string> logColumnNames();
+
+    /** Converts a log entry into a telemetry row. The step type and the convergence are stored as the value of their enum. */
+    std::array<scalar_t, numLogColumns> toLogRow(const LogEntry &logEntry);
+
     template<typename T>
     class Logger {
     public:
@@ -31,6 +31,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <ocs2_core/Types.h>
 #include <ocs2_core/integration/SensitivityIntegrator.h>
+#include <ocs2_core/thread_support/ThreadPlacement.h>
 
 #include <hpipm_colcon/HpipmInterfaceSettings.h>
 
@@ -45,6 +46,9 @@ namespace ocs2::sqp {
         // Linesearch - step size rules
         scalar_t alpha_decay = 0.5; // multiply the step size by this factor every time a linesearch step is rejected.
         scalar_t alpha_min = 1e-4; // terminate linesearch if the attempted step size is below this threshold
+        size_t linesearchCandidates = 1;
+        // number of step sizes of the backtracking sequence that are evaluated concurrently. Values above 1 speculatively
+        // evaluate smaller steps together with the larger ones, which pays off when the full step is often rejected.
 
         // Linesearch - step acceptance criteria with c = costs, g = the norm of constraint violation, and w = [x; u]
         scalar_t g_max = 1e6; // (1): IF g{i+1} > g_max REQUIRE g{i+1} < (1-gamma_c) * g{i}
@@ -62,6 +66,10 @@ namespace ocs2::sqp {
 
         // Discretization method
         scalar_t dt = 0.01; // user-defined time discretization
+        scalar_t dtGrowthRate = 0.0; // growth of the time step per second along the horizon, zero for a uniform discretization
+        scalar_t dtMax = 0.0; // maximum time step of the non-uniform discretization, non-positive for no limit
+        scalar_t refinementTolerance = 0.0; // intervals whose dynamics violation exceeds it are bisected in the next call, non-positive to disable
+        scalar_t shiftTolerance = 1e-6; // [s] the previous solution is shifted instead of interpolated if its nodes match the new ones up to it, negative to disable
         SensitivityIntegratorType integratorType = SensitivityIntegratorType::RK2;
 
         // Inequality penalty relaxed barrier parameters
@@ -72,6 +80,13 @@ namespace ocs2::sqp {
         // Use a projection method to resolve the state-input constraint Cx+Du+e
         bool extractProjectionMultiplier = false;
         // Extract the Lagrange multiplier of the projected state-input constraint Cx+Du+e
+        scalar_t lqReuseTolerance = 0.0;
+        // Nodes whose state and input moved less than this value (infinity norm) since their last LQ approximation keep it in the
+        // next iteration instead of being relinearized. Non-positive to disable.
+        bool quasiNewtonHessian = false;
+        // Replace the cost Hessian of each node by a damped BFGS approximation built from the cost gradients, which allows the cost to be
+        // generated with first-order derivatives only.
+        scalar_t quasiNewtonInitialScaling = 1.0; // scaling of the identity the approximation starts from
 
         // Printing
         bool printSolverStatus = false; // Print HPIPM status after solving the QP subproblem
@@ -82,10 +97,13 @@ namespace ocs2::sqp {
         bool enableLogging = true;
         size_t logSize = 1000; // the of the last N iterations will be stored
         std::string logFilePath = "/tmp/ocs2/sqp_log/"; // Folder the log will be written to
+        // Stream all iterations to a binary telemetry file in the background instead of keeping the last logSize iterations in memory
+        bool streamLog = false;
 
         // Threading
         size_t nThreads = 4;
-        int threadPriority = 50;
+        // Placement of the worker threads, the priority is loaded from threadPriority and can be overwritten in threadPlacement
+        ThreadPlacement threadPlacement = {ThreadPlacement::SchedulingPolicy::FIFO, 50};
     };
 
     /**
@@ -32,9 +32,11 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ocs2_core/initialization/Initializer.h>
 #include <ocs2_core/integration/SensitivityIntegrator.h>
 #include <ocs2_core/misc/Benchmark.h>
+#include <ocs2_core/misc/TelemetryLogger.h>
 #include <ocs2_core/thread_support/ThreadPool.h>
 
 #include <ocs2_oc/multiple_shooting/ProjectionMultiplierCoefficients.h>
+#include <ocs2_oc/multiple_shooting/QuasiNewtonHessian.h>
 #include <ocs2_oc/oc_data/TimeDiscretization.h>
 #include <ocs2_oc/oc_problem/OptimalControlProblem.h>
 #include <ocs2_oc/oc_solver/SolverBase.h>
@@ -79,6 +81,9 @@ namespace ocs2 {
 
         const std::vector<PerformanceIndex> &getIterationsLog() const override;
 
+        /** Gets the number of nodes whose LQ approximation was reused in the last run, summed over its iterations. */
+        size_t getNumReusedNodes() const { return numReusedNodes_; }
+
         ScalarFunctionQuadraticApproximation getValueFunction(scalar_t time, const vector_t &state) const override;
 
         ScalarFunctionQuadraticApproximation
@@ -123,15 +128,28 @@ namespace ocs2 {
         /** Get profiling information as a string */
         std::string getBenchmarkingInformation() const;
 
-        /** Creates QP around t, x(t), u(t). Returns performance metrics at the current {t, x(t), u(t)} */
-        PerformanceIndex setupQuadraticSubproblem(const std::vector<AnnotatedTime> &time, const vector_t &initState,
-                                                  const vector_array_t &x,
-                                                  const vector_array_t &u, std::vector<Metrics> &metrics);
+        /**
+         * Creates QP around t, x(t), u(t). Returns performance metrics at the current {t, x(t), u(t)}.
+         * If reuseUnchangedNodes is set, the nodes whose state and input moved less than settings.lqReuseTolerance since their last
+         * approximation keep it. This requires that the approximation of all nodes was created on the same time discretization and that
+         * metrics already holds the metrics at {t, x(t), u(t)}, as left by the linesearch.
+         *
+         * @return The performance metrics and the number of nodes whose approximation is reused.
+         */
+        std::pair<PerformanceIndex, size_t> setupQuadraticSubproblem(const std::vector<AnnotatedTime> &time,
+                                                                     const vector_t &initState, const vector_array_t &x,
+                                                                     const vector_array_t &u, std::vector<Metrics> &metrics,
+                                                                     bool reuseUnchangedNodes);
 
-        /** Computes only the performance metrics at the current {t, x(t), u(t)} */
-        PerformanceIndex computePerformance(const std::vector<AnnotatedTime> &time, const vector_t &initState,
-                                            const vector_array_t &x,
-                                            const vector_array_t &u, std::vector<Metrics> &metrics);
+        /**
+         * Computes only the performance metrics at the first numCandidates linesearch candidates {t, x_c(t), u_c(t)}.
+         * The nodes of all candidates are distributed over the threads together.
+         */
+        std::vector<PerformanceIndex> computePerformance(const std::vector<AnnotatedTime> &time,
+                                                         const vector_t &initState, size_t numCandidates,
+                                                         const std::vector<vector_array_t> &x,
+                                                         const std::vector<vector_array_t> &u,
+                                                         std::vector<std::vector<Metrics> > &metrics);
 
         /** Returns solution of the QP subproblem in delta coordinates: */
         struct OcpSubproblemSolution {
@@ -174,6 +192,9 @@ namespace ocs2 {
 
         // Solution
         PrimalSolution primalSolution_;
+        // State and input vectors of an earlier solution, reused for the initialization of the next one
+        vector_array_t stateTrajectoryBuffer_;
+        vector_array_t inputTrajectoryBuffer_;
 
         // Value function in absolute state coordinates (without the constant value)
         std::vector<ScalarFunctionQuadraticApproximation> valueFunction_;
@@ -189,16 +210,37 @@ namespace ocs2 {
         // Lagrange multipliers
         std::vector<multiple_shooting::ProjectionMultiplierCoefficients> projectionMultiplierCoefficients_;
 
+        // Points at which the LQ approximation of each node was created: x(t_i), x(t_{i+1}) and u(t_i)
+        vector_array_t lqState_;
+        vector_array_t lqNextState_;
+        vector_array_t lqInput_;
+
+        // Quasi-Newton approximation of the cost Hessian of each node, used if settings.quasiNewtonHessian is set
+        multiple_shooting::QuasiNewtonHessian quasiNewtonHessian_;
+
         // Iteration performance log
         std::vector<PerformanceIndex> performanceIndeces_;
 
         // The ProblemMetrics associated to primalSolution_
         ProblemMetrics problemMetrics_;
 
+        // Metrics of the current iterate, kept to reuse their memory
+        std::vector<Metrics> metrics_;
+
+        // Times of the intervals of the previous solution with a large dynamics violation, refined in the next discretization
+        scalar_array_t refinementTimes_;
+
+        // Linesearch candidates, kept to reuse their memory
+        std::vector<vector_array_t> xCandidates_;
+        std::vector<vector_array_t> uCandidates_;
+        std::vector<std::vector<Metrics> > metricsCandidates_;
+
         // Benchmarking
         size_t numProblems_{0};
         size_t totalNumIterations_{0};
+        size_t numReusedNodes_{0};
         sqp::Logger<sqp::LogEntry> logger_;
+        std::unique_ptr<TelemetryLogger> telemetryLoggerPtr_; // only if the log is streamed
         benchmark::RepeatedTimer initializationTimer_;
         benchmark::RepeatedTimer linearQuadraticApproximationTimer_;
         benchmark::RepeatedTimer solveQpTimer_;
@@ -30,6 +30,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "ocs2_sqp/SqpLogging.h"
 
 #include <iomanip>
+#include <sstream>
 
 
 namespace ocs2::sqp {
@@ -44,6 +45,7 @@ namespace ocs2::sqp {
                 << logEntry.linearQuadraticApproximationTime << delim
                 << logEntry.solveQpTime << delim
                 << logEntry.linesearchTime << delim
+                << logEntry.lqReuseFraction << delim
                 << logEntry.baselinePerformanceIndex.merit << delim
                 << logEntry.baselinePerformanceIndex.dynamicsViolationSSE << delim
                 << logEntry.baselinePerformanceIndex.equalityConstraintsSSE << delim
@@ -65,27 +67,60 @@ namespace ocs2::sqp {
         const std::string delim = ", ";
         const std::string lineEnd = "\n";
         std::stringstream stream;
-        // clang-format off
-        stream << "problemNumber" << delim
-                << "time" << delim
-                << "iteration" << delim
-                << "linearQuadraticApproximationTime" << delim
-                << "solveQpTime" << delim
-                << "linesearchTime" << delim
-                << "baselinePerformanceIndex/merit" << delim
-                << "baselinePerformanceIndex/dynamicsViolationSSE" << delim
-                << "baselinePerformanceIndex/equalityConstraintsSSE" << delim
-                << "totalConstraintViolationBaseline" << delim
-                << "stepSize" << delim
-                << "stepType" << delim
-                << "dxNorm" << delim
-                << "duNorm" << delim
-                << "performanceAfterStep/merit" << delim
-                << "performanceAfterStep/dynamicsViolationSSE" << delim
-                << "performanceAfterStep/equalityConstraintsSSE" << delim
-                << "totalConstraintViolationAfterStep" << delim
-                << "convergence" << lineEnd;
-        // clang-format on
+        const auto columnNames = logColumnNames();
+        for (size_t i = 0; i < columnNames.size(); ++i) {
+            stream << columnNames[i] << (i + 1 < columnNames.size() ? delim : lineEnd);
+        }
         return stream.str();
     }
+
+    std::vector<std::string> logColumnNames() {
+        return {
+            "problemNumber",
+            "time",
+            "iteration",
+            "linearQuadraticApproximationTime",
+            "solveQpTime",
+            "linesearchTime",
+            "lqReuseFraction",
+            "baselinePerformanceIndex/merit",
+            "baselinePerformanceIndex/dynamicsViolationSSE",
+            "baselinePerformanceIndex/equalityConstraintsSSE",
+            "totalConstraintViolationBaseline",
+            "stepSize",
+            "stepType",
+            "dxNorm",
+            "duNorm",
+            "performanceAfterStep/merit",
+            "performanceAfterStep/dynamicsViolationSSE",
+            "performanceAfterStep/equalityConstraintsSSE",
+            "totalConstraintViolationAfterStep",
+            "convergence"
+        };
+    }
+
+    std::array<scalar_t, numLogColumns> toLogRow(const LogEntry &logEntry) {
+        return {
+            static_cast<scalar_t>(logEntry.problemNumber),
+            logEntry.time,
+            static_cast<scalar_t>(logEntry.iteration),
+            logEntry.linearQuadraticApproximationTime,
+            logEntry.solveQpTime,
+            logEntry.linesearchTime,
+            logEntry.lqReuseFraction,
+            logEntry.baselinePerformanceIndex.merit,
+            logEntry.baselinePerformanceIndex.dynamicsViolationSSE,
+            logEntry.baselinePerformanceIndex.equalityConstraintsSSE,
+            logEntry.totalConstraintViolationBaseline,
+            logEntry.stepInfo.stepSize,
+            static_cast<scalar_t>(logEntry.stepInfo.stepType),
+            logEntry.stepInfo.dx_norm,
+            logEntry.stepInfo.du_norm,
+            logEntry.stepInfo.performanceAfterStep.merit,
+            logEntry.stepInfo.performanceAfterStep.dynamicsViolationSSE,
+            logEntry.stepInfo.performanceAfterStep.equalityConstraintsSSE,
+            logEntry.stepInfo.totalConstraintViolationAfterStep,
+            static_cast<scalar_t>(logEntry.convergence)
+        };
+    }
 } // namespace ocs2::sqp
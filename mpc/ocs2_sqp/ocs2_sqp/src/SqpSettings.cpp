@@ -37,8 +37,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 namespace ocs2::sqp {
     Settings loadSettings(const std::string &filename, const std::string &fieldName, bool verbose) {
-        boost::property_tree::ptree pt;
-        read_info(filename, pt);
+        const auto ptPtr = loadData::readInfoFile(filename);
+        const auto &pt = *ptPtr;
 
         Settings settings;
 
@@ -51,12 +51,17 @@ namespace ocs2::sqp {
         loadData::loadPtreeValue(pt, settings.deltaTol, fieldName + ".deltaTol", verbose);
         loadData::loadPtreeValue(pt, settings.alpha_decay, fieldName + ".alpha_decay", verbose);
         loadData::loadPtreeValue(pt, settings.alpha_min, fieldName + ".alpha_min", verbose);
+        loadData::loadPtreeValue(pt, settings.linesearchCandidates, fieldName + ".linesearchCandidates", verbose);
         loadData::loadPtreeValue(pt, settings.gamma_c, fieldName + ".gamma_c", verbose);
         loadData::loadPtreeValue(pt, settings.g_max, fieldName + ".g_max", verbose);
         loadData::loadPtreeValue(pt, settings.g_min, fieldName + ".g_min", verbose);
         loadData::loadPtreeValue(pt, settings.armijoFactor, fieldName + ".armijoFactor", verbose);
         loadData::loadPtreeValue(pt, settings.costTol, fieldName + ".costTol", verbose);
         loadData::loadPtreeValue(pt, settings.dt, fieldName + ".dt", verbose);
+        loadData::loadPtreeValue(pt, settings.dtGrowthRate, fieldName + ".dtGrowthRate", verbose);
+        loadData::loadPtreeValue(pt, settings.dtMax, fieldName + ".dtMax", verbose);
+        loadData::loadPtreeValue(pt, settings.refinementTolerance, fieldName + ".refinementTolerance", verbose);
+        loadData::loadPtreeValue(pt, settings.shiftTolerance, fieldName + ".shiftTolerance", verbose);
         loadData::loadPtreeValue(pt, settings.useFeedbackPolicy, fieldName + ".useFeedbackPolicy", verbose);
         loadData::loadPtreeValue(pt, settings.createValueFunction, fieldName + ".createValueFunction", verbose);
         auto integratorName = sensitivity_integrator::toString(settings.integratorType);
@@ -69,14 +74,19 @@ namespace ocs2::sqp {
                                  fieldName + ".projectStateInputEqualityConstraints", verbose);
         loadData::loadPtreeValue(pt, settings.extractProjectionMultiplier, fieldName + ".extractProjectionMultiplier",
                                  verbose);
+        loadData::loadPtreeValue(pt, settings.lqReuseTolerance, fieldName + ".lqReuseTolerance", verbose);
+        loadData::loadPtreeValue(pt, settings.quasiNewtonHessian, fieldName + ".quasiNewtonHessian", verbose);
+        loadData::loadPtreeValue(pt, settings.quasiNewtonInitialScaling, fieldName + ".quasiNewtonInitialScaling", verbose);
         loadData::loadPtreeValue(pt, settings.printSolverStatus, fieldName + ".printSolverStatus", verbose);
         loadData::loadPtreeValue(pt, settings.printSolverStatistics, fieldName + ".printSolverStatistics", verbose);
         loadData::loadPtreeValue(pt, settings.printLinesearch, fieldName + ".printLinesearch", verbose);
         loadData::loadPtreeValue(pt, settings.enableLogging, fieldName + ".enableLogging", verbose);
         loadData::loadPtreeValue(pt, settings.logSize, fieldName + ".logSize", verbose);
         loadData::loadPtreeValue(pt, settings.logFilePath, fieldName + ".logFilePath", verbose);
+        loadData::loadPtreeValue(pt, settings.streamLog, fieldName + ".streamLog", verbose);
         loadData::loadPtreeValue(pt, settings.nThreads, fieldName + ".nThreads", verbose);
-        loadData::loadPtreeValue(pt, settings.threadPriority, fieldName + ".threadPriority", verbose);
+        loadData::loadPtreeValue(pt, settings.threadPlacement.priority, fieldName + ".threadPriority", verbose);
+        loadThreadPlacement(pt, fieldName + ".threadPlacement", settings.threadPlacement, verbose);
 
         if (verbose) {
             std::cerr << settings.hpipmSettings;
@@ -50,19 +50,45 @@ namespace ocs2 {
             if (ocp.equalityConstraintPtr->empty()) {
                 settings.projectStateInputEqualityConstraints = false;
             }
+            // At least one linesearch candidate is needed to take a step.
+            settings.linesearchCandidates = std::max(settings.linesearchCandidates, static_cast<size_t>(1));
             return settings;
         }
+
+        /** Checks whether v differs from vRef by at most tolerance in the infinity norm. */
+        bool isUnchanged(const vector_t &v, const vector_t &vRef, scalar_t tolerance) {
+            if (v.size() != vRef.size()) {
+                return false;
+            }
+            return v.size() == 0 || (v - vRef).lpNorm<Eigen::Infinity>() <= tolerance;
+        }
+
+        /** Path of a new log file in the log folder, named after the current time. The folder is created if needed. */
+        std::string getLogFileName(const std::string &logFilePath, const std::string &extension) {
+            // Create the folder
+            boost::filesystem::create_directories(logFilePath);
+
+            // Get current time
+            const auto t = std::chrono::high_resolution_clock::to_time_t(std::chrono::high_resolution_clock::now());
+            std::string timeStamp = std::ctime(&t);
+            std::replace(timeStamp.begin(), timeStamp.end(), ' ', '_');
+            timeStamp.erase(std::remove(timeStamp.begin(), timeStamp.end(), '\n'), timeStamp.end());
+
+            return logFilePath + "log_" + timeStamp + extension;
+        }
     } // anonymous namespace
 
     SqpSolver::SqpSolver(sqp::Settings settings, const OptimalControlProblem &optimalControlProblem,
                          const Initializer &initializer)
         : settings_(rectifySettings(optimalControlProblem, std::move(settings))),
           hpipmInterface_(OcpSize(), settings_.hpipmSettings),
-          threadPool_(std::max(settings_.nThreads, static_cast<size_t>(1)) - 1, settings_.threadPriority),
+          threadPool_(std::max(settings_.nThreads, static_cast<size_t>(1)) - 1, settings_.threadPlacement),
           logger_(settings_.logSize) {
         Eigen::setNbThreads(1); // No multithreading within Eigen.
         Eigen::initParallel();
 
+        quasiNewtonHessian_ = multiple_shooting::QuasiNewtonHessian(settings_.quasiNewtonInitialScaling);
+
         // Dynamics discretization
         discretizer_ = selectDynamicsDiscretization(settings_.integratorType);
         sensitivityDiscretizer_ = selectDynamicsSensitivityDiscretization(settings_.integratorType);
@@ -80,6 +106,11 @@ namespace ocs2 {
         filterLinesearch_.g_min = settings_.g_min;
         filterLinesearch_.gamma_c = settings_.gamma_c;
         filterLinesearch_.armijoFactor = settings_.armijoFactor;
+
+        // Logging
+        if (settings_.enableLogging && settings_.streamLog) {
+            telemetryLoggerPtr_.reset(new TelemetryLogger(getLogFileName(settings_.logFilePath, ".bin"), sqp::logColumnNames()));
+        }
     }
 
     SqpSolver::~SqpSolver() {
@@ -87,18 +118,13 @@ namespace ocs2 {
             std::cerr << getBenchmarkingInformation() << std::endl;
         }
 
-        if (settings_.enableLogging) {
-            // Create the folder
-            boost::filesystem::create_directories(settings_.logFilePath);
-
-            // Get current time
-            const auto t = std::chrono::high_resolution_clock::to_time_t(std::chrono::high_resolution_clock::now());
-            std::string timeStamp = std::ctime(&t);
-            std::replace(timeStamp.begin(), timeStamp.end(), ' ', '_');
-            timeStamp.erase(std::remove(timeStamp.begin(), timeStamp.end(), '\n'), timeStamp.end());
-
+        if (telemetryLoggerPtr_ != nullptr) {
+            const std::string logFileName = telemetryLoggerPtr_->getFileName();
+            telemetryLoggerPtr_.reset(); // writes the remaining iterations
+            std::cerr << "[SqpSolver] Log written to '" << logFileName << "'\n";
+        } else if (settings_.enableLogging) {
             // Write to file
-            const std::string logFileName = settings_.logFilePath + "log_" + timeStamp + ".txt";
+            const std::string logFileName = getLogFileName(settings_.logFilePath, ".txt");
             if (std::ofstream logfile{logFileName}) {
                 logfile << sqp::logHeader();
                 logger_.write(logfile);
@@ -114,10 +140,13 @@ namespace ocs2 {
         primalSolution_ = PrimalSolution();
         valueFunction_.clear();
         performanceIndeces_.clear();
+        refinementTimes_.clear();
+        quasiNewtonHessian_.reset();
 
         // reset timers
         numProblems_ = 0;
         totalNumIterations_ = 0;
+        numReusedNodes_ = 0;
         logger_ = sqp::Logger<sqp::LogEntry>(settings_.logSize);
         linearQuadraticApproximationTimer_.reset();
         solveQpTimer_.reset();
@@ -196,7 +225,11 @@ namespace ocs2 {
 
         // Determine time discretization, taking into account event times.
         const auto &eventTimes = this->getReferenceManager().getModeSchedule().eventTimes;
-        const auto timeDiscretization = timeDiscretizationWithEvents(initTime, finalTime, settings_.dt, eventTimes);
+        const auto timeDiscretization = timeDiscretizationWithEvents(initTime, finalTime, settings_.dt, settings_.dtGrowthRate,
+                                                                     settings_.dtMax, eventTimes, refinementTimes_);
+        if (settings_.quasiNewtonHessian) {
+            quasiNewtonHessian_.setTimeDiscretization(timeDiscretization);
+        }
 
         // Initialize references
         for (auto &ocpDefinition: ocpDefinitions_) {
@@ -204,20 +237,26 @@ namespace ocs2 {
             ocpDefinition.targetTrajectoriesPtr = &targetTrajectories;
         }
 
-        // Trajectory spread of primalSolution_
-        if (!primalSolution_.timeTrajectory_.empty()) {
-            std::ignore = trajectorySpread(primalSolution_.modeSchedule_, this->getReferenceManager().getModeSchedule(),
-                                           primalSolution_);
-        }
-
-        // Initialize the state and input
+        // Initialize the state and input, shifting the previous solution if the discretization is a shift of its discretization. The
+        // vectors of the solution before the previous one are reused, the previous solution is kept until the new one is written.
         vector_array_t x, u;
-        multiple_shooting::initializeStateInputTrajectories(initState, timeDiscretization, primalSolution_,
-                                                            *initializerPtr_, x, u);
+        x.swap(stateTrajectoryBuffer_);
+        u.swap(inputTrajectoryBuffer_);
+        if (!multiple_shooting::shiftStateInputTrajectories(timeDiscretization, settings_.shiftTolerance, primalSolution_,
+                                                            *initializerPtr_, x, u)) {
+            // Trajectory spread of primalSolution_
+            if (!primalSolution_.timeTrajectory_.empty()) {
+                std::ignore = trajectorySpread(primalSolution_.modeSchedule_, this->getReferenceManager().getModeSchedule(),
+                                               primalSolution_);
+            }
+            multiple_shooting::initializeStateInputTrajectories(initState, timeDiscretization, primalSolution_,
+                                                                *initializerPtr_, x, u);
+        }
 
         // Bookkeeping
         performanceIndeces_.clear();
-        std::vector<Metrics> metrics;
+        numReusedNodes_ = 0;
+        auto& metrics = metrics_;  // member to reuse the memory between iterations and calls
 
         int iter = 0;
         sqp::Convergence convergence = sqp::Convergence::FALSE;
@@ -227,8 +266,11 @@ namespace ocs2 {
             }
             // Make QP approximation
             linearQuadraticApproximationTimer_.startTimer();
-            const auto baselinePerformance = setupQuadraticSubproblem(timeDiscretization, initState, x, u, metrics);
+            const bool reuseUnchangedNodes = settings_.lqReuseTolerance > 0.0 && iter > 0;
+            const auto [baselinePerformance, numReusedNodes] =
+                    setupQuadraticSubproblem(timeDiscretization, initState, x, u, metrics, reuseUnchangedNodes);
             linearQuadraticApproximationTimer_.endTimer();
+            numReusedNodes_ += numReusedNodes;
 
             // Solve QP
             solveQpTimer_.startTimer();
@@ -257,12 +299,18 @@ namespace ocs2 {
                         getLastIntervalInMilliseconds();
                 logEntry.solveQpTime = solveQpTimer_.getLastIntervalInMilliseconds();
                 logEntry.linesearchTime = linesearchTimer_.getLastIntervalInMilliseconds();
+                logEntry.lqReuseFraction = static_cast<scalar_t>(numReusedNodes) / timeDiscretization.size();
                 logEntry.baselinePerformanceIndex = baselinePerformance;
                 logEntry.totalConstraintViolationBaseline = FilterLinesearch::totalConstraintViolation(
                     baselinePerformance);
                 logEntry.stepInfo = stepInfo;
                 logEntry.convergence = convergence;
-                logger_.advance();
+                if (telemetryLoggerPtr_ != nullptr) {
+                    const auto logRow = sqp::toLogRow(logEntry);
+                    telemetryLoggerPtr_->append(logRow.data());
+                } else {
+                    logger_.advance();
+                }
             }
 
             // Next iteration
@@ -273,8 +321,15 @@ namespace ocs2 {
         ++numProblems_;
 
         computeControllerTimer_.startTimer();
-        primalSolution_ = toPrimalSolution(timeDiscretization, std::move(x), std::move(u));
-        problemMetrics_ = multiple_shooting::toProblemMetrics(timeDiscretization, std::move(metrics));
+        auto primalSolution = toPrimalSolution(timeDiscretization, std::move(x), std::move(u));
+        stateTrajectoryBuffer_.swap(primalSolution_.stateTrajectory_);
+        inputTrajectoryBuffer_.swap(primalSolution_.inputTrajectory_);
+        primalSolution_ = std::move(primalSolution);
+        // before toProblemMetrics() swaps the metrics into problemMetrics_
+        if (settings_.refinementTolerance > 0.0) {
+            refinementTimes_ = getRefinementTimes(timeDiscretization, metrics, settings_.refinementTolerance);
+        }
+        multiple_shooting::toProblemMetrics(timeDiscretization, metrics, problemMetrics_);
         computeControllerTimer_.endTimer();
 
         if (settings_.printSolverStatus || settings_.printLinesearch) {
@@ -349,10 +404,12 @@ namespace ocs2 {
         }
     }
 
-    PerformanceIndex SqpSolver::setupQuadraticSubproblem(const std::vector<AnnotatedTime> &time,
-                                                         const vector_t &initState,
-                                                         const vector_array_t &x, const vector_array_t &u,
-                                                         std::vector<Metrics> &metrics) {
+    std::pair<PerformanceIndex, size_t> SqpSolver::setupQuadraticSubproblem(const std::vector<AnnotatedTime> &time,
+                                                                            const vector_t &initState,
+                                                                            const vector_array_t &x,
+                                                                            const vector_array_t &u,
+                                                                            std::vector<Metrics> &metrics,
+                                                                            bool reuseUnchangedNodes) {
         // Problem horizon
         const int N = static_cast<int>(time.size()) - 1;
 
@@ -365,8 +422,19 @@ namespace ocs2 {
         constraintsProjection_.resize(N);
         projectionMultiplierCoefficients_.resize(N);
         metrics.resize(N + 1);
+        lqState_.resize(N + 1);
+        lqNextState_.resize(N);
+        lqInput_.resize(N);
+
+        // The first node also accounts for the initial state, it is always recomputed
+        const scalar_t tolerance = settings_.lqReuseTolerance;
+        const auto isNodeUnchanged = [&](int i) {
+            return reuseUnchangedNodes && i > 0 && isUnchanged(x[i], lqState_[i], tolerance) &&
+                   (i == N || (isUnchanged(x[i + 1], lqNextState_[i], tolerance) && isUnchanged(u[i], lqInput_[i], tolerance)));
+        };
 
         std::atomic_int timeIndex{0};
+        std::atomic_size_t numReusedNodes{0};
         auto parallelTask = [&](int workerId) {
             // Get worker specific resources
             OptimalControlProblem &ocpDefinition = ocpDefinitions_[workerId];
@@ -374,10 +442,21 @@ namespace ocs2 {
 
             int i = timeIndex++;
             while (i < N) {
-                if (time[i].event == AnnotatedTime::Event::PreEvent) {
+                if (isNodeUnchanged(i)) {
+                    // Keep the approximation, the metrics at this point are already computed by the linesearch
+                    if (time[i].event == AnnotatedTime::Event::PreEvent) {
+                        workerPerformance += toPerformanceIndex(metrics[i]);
+                    } else {
+                        workerPerformance += toPerformanceIndex(metrics[i], getIntervalDuration(time[i], time[i + 1]));
+                    }
+                    ++numReusedNodes;
+                } else if (time[i].event == AnnotatedTime::Event::PreEvent) {
                     // Event node
                     auto result = multiple_shooting::setupEventNode(ocpDefinition, time[i].time, x[i], x[i + 1]);
-                    metrics[i] = multiple_shooting::computeMetrics(result);
+                    if (settings_.quasiNewtonHessian) {
+                        quasiNewtonHessian_.update(i, x[i], vector_t(), result.cost);
+                    }
+                    multiple_shooting::computeMetrics(result, metrics[i]);
                     workerPerformance += multiple_shooting::computePerformanceIndex(result);
                     cost_[i] = std::move(result.cost);
                     dynamics_[i] = std::move(result.dynamics);
@@ -386,13 +465,19 @@ namespace ocs2 {
                     stateInputIneqConstraints_[i].resize(0, x[i].size());
                     constraintsProjection_[i].resize(0, x[i].size());
                     projectionMultiplierCoefficients_[i] = multiple_shooting::ProjectionMultiplierCoefficients();
+                    lqState_[i] = x[i];
+                    lqNextState_[i] = x[i + 1];
+                    lqInput_[i].resize(0);
                 } else {
                     // Normal, intermediate node
                     const scalar_t ti = getIntervalStart(time[i]);
                     const scalar_t dt = getIntervalDuration(time[i], time[i + 1]);
                     auto result = multiple_shooting::setupIntermediateNode(
                         ocpDefinition, sensitivityDiscretizer_, ti, dt, x[i], x[i + 1], u[i]);
-                    metrics[i] = multiple_shooting::computeMetrics(result);
+                    if (settings_.quasiNewtonHessian) {
+                        quasiNewtonHessian_.update(i, x[i], u[i], result.cost);
+                    }
+                    multiple_shooting::computeMetrics(result, metrics[i]);
                     workerPerformance += multiple_shooting::computePerformanceIndex(result, dt);
                     if (settings_.projectStateInputEqualityConstraints) {
                         multiple_shooting::projectTranscription(result, settings_.extractProjectionMultiplier);
@@ -404,6 +489,9 @@ namespace ocs2 {
                     stateInputIneqConstraints_[i] = std::move(result.stateInputIneqConstraints);
                     constraintsProjection_[i] = std::move(result.constraintsProjection);
                     projectionMultiplierCoefficients_[i] = std::move(result.projectionMultiplierCoefficients);
+                    lqState_[i] = x[i];
+                    lqNextState_[i] = x[i + 1];
+                    lqInput_[i] = u[i];
                 }
 
                 i = timeIndex++;
@@ -411,13 +499,22 @@ namespace ocs2 {
 
             if (i == N) {
                 // Only one worker will execute this
-                const scalar_t tN = getIntervalStart(time[N]);
-                auto result = multiple_shooting::setupTerminalNode(ocpDefinition, tN, x[N]);
-                metrics[i] = multiple_shooting::computeMetrics(result);
-                workerPerformance += multiple_shooting::computePerformanceIndex(result);
-                cost_[i] = std::move(result.cost);
-                stateInputEqConstraints_[i].resize(0, x[i].size());
-                stateIneqConstraints_[i] = std::move(result.ineqConstraints);
+                if (isNodeUnchanged(N)) {
+                    workerPerformance += toPerformanceIndex(metrics[N]);
+                    ++numReusedNodes;
+                } else {
+                    const scalar_t tN = getIntervalStart(time[N]);
+                    auto result = multiple_shooting::setupTerminalNode(ocpDefinition, tN, x[N]);
+                    if (settings_.quasiNewtonHessian) {
+                        quasiNewtonHessian_.update(N, x[N], vector_t(), result.cost);
+                    }
+                    multiple_shooting::computeMetrics(result, metrics[i]);
+                    workerPerformance += multiple_shooting::computePerformanceIndex(result);
+                    cost_[i] = std::move(result.cost);
+                    stateInputEqConstraints_[i].resize(0, x[i].size());
+                    stateIneqConstraints_[i] = std::move(result.ineqConstraints);
+                    lqState_[N] = x[N];
+                }
             }
 
             // Accumulate! Same worker might run multiple tasks
@@ -436,59 +533,72 @@ namespace ocs2 {
         totalPerformance.merit = totalPerformance.cost + totalPerformance.equalityLagrangian + totalPerformance.
                                  inequalityLagrangian;
 
-        return totalPerformance;
+        return {totalPerformance, numReusedNodes.load()};
     }
 
-    PerformanceIndex SqpSolver::computePerformance(const std::vector<AnnotatedTime> &time, const vector_t &initState,
-                                                   const vector_array_t &x,
-                                                   const vector_array_t &u, std::vector<Metrics> &metrics) {
+    std::vector<PerformanceIndex> SqpSolver::computePerformance(const std::vector<AnnotatedTime> &time,
+                                                                const vector_t &initState, size_t numCandidates,
+                                                                const std::vector<vector_array_t> &x,
+                                                                const std::vector<vector_array_t> &u,
+                                                                std::vector<std::vector<Metrics> > &metrics) {
         // Problem size
         const int N = static_cast<int>(time.size()) - 1;
-        metrics.resize(N + 1);
+        for (size_t c = 0; c < numCandidates; c++) {
+            metrics[c].resize(N + 1);
+        }
 
-        std::vector<PerformanceIndex> performance(settings_.nThreads, PerformanceIndex());
-        std::atomic_int timeIndex{0};
+        // The tasks are the nodes of all candidates, task k is node (k % (N + 1)) of candidate (k / (N + 1))
+        const int numTasks = static_cast<int>(numCandidates) * (N + 1);
+        std::vector<PerformanceIndex> performance(settings_.nThreads * numCandidates, PerformanceIndex());
+        std::atomic_int taskIndex{0};
         auto parallelTask = [&](int workerId) {
             // Get worker specific resources
             OptimalControlProblem &ocpDefinition = ocpDefinitions_[workerId];
 
-            int i = timeIndex++;
-            while (i < N) {
-                if (time[i].event == AnnotatedTime::Event::PreEvent) {
+            int k = taskIndex++;
+            while (k < numTasks) {
+                const int c = k / (N + 1);
+                const int i = k % (N + 1);
+                auto &workerPerformance = performance[workerId * numCandidates + c];
+                auto &nodeMetrics = metrics[c][i];
+                if (i == N) {
+                    // Terminal node
+                    const scalar_t tN = getIntervalStart(time[N]);
+                    multiple_shooting::computeTerminalMetrics(ocpDefinition, tN, x[c][N], nodeMetrics);
+                    workerPerformance += toPerformanceIndex(nodeMetrics);
+                } else if (time[i].event == AnnotatedTime::Event::PreEvent) {
                     // Event node
-                    metrics[i] = multiple_shooting::computeEventMetrics(ocpDefinition, time[i].time, x[i], x[i + 1]);
-                    performance[workerId] += toPerformanceIndex(metrics[i]);
+                    multiple_shooting::computeEventMetrics(ocpDefinition, time[i].time, x[c][i], x[c][i + 1],
+                                                           nodeMetrics);
+                    workerPerformance += toPerformanceIndex(nodeMetrics);
                 } else {
                     // Normal, intermediate node
                     const scalar_t ti = getIntervalStart(time[i]);
                     const scalar_t dt = getIntervalDuration(time[i], time[i + 1]);
-                    metrics[i] = multiple_shooting::computeIntermediateMetrics(
-                        ocpDefinition, discretizer_, ti, dt, x[i], x[i + 1], u[i]);
-                    performance[workerId] += toPerformanceIndex(metrics[i], dt);
+                    multiple_shooting::computeIntermediateMetrics(ocpDefinition, discretizer_, ti, dt, x[c][i],
+                                                                  x[c][i + 1], u[c][i], nodeMetrics);
+                    workerPerformance += toPerformanceIndex(nodeMetrics, dt);
                 }
 
-                i = timeIndex++;
-            }
-
-            if (i == N) {
-                // Only one worker will execute this
-                const scalar_t tN = getIntervalStart(time[N]);
-                metrics[N] = multiple_shooting::computeTerminalMetrics(ocpDefinition, tN, x[N]);
-                performance[workerId] += toPerformanceIndex(metrics[N]);
+                k = taskIndex++;
             }
         };
         runParallel(std::move(parallelTask));
 
-        // Account for initial state in performance
-        const vector_t initDynamicsViolation = initState - x.front();
-        metrics.front().dynamicsViolation += initDynamicsViolation;
-        performance.front().dynamicsViolationSSE += initDynamicsViolation.squaredNorm();
+        std::vector<PerformanceIndex> totalPerformance(numCandidates);
+        for (size_t c = 0; c < numCandidates; c++) {
+            // Account for initial state in performance
+            const vector_t initDynamicsViolation = initState - x[c].front();
+            metrics[c].front().dynamicsViolation += initDynamicsViolation;
+            totalPerformance[c].dynamicsViolationSSE += initDynamicsViolation.squaredNorm();
 
-        // Sum performance of the threads
-        PerformanceIndex totalPerformance = std::accumulate(std::next(performance.begin()), performance.end(),
-                                                            performance.front());
-        totalPerformance.merit = totalPerformance.cost + totalPerformance.equalityLagrangian + totalPerformance.
-                                 inequalityLagrangian;
+            // Sum performance of the threads
+            for (size_t w = 0; w < settings_.nThreads; w++) {
+                totalPerformance[c] += performance[w * numCandidates + c];
+            }
+            totalPerformance[c].merit = totalPerformance[c].cost + totalPerformance[c].equalityLagrangian +
+                                        totalPerformance[c].inequalityLagrangian;
+        }
         return totalPerformance;
     }
 
@@ -519,64 +629,84 @@ namespace ocs2 {
         const auto deltaUnorm = multiple_shooting::trajectoryNorm(du);
         const auto deltaXnorm = multiple_shooting::trajectoryNorm(dx);
 
+        // Buffers of the step candidates, members to reuse the memory between line searches
+        const size_t maxNumCandidates = settings_.linesearchCandidates;
+        xCandidates_.resize(maxNumCandidates);
+        uCandidates_.resize(maxNumCandidates);
+        metricsCandidates_.resize(maxNumCandidates);
+        scalar_array_t alphaCandidates;
+        alphaCandidates.reserve(maxNumCandidates);
+
         scalar_t alpha = 1.0;
-        vector_array_t xNew(x.size());
-        vector_array_t uNew(u.size());
-        std::vector<Metrics> metricsNew(metrics.size());
+        bool isStepSizeTooSmall = false;
         do {
-            // Compute step
-            multiple_shooting::incrementTrajectory(u, du, alpha, uNew);
-            multiple_shooting::incrementTrajectory(x, dx, alpha, xNew);
+            // Collect the next step sizes of the backtracking sequence, they are evaluated concurrently
+            alphaCandidates.clear();
+            while (alphaCandidates.size() < maxNumCandidates && alpha >= settings_.alpha_min && !isStepSizeTooSmall) {
+                alphaCandidates.push_back(alpha);
+                // Try smaller step
+                alpha *= settings_.alpha_decay;
+                // Detect too small step size during back-tracking to escape early. Prevents going all the way to alpha_min
+                isStepSizeTooSmall = alpha * deltaXnorm < settings_.deltaTol && alpha * deltaUnorm < settings_.deltaTol;
+            }
 
-            // Compute cost and constraints
-            const PerformanceIndex performanceNew = computePerformance(timeDiscretization, initState, xNew, uNew,
-                                                                       metricsNew);
-
-            // Step acceptance and record step type
-            bool stepAccepted;
-            StepType stepType;
-            std::tie(stepAccepted, stepType) =
-                    filterLinesearch_.acceptStep(baseline, performanceNew,
-                                                 alpha * subproblemSolution.armijoDescentMetric);
-
-            if (settings_.printLinesearch) {
-                std::cerr << "Step size: " << alpha << ", Step Type: " << toString(stepType)
-                        << (stepAccepted ? std::string{" (Accepted)"} : std::string{" (Rejected)"}) << "\n";
-                std::cerr << "|dx| = " << alpha * deltaXnorm << "\t|du| = " << alpha * deltaUnorm << "\n";
-                std::cerr << performanceNew << "\n";
+            // Compute step
+            for (size_t c = 0; c < alphaCandidates.size(); c++) {
+                xCandidates_[c].resize(x.size());
+                uCandidates_[c].resize(u.size());
+                multiple_shooting::incrementTrajectory(u, du, alphaCandidates[c], uCandidates_[c]);
+                multiple_shooting::incrementTrajectory(x, dx, alphaCandidates[c], xCandidates_[c]);
             }
 
-            if (stepAccepted) {
-                // Return if step accepted
-                x = std::move(xNew);
-                u = std::move(uNew);
-                metrics = std::move(metricsNew);
-
-                // Prepare step info
-                sqp::StepInfo stepInfo;
-                stepInfo.stepSize = alpha;
-                stepInfo.stepType = stepType;
-                stepInfo.dx_norm = alpha * deltaXnorm;
-                stepInfo.du_norm = alpha * deltaUnorm;
-                stepInfo.performanceAfterStep = performanceNew;
-                stepInfo.totalConstraintViolationAfterStep = FilterLinesearch::totalConstraintViolation(performanceNew);
-                return stepInfo;
-            } else {
-                // Try smaller step
-                alpha *= settings_.alpha_decay;
+            // Compute cost and constraints
+            const auto performanceCandidates = computePerformance(timeDiscretization, initState, alphaCandidates.size(),
+                                                                  xCandidates_, uCandidates_, metricsCandidates_);
+
+            // Step acceptance in the order of decreasing step size, the largest accepted step is taken
+            for (size_t c = 0; c < alphaCandidates.size(); c++) {
+                const scalar_t alphaCandidate = alphaCandidates[c];
+                const PerformanceIndex &performanceNew = performanceCandidates[c];
+
+                // Step acceptance and record step type
+                bool stepAccepted;
+                StepType stepType;
+                std::tie(stepAccepted, stepType) =
+                        filterLinesearch_.acceptStep(baseline, performanceNew,
+                                                     alphaCandidate * subproblemSolution.armijoDescentMetric);
+
+                if (settings_.printLinesearch) {
+                    std::cerr << "Step size: " << alphaCandidate << ", Step Type: " << toString(stepType)
+                            << (stepAccepted ? std::string{" (Accepted)"} : std::string{" (Rejected)"}) << "\n";
+                    std::cerr << "|dx| = " << alphaCandidate * deltaXnorm << "\t|du| = " << alphaCandidate *
+                            deltaUnorm << "\n";
+                    std::cerr << performanceNew << "\n";
+                }
 
-                // Detect too small step size during back-tracking to escape early. Prevents going all the way to alpha_min
-                if (alpha * deltaXnorm < settings_.deltaTol && alpha * deltaUnorm < settings_.deltaTol) {
-                    if (settings_.printLinesearch) {
-                        std::cerr << "Exiting linesearch early due to too small primal steps |dx|: " << alpha *
-                                deltaXnorm
-                                << ", and or |du|: " << alpha * deltaUnorm << " are below deltaTol: " << settings_.
-                                deltaTol << "\n";
-                    }
-                    break;
+                if (stepAccepted) {
+                    // Return if step accepted
+                    x.swap(xCandidates_[c]);
+                    u.swap(uCandidates_[c]);
+                    metrics.swap(metricsCandidates_[c]);
+
+                    // Prepare step info
+                    sqp::StepInfo stepInfo;
+                    stepInfo.stepSize = alphaCandidate;
+                    stepInfo.stepType = stepType;
+                    stepInfo.dx_norm = alphaCandidate * deltaXnorm;
+                    stepInfo.du_norm = alphaCandidate * deltaUnorm;
+                    stepInfo.performanceAfterStep = performanceNew;
+                    stepInfo.totalConstraintViolationAfterStep = FilterLinesearch::totalConstraintViolation(
+                        performanceNew);
+                    return stepInfo;
                 }
             }
-        } while (alpha >= settings_.alpha_min);
+
+            if (isStepSizeTooSmall && settings_.printLinesearch) {
+                std::cerr << "Exiting linesearch early due to too small primal steps |dx|: " << alpha * deltaXnorm
+                        << ", and or |du|: " << alpha * deltaUnorm << " are below deltaTol: " << settings_.deltaTol
+                        << "\n";
+            }
+        } while (alpha >= settings_.alpha_min && !isStepSizeTooSmall);
 
         // Alpha_min reached -> Don't take a step
         sqp::StepInfo stepInfo;
@@ -32,6 +32,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "ocs2_sqp/SqpSolver.h"
 
 #include <ocs2_core/initialization/DefaultInitializer.h>
+#include <ocs2_core/misc/LinearInterpolation.h>
 
 #include <ocs2_oc/test/circular_kinematics.h>
 
@@ -141,3 +142,52 @@ TEST(test_circular_kinematics, solve_EqConstraints_inQPSubproblem) {
     ASSERT_TRUE(u.isApprox(primalSolution.controllerPtr_->computeInput(t, x)));
   }
 }
+
+TEST(test_circular_kinematics, solve_reuseUnchangedLqApproximation) {
+  // optimal control problem
+  ocs2::OptimalControlProblem problem = ocs2::createCircularKinematicsProblem("/tmp/ocs2/sqp_test_generated");
+
+  // Initializer
+  ocs2::DefaultInitializer zeroInitializer(2);
+
+  // Solver settings
+  ocs2::sqp::Settings settings;
+  settings.dt = 0.01;
+  settings.sqpIteration = 20;
+  settings.deltaTol = 1e-10;  // iterate until the nodes settle, such that their approximation can be reused
+  settings.costTol = 1e-12;
+  settings.projectStateInputEqualityConstraints = true;
+  settings.nThreads = 1;
+
+  // Additional problem definitions
+  const ocs2::scalar_t startTime = 0.0;
+  const ocs2::scalar_t finalTime = 1.0;
+  const ocs2::scalar_t shiftTime = 0.05;
+  const ocs2::vector_t initState = (ocs2::vector_t(2) << 1.0, 0.0).finished();  // radius 1.0
+
+  // Solve, and solve again warm-started on the shifted horizon as in MPC, with and without reusing the approximation of unchanged nodes
+  auto solve = [&](ocs2::scalar_t lqReuseTolerance) {
+    settings.lqReuseTolerance = lqReuseTolerance;
+    ocs2::SqpSolver solver(settings, problem, zeroInitializer);
+    solver.run(startTime, initState, finalTime);
+    const auto coldSolution = solver.primalSolution(finalTime);
+    const ocs2::vector_t shiftedState =
+        ocs2::LinearInterpolation::interpolate(startTime + shiftTime, coldSolution.timeTrajectory_, coldSolution.stateTrajectory_);
+    solver.run(startTime + shiftTime, shiftedState, finalTime + shiftTime);
+    return std::make_tuple(solver.primalSolution(finalTime + shiftTime), solver.getPerformanceIndeces(), solver.getNumReusedNodes());
+  };
+  const auto [reference, referencePerformance, referenceNumReusedNodes] = solve(0.0);
+  const auto [reused, reusedPerformance, numReusedNodes] = solve(1e-4);
+
+  // The warm-started solve reuses approximations, the solution is the same
+  ASSERT_EQ(referenceNumReusedNodes, 0);
+  ASSERT_GT(numReusedNodes, 0);
+  ASSERT_LT(reusedPerformance.dynamicsViolationSSE, 1e-6);
+  ASSERT_LT(reusedPerformance.equalityConstraintsSSE, 1e-6);
+  ASSERT_NEAR(reusedPerformance.cost, referencePerformance.cost, 1e-8);
+  ASSERT_EQ(reused.stateTrajectory_.size(), reference.stateTrajectory_.size());
+  for (int i = 0; i < reference.stateTrajectory_.size(); i++) {
+    ASSERT_TRUE(reused.stateTrajectory_[i].isApprox(reference.stateTrajectory_[i], 1e-8));
+    ASSERT_TRUE(reused.inputTrajectory_[i].isApprox(reference.inputTrajectory_[i], 1e-8));
+  }
+}
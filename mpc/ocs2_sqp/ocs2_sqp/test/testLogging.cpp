@@ -48,3 +48,23 @@ TEST(test_logging, wrap_around) {
 
   ASSERT_EQ(stream.str(), std::string("0") + "01" + "012" + "123" + "234" + "345");
 }
+
+TEST(test_logging, telemetry_row) {
+  const auto columnNames = sqp::logColumnNames();
+  ASSERT_EQ(columnNames.size(), sqp::numLogColumns);
+
+  std::string header;
+  for (const auto& name : columnNames) {
+    header += name + (&name == &columnNames.back() ? "\n" : ", ");
+  }
+  ASSERT_EQ(sqp::logHeader(), header);
+
+  sqp::LogEntry logEntry;
+  logEntry.iteration = 3;
+  logEntry.stepInfo.dx_norm = 0.5;
+  logEntry.convergence = sqp::Convergence::STEPSIZE;
+  const auto row = sqp::toLogRow(logEntry);
+  ASSERT_EQ(row[2], 3.0);
+  ASSERT_EQ(row[13], 0.5);
+  ASSERT_EQ(row[19], static_cast<scalar_t>(sqp::Convergence::STEPSIZE));
+}
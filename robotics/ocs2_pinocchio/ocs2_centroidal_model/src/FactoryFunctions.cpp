@@ -130,8 +130,8 @@ CentroidalModelInfo createCentroidalModelInfo(const PinocchioInterface& interfac
 /******************************************************************************************************/
 /******************************************************************************************************/
 CentroidalModelType loadCentroidalType(const std::string& configFilePath, const std::string& fieldName) {
-  boost::property_tree::ptree pt;
-  boost::property_tree::read_info(configFilePath, pt);
+  const auto ptPtr = ocs2::loadData::readInfoFile(configFilePath);
+  const auto &pt = *ptPtr;
   const size_t type = pt.template get<size_t>(fieldName);
   return static_cast<CentroidalModelType>(type);
 }
@@ -32,6 +32,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <pinocchio/parsers/urdf.hpp>
 #include <urdf_parser/urdf_parser.h>
 
+#include <ocs2_core/misc/StartupProfiler.h>
+
 #include "ocs2_pinocchio_interface/urdf.h"
 
 namespace ocs2 {
@@ -40,6 +42,7 @@ namespace ocs2 {
 /******************************************************************************************************/
 /******************************************************************************************************/
 PinocchioInterface getPinocchioInterfaceFromUrdfFile(const std::string& urdfFile) {
+  benchmark::ScopedStartupTimer timer(benchmark::StartupPhase::ModelLoading);
   ::urdf::ModelInterfaceSharedPtr urdfTree = ::urdf::parseURDFFile(urdfFile);
   if (urdfTree != nullptr) {
     return getPinocchioInterfaceFromUrdfModel(urdfTree);
@@ -52,6 +55,7 @@ PinocchioInterface getPinocchioInterfaceFromUrdfFile(const std::string& urdfFile
 /******************************************************************************************************/
 /******************************************************************************************************/
 PinocchioInterface getPinocchioInterfaceFromUrdfFile(const std::string& urdfFile, const PinocchioInterface::JointModel& rootJoint) {
+  benchmark::ScopedStartupTimer timer(benchmark::StartupPhase::ModelLoading);
   ::urdf::ModelInterfaceSharedPtr urdfTree = ::urdf::parseURDFFile(urdfFile);
   if (urdfTree != nullptr) {
     return getPinocchioInterfaceFromUrdfModel(urdfTree, rootJoint);
@@ -64,6 +68,7 @@ PinocchioInterface getPinocchioInterfaceFromUrdfFile(const std::string& urdfFile
 /******************************************************************************************************/
 /******************************************************************************************************/
 PinocchioInterface getPinocchioInterfaceFromUrdfString(const std::string& xmlString) {
+  benchmark::ScopedStartupTimer timer(benchmark::StartupPhase::ModelLoading);
   ::urdf::ModelInterfaceSharedPtr urdfTree = ::urdf::parseURDF(xmlString);
   if (urdfTree != nullptr) {
     return getPinocchioInterfaceFromUrdfModel(urdfTree);
@@ -76,6 +81,7 @@ PinocchioInterface getPinocchioInterfaceFromUrdfString(const std::string& xmlStr
 /******************************************************************************************************/
 /******************************************************************************************************/
 PinocchioInterface getPinocchioInterfaceFromUrdfString(const std::string& xmlString, const PinocchioInterface::JointModel& rootJoint) {
+  benchmark::ScopedStartupTimer timer(benchmark::StartupPhase::ModelLoading);
   ::urdf::ModelInterfaceSharedPtr urdfTree = ::urdf::parseURDF(xmlString);
   if (urdfTree != nullptr) {
     return getPinocchioInterfaceFromUrdfModel(urdfTree, rootJoint);
@@ -88,6 +94,7 @@ PinocchioInterface getPinocchioInterfaceFromUrdfString(const std::string& xmlStr
 /******************************************************************************************************/
 /******************************************************************************************************/
 PinocchioInterface getPinocchioInterfaceFromUrdfModel(const std::shared_ptr<::urdf::ModelInterface>& urdfTree) {
+  benchmark::ScopedStartupTimer timer(benchmark::StartupPhase::ModelLoading);
   pinocchio::ModelTpl<scalar_t> model;
   pinocchio::urdf::buildModel(urdfTree, model);
   return PinocchioInterface(model, urdfTree);
@@ -98,6 +105,7 @@ PinocchioInterface getPinocchioInterfaceFromUrdfModel(const std::shared_ptr<::ur
 /******************************************************************************************************/
 PinocchioInterface getPinocchioInterfaceFromUrdfModel(const std::shared_ptr<::urdf::ModelInterface>& urdfTree,
                                                       const PinocchioInterface::JointModel& rootJoint) {
+  benchmark::ScopedStartupTimer timer(benchmark::StartupPhase::ModelLoading);
   pinocchio::ModelTpl<scalar_t> model;
   pinocchio::urdf::buildModel(urdfTree, rootJoint, model);
   return PinocchioInterface(model, urdfTree);
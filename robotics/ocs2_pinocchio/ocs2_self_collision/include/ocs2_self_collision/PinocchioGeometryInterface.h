@@ -82,6 +82,28 @@ namespace ocs2 {
         std::vector<hpp::fcl::DistanceResult> computeDistances(
             const PinocchioInterface &pinocchioInterface) const;
 
+        /**
+         * Compute collision pair distances with a bounding-sphere broad phase
+         * The bounding spheres of the two objects of a pair give a lower bound on
+         * their distance. Pairs for which this bound exceeds activationDistance are
+         * skipped by the narrow phase. For those pairs, the distance result only
+         * holds the lower bound as min_distance and the closest points of the two
+         * bounding spheres as nearest_points.
+         *
+         * @note Requires pinocchioInterface with updated joint placements by calling
+         * forwardKinematics().
+         *
+         * @param [in] pinocchioInterface: pinocchio interface of the robot model
+         * @param [in] activationDistance: The distance beyond which a pair is skipped.
+         * @param [out] isPairActive: Whether the distance of each pair is computed
+         * by the narrow phase.
+         * @return An array of distances (lower bounds for the skipped pairs) between
+         * pairs of collision bodies defined in the constructor.
+         */
+        std::vector<hpp::fcl::DistanceResult> computeDistances(
+            const PinocchioInterface &pinocchioInterface, scalar_t activationDistance,
+            std::vector<bool> &isPairActive) const;
+
         /** Get the number of collision pairs */
         size_t getNumCollisionPairs() const;
 
@@ -93,6 +115,8 @@ namespace ocs2 {
         }
 
     private:
+        using vector3_t = Eigen::Matrix<scalar_t, 3, 1>;
+
         // Construction helpers
         void buildGeomFromPinocchioInterface(
             const PinocchioInterface &pinocchioInterface,
@@ -107,6 +131,12 @@ namespace ocs2 {
             const std::vector<std::pair<std::string, std::string> > &
             collisionLinkPairs);
 
+        void computeBoundingSpheres();
+
         std::shared_ptr<pinocchio::GeometryModel> geometryModelPtr_;
+
+        // bounding sphere of each geometry object expressed in the object frame
+        std::vector<vector3_t> boundingSphereCenters_;
+        std::vector<scalar_t> boundingSphereRadii_;
     };
 } // namespace ocs2
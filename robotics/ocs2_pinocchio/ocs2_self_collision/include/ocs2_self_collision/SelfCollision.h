@@ -29,6 +29,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #pragma once
 
+#include <limits>
+
 #include <ocs2_pinocchio_interface/PinocchioInterface.h>
 #include <ocs2_self_collision/PinocchioGeometryInterface.h>
 
@@ -42,8 +44,13 @@ namespace ocs2 {
          *
          * @param [in] pinocchioGeometryInterface: pinocchio geometry interface of the robot model
          * @parma [in] minimumDistance: minimum allowed distance between each collision pair
+         * @param [in] activationMargin: distance beyond the minimum distance after which a pair is considered inactive.
+         *                               Inactive pairs are culled by a bounding-sphere broad phase; their value is a lower
+         *                               bound on the distance violation and their derivative is the one of this lower bound.
+         *                               The default (infinity) disables the broad phase.
          */
-        SelfCollision(PinocchioGeometryInterface pinocchioGeometryInterface, scalar_t minimumDistance);
+        SelfCollision(PinocchioGeometryInterface pinocchioGeometryInterface, scalar_t minimumDistance,
+                      scalar_t activationMargin = std::numeric_limits<scalar_t>::infinity());
 
         /** Get the number of collision pairs */
         size_t getNumCollisionPairs() const { return pinocchioGeometryInterface_.getNumCollisionPairs(); }
@@ -73,7 +80,11 @@ namespace ocs2 {
         std::pair<vector_t, matrix_t> getLinearApproximation(const PinocchioInterface &pinocchioInterface) const;
 
     private:
+        std::vector<hpp::fcl::DistanceResult> computeDistances(const PinocchioInterface &pinocchioInterface,
+                                                               std::vector<bool> &isPairActive) const;
+
         PinocchioGeometryInterface pinocchioGeometryInterface_;
         scalar_t minimumDistance_;
+        scalar_t activationMargin_;
     };
 } // namespace ocs2
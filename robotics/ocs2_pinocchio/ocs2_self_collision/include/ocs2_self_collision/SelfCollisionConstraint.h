@@ -48,10 +48,13 @@ namespace ocs2 {
          * @param [in] mapping: The pinocchio mapping from pinocchio states to ocs2 states.
          * @param [in] pinocchioGeometryInterface: Pinocchio geometry interface of the robot model.
          * @param [in] minimumDistance: The minimum allowed distance between collision pairs.
+         * @param [in] activationMargin: The distance beyond the minimum distance after which the pairs are culled by the
+         *                               broad phase. See SelfCollision.
          */
         SelfCollisionConstraint(const PinocchioStateInputMapping<scalar_t> &mapping,
                                 PinocchioGeometryInterface pinocchioGeometryInterface,
-                                scalar_t minimumDistance);
+                                scalar_t minimumDistance,
+                                scalar_t activationMargin = std::numeric_limits<scalar_t>::infinity());
 
         ~SelfCollisionConstraint() override = default;
 
@@ -49,6 +49,7 @@ namespace ocs2 {
         buildGeomFromPinocchioInterface(pinocchioInterface, *geometryModelPtr_);
 
         addCollisionObjectPairs(pinocchioInterface, collisionObjectPairs);
+        computeBoundingSpheres();
     }
 
     PinocchioGeometryInterface::PinocchioGeometryInterface(
@@ -60,6 +61,7 @@ namespace ocs2 {
 
         addCollisionObjectPairs(pinocchioInterface, collisionObjectPairs);
         addCollisionLinkPairs(pinocchioInterface, collisionLinkPairs);
+        computeBoundingSpheres();
     }
 
 
@@ -77,6 +79,49 @@ namespace ocs2 {
     }
 
 
+    std::vector<hpp::fcl::DistanceResult>
+    PinocchioGeometryInterface::computeDistances(
+        const PinocchioInterface &pinocchioInterface, scalar_t activationDistance,
+        std::vector<bool> &isPairActive) const {
+        pinocchio::GeometryData geometryData(*geometryModelPtr_);
+
+        pinocchio::updateGeometryPlacements(pinocchioInterface.getModel(),
+                                            pinocchioInterface.getData(),
+                                            *geometryModelPtr_, geometryData);
+
+        const size_t numCollisionPairs = geometryModelPtr_->collisionPairs.size();
+        isPairActive.assign(numCollisionPairs, false);
+        for (size_t i = 0; i < numCollisionPairs; ++i) {
+            const auto &collisionPair = geometryModelPtr_->collisionPairs[i];
+            const vector3_t center1 = geometryData.oMg[collisionPair.first].act(
+                boundingSphereCenters_[collisionPair.first]);
+            const vector3_t center2 = geometryData.oMg[collisionPair.second].act(
+                boundingSphereCenters_[collisionPair.second]);
+            const scalar_t radius1 = boundingSphereRadii_[collisionPair.first];
+            const scalar_t radius2 = boundingSphereRadii_[collisionPair.second];
+
+            const vector3_t centerDifference = center2 - center1;
+            const scalar_t centerDistance = centerDifference.norm();
+            const scalar_t distanceLowerBound = centerDistance - radius1 - radius2;
+
+            if (distanceLowerBound > activationDistance) {
+                // distanceLowerBound > activationDistance >= 0 implies centerDistance > 0
+                const vector3_t normal = centerDifference / centerDistance;
+                auto &result = geometryData.distanceResults[i];
+                result.min_distance = distanceLowerBound;
+                result.nearest_points[0] = center1 + radius1 * normal;
+                result.nearest_points[1] = center2 - radius2 * normal;
+                result.normal = normal;
+            } else {
+                pinocchio::computeDistance(*geometryModelPtr_, geometryData, i);
+                isPairActive[i] = true;
+            }
+        }
+
+        return std::move(geometryData.distanceResults);
+    }
+
+
     size_t PinocchioGeometryInterface::getNumCollisionPairs() const {
         return geometryModelPtr_->collisionPairs.size();
     }
@@ -115,6 +160,19 @@ namespace ocs2 {
     }
 
 
+    void PinocchioGeometryInterface::computeBoundingSpheres() {
+        const size_t numGeometryObjects = geometryModelPtr_->geometryObjects.size();
+        boundingSphereCenters_.resize(numGeometryObjects);
+        boundingSphereRadii_.resize(numGeometryObjects);
+        for (size_t i = 0; i < numGeometryObjects; ++i) {
+            auto &geometry = *geometryModelPtr_->geometryObjects[i].geometry;
+            geometry.computeLocalAABB();
+            boundingSphereCenters_[i] = geometry.aabb_center;
+            boundingSphereRadii_[i] = geometry.aabb_radius;
+        }
+    }
+
+
     void PinocchioGeometryInterface::addCollisionObjectPairs(
         const PinocchioInterface &pinocchioInterface,
         const std::vector<std::pair<size_t, size_t> > &collisionObjectPairs) {
@@ -29,6 +29,8 @@
 
 #include <pinocchio/fwd.hpp>
 
+#include <cmath>
+
 #include <pinocchio/algorithm/jacobian.hpp>
 #include <pinocchio/multibody/geometry.hpp>
 
@@ -38,14 +40,56 @@
 #include <ocs2_self_collision/SelfCollision.h>
 
 namespace ocs2 {
-    SelfCollision::SelfCollision(PinocchioGeometryInterface pinocchioGeometryInterface, scalar_t minimumDistance)
-        : pinocchioGeometryInterface_(std::move(pinocchioGeometryInterface)), minimumDistance_(minimumDistance) {
+    namespace {
+        /**
+         * Adds the derivative of normal' * p with respect to the generalized coordinates to row, where the point p is rigidly attached to
+         * the joint. Only the world frame jacobian columns of the joint support are read, no joint jacobian is extracted.
+         *
+         * @note Requires updated computeJointJacobians() on data.
+         */
+        template<typename RowType>
+        void addProjectedPointJacobian(const pinocchio::Model &model, const pinocchio::Data &data, pinocchio::JointIndex joint,
+                                       const SelfCollision::vector3_t &point, const SelfCollision::vector3_t &normal, RowType &&row) {
+            // the velocity of p is v + omega x p, hence normal' * (v + omega x p) = normal' * v + (p x normal)' * omega
+            Eigen::Matrix<scalar_t, 6, 1> projection;
+            projection << normal, point.cross(normal);
+            for (const auto supportJoint: model.supports[joint]) {
+                if (supportJoint == 0) {
+                    continue; // universe
+                }
+                const auto &jointModel = model.joints[supportJoint];
+                row.segment(jointModel.idx_v(), jointModel.nv()).noalias() +=
+                        projection.transpose() * data.J.middleCols(jointModel.idx_v(), jointModel.nv());
+            }
+        }
+    } // namespace
+
+    SelfCollision::SelfCollision(PinocchioGeometryInterface pinocchioGeometryInterface, scalar_t minimumDistance,
+                                 scalar_t activationMargin)
+        : pinocchioGeometryInterface_(std::move(pinocchioGeometryInterface)),
+          minimumDistance_(minimumDistance),
+          activationMargin_(activationMargin) {
+        if (activationMargin_ < 0.0) {
+            throw std::runtime_error("[SelfCollision] activationMargin must be non-negative!");
+        }
+    }
+
+
+    std::vector<hpp::fcl::DistanceResult> SelfCollision::computeDistances(const PinocchioInterface &pinocchioInterface,
+                                                                          std::vector<bool> &isPairActive) const {
+        if (std::isinf(activationMargin_)) {
+            isPairActive.assign(getNumCollisionPairs(), true);
+            return pinocchioGeometryInterface_.computeDistances(pinocchioInterface);
+        } else {
+            const scalar_t activationDistance = std::max(minimumDistance_, scalar_t(0.0)) + activationMargin_;
+            return pinocchioGeometryInterface_.computeDistances(pinocchioInterface, activationDistance, isPairActive);
+        }
     }
 
 
     vector_t SelfCollision::getValue(const PinocchioInterface &pinocchioInterface) const {
-        const std::vector<hpp::fcl::DistanceResult> distanceArray = pinocchioGeometryInterface_.computeDistances(
-            pinocchioInterface);
+        std::vector<bool> isPairActive;
+        const std::vector<hpp::fcl::DistanceResult> distanceArray = computeDistances(pinocchioInterface, isPairActive);
 
         vector_t violations = vector_t::Zero(distanceArray.size());
         for (size_t i = 0; i < distanceArray.size(); ++i) {
@@ -58,8 +102,8 @@ namespace ocs2 {
 
     std::pair<vector_t, matrix_t> SelfCollision::getLinearApproximation(
         const PinocchioInterface &pinocchioInterface) const {
-        const std::vector<hpp::fcl::DistanceResult> distanceArray = pinocchioGeometryInterface_.computeDistances(
-            pinocchioInterface);
+        std::vector<bool> isPairActive;
+        const std::vector<hpp::fcl::DistanceResult> distanceArray = computeDistances(pinocchioInterface, isPairActive);
 
         const auto &model = pinocchioInterface.getModel();
         const auto &data = pinocchioInterface.getData();
@@ -77,6 +121,16 @@ namespace ocs2 {
             const auto &joint1 = geometryModel.geometryObjects[collisionPair.first].parentJoint;
             const auto &joint2 = geometryModel.geometryObjects[collisionPair.second].parentJoint;
 
+            // For pairs culled by the broad phase, the nearest points lie on the bounding spheres along the line between their centers.
+            // The jacobian of the lower bound is therefore the one of normal' * (pt2 - pt1), which only needs the projected joint columns.
+            if (!isPairActive[i]) {
+                const vector3_t normal = distanceArray[i].normal;
+                dfdq.row(i).setZero();
+                addProjectedPointJacobian(model, data, joint2, distanceArray[i].nearest_points[1], normal, dfdq.row(i));
+                addProjectedPointJacobian(model, data, joint1, distanceArray[i].nearest_points[0], -normal, dfdq.row(i));
+                continue;
+            }
+
             // We need to get the jacobian of the point on the first object; use the joint jacobian translated to the point
             const vector3_t joint1Position = data.oMi[joint1].translation();
             const vector3_t pt1Offset = distanceArray[i].nearest_points[0] - joint1Position;
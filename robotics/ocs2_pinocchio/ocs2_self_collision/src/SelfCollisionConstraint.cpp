@@ -33,9 +33,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 namespace ocs2 {
     SelfCollisionConstraint::SelfCollisionConstraint(const PinocchioStateInputMapping<scalar_t> &mapping,
                                                      PinocchioGeometryInterface pinocchioGeometryInterface,
-                                                     scalar_t minimumDistance)
+                                                     scalar_t minimumDistance, scalar_t activationMargin)
         : StateConstraint(ConstraintOrder::Linear),
-          selfCollision_(std::move(pinocchioGeometryInterface), minimumDistance),
+          selfCollision_(std::move(pinocchioGeometryInterface), minimumDistance, activationMargin),
           mappingPtr_(mapping.clone()) {
     }
 
@@ -0,0 +1,137 @@
+/******************************************************************************
+Copyright (c) 2021, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#pragma once
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <ocs2_pinocchio_interface/PinocchioInterface.h>
+#include <ocs2_sphere_approximation/PinocchioSphereInterface.h>
+
+namespace ocs2 {
+
+/**
+ * Collision engine based on the sphere approximation of the robot model.
+ *
+ * The spheres of PinocchioSphereInterface are stored as a structure of arrays (parent joint, center in the joint frame, radius).
+ * All sphere-pair distances and their analytic derivatives are computed in one pass over the sphere set from the joint placements
+ * and the joint Jacobians of pinocchio::Data, without updating the geometry placements, calling FCL or generating code.
+ *
+ * The same sphere set can be used for environment collision: getSphereCenters() gives the positions at which a signed distance
+ * field is to be queried, and getSphereCenterJacobianProjection() maps the field gradients to the generalized coordinates.
+ *
+ * Example:
+ * \code{.cpp}
+ *   PinocchioSphereCollision sphereCollision(pinocchioSphereInterface, {{"base", "forearm"}}, 0.05);
+ *   pinocchio::computeJointJacobians(pinocchioInterface.getModel(), pinocchioInterface.getData(), q);
+ *   const auto distances = sphereCollision.getLinearApproximation(pinocchioInterface);
+ * \endcode
+ */
+class PinocchioSphereCollision final {
+ public:
+  using vector3_t = Eigen::Matrix<scalar_t, 3, 1>;
+  using matrix3x_t = Eigen::Matrix<scalar_t, 3, Eigen::Dynamic>;
+
+  /** Constructor
+   * @param [in] pinocchioSphereInterface : pinocchio sphere interface
+   * @param [in] collisionLinkPairs : pairs of collision links. All sphere combinations between the two links are checked.
+   * @param [in] minimumDistance : minimum allowed distance between the surfaces of each sphere pair
+   */
+  PinocchioSphereCollision(const PinocchioSphereInterface& pinocchioSphereInterface,
+                           const std::vector<std::pair<std::string, std::string>>& collisionLinkPairs, scalar_t minimumDistance);
+
+  /** Get the number of spheres */
+  size_t getNumSpheres() const { return parentJointIds_.size(); }
+
+  /** Get the number of sphere pairs */
+  size_t getNumSpherePairs() const { return firstSphereIds_.size(); }
+
+  /** Get the radius of each sphere */
+  const vector_t& getSphereRadii() const { return sphereRadii_; }
+
+  /** Compute the sphere center positions in world frame, one column per sphere.
+   * @note requires pinocchioInterface to be updated with:
+   *       pinocchio::forwardKinematics(model, data, q)
+   */
+  matrix3x_t getSphereCenters(const PinocchioInterface& pinocchioInterface) const;
+
+  /** Evaluate the distance violation of each sphere pair, i.e. the distance between the sphere surfaces minus the minimum distance.
+   * @note requires pinocchioInterface to be updated with:
+   *       pinocchio::forwardKinematics(model, data, q)
+   */
+  vector_t getValue(const PinocchioInterface& pinocchioInterface) const;
+
+  /** Evaluate the distance violation of each sphere pair and its derivative with respect to the generalized velocities.
+   * @note requires pinocchioInterface to be updated with:
+   *       pinocchio::forwardKinematics(model, data, q)
+   *       pinocchio::computeJointJacobians(model, data)
+   * @return: The pair of the distance violation and its derivative
+   */
+  std::pair<vector_t, matrix_t> getLinearApproximation(const PinocchioInterface& pinocchioInterface) const;
+
+  /** Project a gradient at each sphere center onto the generalized velocities.
+   * Row i of the output is gradients.col(i)^T times the Jacobian of the center of sphere i, e.g. the derivative of a signed distance
+   * field evaluated at the sphere centers.
+   * @note requires pinocchioInterface to be updated with:
+   *       pinocchio::forwardKinematics(model, data, q)
+   *       pinocchio::computeJointJacobians(model, data)
+   * @param [in] pinocchioInterface: pinocchio interface of the robot model
+   * @param [in] gradients: gradient at each sphere center in world frame, one column per sphere.
+   */
+  matrix_t getSphereCenterJacobianProjection(const PinocchioInterface& pinocchioInterface, const matrix3x_t& gradients) const;
+
+ private:
+  using vector6_t = Eigen::Matrix<scalar_t, 6, 1>;
+  using matrix6x_t = Eigen::Matrix<scalar_t, 6, Eigen::Dynamic>;
+
+  /** Joint Jacobians in LOCAL_WORLD_ALIGNED of all the joints carrying spheres */
+  std::vector<matrix6x_t> getJointJacobians(const PinocchioInterface& pinocchioInterface) const;
+
+  /** Maps a world frame direction at a sphere center to the row multiplying the joint Jacobian */
+  vector6_t getJointJacobianWeights(const PinocchioInterface& pinocchioInterface, const vector3_t& sphereCenter, size_t sphereId,
+                                    const vector3_t& direction) const;
+
+  // per sphere
+  std::vector<size_t> parentJointIds_;
+  std::vector<size_t> jointIndices_;  // index of the parent joint in jointIds_
+  matrix3x_t sphereCentersInJointFrame_;
+  vector_t sphereRadii_;
+
+  // per joint carrying spheres
+  std::vector<size_t> jointIds_;
+
+  // per sphere pair
+  std::vector<size_t> firstSphereIds_;
+  std::vector<size_t> secondSphereIds_;
+  vector_t distanceOffsets_;  // sum of the radii and the minimum distance
+};
+
+}  // namespace ocs2
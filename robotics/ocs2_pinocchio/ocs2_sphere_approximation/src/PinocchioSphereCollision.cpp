@@ -0,0 +1,218 @@
+/******************************************************************************
+Copyright (c) 2021, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include <pinocchio/fwd.hpp>
+
+#include <pinocchio/algorithm/jacobian.hpp>
+#include <pinocchio/multibody/data.hpp>
+#include <pinocchio/multibody/geometry.hpp>
+#include <pinocchio/multibody/model.hpp>
+
+#include <algorithm>
+#include <iostream>
+#include <stdexcept>
+
+#include "ocs2_sphere_approximation/PinocchioSphereCollision.h"
+
+namespace ocs2 {
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+PinocchioSphereCollision::PinocchioSphereCollision(const PinocchioSphereInterface& pinocchioSphereInterface,
+                                                   const std::vector<std::pair<std::string, std::string>>& collisionLinkPairs,
+                                                   scalar_t minimumDistance) {
+  const auto& geometryModel = pinocchioSphereInterface.getGeometryModel();
+  const auto& collisionLinkOfEachPrimitiveShape = pinocchioSphereInterface.getCollisionLinkOfEachPrimitveShape();
+  const auto& geomObjIds = pinocchioSphereInterface.getGeomObjIds();
+  const auto& numSpheres = pinocchioSphereInterface.getNumSpheres();
+  const auto& radii = pinocchioSphereInterface.getSphereRadii();
+
+  const size_t numSpheresInTotal = pinocchioSphereInterface.getNumSpheresInTotal();
+  parentJointIds_.reserve(numSpheresInTotal);
+  jointIndices_.reserve(numSpheresInTotal);
+  sphereCentersInJointFrame_.resize(3, numSpheresInTotal);
+  sphereRadii_.resize(numSpheresInTotal);
+
+  std::vector<std::string> sphereLinks;
+  sphereLinks.reserve(numSpheresInTotal);
+
+  size_t count = 0;
+  for (size_t i = 0; i < pinocchioSphereInterface.getNumPrimitiveShapes(); i++) {
+    const auto& geometryObject = geometryModel.geometryObjects[geomObjIds[i]];
+    const size_t parentJointId = geometryObject.parentJoint;
+
+    auto jointIt = std::find(jointIds_.begin(), jointIds_.end(), parentJointId);
+    if (jointIt == jointIds_.end()) {
+      jointIt = jointIds_.insert(jointIds_.end(), parentJointId);
+    }
+    const size_t jointIndex = std::distance(jointIds_.begin(), jointIt);
+
+    const auto& sphereCentersToObjectCenter = pinocchioSphereInterface.getSphereCentersToObjectCenter(i);
+    for (size_t j = 0; j < numSpheres[i]; j++) {
+      parentJointIds_.push_back(parentJointId);
+      jointIndices_.push_back(jointIndex);
+      sphereCentersInJointFrame_.col(count) = geometryObject.placement.act(sphereCentersToObjectCenter[j]);
+      sphereRadii_[count] = radii[count];
+      sphereLinks.push_back(collisionLinkOfEachPrimitiveShape[i]);
+      count++;
+    }
+  }
+
+  for (const auto& linkPair : collisionLinkPairs) {
+    bool addedPair = false;
+    for (size_t i = 0; i < numSpheresInTotal; i++) {
+      if (sphereLinks[i] != linkPair.first) {
+        continue;
+      }
+      for (size_t j = 0; j < numSpheresInTotal; j++) {
+        if (sphereLinks[j] == linkPair.second) {
+          firstSphereIds_.push_back(i);
+          secondSphereIds_.push_back(j);
+          addedPair = true;
+        }
+      }
+    }
+    if (!addedPair) {
+      std::cerr << "WARNING: in collision link pair [" << linkPair.first << ", " << linkPair.second
+                << "], one or both of the links are not approximated with spheres\n";
+    }
+  }
+
+  distanceOffsets_.resize(firstSphereIds_.size());
+  for (size_t k = 0; k < firstSphereIds_.size(); k++) {
+    distanceOffsets_[k] = sphereRadii_[firstSphereIds_[k]] + sphereRadii_[secondSphereIds_[k]] + minimumDistance;
+  }
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+auto PinocchioSphereCollision::getSphereCenters(const PinocchioInterface& pinocchioInterface) const -> matrix3x_t {
+  const auto& data = pinocchioInterface.getData();
+
+  matrix3x_t sphereCenters(3, getNumSpheres());
+  for (size_t i = 0; i < getNumSpheres(); i++) {
+    const auto& jointPlacement = data.oMi[parentJointIds_[i]];
+    sphereCenters.col(i) = jointPlacement.translation();
+    sphereCenters.col(i).noalias() += jointPlacement.rotation() * sphereCentersInJointFrame_.col(i);
+  }
+  return sphereCenters;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+vector_t PinocchioSphereCollision::getValue(const PinocchioInterface& pinocchioInterface) const {
+  const matrix3x_t sphereCenters = getSphereCenters(pinocchioInterface);
+
+  vector_t violations(getNumSpherePairs());
+  for (size_t k = 0; k < getNumSpherePairs(); k++) {
+    violations[k] = (sphereCenters.col(secondSphereIds_[k]) - sphereCenters.col(firstSphereIds_[k])).norm();
+  }
+  violations -= distanceOffsets_;
+  return violations;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+std::pair<vector_t, matrix_t> PinocchioSphereCollision::getLinearApproximation(const PinocchioInterface& pinocchioInterface) const {
+  const matrix3x_t sphereCenters = getSphereCenters(pinocchioInterface);
+  const std::vector<matrix6x_t> jointJacobians = getJointJacobians(pinocchioInterface);
+
+  vector_t f(getNumSpherePairs());
+  matrix_t dfdq(getNumSpherePairs(), pinocchioInterface.getModel().nv);
+  for (size_t k = 0; k < getNumSpherePairs(); k++) {
+    const size_t i1 = firstSphereIds_[k];
+    const size_t i2 = secondSphereIds_[k];
+
+    const vector3_t centerDifference = sphereCenters.col(i2) - sphereCenters.col(i1);
+    const scalar_t centerDistance = centerDifference.norm();
+    f[k] = centerDistance - distanceOffsets_[k];
+
+    // the derivative is not defined for coinciding centers
+    const vector3_t normal = centerDistance > 0.0 ? vector3_t(centerDifference / centerDistance) : vector3_t::Zero();
+    const vector6_t weights1 = getJointJacobianWeights(pinocchioInterface, sphereCenters.col(i1), i1, normal);
+    const vector6_t weights2 = getJointJacobianWeights(pinocchioInterface, sphereCenters.col(i2), i2, normal);
+    dfdq.row(k).noalias() = weights2.transpose() * jointJacobians[jointIndices_[i2]];
+    dfdq.row(k).noalias() -= weights1.transpose() * jointJacobians[jointIndices_[i1]];
+  }
+
+  return {f, dfdq};
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+matrix_t PinocchioSphereCollision::getSphereCenterJacobianProjection(const PinocchioInterface& pinocchioInterface,
+                                                                     const matrix3x_t& gradients) const {
+  if (gradients.cols() != getNumSpheres()) {
+    throw std::runtime_error("[PinocchioSphereCollision::getSphereCenterJacobianProjection] gradients must have one column per sphere!");
+  }
+
+  const matrix3x_t sphereCenters = getSphereCenters(pinocchioInterface);
+  const std::vector<matrix6x_t> jointJacobians = getJointJacobians(pinocchioInterface);
+
+  matrix_t projection(getNumSpheres(), pinocchioInterface.getModel().nv);
+  for (size_t i = 0; i < getNumSpheres(); i++) {
+    const vector6_t weights = getJointJacobianWeights(pinocchioInterface, sphereCenters.col(i), i, gradients.col(i));
+    projection.row(i).noalias() = weights.transpose() * jointJacobians[jointIndices_[i]];
+  }
+  return projection;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+auto PinocchioSphereCollision::getJointJacobians(const PinocchioInterface& pinocchioInterface) const -> std::vector<matrix6x_t> {
+  const auto& model = pinocchioInterface.getModel();
+  const auto& data = pinocchioInterface.getData();
+
+  std::vector<matrix6x_t> jointJacobians(jointIds_.size(), matrix6x_t::Zero(6, model.nv));
+  for (size_t j = 0; j < jointIds_.size(); j++) {
+    pinocchio::getJointJacobian(model, data, jointIds_[j], pinocchio::ReferenceFrame::LOCAL_WORLD_ALIGNED, jointJacobians[j]);
+  }
+  return jointJacobians;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+auto PinocchioSphereCollision::getJointJacobianWeights(const PinocchioInterface& pinocchioInterface, const vector3_t& sphereCenter,
+                                                       size_t sphereId, const vector3_t& direction) const -> vector6_t {
+  // The sphere center Jacobian is Jv - [r]x Jw with r the offset from the joint. Hence
+  // direction^T (Jv - [r]x Jw) = [direction; r x direction]^T [Jv; Jw]
+  const vector3_t offset = sphereCenter - pinocchioInterface.getData().oMi[parentJointIds_[sphereId]].translation();
+  vector6_t weights;
+  weights << direction, offset.cross(direction);
+  return weights;
+}
+
+}  // namespace ocs2
@@ -0,0 +1,125 @@
+/******************************************************************************
+Copyright (c) 2021, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+#include <gtest/gtest.h>
+
+#include <pinocchio/fwd.hpp>
+
+#include <pinocchio/algorithm/jacobian.hpp>
+#include <pinocchio/algorithm/kinematics.hpp>
+
+#include <ocs2_pinocchio_interface/urdf.h>
+#include <ocs2_robotic_assets/package_path.h>
+#include <ocs2_sphere_approximation/PinocchioSphereCollision.h>
+
+using namespace ocs2;
+
+class TestSphereCollision : public ::testing::Test {
+ public:
+  using vector3_t = PinocchioSphereCollision::vector3_t;
+  using matrix3x_t = PinocchioSphereCollision::matrix3x_t;
+
+  TestSphereCollision()
+      : pinocchioInterface(getPinocchioInterfaceFromUrdfFile(ocs2::robotic_assets::getPath() +
+                                                             "/resources/mobile_manipulator/mabi_mobile/urdf/mabi_mobile.urdf")),
+        sphereInterface(pinocchioInterface, {"ARM", "SHOULDER", "FOREARM", "WRIST_1"}, {0.20, 0.10, 0.05, 0.05}, 0.7),
+        sphereCollision(sphereInterface, {{"ARM", "FOREARM"}, {"SHOULDER", "WRIST_1"}}, minimumDistance) {
+    q = vector_t::Random(pinocchioInterface.getModel().nq);
+  }
+
+  void updateKinematics(const vector_t& jointPositions) {
+    const auto& model = pinocchioInterface.getModel();
+    auto& data = pinocchioInterface.getData();
+    pinocchio::computeJointJacobians(model, data, jointPositions);  // also computes forwardKinematics
+  }
+
+  const scalar_t minimumDistance = 0.05;
+  const scalar_t precision = 1e-5;
+
+  PinocchioInterface pinocchioInterface;
+  PinocchioSphereInterface sphereInterface;
+  PinocchioSphereCollision sphereCollision;
+  vector_t q;
+};
+
+TEST_F(TestSphereCollision, SphereCenters) {
+  updateKinematics(q);
+
+  const auto sphereCenters = sphereCollision.getSphereCenters(pinocchioInterface);
+  const auto sphereCentersReference = sphereInterface.computeSphereCentersInWorldFrame(pinocchioInterface);
+
+  ASSERT_EQ(sphereCenters.cols(), sphereCentersReference.size());
+  for (size_t i = 0; i < sphereCentersReference.size(); i++) {
+    EXPECT_TRUE(sphereCenters.col(i).isApprox(sphereCentersReference[i]));
+  }
+}
+
+TEST_F(TestSphereCollision, ValueAndApproximation) {
+  updateKinematics(q);
+
+  ASSERT_GT(sphereCollision.getNumSpherePairs(), 0);
+  const vector_t value = sphereCollision.getValue(pinocchioInterface);
+  const auto linearApproximation = sphereCollision.getLinearApproximation(pinocchioInterface);
+  EXPECT_TRUE(value.isApprox(linearApproximation.first));
+}
+
+TEST_F(TestSphereCollision, FiniteDifferenceJacobian) {
+  updateKinematics(q);
+  const auto linearApproximation = sphereCollision.getLinearApproximation(pinocchioInterface);
+
+  const scalar_t eps = 1e-7;
+  matrix_t dfdqFiniteDifference(sphereCollision.getNumSpherePairs(), q.size());
+  for (int i = 0; i < q.size(); i++) {
+    vector_t qPerturbed = q;
+    qPerturbed[i] += eps;
+    updateKinematics(qPerturbed);
+    dfdqFiniteDifference.col(i) = (sphereCollision.getValue(pinocchioInterface) - linearApproximation.first) / eps;
+  }
+
+  EXPECT_TRUE(linearApproximation.second.isApprox(dfdqFiniteDifference, precision));
+}
+
+TEST_F(TestSphereCollision, JacobianProjection) {
+  updateKinematics(q);
+
+  const matrix3x_t gradients = matrix3x_t::Random(3, sphereCollision.getNumSpheres());
+  const matrix_t projection = sphereCollision.getSphereCenterJacobianProjection(pinocchioInterface, gradients);
+  const matrix3x_t sphereCenters = sphereCollision.getSphereCenters(pinocchioInterface);
+
+  const scalar_t eps = 1e-7;
+  matrix_t projectionFiniteDifference(sphereCollision.getNumSpheres(), q.size());
+  for (int i = 0; i < q.size(); i++) {
+    vector_t qPerturbed = q;
+    qPerturbed[i] += eps;
+    updateKinematics(qPerturbed);
+    const matrix3x_t sphereCentersPerturbed = sphereCollision.getSphereCenters(pinocchioInterface);
+    projectionFiniteDifference.col(i) = ((sphereCentersPerturbed - sphereCenters) / eps).cwiseProduct(gradients).colwise().sum().transpose();
+  }
+
+  EXPECT_TRUE(projection.isApprox(projectionFiniteDifference, precision));
+}
@@ -94,6 +94,18 @@ using namespace pybind11::literals;
         .def_readwrite("dfdxx", &ocs2::ScalarFunctionQuadraticApproximation::dfdxx)                                                        \
         .def_readwrite("dfdux", &ocs2::ScalarFunctionQuadraticApproximation::dfdux)                                                        \
         .def_readwrite("dfduu", &ocs2::ScalarFunctionQuadraticApproximation::dfduu);                                                       \
+    /* bind batch approximation classes */                                                                                                 \
+    pybind11::class_<ocs2::BatchLinearApproximation>(m, "BatchLinearApproximation")                                                        \
+        .def_readwrite("f", &ocs2::BatchLinearApproximation::f)                                                                            \
+        .def_readwrite("dfdx", &ocs2::BatchLinearApproximation::dfdx)                                                                      \
+        .def_readwrite("dfdu", &ocs2::BatchLinearApproximation::dfdu);                                                                     \
+    pybind11::class_<ocs2::BatchQuadraticApproximation>(m, "BatchQuadraticApproximation")                                                  \
+        .def_readwrite("f", &ocs2::BatchQuadraticApproximation::f)                                                                         \
+        .def_readwrite("dfdx", &ocs2::BatchQuadraticApproximation::dfdx)                                                                   \
+        .def_readwrite("dfdu", &ocs2::BatchQuadraticApproximation::dfdu)                                                                   \
+        .def_readwrite("dfdxx", &ocs2::BatchQuadraticApproximation::dfdxx)                                                                 \
+        .def_readwrite("dfdux", &ocs2::BatchQuadraticApproximation::dfdux)                                                                 \
+        .def_readwrite("dfduu", &ocs2::BatchQuadraticApproximation::dfduu);                                                                \
     /* bind TargetTrajectories class */                                                                                                    \
     pybind11::class_<ocs2::TargetTrajectories>(m, "TargetTrajectories")                                                                    \
         .def(pybind11::init<ocs2::scalar_array_t, ocs2::vector_array_t, ocs2::vector_array_t>());                                          \
@@ -120,5 +132,14 @@ using namespace pybind11::literals;
         .def("stateInputEqualityConstraintLagrangian", &PY_INTERFACE::stateInputEqualityConstraintLagrangian, "t"_a, "x"_a.noconvert(),    \
              "u"_a.noconvert())                                                                                                            \
         .def("visualizeTrajectory", &PY_INTERFACE::visualizeTrajectory, "t"_a.noconvert(), "x"_a.noconvert(), "u"_a.noconvert(),           \
-             "speed"_a);                                                                                                                   \
+             "speed"_a)                                                                                                                    \
+        /* batch queries release the GIL while they are evaluated on the batch threads */                                                  \
+        .def("flowMapBatch", &PY_INTERFACE::flowMapBatch, "t"_a, "x"_a, "u"_a, pybind11::call_guard<pybind11::gil_scoped_release>())       \
+        .def("flowMapLinearApproximationBatch", &PY_INTERFACE::flowMapLinearApproximationBatch, "t"_a, "x"_a, "u"_a,                       \
+             pybind11::call_guard<pybind11::gil_scoped_release>())                                                                         \
+        .def("costBatch", &PY_INTERFACE::costBatch, "t"_a, "x"_a, "u"_a, pybind11::call_guard<pybind11::gil_scoped_release>())             \
+        .def("costQuadraticApproximationBatch", &PY_INTERFACE::costQuadraticApproximationBatch, "t"_a, "x"_a, "u"_a,                       \
+             pybind11::call_guard<pybind11::gil_scoped_release>())                                                                         \
+        .def("valueFunctionBatch", &PY_INTERFACE::valueFunctionBatch, "t"_a, "x"_a,                                                        \
+             pybind11::call_guard<pybind11::gil_scoped_release>());                                                                        \
   }
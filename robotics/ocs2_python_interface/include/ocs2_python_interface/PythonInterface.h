@@ -29,11 +29,43 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #pragma once
 
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <thread>
+
+#include <ocs2_core/thread_support/ThreadPool.h>
 #include <ocs2_mpc/MPC_MRT_Interface.h>
 #include <ocs2_oc/oc_problem/OptimalControlProblem.h>
 #include <ocs2_robotic_tools/common/RobotInterface.h>
 
 namespace ocs2 {
+    /** Row-major matrix whose row i holds sample i of a batch. It maps to a C-contiguous (N x n) NumPy array without a copy. */
+    using batch_matrix_t = Eigen::Matrix<scalar_t, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+
+    /**
+     * Linear approximations of a batch of N samples of a function with n outputs. Row i of f is the value of sample i and the
+     * rows [i * n, (i + 1) * n) of dfdx and dfdu are its derivatives.
+     */
+    struct BatchLinearApproximation {
+        batch_matrix_t f; // N x n
+        batch_matrix_t dfdx; // (N * n) x nx
+        batch_matrix_t dfdu; // (N * n) x nu
+    };
+
+    /**
+     * Quadratic approximations of a batch of N samples of a scalar function. Entry i of f and row i of dfdx and dfdu belong to
+     * sample i, as well as the rows [i * nx, (i + 1) * nx) of dfdxx and the rows [i * nu, (i + 1) * nu) of dfdux and dfduu.
+     */
+    struct BatchQuadraticApproximation {
+        vector_t f; // N
+        batch_matrix_t dfdx; // N x nx
+        batch_matrix_t dfdu; // N x nu
+        batch_matrix_t dfdxx; // (N * nx) x nx
+        batch_matrix_t dfdux; // (N * nu) x nx
+        batch_matrix_t dfduu; // (N * nu) x nu
+    };
+
     /**
      * PythonInterface provides a unified interface for all systems
      * to the MPC_MRT_Interface to be used for Python bindings
@@ -48,8 +80,10 @@ namespace ocs2 {
          * @note This should be called from derived class constructor.
          * @param [in] robot: Robot interface.
          * @param [in] mpcPtr: The Python interface takes ownership of the mpcPtr
+         * @param [in] nBatchThreads: Number of threads which evaluate the batch queries.
          */
-        void init(const RobotInterface &robot, std::unique_ptr<MPC_BASE> mpcPtr);
+        void init(const RobotInterface &robot, std::unique_ptr<MPC_BASE> mpcPtr,
+                  size_t nBatchThreads = std::max(std::thread::hardware_concurrency(), 1U));
 
     public:
         /** Destructor */
@@ -141,6 +175,30 @@ namespace ocs2 {
          */
         vector_t valueFunctionStateDerivative(scalar_t t, Eigen::Ref<const vector_t> x);
 
+        /**
+         * Batch queries: the samples are the rows of x and u with the times in t. They are evaluated in parallel on the batch threads,
+         * each with its own copy of the optimal control problem. The Python bindings release the GIL during the evaluation, therefore
+         * they must not be called concurrently with advanceMpc() or the setters.
+         */
+
+        /** System dynamics of a batch, returns the N x nx flow maps */
+        batch_matrix_t flowMapBatch(Eigen::Ref<const vector_t> t, Eigen::Ref<const batch_matrix_t> x,
+                                    Eigen::Ref<const batch_matrix_t> u);
+
+        /** System dynamics linearization of a batch */
+        BatchLinearApproximation flowMapLinearApproximationBatch(Eigen::Ref<const vector_t> t, Eigen::Ref<const batch_matrix_t> x,
+                                                                 Eigen::Ref<const batch_matrix_t> u);
+
+        /** Cost function with added penalty term of a batch, returns the N costs */
+        vector_t costBatch(Eigen::Ref<const vector_t> t, Eigen::Ref<const batch_matrix_t> x, Eigen::Ref<const batch_matrix_t> u);
+
+        /** Cost function quadratic approximation with added penalty term of a batch */
+        BatchQuadraticApproximation costQuadraticApproximationBatch(Eigen::Ref<const vector_t> t, Eigen::Ref<const batch_matrix_t> x,
+                                                                    Eigen::Ref<const batch_matrix_t> u);
+
+        /** The solver's internal value function of a batch, returns the N values */
+        vector_t valueFunctionBatch(Eigen::Ref<const vector_t> t, Eigen::Ref<const batch_matrix_t> x);
+
         /**
          * @brief Access state-input constraint value
          * @param[in] t time
@@ -190,10 +248,25 @@ namespace ocs2 {
         int inputDim_ = -1; // -1 indicates that it is not initialized
 
     private:
+        scalar_t computePenalizedCost(OptimalControlProblem &problem, scalar_t t, const vector_t &x, const vector_t &u) const;
+
+        ScalarFunctionQuadraticApproximation approximatePenalizedCost(OptimalControlProblem &problem, scalar_t t, const vector_t &x,
+                                                                      const vector_t &u) const;
+
+        /** Checks the sizes of a batch and returns the number of samples. */
+        size_t checkBatchSize(const Eigen::Ref<const vector_t> &t, const Eigen::Ref<const batch_matrix_t> &x,
+                              const Eigen::Ref<const batch_matrix_t> *uPtr) const;
+
+        /** Runs task(problem, i) for all samples i in [0, numSamples) on the batch threads. */
+        void runBatch(size_t numSamples, const std::function<void(OptimalControlProblem &, size_t)> &task);
+
         std::unique_ptr<MPC_BASE> mpcPtr_;
         std::unique_ptr<MPC_MRT_Interface> mpcMrtInterface_;
 
         TargetTrajectories targetTrajectories_;
         OptimalControlProblem problem_;
+
+        std::unique_ptr<ThreadPool> batchThreadPoolPtr_;
+        std::vector<OptimalControlProblem> batchProblemStock_;
     };
 } // namespace ocs2
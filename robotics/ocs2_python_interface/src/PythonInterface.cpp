@@ -33,11 +33,14 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <ocs2_oc/approximate_model/LinearQuadraticApproximator.h>
 
+#include <atomic>
+#include <exception>
 #include <memory>
+#include <mutex>
 
 namespace ocs2 {
     
-    void PythonInterface::init(const RobotInterface &robot, std::unique_ptr<MPC_BASE> mpcPtr) {
+    void PythonInterface::init(const RobotInterface &robot, std::unique_ptr<MPC_BASE> mpcPtr, size_t nBatchThreads) {
         if (!mpcPtr) {
             throw std::runtime_error(
                 "[PythonInterface] Mpc pointer must be initialized before passing to the Python interface.");
@@ -47,6 +50,11 @@ namespace ocs2 {
         mpcMrtInterface_ = std::make_unique<MPC_MRT_Interface>(*mpcPtr_);
 
         problem_ = robot.getOptimalControlProblem();
+
+        // the calling thread takes part in the batch evaluation
+        nBatchThreads = std::max<size_t>(nBatchThreads, 1);
+        batchThreadPoolPtr_ = std::make_unique<ThreadPool>(nBatchThreads - 1);
+        batchProblemStock_.assign(nBatchThreads, problem_);
     }
 
     
@@ -54,6 +62,9 @@ namespace ocs2 {
         targetTrajectories_ = std::move(targetTrajectories);
         mpcMrtInterface_->resetMpcNode(targetTrajectories_);
         problem_.targetTrajectoriesPtr = &targetTrajectories_;
+        for (auto &problem: batchProblemStock_) {
+            problem.targetTrajectoriesPtr = &targetTrajectories_;
+        }
     }
 
     
@@ -69,6 +80,9 @@ namespace ocs2 {
     void PythonInterface::setTargetTrajectories(TargetTrajectories targetTrajectories) {
         targetTrajectories_ = std::move(targetTrajectories);
         problem_.targetTrajectoriesPtr = &targetTrajectories_;
+        for (auto &problem: batchProblemStock_) {
+            problem.targetTrajectoriesPtr = &targetTrajectories_;
+        }
         mpcMrtInterface_->getReferenceManager().setTargetTrajectories(targetTrajectories_);
     }
 
@@ -104,63 +118,75 @@ namespace ocs2 {
 
     
     scalar_t PythonInterface::cost(scalar_t t, Eigen::Ref<const vector_t> x, Eigen::Ref<const vector_t> u) {
-        auto &preComputation = *problem_.preComputationPtr;
+        return computePenalizedCost(problem_, t, x, u);
+    }
+
+    
+    ScalarFunctionQuadraticApproximation PythonInterface::costQuadraticApproximation(
+        scalar_t t, Eigen::Ref<const vector_t> x,
+        Eigen::Ref<const vector_t> u) {
+        return approximatePenalizedCost(problem_, t, x, u);
+    }
+
+    
+    scalar_t PythonInterface::computePenalizedCost(OptimalControlProblem &problem, scalar_t t, const vector_t &x,
+                                                   const vector_t &u) const {
+        auto &preComputation = *problem.preComputationPtr;
         const auto request = Request::Cost + Request::SoftConstraint + Request::Constraint;
         preComputation.request(request, t, x, u);
 
         // cost
-        scalar_t cost = computeCost(problem_, t, x, u);
+        scalar_t cost = computeCost(problem, t, x, u);
 
         // Lagrangians
         const auto m = mpcMrtInterface_->getIntermediateDualSolution(t);
-        if (!problem_.stateEqualityLagrangianPtr->empty()) {
-            cost += sumPenalties(problem_.stateEqualityLagrangianPtr->getValue(t, x, m.stateEq, preComputation));
+        if (!problem.stateEqualityLagrangianPtr->empty()) {
+            cost += sumPenalties(problem.stateEqualityLagrangianPtr->getValue(t, x, m.stateEq, preComputation));
         }
-        if (!problem_.stateInequalityLagrangianPtr->empty()) {
-            cost += sumPenalties(problem_.stateInequalityLagrangianPtr->getValue(t, x, m.stateIneq, preComputation));
+        if (!problem.stateInequalityLagrangianPtr->empty()) {
+            cost += sumPenalties(problem.stateInequalityLagrangianPtr->getValue(t, x, m.stateIneq, preComputation));
         }
-        if (!problem_.equalityLagrangianPtr->empty()) {
-            cost += sumPenalties(problem_.equalityLagrangianPtr->getValue(t, x, u, m.stateInputEq, preComputation));
+        if (!problem.equalityLagrangianPtr->empty()) {
+            cost += sumPenalties(problem.equalityLagrangianPtr->getValue(t, x, u, m.stateInputEq, preComputation));
         }
-        if (!problem_.inequalityLagrangianPtr->empty()) {
-            cost += sumPenalties(problem_.inequalityLagrangianPtr->getValue(t, x, u, m.stateInputIneq, preComputation));
+        if (!problem.inequalityLagrangianPtr->empty()) {
+            cost += sumPenalties(problem.inequalityLagrangianPtr->getValue(t, x, u, m.stateInputIneq, preComputation));
         }
 
         return cost;
     }
 
     
-    ScalarFunctionQuadraticApproximation PythonInterface::costQuadraticApproximation(
-        scalar_t t, Eigen::Ref<const vector_t> x,
-        Eigen::Ref<const vector_t> u) {
-        auto &preComputation = *problem_.preComputationPtr;
+    ScalarFunctionQuadraticApproximation PythonInterface::approximatePenalizedCost(OptimalControlProblem &problem, scalar_t t,
+                                                                                   const vector_t &x, const vector_t &u) const {
+        auto &preComputation = *problem.preComputationPtr;
         const auto request = Request::Cost + Request::SoftConstraint + Request::Constraint + Request::Approximation;
         preComputation.request(request, t, x, u);
 
         // cost
-        auto cost = approximateCost(problem_, t, x, u);
+        auto cost = approximateCost(problem, t, x, u);
 
         // Lagrangians
         const auto m = mpcMrtInterface_->getIntermediateDualSolution(t);
-        if (!problem_.stateEqualityLagrangianPtr->empty()) {
-            auto approx = problem_.stateEqualityLagrangianPtr->getQuadraticApproximation(
+        if (!problem.stateEqualityLagrangianPtr->empty()) {
+            auto approx = problem.stateEqualityLagrangianPtr->getQuadraticApproximation(
                 t, x, m.stateEq, preComputation);
             cost.f += approx.f;
             cost.dfdx += approx.dfdx;
             cost.dfdxx += approx.dfdxx;
         }
-        if (!problem_.stateInequalityLagrangianPtr->empty()) {
-            auto approx = problem_.stateInequalityLagrangianPtr->getQuadraticApproximation(
+        if (!problem.stateInequalityLagrangianPtr->empty()) {
+            auto approx = problem.stateInequalityLagrangianPtr->getQuadraticApproximation(
                 t, x, m.stateIneq, preComputation);
             cost.f += approx.f;
             cost.dfdx += approx.dfdx;
             cost.dfdxx += approx.dfdxx;
         }
-        if (!problem_.equalityLagrangianPtr->empty()) {
-            cost += problem_.equalityLagrangianPtr->getQuadraticApproximation(t, x, u, m.stateInputEq, preComputation);
+        if (!problem.equalityLagrangianPtr->empty()) {
+            cost += problem.equalityLagrangianPtr->getQuadraticApproximation(t, x, u, m.stateInputEq, preComputation);
         }
-        if (!problem_.inequalityLagrangianPtr->empty()) {
-            cost += problem_.inequalityLagrangianPtr->getQuadraticApproximation(
+        if (!problem.inequalityLagrangianPtr->empty()) {
+            cost += problem.inequalityLagrangianPtr->getQuadraticApproximation(
                 t, x, u, m.stateInputIneq, preComputation);
         }
 
@@ -178,6 +204,132 @@ namespace ocs2 {
     }
 
     
+    batch_matrix_t PythonInterface::flowMapBatch(Eigen::Ref<const vector_t> t, Eigen::Ref<const batch_matrix_t> x,
+                                                 Eigen::Ref<const batch_matrix_t> u) {
+        const size_t N = checkBatchSize(t, x, &u);
+        batch_matrix_t dxdt(N, stateDim_);
+        runBatch(N, [&](OptimalControlProblem &problem, size_t i) {
+            dxdt.row(i) = problem.dynamicsPtr->computeFlowMap(t(i), x.row(i).transpose(), u.row(i).transpose()).transpose();
+        });
+        return dxdt;
+    }
+
+    
+    BatchLinearApproximation PythonInterface::flowMapLinearApproximationBatch(Eigen::Ref<const vector_t> t,
+                                                                              Eigen::Ref<const batch_matrix_t> x,
+                                                                              Eigen::Ref<const batch_matrix_t> u) {
+        const size_t N = checkBatchSize(t, x, &u);
+        BatchLinearApproximation approximation;
+        approximation.f.resize(N, stateDim_);
+        approximation.dfdx.resize(N * stateDim_, stateDim_);
+        approximation.dfdu.resize(N * stateDim_, inputDim_);
+        runBatch(N, [&](OptimalControlProblem &problem, size_t i) {
+            const auto dynamics = problem.dynamicsPtr->linearApproximation(t(i), x.row(i).transpose(), u.row(i).transpose());
+            approximation.f.row(i) = dynamics.f.transpose();
+            approximation.dfdx.middleRows(i * stateDim_, stateDim_) = dynamics.dfdx;
+            approximation.dfdu.middleRows(i * stateDim_, stateDim_) = dynamics.dfdu;
+        });
+        return approximation;
+    }
+
+    
+    vector_t PythonInterface::costBatch(Eigen::Ref<const vector_t> t, Eigen::Ref<const batch_matrix_t> x,
+                                        Eigen::Ref<const batch_matrix_t> u) {
+        const size_t N = checkBatchSize(t, x, &u);
+        vector_t cost(N);
+        runBatch(N, [&](OptimalControlProblem &problem, size_t i) {
+            cost(i) = computePenalizedCost(problem, t(i), x.row(i).transpose(), u.row(i).transpose());
+        });
+        return cost;
+    }
+
+    
+    BatchQuadraticApproximation PythonInterface::costQuadraticApproximationBatch(Eigen::Ref<const vector_t> t,
+                                                                                 Eigen::Ref<const batch_matrix_t> x,
+                                                                                 Eigen::Ref<const batch_matrix_t> u) {
+        const size_t N = checkBatchSize(t, x, &u);
+        BatchQuadraticApproximation approximation;
+        approximation.f.resize(N);
+        approximation.dfdx.resize(N, stateDim_);
+        approximation.dfdu.resize(N, inputDim_);
+        approximation.dfdxx.resize(N * stateDim_, stateDim_);
+        approximation.dfdux.resize(N * inputDim_, stateDim_);
+        approximation.dfduu.resize(N * inputDim_, inputDim_);
+        runBatch(N, [&](OptimalControlProblem &problem, size_t i) {
+            const auto cost = approximatePenalizedCost(problem, t(i), x.row(i).transpose(), u.row(i).transpose());
+            approximation.f(i) = cost.f;
+            approximation.dfdx.row(i) = cost.dfdx.transpose();
+            approximation.dfdu.row(i) = cost.dfdu.transpose();
+            approximation.dfdxx.middleRows(i * stateDim_, stateDim_) = cost.dfdxx;
+            approximation.dfdux.middleRows(i * inputDim_, inputDim_) = cost.dfdux;
+            approximation.dfduu.middleRows(i * inputDim_, inputDim_) = cost.dfduu;
+        });
+        return approximation;
+    }
+
+    
+    vector_t PythonInterface::valueFunctionBatch(Eigen::Ref<const vector_t> t, Eigen::Ref<const batch_matrix_t> x) {
+        const size_t N = checkBatchSize(t, x, nullptr);
+        vector_t value(N);
+        runBatch(N, [&](OptimalControlProblem &, size_t i) {
+            value(i) = mpcMrtInterface_->getValueFunction(t(i), x.row(i).transpose()).f;
+        });
+        return value;
+    }
+
+    
+    size_t PythonInterface::checkBatchSize(const Eigen::Ref<const vector_t> &t, const Eigen::Ref<const batch_matrix_t> &x,
+                                           const Eigen::Ref<const batch_matrix_t> *uPtr) const {
+        const auto N = t.size();
+        if (x.rows() != N || x.cols() != stateDim_) {
+            throw std::runtime_error(
+                "[PythonInterface] The state batch must be of size " + std::to_string(N) + " x " + std::to_string(stateDim_) +
+                ", but it is " + std::to_string(x.rows()) + " x " + std::to_string(x.cols()) + ".");
+        }
+        if (uPtr != nullptr && (uPtr->rows() != N || uPtr->cols() != inputDim_)) {
+            throw std::runtime_error(
+                "[PythonInterface] The input batch must be of size " + std::to_string(N) + " x " + std::to_string(inputDim_) +
+                ", but it is " + std::to_string(uPtr->rows()) + " x " + std::to_string(uPtr->cols()) + ".");
+        }
+        return static_cast<size_t>(N);
+    }
+
+    
+    void PythonInterface::runBatch(size_t numSamples, const std::function<void(OptimalControlProblem &, size_t)> &task) {
+        const size_t numWorkers = std::min(batchProblemStock_.size(), std::max<size_t>(numSamples, 1));
+        // samples are claimed in chunks, such that the workers do not contend on the index for cheap queries
+        const size_t chunkSize = std::max<size_t>(numSamples / (8 * numWorkers), 1);
+
+        std::atomic_size_t nextIndex{0};
+        std::mutex errorMutex;
+        std::exception_ptr errorPtr;
+        auto worker = [&](int workerIndex) {
+            auto &problem = batchProblemStock_[workerIndex];
+            size_t begin;
+            while ((begin = nextIndex.fetch_add(chunkSize)) < numSamples) {
+                try {
+                    const size_t end = std::min(begin + chunkSize, numSamples);
+                    for (size_t i = begin; i < end; i++) {
+                        task(problem, i);
+                    }
+                } catch (...) {
+                    // stop all workers and rethrow the first error in the calling thread
+                    nextIndex = numSamples;
+                    std::lock_guard<std::mutex> lock(errorMutex);
+                    if (!errorPtr) {
+                        errorPtr = std::current_exception();
+                    }
+                }
+            }
+        };
+        batchThreadPoolPtr_->runParallel(worker, numWorkers);
+
+        if (errorPtr) {
+            std::rethrow_exception(errorPtr);
+        }
+    }
+
+    
     vector_t PythonInterface::stateInputEqualityConstraint(scalar_t t, Eigen::Ref<const vector_t> x,
                                                            Eigen::Ref<const vector_t> u) {
         problem_.preComputationPtr->request(Request::Constraint, t, x, u);
@@ -40,6 +40,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ocs2_python_interface/PythonInterface.h>
 #include <ocs2_robotic_tools/common/RobotInterface.h>
 
+#include <chrono>
+#include <functional>
+#include <iostream>
 #include <memory>
 
 
@@ -93,6 +96,8 @@ namespace ocs2::pybindings_test {
         DummyPyBindings() {
             DummyInterface robot;
             PythonInterface::init(robot, robot.getMpc());
+            stateDim_ = 2;
+            inputDim_ = 1;
         }
     };
 } // namespace ocs2::pybindings_test
@@ -101,3 +106,80 @@ namespace ocs2::pybindings_test {
 TEST(OCS2PyBindingsTest, createDummyPyBindings) {
     ocs2::pybindings_test::DummyPyBindings dummy;
 }
+
+
+TEST(OCS2PyBindingsTest, batchQueries) {
+    using namespace ocs2;
+    pybindings_test::DummyPyBindings dummy;
+    dummy.reset(TargetTrajectories({0.0}, {vector_t::Ones(2)}, {vector_t::Zero(1)}));
+    dummy.setObservation(0.0, vector_t::Zero(2), vector_t::Zero(1));
+    dummy.advanceMpc();
+
+    constexpr size_t N = 1000;
+    const vector_t t = vector_t::LinSpaced(N, 0.0, 1.0);
+    const batch_matrix_t x = batch_matrix_t::Random(N, 2);
+    const batch_matrix_t u = batch_matrix_t::Random(N, 1);
+
+    const auto flowMap = dummy.flowMapBatch(t, x, u);
+    const auto dynamics = dummy.flowMapLinearApproximationBatch(t, x, u);
+    const auto cost = dummy.costBatch(t, x, u);
+    const auto costApproximation = dummy.costQuadraticApproximationBatch(t, x, u);
+    const auto value = dummy.valueFunctionBatch(t, x);
+
+    for (size_t i = 0; i < N; i++) {
+        const vector_t xi = x.row(i).transpose();
+        const vector_t ui = u.row(i).transpose();
+
+        EXPECT_TRUE(flowMap.row(i).transpose().isApprox(dummy.flowMap(t(i), xi, ui)));
+
+        const auto dynamicsi = dummy.flowMapLinearApproximation(t(i), xi, ui);
+        EXPECT_TRUE(dynamics.f.row(i).transpose().isApprox(dynamicsi.f));
+        EXPECT_TRUE(dynamics.dfdx.middleRows(2 * i, 2).isApprox(dynamicsi.dfdx));
+        EXPECT_TRUE(dynamics.dfdu.middleRows(2 * i, 2).isApprox(dynamicsi.dfdu));
+
+        EXPECT_DOUBLE_EQ(cost(i), dummy.cost(t(i), xi, ui));
+
+        const auto costi = dummy.costQuadraticApproximation(t(i), xi, ui);
+        EXPECT_DOUBLE_EQ(costApproximation.f(i), costi.f);
+        EXPECT_TRUE(costApproximation.dfdx.row(i).transpose().isApprox(costi.dfdx));
+        EXPECT_TRUE(costApproximation.dfdu.row(i).transpose().isApprox(costi.dfdu));
+        EXPECT_TRUE(costApproximation.dfdxx.middleRows(2 * i, 2).isApprox(costi.dfdxx));
+        EXPECT_TRUE(costApproximation.dfdux.middleRows(i, 1).isApprox(costi.dfdux));
+        EXPECT_TRUE(costApproximation.dfduu.middleRows(i, 1).isApprox(costi.dfduu));
+
+        EXPECT_DOUBLE_EQ(value(i), dummy.valueFunction(t(i), xi));
+    }
+
+    EXPECT_THROW(dummy.costBatch(t, x.topRows(N - 1), u), std::runtime_error);
+    EXPECT_THROW(dummy.flowMapBatch(t, x, batch_matrix_t::Zero(N, 2)), std::runtime_error);
+}
+
+
+TEST(OCS2PyBindingsTest, batchQueriesBenchmark) {
+    using namespace ocs2;
+    pybindings_test::DummyPyBindings dummy;
+    dummy.reset(TargetTrajectories({0.0}, {vector_t::Ones(2)}, {vector_t::Zero(1)}));
+    dummy.setObservation(0.0, vector_t::Zero(2), vector_t::Zero(1));
+    dummy.advanceMpc();
+
+    constexpr size_t N = 100000;
+    const vector_t t = vector_t::LinSpaced(N, 0.0, 1.0);
+    const batch_matrix_t x = batch_matrix_t::Random(N, 2);
+    const batch_matrix_t u = batch_matrix_t::Random(N, 1);
+
+    const auto timeIt = [](const std::function<void()> &f) {
+        const auto start = std::chrono::steady_clock::now();
+        f();
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    };
+
+    const auto perSampleTime = timeIt([&]() {
+        for (size_t i = 0; i < N; i++) {
+            dummy.costQuadraticApproximation(t(i), x.row(i).transpose(), u.row(i).transpose());
+        }
+    });
+    const auto batchTime = timeIt([&]() { dummy.costQuadraticApproximationBatch(t, x, u); });
+
+    std::cerr << "costQuadraticApproximation of " << N << " samples: per sample " << perSampleTime << " [ms], batch "
+            << batchTime << " [ms]\n";
+}
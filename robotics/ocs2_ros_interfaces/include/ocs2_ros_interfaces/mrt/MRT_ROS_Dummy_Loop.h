@@ -29,6 +29,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #pragma once
 
+#include <ocs2_core/thread_support/ThreadPlacement.h>
+
 #include "ocs2_ros_interfaces/mrt/DummyObserver.h"
 #include "ocs2_ros_interfaces/mrt/MRT_ROS_Interface.h"
 
@@ -50,9 +52,11 @@ namespace ocs2 {
          * @param [in] mpcDesiredFrequency: MPC loop frequency in Hz. If set to a
          * positive number, MPC loop will be simulated to run by this frequency. Note
          * that this might not be the MPC's real-time frequency.
+         * @param [in] threadPlacement: Placement of the thread which calls run().
          */
         MRT_ROS_Dummy_Loop(MRT_ROS_Interface &mrt, scalar_t mrtDesiredFrequency,
-                           scalar_t mpcDesiredFrequency = -1);
+                           scalar_t mpcDesiredFrequency = -1,
+                           ThreadPlacement threadPlacement = ThreadPlacement());
 
         /**
          * Destructor.
@@ -114,5 +118,6 @@ namespace ocs2 {
 
         scalar_t mrtDesiredFrequency_;
         scalar_t mpcDesiredFrequency_;
+        ThreadPlacement threadPlacement_;
     };
 } // namespace ocs2
@@ -0,0 +1,125 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+/**
+ * Measures the wake-up jitter of a periodic MRT loop while a thread pool keeps all cores busy, as the MPC does. The measurement is done
+ * once with the default thread placement and once with the mpcThreadPlacement and mrtThreadPlacement of the MPC settings.
+ * Usage: thread_placement_jitter_benchmark <task.info> [fieldName] [durationInSeconds]
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include <ocs2_core/thread_support/ThreadPlacement.h>
+#include <ocs2_core/thread_support/ThreadPool.h>
+#include <ocs2_mpc/MPC_Settings.h>
+
+using namespace ocs2;
+
+namespace {
+    /** Wake-up latencies of the loop in microseconds, sorted. */
+    std::vector<double> measureLatencies(const ThreadPlacement &mpcThreadPlacement, const ThreadPlacement &mrtThreadPlacement,
+                                         double mrtFrequency, std::chrono::duration<double> duration) {
+        const size_t nThreads = std::max(std::thread::hardware_concurrency(), 2U);
+
+        // Busy load on the worker threads, the task of the calling thread is skipped
+        std::atomic_bool stop(false);
+        ThreadPool threadPool(nThreads - 1, mpcThreadPlacement);
+        std::thread loadThread([&]() {
+            setThisThreadPlacement(mpcThreadPlacement, nThreads - 1);
+            threadPool.runParallel([&](int workerId) {
+                volatile double x = 0.0;
+                while (workerId < static_cast<int>(nThreads - 1) && !stop) {
+                    for (int i = 0; i < 10000; i++) {
+                        x = x + 1e-3;
+                    }
+                }
+            }, nThreads);
+        });
+
+        // Periodic loop
+        std::vector<double> latencies;
+        latencies.reserve(static_cast<size_t>(duration.count() * mrtFrequency) + 1);
+        std::thread loopThread([&]() {
+            setThisThreadPlacement(mrtThreadPlacement);
+            const auto period = std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(1.0 / mrtFrequency));
+            const auto start = std::chrono::steady_clock::now();
+            auto wakeUpTime = start + period;
+            while (wakeUpTime - start < duration) {
+                std::this_thread::sleep_until(wakeUpTime);
+                latencies.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - wakeUpTime).count());
+                wakeUpTime += period;
+            }
+        });
+
+        loopThread.join();
+        stop = true;
+        loadThread.join();
+
+        std::sort(latencies.begin(), latencies.end());
+        return latencies;
+    }
+
+    void printLatencies(const std::string &name, const std::vector<double> &latencies) {
+        const auto percentile = [&](double p) {
+            return latencies.empty() ? 0.0 : latencies[std::min(static_cast<size_t>(p * latencies.size()), latencies.size() - 1)];
+        };
+        std::cerr << std::setw(12) << name << std::fixed << std::setprecision(1) << std::setw(12) << percentile(0.5) << std::setw(12)
+                << percentile(0.99) << std::setw(12) << percentile(0.999) << std::setw(12) << percentile(1.0) << "\n";
+    }
+} // namespace
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " <task.info> [fieldName] [durationInSeconds]\n";
+        return 1;
+    }
+    const std::string taskFile(argv[1]);
+    const std::string fieldName = (argc > 2) ? argv[2] : "mpc";
+    const std::chrono::duration<double> duration((argc > 3) ? std::stod(argv[3]) : 10.0);
+
+    const auto mpcSettings = mpc::loadSettings(taskFile, fieldName, true);
+
+    const auto defaultLatencies = measureLatencies(ThreadPlacement(), ThreadPlacement(), mpcSettings.mrtDesiredFrequency_, duration);
+    const auto configuredLatencies = measureLatencies(mpcSettings.mpcThreadPlacement_, mpcSettings.mrtThreadPlacement_,
+                                                      mpcSettings.mrtDesiredFrequency_, duration);
+
+    std::cerr << "\nWake-up latency of the MRT loop at " << mpcSettings.mrtDesiredFrequency_ << " [Hz] in [us]\n";
+    std::cerr << std::setw(12) << "placement" << std::setw(12) << "median" << std::setw(12) << "99%" << std::setw(12) << "99.9%"
+            << std::setw(12) << "max" << "\n";
+    printLatencies("default", defaultLatencies);
+    printLatencies("configured", configuredLatencies);
+
+    return 0;
+}
@@ -29,6 +29,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "ocs2_ros_interfaces/mpc/MPC_ROS_Interface.h"
 
+#include <ocs2_core/thread_support/ThreadPlacement.h>
+
 #include "ocs2_ros_interfaces/common/RosMsgConversions.h"
 
 const rclcpp::Logger LOGGER = rclcpp::get_logger("MPC_ROS_Interface");
@@ -175,6 +177,8 @@ namespace ocs2 {
 
 
     void MPC_ROS_Interface::publisherWorker() {
+        setThisThreadPlacement(mpc_.settings().mpcThreadPlacement_, 1);
+
         while (!terminateThread_) {
             std::unique_lock<std::mutex> lk(publisherMutex_);
 
@@ -314,6 +318,8 @@ namespace ocs2 {
 
     void MPC_ROS_Interface::spin() {
         RCLCPP_INFO(LOGGER, "Start spinning now ...");
+        // The MPC runs in the observation callback of the spinning thread
+        setThisThreadPlacement(mpc_.settings().mpcThreadPlacement_, 0);
         // Equivalent to ros::spin() + check if master is alive
         while (rclcpp::ok()) {
             rclcpp::spin(node_);
@@ -35,10 +35,12 @@ namespace ocs2 {
 
     MRT_ROS_Dummy_Loop::MRT_ROS_Dummy_Loop(MRT_ROS_Interface &mrt,
                                            scalar_t mrtDesiredFrequency,
-                                           scalar_t mpcDesiredFrequency)
+                                           scalar_t mpcDesiredFrequency,
+                                           ThreadPlacement threadPlacement)
         : mrt_(mrt),
           mrtDesiredFrequency_(mrtDesiredFrequency),
-          mpcDesiredFrequency_(mpcDesiredFrequency) {
+          mpcDesiredFrequency_(mpcDesiredFrequency),
+          threadPlacement_(std::move(threadPlacement)) {
         if (mrtDesiredFrequency_ < 0) {
             throw std::runtime_error("MRT loop frequency should be a positive number.");
         }
@@ -53,6 +55,8 @@ namespace ocs2 {
 
     void MRT_ROS_Dummy_Loop::run(const SystemObservation &initObservation,
                                  const TargetTrajectories &initTargetTrajectories) {
+        setThisThreadPlacement(threadPlacement_);
+
         RCLCPP_INFO_STREAM(LOGGER, "Waiting for the initial policy ...");
 
         // Reset MPC node